@@ -17,6 +17,9 @@ namespace MachineLearning
     struct IInferenceContext
     {
         virtual ~IInferenceContext() = default;
+
+        //! Returns the number of bytes of working memory currently held by the context.
+        virtual AZStd::size_t GetMemoryUsage() const { return 0; }
     };
 
     using IInferenceContextPtr = IInferenceContext*;
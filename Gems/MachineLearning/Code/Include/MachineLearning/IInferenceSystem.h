@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <MachineLearning/MachineLearningTypeIds.h>
+#include <MachineLearning/INeuralNetwork.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/function/function_template.h>
+
+namespace MachineLearning
+{
+    //! Invoked with the model output once a submitted set of activations has been evaluated.
+    using InferenceCallback = AZStd::function<void(const AZ::VectorN& output)>;
+
+    //! Batches inference requests from many independent agents into a single forward pass per model.
+    class IInferenceSystem
+    {
+    public:
+
+        AZ_RTTI(IInferenceSystem, IInferenceSystemTypeId);
+
+        virtual ~IInferenceSystem() = default;
+
+        //! Queues a set of activations for the next batched forward pass of the provided model.
+        //! The callback is invoked on the main thread with the model output before the next tick begins.
+        //! This is safe to call from any thread.
+        virtual void SubmitInference(INeuralNetworkPtr model, const AZ::VectorN& activations, InferenceCallback callback) = 0;
+
+        //! Immediately evaluates all queued inference requests and invokes their callbacks.
+        virtual void ExecutePendingInferences() = 0;
+
+        //! Retrieves a pooled inference context for the provided model, creating a new one if none are available.
+        //! Contexts must be returned using ReleaseInferenceContext once the caller is done with them.
+        virtual IInferenceContextPtr AcquireInferenceContext(INeuralNetworkPtr model) = 0;
+
+        //! Returns an inference context previously retrieved using AcquireInferenceContext to the pool.
+        virtual void ReleaseInferenceContext(INeuralNetworkPtr model, IInferenceContextPtr context) = 0;
+
+        //! Discards all pooled contexts and queued requests for the provided model, this must be called before a model is destroyed.
+        virtual void ReleaseModel(INeuralNetworkPtr model) = 0;
+    };
+
+    class IInferenceSystemBusTraits
+        : public AZ::EBusTraits
+    {
+    public:
+        //! EBusTraits overrides
+        //! @{
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        //! @}
+    };
+
+    using InferenceSystemRequestBus = AZ::EBus<IInferenceSystem, IInferenceSystemBusTraits>;
+    using InferenceSystemInterface = AZ::Interface<IInferenceSystem>;
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <MachineLearning/Types.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/string/string.h>
 
 namespace MachineLearning
@@ -30,6 +31,14 @@ namespace MachineLearning
 
         //! Returns the index-th set of activations in the training data set.
         virtual const AZ::VectorN& GetDataByIndex(AZStd::size_t index) = 0;
+
+        //! Writes the data and label of each requested sample directly into the caller provided batch.
+        //! Unlike GetDataByIndex and GetLabelByIndex this does not return scratch storage owned by the data set.
+        virtual void GetBatch(AZStd::span<const AZStd::size_t> indices, AZStd::span<AZ::VectorN> data, AZStd::span<AZ::VectorN> labels) const = 0;
+
+        //! Returns true if GetBatch may be invoked concurrently from multiple threads on disjoint batches.
+        //! The training cycle then gathers each mini-batch across its workers instead of on the training thread.
+        virtual bool SupportsConcurrentBatches() const { return false; }
     };
 
     using ILabeledTrainingDataPtr = AZStd::shared_ptr<ILabeledTrainingData>;
@@ -34,6 +34,13 @@ namespace MachineLearning
 
         //! Retrieves the full set of registered models from the machine learning interface.
         virtual ModelSet& GetModelSet() = 0;
+
+        //! Records the metrics of the most recently completed training epoch of a model, this may be called from any thread.
+        virtual void ReportTrainingMetrics(INeuralNetworkPtr model, const TrainingMetrics& metrics) = 0;
+
+        //! Retrieves the metrics of the most recently completed training epoch of a model.
+        //! @return boolean false if no training metrics have been reported for the model
+        virtual bool GetTrainingMetrics(INeuralNetworkPtr model, TrainingMetrics& metrics) const = 0;
     };
 
     class IMachineLearningBusTraits
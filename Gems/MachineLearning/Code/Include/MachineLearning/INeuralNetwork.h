@@ -14,6 +14,7 @@
 #include <MachineLearning/IInferenceContext.h>
 #include <MachineLearning/ITrainingContext.h>
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/string/string.h>
 
 namespace MachineLearning
@@ -67,11 +68,34 @@ namespace MachineLearning
         //! Performs a basic feed-forward operation to compute the output from a set of activation values.
         virtual const AZ::VectorN* Forward([[maybe_unused]] IInferenceContextPtr context, [[maybe_unused]] const AZ::VectorN& activations) { return nullptr; }
 
+        //! Selects the numeric precision used for inference, models which do not support the requested precision continue to use full precision.
+        virtual void SetInferencePrecision([[maybe_unused]] InferencePrecision precision) {}
+
+        //! Returns the numeric precision currently used for inference.
+        virtual InferencePrecision GetInferencePrecision() const { return InferencePrecision::Float; }
+
         //! Accumulates the loss gradients given a loss function, an activation vector and a corresponding label vector.
         virtual void Reverse([[maybe_unused]] ITrainingContextPtr context, [[maybe_unused]] LossFunctions lossFunction, [[maybe_unused]] const AZ::VectorN& activations, [[maybe_unused]] const AZ::VectorN& expected) {}
 
-        //! Performs a gradient descent step and resets all gradient accumulators to zero.
-        virtual void GradientDescent([[maybe_unused]] ITrainingContextPtr context, [[maybe_unused]] float learningRate) {}
+        //! Performs a feed-forward operation on a batch of activation vectors, returning one output vector per sample.
+        virtual AZStd::span<const AZ::VectorN* const> ForwardBatch([[maybe_unused]] IInferenceContextPtr context, [[maybe_unused]] AZStd::span<const AZ::VectorN* const> activations) { return {}; }
+
+        //! Accumulates the loss gradients for a batch of activation vectors and their corresponding label vectors.
+        //! Models without a dedicated batched implementation simply accumulate one sample at a time.
+        virtual void ReverseBatch(ITrainingContextPtr context, LossFunctions lossFunction, AZStd::span<const AZ::VectorN* const> activations, AZStd::span<const AZ::VectorN* const> expected)
+        {
+            for (AZStd::size_t iter = 0; iter < activations.size(); ++iter)
+            {
+                Reverse(context, lossFunction, *activations[iter], *expected[iter]);
+            }
+        }
+
+        //! Folds the loss gradients accumulated in the source context into the destination context and resets the source context.
+        //! This allows multiple training contexts to accumulate gradients for disjoint parts of a mini-batch in parallel.
+        virtual void ReduceGradients([[maybe_unused]] ITrainingContextPtr destination, [[maybe_unused]] ITrainingContextPtr source) {}
+
+        //! Performs a gradient descent step using the requested optimizer and resets all gradient accumulators to zero.
+        virtual void GradientDescent([[maybe_unused]] ITrainingContextPtr context, [[maybe_unused]] float learningRate, [[maybe_unused]] const OptimizerParameters& optimizer = OptimizerParameters()) {}
 
         //! Loads the current model parameters from the associated asset file.
         virtual bool LoadModel() { return false; }
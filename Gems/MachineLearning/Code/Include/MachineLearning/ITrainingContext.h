@@ -9,6 +9,7 @@
 #pragma once
 
 #include <MachineLearning/Types.h>
+#include <AzCore/std/chrono/chrono.h>
 
 namespace MachineLearning
 {
@@ -16,6 +17,15 @@ namespace MachineLearning
     struct ITrainingContext
     {
         virtual ~ITrainingContext() = default;
+
+        //! Returns the number of bytes of working memory currently held by the context.
+        virtual AZStd::size_t GetMemoryUsage() const { return 0; }
+
+        //! Time spent in the forward and backward passes of batched back-propagation (ReverseBatch) using this context.
+        //! These are measured once per batch rather than per sample, so single sample Reverse calls are not included.
+        //! These accumulate until reset by the caller, models which do not measure them leave them at zero.
+        AZStd::chrono::steady_clock::duration m_forwardTime = AZStd::chrono::steady_clock::duration::zero();
+        AZStd::chrono::steady_clock::duration m_backwardTime = AZStd::chrono::steady_clock::duration::zero();
     };
 
     using ITrainingContextPtr = ITrainingContext*;
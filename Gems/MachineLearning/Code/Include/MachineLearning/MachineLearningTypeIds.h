@@ -12,6 +12,7 @@ namespace MachineLearning
 {
     // System Component TypeIds
     inline constexpr const char* MachineLearningSystemComponentTypeId = "{D1A87047-6088-42F6-9275-D6BCE2266322}";
+    inline constexpr const char* InferenceSystemComponentTypeId = "{5C0E7A51-2F3B-4D8E-9A61-7E4B2C9D1F08}";
     inline constexpr const char* MachineLearningEditorSystemComponentTypeId = "{EE7AB2E3-9A4B-45B8-93FE-B5FC6ED0D6FF}";
 
     // Module derived classes TypeIds
@@ -23,4 +24,5 @@ namespace MachineLearning
 
     // Interface TypeIds
     inline constexpr const char* IMachineLearningTypeId = "{B65151FE-3588-432A-A0EE-1DB5BF5147CA}";
+    inline constexpr const char* IInferenceSystemTypeId = "{9E3D6B27-41C8-4F5A-B0D2-8A17C6E43F95}";
 } // namespace MachineLearning
@@ -14,16 +14,99 @@
 namespace MachineLearning
 {
     AZ_ENUM_CLASS(LossFunctions,
-        MeanSquaredError
+        MeanSquaredError,
+        CategoricalCrossEntropy
     );
 
     AZ_ENUM_CLASS(ActivationFunctions,
         ReLU,
         Sigmoid,
         Softmax,
-        Linear
+        Linear,
+        Tanh,
+        LeakyReLU,
+        GELU
     );
 
+    AZ_ENUM_CLASS(LayerTypes,
+        Dense,
+        Convolution,
+        MaxPool
+    );
+
+    AZ_ENUM_CLASS(InferencePrecision,
+        Float,
+        Int8
+    );
+
+    AZ_ENUM_CLASS(OptimizerFunctions,
+        StochasticGradientDescent,
+        Momentum,
+        RMSProp,
+        Adam
+    );
+
+    //! Hyper-parameters for the optimizer applied during gradient descent.
+    struct OptimizerParameters
+    {
+        OptimizerFunctions m_optimizer = OptimizerFunctions::StochasticGradientDescent;
+
+        //! The decay rate of the first moment (momentum), used by Momentum and Adam.
+        float m_beta1 = 0.9f;
+
+        //! The decay rate of the second moment (squared gradients), used by RMSProp and Adam.
+        float m_beta2 = 0.999f;
+
+        //! Added to the denominator of RMSProp and Adam to avoid division by zero.
+        float m_epsilon = 1.0e-7f;
+    };
+
+    //! Throughput, timing and memory measurements gathered by a training cycle.
+    //! Phase timings cover a single epoch, times are in seconds.
+    struct TrainingMetrics
+    {
+        //! The number of completed epochs.
+        AZStd::size_t m_epoch = 0;
+
+        //! The total number of training samples processed since training started.
+        AZStd::size_t m_totalSamples = 0;
+
+        //! The number of training samples processed during the epoch.
+        AZStd::size_t m_epochSamples = 0;
+
+        //! The number of training samples processed per second of epoch time.
+        double m_samplesPerSecond = 0.0;
+
+        //! Wall time spent training on the epoch, this excludes cost evaluation.
+        double m_epochTime = 0.0;
+
+        //! Wall time spent copying mini-batches out of the training data.
+        double m_gatherTime = 0.0;
+
+        //! Wall time spent accumulating gradients, this covers both the forward and backward passes on all workers.
+        double m_gradientTime = 0.0;
+
+        //! Time spent in the forward and backward passes, summed across all workers.
+        double m_forwardTime = 0.0;
+        double m_backwardTime = 0.0;
+
+        //! Wall time spent reducing the gradients of all workers.
+        double m_reduceTime = 0.0;
+
+        //! Wall time spent applying gradients to the model parameters.
+        double m_updateTime = 0.0;
+
+        //! Wall time spent evaluating the cost of the model on the training and test data at the end of the epoch.
+        double m_evaluationTime = 0.0;
+
+        //! The number of workers training is split across, each holds one inference and one training context.
+        AZStd::size_t m_workerCount = 0;
+
+        //! The average working memory in bytes held by a single inference or training context.
+        AZStd::size_t m_inferenceContextMemory = 0;
+        AZStd::size_t m_trainingContextMemory = 0;
+    };
+
     AZ_ENUM_CLASS(AssetTypes,
         TestData,
         TestLabels,
@@ -5,4 +5,5 @@
 #      ../Include/Android/MachineLearningAndroid.h
 
 set(FILES
+    ../Common/Unixlike/MappedFile_Unixlike.cpp
 )
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Assets/MappedFile.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace MachineLearning
+{
+    bool MappedFile::MapFile(const char* filePath)
+    {
+        const int fileDescriptor = open(filePath, O_RDONLY);
+        if (fileDescriptor < 0)
+        {
+            return false;
+        }
+
+        struct stat fileStat;
+        if ((fstat(fileDescriptor, &fileStat) != 0) || (fileStat.st_size <= 0))
+        {
+            close(fileDescriptor);
+            return false;
+        }
+
+        const AZStd::size_t size = static_cast<AZStd::size_t>(fileStat.st_size);
+        void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+        // The mapping holds its own reference to the file, so the descriptor can be closed immediately
+        close(fileDescriptor);
+        if (mapping == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_data = static_cast<const uint8_t*>(mapping);
+        m_size = size;
+        return true;
+    }
+
+    void MappedFile::UnmapFile()
+    {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Assets/MappedFile.h>
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/std/string/conversions.h>
+
+namespace MachineLearning
+{
+    bool MappedFile::MapFile(const char* filePath)
+    {
+        AZStd::wstring filePathW;
+        AZStd::to_wstring(filePathW, filePath);
+
+        HANDLE file = CreateFileW(filePathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || (fileSize.QuadPart <= 0))
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        // The view holds its own reference to the mapping, so the mapping handle can be closed immediately
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (view == nullptr)
+        {
+            return false;
+        }
+
+        m_data = static_cast<const uint8_t*>(view);
+        m_size = static_cast<AZStd::size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MappedFile::UnmapFile()
+    {
+        UnmapViewOfFile(m_data);
+    }
+}
@@ -5,4 +5,5 @@
 #      ../Include/Linux/MachineLearningLinux.h
 
 set(FILES
+    ../Common/Unixlike/MappedFile_Unixlike.cpp
 )
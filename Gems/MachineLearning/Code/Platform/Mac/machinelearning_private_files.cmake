@@ -5,4 +5,5 @@
 #      ../Include/Mac/MachineLearningMac.h
 
 set(FILES
+    ../Common/Unixlike/MappedFile_Unixlike.cpp
 )
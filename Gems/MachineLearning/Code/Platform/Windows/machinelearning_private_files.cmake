@@ -5,4 +5,5 @@
 #      ../Include/Windows/MachineLearningWindows.h
 
 set(FILES
+    ../Common/WinAPI/MappedFile_WinAPI.cpp
 )
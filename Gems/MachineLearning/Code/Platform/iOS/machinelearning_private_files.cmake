@@ -5,4 +5,5 @@
 #      ../Include/iOS/MachineLearningiOS.h
 
 set(FILES
+    ../Common/Unixlike/MappedFile_Unixlike.cpp
 )
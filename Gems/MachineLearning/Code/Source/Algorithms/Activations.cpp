@@ -19,9 +19,60 @@ namespace MachineLearning
         values.emplace_back(ActivationFunctions::Sigmoid, "Sigmoid");
         values.emplace_back(ActivationFunctions::Softmax, "Softmax");
         values.emplace_back(ActivationFunctions::Linear, "Linear");
+        values.emplace_back(ActivationFunctions::Tanh, "Tanh");
+        values.emplace_back(ActivationFunctions::LeakyReLU, "LeakyReLU");
+        values.emplace_back(ActivationFunctions::GELU, "GELU");
         return values;
     }
 
+    // Vectorized expf, this is the Cephes range reduction and minimax polynomial.
+    // exp(x) = 2^n * exp(r), where n = round(x / ln(2)) and r = x - n * ln(2) lies in [-ln(2)/2, ln(2)/2]
+    // ln(2) is split into a high and low part so that the reduction is exact in single precision
+    static AZ::Simd::Vec4::FloatType ExpPolynomial(AZ::Simd::Vec4::FloatType x)
+    {
+        using namespace AZ::Simd;
+        const AZ::Vector4 clamped = AZ::Vector4(x).GetClamp(AZ::Vector4(-87.3f), AZ::Vector4(88.3f));
+        x = clamped.GetSimdValue();
+
+        const Vec4::FloatType n = Vec4::ConvertToFloat(Vec4::ConvertToIntNearest(Vec4::Mul(x, Vec4::Splat(1.44269504088896341f))));
+        Vec4::FloatType r = Vec4::Sub(x, Vec4::Mul(n, Vec4::Splat(0.693359375f)));
+        r = Vec4::Sub(r, Vec4::Mul(n, Vec4::Splat(-2.12194440e-4f)));
+
+        Vec4::FloatType poly = Vec4::Splat(1.9875691500e-4f);
+        poly = Vec4::Madd(poly, r, Vec4::Splat(1.3981999507e-3f));
+        poly = Vec4::Madd(poly, r, Vec4::Splat(8.3334519073e-3f));
+        poly = Vec4::Madd(poly, r, Vec4::Splat(4.1665795894e-2f));
+        poly = Vec4::Madd(poly, r, Vec4::Splat(1.6666665459e-1f));
+        poly = Vec4::Madd(poly, r, Vec4::Splat(5.0000001201e-1f));
+        poly = Vec4::Madd(poly, Vec4::Mul(r, r), Vec4::Add(r, Vec4::Splat(1.0f)));
+
+        // Construct 2^n directly by writing the biased exponent into the float bit pattern
+        const Vec4::FloatType exponent = Vec4::Mul(Vec4::Add(n, Vec4::Splat(127.0f)), Vec4::Splat(8388608.0f));
+        return Vec4::Mul(poly, Vec4::CastToFloat(Vec4::ConvertToInt(exponent)));
+    }
+
+    // tanh(x) = 1 - 2 / (exp(2x) + 1), inputs are clamped as tanh is exactly +-1 in single precision beyond |x| > 9
+    static AZ::Simd::Vec4::FloatType TanhPolynomial(AZ::Simd::Vec4::FloatType x)
+    {
+        using namespace AZ::Simd;
+        const AZ::Vector4 clamped = AZ::Vector4(x).GetClamp(AZ::Vector4(-9.0f), AZ::Vector4(9.0f));
+        const Vec4::FloatType exp2x = ExpPolynomial(Vec4::Add(clamped.GetSimdValue(), clamped.GetSimdValue()));
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        return Vec4::Sub(one, Vec4::Div(Vec4::Splat(2.0f), Vec4::Add(exp2x, one)));
+    }
+
+    void Exp(const AZ::VectorN& sourceVector, AZ::VectorN& output)
+    {
+        const AZStd::size_t numElements = sourceVector.GetVectorValues().size();
+        output.Resize(sourceVector.GetDimensionality());
+        for (AZStd::size_t iter = 0; iter < numElements; ++iter)
+        {
+            const AZ::Vector4& sourceElement = sourceVector.GetVectorValues()[iter];
+            output.GetVectorValues()[iter].SetSimdValue(ExpPolynomial(sourceElement.GetSimdValue()));
+        }
+        output.FixLastVectorElement();
+    }
+
     void OneHotEncode(AZStd::size_t value, AZStd::size_t maxValue, AZ::VectorN& output)
     {
         AZ_Assert(value <= maxValue, "Requested one-hot encode of an out of range value");
@@ -63,9 +114,23 @@ namespace MachineLearning
         case ActivationFunctions::Linear:
             Linear(sourceVector, output);
             break;
+        case ActivationFunctions::Tanh:
+            Tanh(sourceVector, output);
+            break;
+        case ActivationFunctions::LeakyReLU:
+            LeakyReLU(sourceVector, output);
+            break;
+        case ActivationFunctions::GELU:
+            GELU(sourceVector, output);
+            break;
         }
     }
 
+    bool RequiresActivationInput(ActivationFunctions activationFunction)
+    {
+        return activationFunction == ActivationFunctions::GELU;
+    }
+
     void ReLU(const AZ::VectorN& sourceVector, AZ::VectorN& output)
     {
         const AZStd::size_t numElements = sourceVector.GetVectorValues().size();
@@ -83,18 +148,16 @@ namespace MachineLearning
 
     void Sigmoid(const AZ::VectorN& sourceVector, AZ::VectorN& output)
     {
-        const AZ::Vector4 vecZero = AZ::Vector4::CreateZero();
-        const AZ::Vector4 vecOne = AZ::Vector4::CreateOne();
-        const AZ::Vector4 epsilon = AZ::Vector4(AZ::Constants::Tolerance);
+        const AZ::Simd::Vec4::FloatType one = AZ::Simd::Vec4::Splat(1.0f);
         const AZStd::size_t numElements = sourceVector.GetVectorValues().size();
         output.Resize(sourceVector.GetDimensionality());
         for (AZStd::size_t iter = 0; iter < numElements; ++iter)
         {
             const AZ::Vector4& sourceElement = sourceVector.GetVectorValues()[iter];
             AZ::Vector4& outputElement = output.GetVectorValues()[iter];
-            const AZ::Vector4 divisor = (vecOne + (-sourceElement).GetExpEstimate()).GetMax(epsilon);
-            outputElement = vecOne / divisor;
-            outputElement = outputElement.GetClamp(vecZero, vecOne);
+            // sigmoid(x) = 1 / (1 + exp(-x)), exp is clamped internally so the divisor is always in [1, inf)
+            const AZ::Simd::Vec4::FloatType negExp = ExpPolynomial(AZ::Simd::Vec4::Sub(AZ::Simd::Vec4::ZeroFloat(), sourceElement.GetSimdValue()));
+            outputElement.SetSimdValue(AZ::Simd::Vec4::Div(one, AZ::Simd::Vec4::Add(one, negExp)));
         }
         output.FixLastVectorElement();
     }
@@ -112,28 +175,35 @@ namespace MachineLearning
         const AZStd::size_t numElements = sourceVector.GetVectorValues().size();
         output.Resize(sourceVector.GetDimensionality());
 
-        AZ::Vector4 max = sourceVector.GetVectorValues()[0];
-        for (AZStd::size_t iter = 1; iter < numElements; ++iter)
+        // The maximum is taken over the valid elements only, the zero padding in the last vector element must not participate
+        float maxValue = sourceVector.GetElement(0);
+        for (AZStd::size_t iter = 1; iter < sourceVector.GetDimensionality(); ++iter)
         {
-            max.GetMax(sourceVector.GetVectorValues()[iter]);
+            maxValue = AZ::GetMax(maxValue, sourceVector.GetElement(iter));
         }
 
-        AZ::Vector4 partialSum = vecZero;
+        const AZ::Simd::Vec4::FloatType max = AZ::Simd::Vec4::Splat(maxValue);
         for (AZStd::size_t iter = 0; iter < numElements; ++iter)
         {
             const AZ::Vector4& sourceElement = sourceVector.GetVectorValues()[iter];
             AZ::Vector4& outputElement = output.GetVectorValues()[iter];
-            outputElement = (sourceElement - max).GetExpEstimate();
-            outputElement = outputElement.GetClamp(vecZero, vecOne);
-            partialSum += outputElement;
+            outputElement.SetSimdValue(ExpPolynomial(AZ::Simd::Vec4::Sub(sourceElement.GetSimdValue(), max)));
         }
 
-        const float divisor = AZ::GetMax(1.0f / partialSum.Dot(vecOne), AZ::Constants::Tolerance);
+        // Zero the padding before summing, otherwise exp(0 - max) would be added once per padded lane
+        output.FixLastVectorElement();
+        AZ::Vector4 partialSum = vecZero;
+        for (const AZ::Vector4& element : output.GetVectorValues())
+        {
+            partialSum += element;
+        }
+
+        // The largest element contributes exp(0) = 1, so the sum is always at least one
+        const float divisor = 1.0f / partialSum.Dot(vecOne);
         for (AZ::Vector4& element : output.GetVectorValues())
         {
             element = element * divisor;
         }
-        output.FixLastVectorElement();
     }
 
     void Linear(const AZ::VectorN& sourceVector, AZ::VectorN& output)
@@ -144,6 +214,56 @@ namespace MachineLearning
         }
     }
 
+    void Tanh(const AZ::VectorN& sourceVector, AZ::VectorN& output)
+    {
+        const AZStd::size_t numElements = sourceVector.GetVectorValues().size();
+        output.Resize(sourceVector.GetDimensionality());
+        for (AZStd::size_t iter = 0; iter < numElements; ++iter)
+        {
+            const AZ::Vector4& sourceElement = sourceVector.GetVectorValues()[iter];
+            output.GetVectorValues()[iter].SetSimdValue(TanhPolynomial(sourceElement.GetSimdValue()));
+        }
+        output.FixLastVectorElement();
+    }
+
+    void LeakyReLU(const AZ::VectorN& sourceVector, AZ::VectorN& output)
+    {
+        // Since the slope is less than one, leakyrelu(x) = max(x, slope * x)
+        const AZ::Vector4 slope = AZ::Vector4(LeakyReLUSlope);
+        const AZStd::size_t numElements = sourceVector.GetVectorValues().size();
+        output.Resize(sourceVector.GetDimensionality());
+        for (AZStd::size_t iter = 0; iter < numElements; ++iter)
+        {
+            const AZ::Vector4& sourceElement = sourceVector.GetVectorValues()[iter];
+            output.GetVectorValues()[iter] = sourceElement.GetMax(sourceElement * slope);
+        }
+        output.FixLastVectorElement();
+    }
+
+    // sqrt(2 / pi) and the cubic coefficient of the tanh approximation to GELU
+    static constexpr float GeluScale = 0.7978845608028654f;
+    static constexpr float GeluCubic = 0.044715f;
+
+    void GELU(const AZ::VectorN& sourceVector, AZ::VectorN& output)
+    {
+        using namespace AZ::Simd;
+        const Vec4::FloatType half = Vec4::Splat(0.5f);
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType scale = Vec4::Splat(GeluScale);
+        const Vec4::FloatType cubic = Vec4::Splat(GeluCubic);
+        const AZStd::size_t numElements = sourceVector.GetVectorValues().size();
+        output.Resize(sourceVector.GetDimensionality());
+        for (AZStd::size_t iter = 0; iter < numElements; ++iter)
+        {
+            const Vec4::FloatType x = sourceVector.GetVectorValues()[iter].GetSimdValue();
+            const Vec4::FloatType x3 = Vec4::Mul(Vec4::Mul(x, x), x);
+            const Vec4::FloatType inner = Vec4::Mul(scale, Vec4::Madd(cubic, x3, x));
+            const Vec4::FloatType result = Vec4::Mul(Vec4::Mul(half, x), Vec4::Add(one, TanhPolynomial(inner)));
+            output.GetVectorValues()[iter].SetSimdValue(result);
+        }
+        output.FixLastVectorElement();
+    }
+
     void Activate_Derivative(ActivationFunctions activationFunction, const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output)
     {
         output.Resize(activationOutput.GetDimensionality());
@@ -161,9 +281,30 @@ namespace MachineLearning
         case ActivationFunctions::Linear:
             Linear_Derivative(activationOutput, backGradients, output);
             break;
+        case ActivationFunctions::Tanh:
+            Tanh_Derivative(activationOutput, backGradients, output);
+            break;
+        case ActivationFunctions::LeakyReLU:
+            LeakyReLU_Derivative(activationOutput, backGradients, output);
+            break;
+        case ActivationFunctions::GELU:
+            AZ_Assert(false, "The GELU derivative requires the activation input, use the overload which accepts it");
+            output.SetZero();
+            break;
         }
     }
 
+    void Activate_Derivative(ActivationFunctions activationFunction, const AZ::VectorN& activationInput, const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output)
+    {
+        if (activationFunction == ActivationFunctions::GELU)
+        {
+            output.Resize(activationInput.GetDimensionality());
+            GELU_Derivative(activationInput, backGradients, output);
+            return;
+        }
+        Activate_Derivative(activationFunction, activationOutput, backGradients, output);
+    }
+
     void ReLU_Derivative(const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output)
     {
         const AZStd::size_t numElements = activationOutput.GetVectorValues().size();
@@ -218,4 +359,64 @@ namespace MachineLearning
     {
         output = backGradients;
     }
+
+    void Tanh_Derivative(const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output)
+    {
+        const AZStd::size_t numElements = activationOutput.GetVectorValues().size();
+        const AZ::Vector4 vecOne = AZ::Vector4::CreateOne();
+        output.Resize(activationOutput.GetDimensionality());
+        for (AZStd::size_t iter = 0; iter < numElements; ++iter)
+        {
+            const AZ::Vector4& activationElement = activationOutput.GetVectorValues()[iter];
+            const AZ::Vector4& backGradientElement = backGradients.GetVectorValues()[iter];
+            AZ::Vector4& outputElement = output.GetVectorValues()[iter];
+            outputElement = backGradientElement * (vecOne - activationElement * activationElement);
+        }
+        output.FixLastVectorElement();
+    }
+
+    void LeakyReLU_Derivative(const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output)
+    {
+        const AZStd::size_t numElements = activationOutput.GetVectorValues().size();
+        const AZ::Simd::Vec4::FloatType zero = AZ::Simd::Vec4::ZeroFloat();
+        const AZ::Simd::Vec4::FloatType slope = AZ::Simd::Vec4::Splat(LeakyReLUSlope);
+        const AZ::Simd::Vec4::FloatType oneMinusSlope = AZ::Simd::Vec4::Splat(1.0f - LeakyReLUSlope);
+        output.Resize(activationOutput.GetDimensionality());
+        for (AZStd::size_t iter = 0; iter < numElements; ++iter)
+        {
+            const AZ::Vector4& activationElement = activationOutput.GetVectorValues()[iter];
+            const AZ::Vector4& backGradientElement = backGradients.GetVectorValues()[iter];
+            // The activation preserves sign, so the output can be tested in place of the original source vector
+            // The derivative is slope + (1 - slope) for positive elements and slope otherwise
+            const AZ::Simd::Vec4::FloatType mask = AZ::Simd::Vec4::CmpGt(activationElement.GetSimdValue(), zero);
+            const AZ::Simd::Vec4::FloatType derivative = AZ::Simd::Vec4::Add(slope, AZ::Simd::Vec4::And(oneMinusSlope, mask));
+            output.GetVectorValues()[iter].SetSimdValue(AZ::Simd::Vec4::Mul(backGradientElement.GetSimdValue(), derivative));
+        }
+        output.FixLastVectorElement();
+    }
+
+    void GELU_Derivative(const AZ::VectorN& activationInput, const AZ::VectorN& backGradients, AZ::VectorN& output)
+    {
+        // With u = sqrt(2/pi)(x + 0.044715x^3) and t = tanh(u)
+        // d/dx gelu(x) = 0.5(1 + t) + 0.5x(1 - t^2) * sqrt(2/pi)(1 + 3 * 0.044715x^2)
+        using namespace AZ::Simd;
+        const Vec4::FloatType half = Vec4::Splat(0.5f);
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType scale = Vec4::Splat(GeluScale);
+        const Vec4::FloatType cubic = Vec4::Splat(GeluCubic);
+        const Vec4::FloatType cubicDerivative = Vec4::Splat(3.0f * GeluCubic);
+        const AZStd::size_t numElements = activationInput.GetVectorValues().size();
+        output.Resize(activationInput.GetDimensionality());
+        for (AZStd::size_t iter = 0; iter < numElements; ++iter)
+        {
+            const Vec4::FloatType x = activationInput.GetVectorValues()[iter].GetSimdValue();
+            const Vec4::FloatType x2 = Vec4::Mul(x, x);
+            const Vec4::FloatType t = TanhPolynomial(Vec4::Mul(scale, Vec4::Madd(cubic, Vec4::Mul(x2, x), x)));
+            const Vec4::FloatType du = Vec4::Mul(scale, Vec4::Madd(cubicDerivative, x2, one));
+            const Vec4::FloatType sech2 = Vec4::Sub(one, Vec4::Mul(t, t));
+            const Vec4::FloatType derivative = Vec4::Madd(Vec4::Mul(Vec4::Mul(half, x), sech2), du, Vec4::Mul(half, Vec4::Add(one, t)));
+            output.GetVectorValues()[iter].SetSimdValue(Vec4::Mul(backGradients.GetVectorValues()[iter].GetSimdValue(), derivative));
+        }
+        output.FixLastVectorElement();
+    }
 }
@@ -23,9 +23,20 @@ namespace MachineLearning
     //! Reverses one-hot encoding, returns the index of the element with the largest value.
     AZStd::size_t ArgMaxDecode(const AZ::VectorN& vector);
 
+    //! The slope applied to negative inputs by the leaky rectified linear unit function.
+    constexpr float LeakyReLUSlope = 0.01f;
+
+    //! Computes exp applied to all elements of the source vector.
+    //! This uses a vectorized polynomial approximation which is accurate to within a few ulp of libm across the full float range.
+    void Exp(const AZ::VectorN& sourceVector, AZ::VectorN& output);
+
     //! Computes the requested activation function applied to all elements of the source vector.
     void Activate(ActivationFunctions activationFunction, const AZ::VectorN& sourceVector, AZ::VectorN& output);
 
+    //! Returns true if the derivative of the activation function can not be computed from the activation output alone.
+    //! Layers using these activation functions must retain the activation input for back-propagation.
+    bool RequiresActivationInput(ActivationFunctions activationFunction);
+
     //! Computes the rectified linear unit function (ReLU) applied to all elements of the source vector.
     void ReLU(const AZ::VectorN& sourceVector, AZ::VectorN& output);
 
@@ -38,10 +49,24 @@ namespace MachineLearning
     //! Computes the linear activation function applied to all elements of the source vector.
     void Linear(const AZ::VectorN& sourceVector, AZ::VectorN& output);
 
+    //! Computes the hyperbolic tangent applied to all elements of the source vector.
+    void Tanh(const AZ::VectorN& sourceVector, AZ::VectorN& output);
+
+    //! Computes the leaky rectified linear unit function applied to all elements of the source vector.
+    void LeakyReLU(const AZ::VectorN& sourceVector, AZ::VectorN& output);
+
+    //! Computes the gaussian error linear unit (GELU) applied to all elements of the source vector.
+    //! This uses the common tanh formulation, 0.5x(1 + tanh(sqrt(2/pi)(x + 0.044715x^3))).
+    void GELU(const AZ::VectorN& sourceVector, AZ::VectorN& output);
+
     //! Computes the derivative of the requested activation function applied to all elements provided vector.
     //! The activationOutput input here is simply the output of calling Activate on the original source vector.
     void Activate_Derivative(ActivationFunctions activationFunction, const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output);
 
+    //! Computes the derivative of the requested activation function applied to all elements provided vector.
+    //! The activationInput is the original source vector, which is only read by activation functions for which RequiresActivationInput returns true.
+    void Activate_Derivative(ActivationFunctions activationFunction, const AZ::VectorN& activationInput, const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output);
+
     //! Computes the derivative of the rectified linear unit function (ReLU) applied to all elements of the original source vector.
     void ReLU_Derivative(const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output);
 
@@ -53,4 +78,14 @@ namespace MachineLearning
 
     //! Computes the derivative linear activation function applied to all elements of the original source vector.
     void Linear_Derivative(const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output);
+
+    //! Computes the derivative of the hyperbolic tangent applied to all elements of the original source vector.
+    void Tanh_Derivative(const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output);
+
+    //! Computes the derivative of the leaky rectified linear unit function applied to all elements of the original source vector.
+    void LeakyReLU_Derivative(const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output);
+
+    //! Computes the derivative of the gaussian error linear unit applied to all elements of the original source vector.
+    //! Unlike the other derivatives, this requires the original source vector as GELU is not invertible.
+    void GELU_Derivative(const AZ::VectorN& activationInput, const AZ::VectorN& backGradients, AZ::VectorN& output);
 }
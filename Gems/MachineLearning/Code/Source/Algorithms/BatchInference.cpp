@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Algorithms/BatchInference.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+
+namespace MachineLearning
+{
+    IInferenceContextPtr InferenceContextPool::Acquire(INeuralNetworkPtr model)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto iter = m_freeContexts.find(model.get());
+            if ((iter != m_freeContexts.end()) && !iter->second.empty())
+            {
+                IInferenceContextPtr context = iter->second.back().release();
+                iter->second.pop_back();
+                m_acquiredContexts[context] = model.get();
+                return context;
+            }
+        }
+
+        IInferenceContextPtr context = model->CreateInferenceContext();
+        if (context != nullptr)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_acquiredContexts[context] = model.get();
+        }
+        return context;
+    }
+
+    void InferenceContextPool::Release(INeuralNetworkPtr model, IInferenceContextPtr context)
+    {
+        if (context == nullptr)
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        auto iter = m_acquiredContexts.find(context);
+        const bool pooled = (iter != m_acquiredContexts.end()) && (iter->second == model.get());
+        if (iter != m_acquiredContexts.end())
+        {
+            m_acquiredContexts.erase(iter);
+        }
+
+        if (pooled)
+        {
+            m_freeContexts[model.get()].emplace_back(context);
+        }
+        else
+        {
+            // The model was cleared while this context was in use, it may no longer exist so the context must not be pooled under its address
+            delete context;
+        }
+    }
+
+    void InferenceContextPool::Clear(INeuralNetworkPtr model)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_freeContexts.erase(model.get());
+        for (auto iter = m_acquiredContexts.begin(); iter != m_acquiredContexts.end();)
+        {
+            iter = (iter->second == model.get()) ? m_acquiredContexts.erase(iter) : AZStd::next(iter);
+        }
+    }
+
+    AZStd::size_t InferenceContextPool::GetFreeCount(INeuralNetworkPtr model)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        auto iter = m_freeContexts.find(model.get());
+        return (iter != m_freeContexts.end()) ? iter->second.size() : 0;
+    }
+
+    void BatchInferenceQueue::Submit(INeuralNetworkPtr model, const AZ::VectorN& activations, InferenceCallback callback)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        ModelBatch& batch = m_pendingBatches[model.get()];
+        batch.m_model = model;
+
+        // Reuse the storage retained from previous batches where possible
+        if (batch.m_count < batch.m_activations.size())
+        {
+            batch.m_activations[batch.m_count] = activations;
+            batch.m_callbacks[batch.m_count] = AZStd::move(callback);
+        }
+        else
+        {
+            batch.m_activations.push_back(activations);
+            batch.m_callbacks.push_back(AZStd::move(callback));
+        }
+        ++batch.m_count;
+    }
+
+    AZStd::size_t BatchInferenceQueue::Execute(InferenceContextPool& contextPool, AZ::JobContext* jobContext, AZStd::size_t samplesPerJob)
+    {
+        {
+            // Swap the queues so that new requests can be submitted while this batch is being evaluated
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_pendingBatches.swap(m_executingBatches);
+            m_executing = true;
+        }
+
+        // Split each model batch into chunks, each of which is evaluated as a single batched forward pass
+        samplesPerJob = AZStd::max<AZStd::size_t>(samplesPerJob, 1);
+        AZStd::size_t requestCount = 0;
+        m_chunks.clear();
+        for (auto& [model, batch] : m_executingBatches)
+        {
+            if (batch.m_count == 0)
+            {
+                continue;
+            }
+
+            requestCount += batch.m_count;
+            batch.m_activationPointers.resize(batch.m_count);
+            for (AZStd::size_t iter = 0; iter < batch.m_count; ++iter)
+            {
+                batch.m_activationPointers[iter] = &batch.m_activations[iter];
+            }
+            if (batch.m_outputs.size() < batch.m_count)
+            {
+                batch.m_outputs.resize(batch.m_count);
+            }
+
+            // Rounding the chunk count down keeps every chunk at or above samplesPerJob samples, so no job is left with a small remainder
+            const AZStd::size_t chunkCount = (jobContext != nullptr) ? AZStd::max<AZStd::size_t>(batch.m_count / samplesPerJob, 1) : 1;
+            const AZStd::size_t samplesPerChunk = (batch.m_count + chunkCount - 1) / chunkCount;
+            for (AZStd::size_t first = 0; first < batch.m_count; first += samplesPerChunk)
+            {
+                BatchChunk chunk;
+                chunk.m_batch = &batch;
+                chunk.m_first = first;
+                chunk.m_count = AZStd::min(samplesPerChunk, batch.m_count - first);
+                chunk.m_context = contextPool.Acquire(batch.m_model);
+                m_chunks.push_back(chunk);
+            }
+        }
+
+        if ((jobContext != nullptr) && (m_chunks.size() > 1))
+        {
+            AZ::JobCompletion completion(jobContext);
+            for (const BatchChunk& chunk : m_chunks)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([&chunk]() { ExecuteChunk(chunk); }, true, jobContext);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (const BatchChunk& chunk : m_chunks)
+            {
+                ExecuteChunk(chunk);
+            }
+        }
+
+        for (const BatchChunk& chunk : m_chunks)
+        {
+            contextPool.Release(chunk.m_batch->m_model, chunk.m_context);
+        }
+
+        // Scatter the results back to the requesters, callbacks are free to submit new requests as these go to the pending queue
+        // A callback may also remove a model, which only marks its batch so that the iteration here stays valid
+        for (auto& [model, batch] : m_executingBatches)
+        {
+            for (AZStd::size_t iter = 0; iter < batch.m_count; ++iter)
+            {
+                if (batch.m_callbacks[iter] && !IsRemoved(model))
+                {
+                    batch.m_callbacks[iter](batch.m_outputs[iter]);
+                }
+                batch.m_callbacks[iter] = nullptr;
+            }
+            batch.m_count = 0;
+        }
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            for (INeuralNetwork* model : m_removedModels)
+            {
+                m_executingBatches.erase(model);
+            }
+            m_removedModels.clear();
+            m_executing = false;
+        }
+        return requestCount;
+    }
+
+    void BatchInferenceQueue::Remove(INeuralNetworkPtr model)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_pendingBatches.erase(model.get());
+        if (m_executing)
+        {
+            // In-flight chunks and callbacks still reference the executing batch, Execute erases it once it completes
+            m_removedModels.push_back(model.get());
+        }
+        else
+        {
+            m_executingBatches.erase(model.get());
+        }
+    }
+
+    bool BatchInferenceQueue::IsRemoved(INeuralNetwork* model)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return AZStd::find(m_removedModels.begin(), m_removedModels.end(), model) != m_removedModels.end();
+    }
+
+    AZStd::size_t BatchInferenceQueue::GetPendingCount()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        AZStd::size_t pendingCount = 0;
+        for (const auto& [model, batch] : m_pendingBatches)
+        {
+            pendingCount += batch.m_count;
+        }
+        return pendingCount;
+    }
+
+    void BatchInferenceQueue::ExecuteChunk(const BatchChunk& chunk)
+    {
+        ModelBatch& batch = *chunk.m_batch;
+        AZStd::span<const AZ::VectorN* const> activations(batch.m_activationPointers.data() + chunk.m_first, chunk.m_count);
+        AZStd::span<const AZ::VectorN* const> outputs = batch.m_model->ForwardBatch(chunk.m_context, activations);
+        if (outputs.size() == chunk.m_count)
+        {
+            for (AZStd::size_t iter = 0; iter < chunk.m_count; ++iter)
+            {
+                batch.m_outputs[chunk.m_first + iter] = *outputs[iter];
+            }
+            return;
+        }
+
+        // Models without a batched implementation are evaluated one sample at a time
+        for (AZStd::size_t iter = 0; iter < chunk.m_count; ++iter)
+        {
+            const AZ::VectorN* output = batch.m_model->Forward(chunk.m_context, *activations[iter]);
+            batch.m_outputs[chunk.m_first + iter] = (output != nullptr) ? *output : AZ::VectorN();
+        }
+    }
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <MachineLearning/IInferenceSystem.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace MachineLearning
+{
+    //! A thread-safe pool of inference contexts, so that repeated inferences against a model do not need to allocate new contexts.
+    class InferenceContextPool
+    {
+    public:
+
+        //! Retrieves a free inference context for the provided model, creating a new one if none are available.
+        IInferenceContextPtr Acquire(INeuralNetworkPtr model);
+
+        //! Returns an inference context to the pool of free contexts for the provided model.
+        //! Contexts which were not acquired from this pool, or were acquired before the model was cleared, are destroyed instead.
+        void Release(INeuralNetworkPtr model, IInferenceContextPtr context);
+
+        //! Destroys all free inference contexts associated with the provided model.
+        //! Contexts of the model which are still acquired are destroyed when they are released, so they never return to the pool.
+        void Clear(INeuralNetworkPtr model);
+
+        //! Returns the number of free inference contexts associated with the provided model.
+        AZStd::size_t GetFreeCount(INeuralNetworkPtr model);
+
+    private:
+
+        AZStd::mutex m_mutex;
+        AZStd::unordered_map<INeuralNetwork*, AZStd::vector<AZStd::unique_ptr<IInferenceContext>>> m_freeContexts;
+
+        //! The model each acquired context was acquired for, Clear removes the entries of the model.
+        //! Once a model is cleared it may be destroyed and its address reused, so only contexts found here are returned to the pool.
+        AZStd::unordered_map<IInferenceContext*, INeuralNetwork*> m_acquiredContexts;
+    };
+
+    //! Collects inference requests for any number of models, and evaluates them as one batched forward pass per model.
+    //! Requests may be submitted from any thread, requests submitted while a batch is being executed are deferred to the following batch.
+    class BatchInferenceQueue
+    {
+    public:
+
+        //! Queues a set of activations for the next batched forward pass of the provided model.
+        void Submit(INeuralNetworkPtr model, const AZ::VectorN& activations, InferenceCallback callback);
+
+        //! Evaluates all queued requests and invokes their callbacks on the calling thread.
+        //! If a job context is provided, batches of at least twice samplesPerJob samples are split into chunks of at least samplesPerJob samples which are evaluated in parallel.
+        //! @return the number of requests that were evaluated
+        AZStd::size_t Execute(InferenceContextPool& contextPool, AZ::JobContext* jobContext, AZStd::size_t samplesPerJob);
+
+        //! Discards all queued requests for the provided model.
+        //! If the model's batch is currently being executed, its remaining callbacks are skipped and its storage is released once Execute completes.
+        void Remove(INeuralNetworkPtr model);
+
+        //! Returns the number of queued requests across all models.
+        AZStd::size_t GetPendingCount();
+
+    private:
+
+        //! The queued requests for a single model, storage is retained between batches to avoid reallocating per frame.
+        struct ModelBatch
+        {
+            INeuralNetworkPtr m_model;
+            AZStd::size_t m_count = 0;
+            AZStd::vector<AZ::VectorN> m_activations;
+            AZStd::vector<const AZ::VectorN*> m_activationPointers;
+            AZStd::vector<AZ::VectorN> m_outputs;
+            AZStd::vector<InferenceCallback> m_callbacks;
+        };
+
+        //! A contiguous range of samples from a single model batch, evaluated using a single inference context.
+        struct BatchChunk
+        {
+            ModelBatch* m_batch = nullptr;
+            AZStd::size_t m_first = 0;
+            AZStd::size_t m_count = 0;
+            IInferenceContextPtr m_context = nullptr;
+        };
+
+        static void ExecuteChunk(const BatchChunk& chunk);
+
+        //! Returns true if the provided model was removed while its batch was executing.
+        bool IsRemoved(INeuralNetwork* model);
+
+        //! Guards the pending batches, m_executing and m_removedModels.
+        //! The executing batches are only modified by Execute, and only read or erased by Remove while no batch is executing.
+        AZStd::mutex m_mutex;
+        AZStd::unordered_map<INeuralNetwork*, ModelBatch> m_pendingBatches;
+        AZStd::unordered_map<INeuralNetwork*, ModelBatch> m_executingBatches;
+        AZStd::vector<BatchChunk> m_chunks;
+        bool m_executing = false;
+
+        //! Models removed while their batch was executing, their batches are erased once Execute completes.
+        AZStd::vector<INeuralNetwork*> m_removedModels;
+    };
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Algorithms/BatchOperations.h>
+#include <AzCore/Math/SimdMath.h>
+
+namespace MachineLearning
+{
+    // The weight matrices are stored as 4x4 submatrices, a tile of 16x16 submatrices is 16KB which comfortably fits in L1/L2 alongside the sample slices
+    static constexpr AZStd::size_t TileGroups = 16;
+
+    void BatchVectorMatrixMultiply(const AZ::MatrixMxN& matrix, AZStd::span<const AZ::VectorN* const> vectors, AZStd::span<AZ::VectorN> outputs)
+    {
+        AZ_Assert(vectors.size() == outputs.size(), "The number of input and output samples must match");
+        const AZStd::size_t rowGroups = matrix.GetRowGroups();
+        const AZStd::size_t colGroups = matrix.GetColumnGroups();
+        for (AZStd::size_t rowTile = 0; rowTile < rowGroups; rowTile += TileGroups)
+        {
+            const AZStd::size_t rowEnd = AZStd::min(rowTile + TileGroups, rowGroups);
+            for (AZStd::size_t colTile = 0; colTile < colGroups; colTile += TileGroups)
+            {
+                const AZStd::size_t colEnd = AZStd::min(colTile + TileGroups, colGroups);
+                for (AZStd::size_t sample = 0; sample < vectors.size(); ++sample)
+                {
+                    const AZStd::vector<AZ::Vector4>& inputValues = vectors[sample]->GetVectorValues();
+                    AZStd::vector<AZ::Vector4>& outputValues = outputs[sample].GetVectorValues();
+                    for (AZStd::size_t rowIter = rowTile; rowIter < rowEnd; ++rowIter)
+                    {
+                        AZ::Simd::Vec4::FloatType accumulator = outputValues[rowIter].GetSimdValue();
+                        for (AZStd::size_t colIter = colTile; colIter < colEnd; ++colIter)
+                        {
+                            // Each simd value of a submatrix holds one of its columns
+                            const AZ::Simd::Vec4::FloatType* block = matrix.GetSubmatrix(rowIter, colIter).GetSimdValues();
+                            const AZ::Simd::Vec4::FloatType element = inputValues[colIter].GetSimdValue();
+                            const AZ::Simd::Vec4::FloatType partial01 = AZ::Simd::Vec4::Madd(block[0], AZ::Simd::Vec4::SplatIndex0(element), AZ::Simd::Vec4::Mul(block[1], AZ::Simd::Vec4::SplatIndex1(element)));
+                            const AZ::Simd::Vec4::FloatType partial23 = AZ::Simd::Vec4::Madd(block[2], AZ::Simd::Vec4::SplatIndex2(element), AZ::Simd::Vec4::Mul(block[3], AZ::Simd::Vec4::SplatIndex3(element)));
+                            accumulator = AZ::Simd::Vec4::Add(accumulator, AZ::Simd::Vec4::Add(partial01, partial23));
+                        }
+                        outputValues[rowIter].SetSimdValue(accumulator);
+                    }
+                }
+            }
+        }
+
+        for (AZ::VectorN& output : outputs)
+        {
+            output.FixLastVectorElement();
+        }
+    }
+
+    void BatchVectorMatrixMultiplyLeft(AZStd::span<const AZ::VectorN> vectors, const AZ::MatrixMxN& matrix, AZStd::span<AZ::VectorN> outputs)
+    {
+        AZ_Assert(vectors.size() == outputs.size(), "The number of input and output samples must match");
+        for (AZ::VectorN& output : outputs)
+        {
+            output.Resize(matrix.GetColumnCount());
+            output.SetZero();
+        }
+
+        // Transposing a submatrix is not free, so each tile is transposed once and then reused for every sample in the batch
+        AZStd::vector<AZ::Matrix4x4> transposedTile(TileGroups * TileGroups);
+        const AZStd::size_t rowGroups = matrix.GetRowGroups();
+        const AZStd::size_t colGroups = matrix.GetColumnGroups();
+        for (AZStd::size_t rowTile = 0; rowTile < rowGroups; rowTile += TileGroups)
+        {
+            const AZStd::size_t rowEnd = AZStd::min(rowTile + TileGroups, rowGroups);
+            for (AZStd::size_t colTile = 0; colTile < colGroups; colTile += TileGroups)
+            {
+                const AZStd::size_t colEnd = AZStd::min(colTile + TileGroups, colGroups);
+                for (AZStd::size_t rowIter = rowTile; rowIter < rowEnd; ++rowIter)
+                {
+                    for (AZStd::size_t colIter = colTile; colIter < colEnd; ++colIter)
+                    {
+                        transposedTile[(rowIter - rowTile) * TileGroups + (colIter - colTile)] = matrix.GetSubmatrix(rowIter, colIter).GetTranspose();
+                    }
+                }
+
+                for (AZStd::size_t sample = 0; sample < vectors.size(); ++sample)
+                {
+                    const AZStd::vector<AZ::Vector4>& inputValues = vectors[sample].GetVectorValues();
+                    AZStd::vector<AZ::Vector4>& outputValues = outputs[sample].GetVectorValues();
+                    for (AZStd::size_t colIter = colTile; colIter < colEnd; ++colIter)
+                    {
+                        AZ::Simd::Vec4::FloatType accumulator = outputValues[colIter].GetSimdValue();
+                        for (AZStd::size_t rowIter = rowTile; rowIter < rowEnd; ++rowIter)
+                        {
+                            // Each simd value of a transposed submatrix holds one of the original rows
+                            const AZ::Simd::Vec4::FloatType* block = transposedTile[(rowIter - rowTile) * TileGroups + (colIter - colTile)].GetSimdValues();
+                            const AZ::Simd::Vec4::FloatType element = inputValues[rowIter].GetSimdValue();
+                            const AZ::Simd::Vec4::FloatType partial01 = AZ::Simd::Vec4::Madd(block[0], AZ::Simd::Vec4::SplatIndex0(element), AZ::Simd::Vec4::Mul(block[1], AZ::Simd::Vec4::SplatIndex1(element)));
+                            const AZ::Simd::Vec4::FloatType partial23 = AZ::Simd::Vec4::Madd(block[2], AZ::Simd::Vec4::SplatIndex2(element), AZ::Simd::Vec4::Mul(block[3], AZ::Simd::Vec4::SplatIndex3(element)));
+                            accumulator = AZ::Simd::Vec4::Add(accumulator, AZ::Simd::Vec4::Add(partial01, partial23));
+                        }
+                        outputValues[colIter].SetSimdValue(accumulator);
+                    }
+                }
+            }
+        }
+
+        for (AZ::VectorN& output : outputs)
+        {
+            output.FixLastVectorElement();
+        }
+    }
+
+    void BatchOuterProductAccumulate(AZStd::span<const AZ::VectorN> lhs, AZStd::span<const AZ::VectorN* const> rhs, float decay, float scale, AZ::MatrixMxN& output)
+    {
+        AZ_Assert(lhs.size() == rhs.size(), "The number of lhs and rhs samples must match");
+        const AZ::Simd::Vec4::FloatType decaySplat = AZ::Simd::Vec4::Splat(decay);
+        const AZ::Simd::Vec4::FloatType scaleSplat = AZ::Simd::Vec4::Splat(scale);
+        const AZStd::size_t rowGroups = output.GetRowGroups();
+        const AZStd::size_t colGroups = output.GetColumnGroups();
+        for (AZStd::size_t rowTile = 0; rowTile < rowGroups; rowTile += TileGroups)
+        {
+            const AZStd::size_t rowEnd = AZStd::min(rowTile + TileGroups, rowGroups);
+            for (AZStd::size_t colTile = 0; colTile < colGroups; colTile += TileGroups)
+            {
+                const AZStd::size_t colEnd = AZStd::min(colTile + TileGroups, colGroups);
+                for (AZStd::size_t rowIter = rowTile; rowIter < rowEnd; ++rowIter)
+                {
+                    for (AZStd::size_t colIter = colTile; colIter < colEnd; ++colIter)
+                    {
+                        // Sum the outer products of the whole batch in registers, then write the submatrix back exactly once
+                        AZ::Simd::Vec4::FloatType sum0 = AZ::Simd::Vec4::ZeroFloat();
+                        AZ::Simd::Vec4::FloatType sum1 = AZ::Simd::Vec4::ZeroFloat();
+                        AZ::Simd::Vec4::FloatType sum2 = AZ::Simd::Vec4::ZeroFloat();
+                        AZ::Simd::Vec4::FloatType sum3 = AZ::Simd::Vec4::ZeroFloat();
+                        for (AZStd::size_t sample = 0; sample < lhs.size(); ++sample)
+                        {
+                            const AZ::Simd::Vec4::FloatType lhsElement = lhs[sample].GetVectorValues()[rowIter].GetSimdValue();
+                            const AZ::Simd::Vec4::FloatType rhsElement = rhs[sample]->GetVectorValues()[colIter].GetSimdValue();
+                            sum0 = AZ::Simd::Vec4::Madd(lhsElement, AZ::Simd::Vec4::SplatIndex0(rhsElement), sum0);
+                            sum1 = AZ::Simd::Vec4::Madd(lhsElement, AZ::Simd::Vec4::SplatIndex1(rhsElement), sum1);
+                            sum2 = AZ::Simd::Vec4::Madd(lhsElement, AZ::Simd::Vec4::SplatIndex2(rhsElement), sum2);
+                            sum3 = AZ::Simd::Vec4::Madd(lhsElement, AZ::Simd::Vec4::SplatIndex3(rhsElement), sum3);
+                        }
+
+                        AZ::Simd::Vec4::FloatType* outputElement = output.GetSubmatrix(rowIter, colIter).GetSimdValues();
+                        outputElement[0] = AZ::Simd::Vec4::Madd(outputElement[0], decaySplat, AZ::Simd::Vec4::Mul(sum0, scaleSplat));
+                        outputElement[1] = AZ::Simd::Vec4::Madd(outputElement[1], decaySplat, AZ::Simd::Vec4::Mul(sum1, scaleSplat));
+                        outputElement[2] = AZ::Simd::Vec4::Madd(outputElement[2], decaySplat, AZ::Simd::Vec4::Mul(sum2, scaleSplat));
+                        outputElement[3] = AZ::Simd::Vec4::Madd(outputElement[3], decaySplat, AZ::Simd::Vec4::Mul(sum3, scaleSplat));
+                    }
+                }
+            }
+        }
+        output.FixUnusedElements();
+    }
+
+    void BatchVectorAccumulate(AZStd::span<const AZ::VectorN> vectors, float decay, float scale, AZ::VectorN& output)
+    {
+        const AZ::Simd::Vec4::FloatType decaySplat = AZ::Simd::Vec4::Splat(decay);
+        const AZ::Simd::Vec4::FloatType scaleSplat = AZ::Simd::Vec4::Splat(scale);
+        AZStd::vector<AZ::Vector4>& outputValues = output.GetVectorValues();
+        for (AZStd::size_t iter = 0; iter < outputValues.size(); ++iter)
+        {
+            AZ::Simd::Vec4::FloatType sum = AZ::Simd::Vec4::ZeroFloat();
+            for (const AZ::VectorN& vector : vectors)
+            {
+                sum = AZ::Simd::Vec4::Add(sum, vector.GetVectorValues()[iter].GetSimdValue());
+            }
+            outputValues[iter].SetSimdValue(AZ::Simd::Vec4::Madd(outputValues[iter].GetSimdValue(), decaySplat, AZ::Simd::Vec4::Mul(sum, scaleSplat)));
+        }
+        output.FixLastVectorElement();
+    }
+
+    void WeightedAccumulate(const AZ::MatrixMxN& source, float sourceWeight, float outputWeight, AZ::MatrixMxN& output)
+    {
+        AZ_Assert(source.GetRowCount() == output.GetRowCount() && source.GetColumnCount() == output.GetColumnCount(), "The dimensionality of source and output must match");
+        const AZ::Simd::Vec4::FloatType sourceSplat = AZ::Simd::Vec4::Splat(sourceWeight);
+        const AZ::Simd::Vec4::FloatType outputSplat = AZ::Simd::Vec4::Splat(outputWeight);
+        const AZStd::vector<AZ::Matrix4x4>& sourceElements = source.GetMatrixElements();
+        AZStd::vector<AZ::Matrix4x4>& outputElements = output.GetMatrixElements();
+        for (AZStd::size_t iter = 0; iter < outputElements.size(); ++iter)
+        {
+            const AZ::Simd::Vec4::FloatType* sourceElement = sourceElements[iter].GetSimdValues();
+            AZ::Simd::Vec4::FloatType* outputElement = outputElements[iter].GetSimdValues();
+            outputElement[0] = AZ::Simd::Vec4::Madd(outputElement[0], outputSplat, AZ::Simd::Vec4::Mul(sourceElement[0], sourceSplat));
+            outputElement[1] = AZ::Simd::Vec4::Madd(outputElement[1], outputSplat, AZ::Simd::Vec4::Mul(sourceElement[1], sourceSplat));
+            outputElement[2] = AZ::Simd::Vec4::Madd(outputElement[2], outputSplat, AZ::Simd::Vec4::Mul(sourceElement[2], sourceSplat));
+            outputElement[3] = AZ::Simd::Vec4::Madd(outputElement[3], outputSplat, AZ::Simd::Vec4::Mul(sourceElement[3], sourceSplat));
+        }
+    }
+
+    void WeightedAccumulate(const AZ::VectorN& source, float sourceWeight, float outputWeight, AZ::VectorN& output)
+    {
+        AZ_Assert(source.GetDimensionality() == output.GetDimensionality(), "The dimensionality of source and output must match");
+        const AZ::Simd::Vec4::FloatType sourceSplat = AZ::Simd::Vec4::Splat(sourceWeight);
+        const AZ::Simd::Vec4::FloatType outputSplat = AZ::Simd::Vec4::Splat(outputWeight);
+        const AZStd::vector<AZ::Vector4>& sourceValues = source.GetVectorValues();
+        AZStd::vector<AZ::Vector4>& outputValues = output.GetVectorValues();
+        for (AZStd::size_t iter = 0; iter < outputValues.size(); ++iter)
+        {
+            outputValues[iter].SetSimdValue(AZ::Simd::Vec4::Madd(outputValues[iter].GetSimdValue(), outputSplat, AZ::Simd::Vec4::Mul(sourceValues[iter].GetSimdValue(), sourceSplat)));
+        }
+    }
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/VectorN.h>
+#include <AzCore/Math/MatrixMxN.h>
+#include <AzCore/std/containers/span.h>
+
+namespace MachineLearning
+{
+    //! These are the matrix-matrix (GEMM) kernels used for mini-batch training and inference.
+    //! A batch is a set of B sample vectors, which together form a matrix with one sample per column.
+    //! All kernels walk the weight matrix in cache sized tiles so that each tile is reused across the whole batch while it is resident in cache.
+
+    //! Computes outputs[i] += matrix * vectors[i] for every sample in the batch.
+    //! This is the batched equivalent of AZ::VectorMatrixMultiply, outputs must already be sized to the row count of the matrix.
+    void BatchVectorMatrixMultiply(const AZ::MatrixMxN& matrix, AZStd::span<const AZ::VectorN* const> vectors, AZStd::span<AZ::VectorN> outputs);
+
+    //! Computes outputs[i] = vectors[i] * matrix (the product with the transposed matrix) for every sample in the batch.
+    //! This is the batched equivalent of AZ::VectorMatrixMultiplyLeft.
+    void BatchVectorMatrixMultiplyLeft(AZStd::span<const AZ::VectorN> vectors, const AZ::MatrixMxN& matrix, AZStd::span<AZ::VectorN> outputs);
+
+    //! Computes output = output * decay + scale * sum(OuterProduct(lhs[i], rhs[i])) over all samples in the batch.
+    //! Folding the decay and scale into the kernel lets callers maintain a running average with a single pass over the output matrix.
+    void BatchOuterProductAccumulate(AZStd::span<const AZ::VectorN> lhs, AZStd::span<const AZ::VectorN* const> rhs, float decay, float scale, AZ::MatrixMxN& output);
+
+    //! Computes output = output * decay + scale * sum(vectors[i]) over all samples in the batch.
+    void BatchVectorAccumulate(AZStd::span<const AZ::VectorN> vectors, float decay, float scale, AZ::VectorN& output);
+
+    //! Computes output = output * outputWeight + source * sourceWeight in place, used to reduce gradients accumulated by separate workers.
+    void WeightedAccumulate(const AZ::MatrixMxN& source, float sourceWeight, float outputWeight, AZ::MatrixMxN& output);
+
+    //! Computes output = output * outputWeight + source * sourceWeight in place, used to reduce gradients accumulated by separate workers.
+    void WeightedAccumulate(const AZ::VectorN& source, float sourceWeight, float outputWeight, AZ::VectorN& output);
+}
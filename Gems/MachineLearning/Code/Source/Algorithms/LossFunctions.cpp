@@ -32,6 +32,9 @@ namespace MachineLearning
         case LossFunctions::MeanSquaredError:
             MeanSquaredError(expected, actual, output);
             break;
+        case LossFunctions::CategoricalCrossEntropy:
+            CategoricalCrossEntropy(expected, actual, output);
+            break;
         }
     }
 
@@ -49,11 +52,47 @@ namespace MachineLearning
         case LossFunctions::MeanSquaredError:
             MeanSquaredError_Derivative(expected, actual, output);
             break;
+        case LossFunctions::CategoricalCrossEntropy:
+            CategoricalCrossEntropy_Derivative(expected, actual, output);
+            break;
         }
     }
 
     void MeanSquaredError_Derivative(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output)
     {
-        output = (expected - actual);
+        output = (actual - expected);
+    }
+
+    // Probabilities are clamped away from zero to keep log and division finite
+    static constexpr float MinimumProbability = 1e-7f;
+
+    void CategoricalCrossEntropy(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output)
+    {
+        output.Resize(actual.GetDimensionality());
+        for (AZStd::size_t iter = 0; iter < actual.GetDimensionality(); ++iter)
+        {
+            const float label = expected.GetElement(iter);
+            output.SetElement(iter, (label != 0.0f) ? -label * logf(AZ::GetMax(actual.GetElement(iter), MinimumProbability)) : 0.0f);
+        }
+    }
+
+    void CategoricalCrossEntropy_Derivative(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output)
+    {
+        output.Resize(actual.GetDimensionality());
+        for (AZStd::size_t iter = 0; iter < actual.GetDimensionality(); ++iter)
+        {
+            output.SetElement(iter, -expected.GetElement(iter) / AZ::GetMax(actual.GetElement(iter), MinimumProbability));
+        }
+    }
+
+    bool IsLossFusedWithActivation(LossFunctions lossFunction, ActivationFunctions activationFunction)
+    {
+        return (lossFunction == LossFunctions::CategoricalCrossEntropy) && (activationFunction == ActivationFunctions::Softmax);
+    }
+
+    void SoftmaxCrossEntropy_Derivative(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output)
+    {
+        AZ_Assert(expected.GetDimensionality() == actual.GetDimensionality(), "The dimensionality of expected and actual must match");
+        output = (actual - expected);
     }
 }
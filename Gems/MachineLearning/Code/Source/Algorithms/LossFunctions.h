@@ -19,12 +19,27 @@ namespace MachineLearning
     //! Computes the gradient of the loss using across all elements of the source vectors using the requested cost function.
     void ComputeLoss(LossFunctions lossFunction, const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output);
 
-    //! Computes the derivative of the rectified linear unit function (ReLU) applied to all elements of the source vector.
+    //! Computes the mean squared error between the expected and actual outputs.
     void MeanSquaredError(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output);
 
     //! Computes the gradient of the loss using across all elements of the source vectors using the requested cost function.
     void ComputeLoss_Derivative(LossFunctions lossFunction, const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output);
 
-    //! Computes the derivative of the rectified linear unit function (ReLU) applied to all elements of the source vector.
+    //! Computes the derivative of the mean squared error with respect to the actual outputs.
     void MeanSquaredError_Derivative(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output);
+
+    //! Computes the categorical cross-entropy -sum(expected * log(actual)), where actual is a probability distribution.
+    void CategoricalCrossEntropy(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output);
+
+    //! Computes the derivative of the categorical cross-entropy with respect to the actual outputs.
+    //! This is only used if the final layer is not a softmax, in which case prefer SoftmaxCrossEntropy_Derivative.
+    void CategoricalCrossEntropy_Derivative(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output);
+
+    //! Returns true if the derivative of the loss function and the final layer's activation function are computed together.
+    //! In this case the loss gradient is taken with respect to the activation input and the activation derivative must be skipped.
+    bool IsLossFusedWithActivation(LossFunctions lossFunction, ActivationFunctions activationFunction);
+
+    //! Computes the derivative of categorical cross-entropy applied to a softmax output with respect to the softmax input.
+    //! The softmax Jacobian and the cross-entropy derivative cancel to simply actual - expected, which is both faster and more numerically stable.
+    void SoftmaxCrossEntropy_Derivative(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output);
 }
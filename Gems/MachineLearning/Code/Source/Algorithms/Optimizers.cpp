@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Algorithms/Optimizers.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/math.h>
+
+namespace MachineLearning
+{
+    namespace
+    {
+        //! Splatted constants shared by every element of a single optimizer step.
+        struct OptimizerConstants
+        {
+            AZ::Simd::Vec4::FloatType m_learningRate;
+            AZ::Simd::Vec4::FloatType m_beta1;
+            AZ::Simd::Vec4::FloatType m_oneMinusBeta1;
+            AZ::Simd::Vec4::FloatType m_beta2;
+            AZ::Simd::Vec4::FloatType m_oneMinusBeta2;
+            AZ::Simd::Vec4::FloatType m_epsilon;
+        };
+
+        OptimizerConstants MakeConstants(const OptimizerParameters& optimizer, float learningRate, AZStd::size_t step)
+        {
+            float epsilon = optimizer.m_epsilon;
+            if (optimizer.m_optimizer == OptimizerFunctions::Adam)
+            {
+                // Fold the bias correction of both moments into the step size and epsilon so the per-element update needs no extra work
+                const float exponent = static_cast<float>(step);
+                const float firstCorrection = 1.0f - AZStd::pow(optimizer.m_beta1, exponent);
+                const float secondCorrection = AZStd::sqrt(1.0f - AZStd::pow(optimizer.m_beta2, exponent));
+                learningRate *= secondCorrection / firstCorrection;
+                epsilon *= secondCorrection;
+            }
+
+            OptimizerConstants constants;
+            constants.m_learningRate = AZ::Simd::Vec4::Splat(learningRate);
+            constants.m_beta1 = AZ::Simd::Vec4::Splat(optimizer.m_beta1);
+            constants.m_oneMinusBeta1 = AZ::Simd::Vec4::Splat(1.0f - optimizer.m_beta1);
+            constants.m_beta2 = AZ::Simd::Vec4::Splat(optimizer.m_beta2);
+            constants.m_oneMinusBeta2 = AZ::Simd::Vec4::Splat(1.0f - optimizer.m_beta2);
+            constants.m_epsilon = AZ::Simd::Vec4::Splat(epsilon);
+            return constants;
+        }
+
+        //! Updates four parameters in place from their gradients, and resets the gradients to zero.
+        template <OptimizerFunctions Optimizer>
+        AZ_FORCE_INLINE void OptimizeElement
+        (
+            const OptimizerConstants& constants,
+            AZ::Simd::Vec4::FloatType& value,
+            AZ::Simd::Vec4::FloatType& gradient,
+            [[maybe_unused]] AZ::Simd::Vec4::FloatType* firstMoment,
+            [[maybe_unused]] AZ::Simd::Vec4::FloatType* secondMoment
+        )
+        {
+            if constexpr (Optimizer == OptimizerFunctions::StochasticGradientDescent)
+            {
+                // value -= learningRate * gradient
+                value = AZ::Simd::Vec4::Sub(value, AZ::Simd::Vec4::Mul(constants.m_learningRate, gradient));
+            }
+            else if constexpr (Optimizer == OptimizerFunctions::Momentum)
+            {
+                // velocity = beta1 * velocity + gradient, value -= learningRate * velocity
+                *firstMoment = AZ::Simd::Vec4::Madd(constants.m_beta1, *firstMoment, gradient);
+                value = AZ::Simd::Vec4::Sub(value, AZ::Simd::Vec4::Mul(constants.m_learningRate, *firstMoment));
+            }
+            else if constexpr (Optimizer == OptimizerFunctions::RMSProp)
+            {
+                // meanSquare = beta2 * meanSquare + (1 - beta2) * gradient^2, value -= learningRate * gradient / (sqrt(meanSquare) + epsilon)
+                *secondMoment = AZ::Simd::Vec4::Madd(constants.m_beta2, *secondMoment, AZ::Simd::Vec4::Mul(constants.m_oneMinusBeta2, AZ::Simd::Vec4::Mul(gradient, gradient)));
+                const AZ::Simd::Vec4::FloatType denominator = AZ::Simd::Vec4::Add(AZ::Simd::Vec4::Sqrt(*secondMoment), constants.m_epsilon);
+                value = AZ::Simd::Vec4::Sub(value, AZ::Simd::Vec4::Div(AZ::Simd::Vec4::Mul(constants.m_learningRate, gradient), denominator));
+            }
+            else if constexpr (Optimizer == OptimizerFunctions::Adam)
+            {
+                // The bias corrections have already been folded into the learning rate and epsilon
+                *firstMoment = AZ::Simd::Vec4::Madd(constants.m_beta1, *firstMoment, AZ::Simd::Vec4::Mul(constants.m_oneMinusBeta1, gradient));
+                *secondMoment = AZ::Simd::Vec4::Madd(constants.m_beta2, *secondMoment, AZ::Simd::Vec4::Mul(constants.m_oneMinusBeta2, AZ::Simd::Vec4::Mul(gradient, gradient)));
+                const AZ::Simd::Vec4::FloatType denominator = AZ::Simd::Vec4::Add(AZ::Simd::Vec4::Sqrt(*secondMoment), constants.m_epsilon);
+                value = AZ::Simd::Vec4::Sub(value, AZ::Simd::Vec4::Div(AZ::Simd::Vec4::Mul(constants.m_learningRate, *firstMoment), denominator));
+            }
+            gradient = AZ::Simd::Vec4::ZeroFloat();
+        }
+
+        template <OptimizerFunctions Optimizer>
+        void OptimizeMatrix(const OptimizerConstants& constants, AZ::MatrixMxN& values, AZ::MatrixMxN& gradients, AZ::MatrixMxN& firstMoments, AZ::MatrixMxN& secondMoments)
+        {
+            constexpr bool usesFirstMoment = (Optimizer == OptimizerFunctions::Momentum) || (Optimizer == OptimizerFunctions::Adam);
+            constexpr bool usesSecondMoment = (Optimizer == OptimizerFunctions::RMSProp) || (Optimizer == OptimizerFunctions::Adam);
+
+            AZStd::vector<AZ::Matrix4x4>& valueElements = values.GetMatrixElements();
+            AZStd::vector<AZ::Matrix4x4>& gradientElements = gradients.GetMatrixElements();
+            for (AZStd::size_t iter = 0; iter < valueElements.size(); ++iter)
+            {
+                AZ::Simd::Vec4::FloatType* value = valueElements[iter].GetSimdValues();
+                AZ::Simd::Vec4::FloatType* gradient = gradientElements[iter].GetSimdValues();
+                AZ::Simd::Vec4::FloatType* firstMoment = usesFirstMoment ? firstMoments.GetMatrixElements()[iter].GetSimdValues() : nullptr;
+                AZ::Simd::Vec4::FloatType* secondMoment = usesSecondMoment ? secondMoments.GetMatrixElements()[iter].GetSimdValues() : nullptr;
+                for (AZStd::size_t column = 0; column < 4; ++column)
+                {
+                    OptimizeElement<Optimizer>
+                    (
+                        constants,
+                        value[column],
+                        gradient[column],
+                        usesFirstMoment ? firstMoment + column : nullptr,
+                        usesSecondMoment ? secondMoment + column : nullptr
+                    );
+                }
+            }
+        }
+
+        template <OptimizerFunctions Optimizer>
+        void OptimizeVector(const OptimizerConstants& constants, AZ::VectorN& values, AZ::VectorN& gradients, AZ::VectorN& firstMoments, AZ::VectorN& secondMoments)
+        {
+            constexpr bool usesFirstMoment = (Optimizer == OptimizerFunctions::Momentum) || (Optimizer == OptimizerFunctions::Adam);
+            constexpr bool usesSecondMoment = (Optimizer == OptimizerFunctions::RMSProp) || (Optimizer == OptimizerFunctions::Adam);
+
+            AZStd::vector<AZ::Vector4>& valueElements = values.GetVectorValues();
+            AZStd::vector<AZ::Vector4>& gradientElements = gradients.GetVectorValues();
+            for (AZStd::size_t iter = 0; iter < valueElements.size(); ++iter)
+            {
+                AZ::Simd::Vec4::FloatType value = valueElements[iter].GetSimdValue();
+                AZ::Simd::Vec4::FloatType gradient = gradientElements[iter].GetSimdValue();
+                AZ::Simd::Vec4::FloatType firstMoment = usesFirstMoment ? firstMoments.GetVectorValues()[iter].GetSimdValue() : AZ::Simd::Vec4::ZeroFloat();
+                AZ::Simd::Vec4::FloatType secondMoment = usesSecondMoment ? secondMoments.GetVectorValues()[iter].GetSimdValue() : AZ::Simd::Vec4::ZeroFloat();
+                OptimizeElement<Optimizer>(constants, value, gradient, &firstMoment, &secondMoment);
+                valueElements[iter].SetSimdValue(value);
+                gradientElements[iter].SetSimdValue(gradient);
+                if constexpr (usesFirstMoment)
+                {
+                    firstMoments.GetVectorValues()[iter].SetSimdValue(firstMoment);
+                }
+                if constexpr (usesSecondMoment)
+                {
+                    secondMoments.GetVectorValues()[iter].SetSimdValue(secondMoment);
+                }
+            }
+        }
+    }
+
+    void ApplyOptimizer(const OptimizerParameters& optimizer, float learningRate, AZStd::size_t step, AZ::MatrixMxN& values, AZ::MatrixMxN& gradients, AZ::MatrixMxN& firstMoments, AZ::MatrixMxN& secondMoments)
+    {
+        AZ_Assert(values.GetRowCount() == gradients.GetRowCount() && values.GetColumnCount() == gradients.GetColumnCount(), "The dimensionality of values and gradients must match");
+        const OptimizerConstants constants = MakeConstants(optimizer, learningRate, step);
+        switch (optimizer.m_optimizer)
+        {
+        case OptimizerFunctions::StochasticGradientDescent:
+            OptimizeMatrix<OptimizerFunctions::StochasticGradientDescent>(constants, values, gradients, firstMoments, secondMoments);
+            break;
+        case OptimizerFunctions::Momentum:
+            OptimizeMatrix<OptimizerFunctions::Momentum>(constants, values, gradients, firstMoments, secondMoments);
+            break;
+        case OptimizerFunctions::RMSProp:
+            OptimizeMatrix<OptimizerFunctions::RMSProp>(constants, values, gradients, firstMoments, secondMoments);
+            break;
+        case OptimizerFunctions::Adam:
+            OptimizeMatrix<OptimizerFunctions::Adam>(constants, values, gradients, firstMoments, secondMoments);
+            break;
+        }
+    }
+
+    void ApplyOptimizer(const OptimizerParameters& optimizer, float learningRate, AZStd::size_t step, AZ::VectorN& values, AZ::VectorN& gradients, AZ::VectorN& firstMoments, AZ::VectorN& secondMoments)
+    {
+        AZ_Assert(values.GetDimensionality() == gradients.GetDimensionality(), "The dimensionality of values and gradients must match");
+        const OptimizerConstants constants = MakeConstants(optimizer, learningRate, step);
+        switch (optimizer.m_optimizer)
+        {
+        case OptimizerFunctions::StochasticGradientDescent:
+            OptimizeVector<OptimizerFunctions::StochasticGradientDescent>(constants, values, gradients, firstMoments, secondMoments);
+            break;
+        case OptimizerFunctions::Momentum:
+            OptimizeVector<OptimizerFunctions::Momentum>(constants, values, gradients, firstMoments, secondMoments);
+            break;
+        case OptimizerFunctions::RMSProp:
+            OptimizeVector<OptimizerFunctions::RMSProp>(constants, values, gradients, firstMoments, secondMoments);
+            break;
+        case OptimizerFunctions::Adam:
+            OptimizeVector<OptimizerFunctions::Adam>(constants, values, gradients, firstMoments, secondMoments);
+            break;
+        }
+    }
+}
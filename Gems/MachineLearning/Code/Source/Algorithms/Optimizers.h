@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <MachineLearning/Types.h>
+#include <AzCore/Math/VectorN.h>
+#include <AzCore/Math/MatrixMxN.h>
+
+namespace MachineLearning
+{
+    //! Applies a single optimizer step to a set of model parameters using the accumulated gradients.
+    //! The parameters, optimizer moments and gradients are all updated in a single fused pass, the gradients are reset to zero for the next accumulation pass.
+    //! The moments are only read when the optimizer requires them, and may be empty for plain stochastic gradient descent.
+    void ApplyOptimizer(const OptimizerParameters& optimizer, float learningRate, AZStd::size_t step, AZ::MatrixMxN& values, AZ::MatrixMxN& gradients, AZ::MatrixMxN& firstMoments, AZ::MatrixMxN& secondMoments);
+
+    //! Applies a single optimizer step to a set of model parameters using the accumulated gradients.
+    //! The parameters, optimizer moments and gradients are all updated in a single fused pass, the gradients are reset to zero for the next accumulation pass.
+    //! The moments are only read when the optimizer requires them, and may be empty for plain stochastic gradient descent.
+    void ApplyOptimizer(const OptimizerParameters& optimizer, float learningRate, AZStd::size_t step, AZ::VectorN& values, AZ::VectorN& gradients, AZ::VectorN& firstMoments, AZ::VectorN& secondMoments);
+}
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Algorithms/QuantizedOperations.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   include <immintrin.h>
+#   if defined(AZ_COMPILER_MSVC)
+#       include <intrin.h>
+        // MSVC permits intrinsics for any instruction set without per-function target attributes
+#       define ML_TARGET_SSSE3
+#       define ML_TARGET_AVX2
+#   else
+#       define ML_TARGET_SSSE3 __attribute__((target("ssse3")))
+#       define ML_TARGET_AVX2 __attribute__((target("avx2")))
+#   endif
+#endif
+
+namespace MachineLearning
+{
+    AZStd::size_t GetPaddedQuantizedSize(AZStd::size_t elementCount)
+    {
+        return ((elementCount + QuantizedRowAlignment - 1) / QuantizedRowAlignment) * QuantizedRowAlignment;
+    }
+
+    static int8_t QuantizeValue(float value, float inverseScale)
+    {
+        const int32_t quantized = static_cast<int32_t>(AZStd::round(value * inverseScale));
+        return static_cast<int8_t>(AZStd::clamp(quantized, -QuantizedMaxValue, QuantizedMaxValue));
+    }
+
+    void QuantizeMatrix(const AZ::MatrixMxN& source, AZStd::size_t paddedColumns, AZStd::vector<int8_t>& weights, AZStd::vector<float>& scales)
+    {
+        const AZStd::size_t rowCount = source.GetRowCount();
+        const AZStd::size_t colCount = source.GetColumnCount();
+        AZ_Assert(paddedColumns >= colCount, "Padded column count must be at least the column count of the source matrix");
+        weights.assign(rowCount * paddedColumns, 0);
+        scales.resize(rowCount);
+        for (AZStd::size_t row = 0; row < rowCount; ++row)
+        {
+            float maxMagnitude = 0.0f;
+            for (AZStd::size_t col = 0; col < colCount; ++col)
+            {
+                maxMagnitude = AZStd::max(maxMagnitude, AZStd::abs(source.GetElement(row, col)));
+            }
+
+            // An all zero row quantizes to zeros regardless of scale, so any non-zero scale will do
+            const float scale = (maxMagnitude > 0.0f) ? maxMagnitude / QuantizedMaxValue : 1.0f;
+            const float inverseScale = 1.0f / scale;
+            scales[row] = scale;
+            int8_t* rowWeights = weights.data() + row * paddedColumns;
+            for (AZStd::size_t col = 0; col < colCount; ++col)
+            {
+                rowWeights[col] = QuantizeValue(source.GetElement(row, col), inverseScale);
+            }
+        }
+    }
+
+    float QuantizeVector(const AZ::VectorN& source, AZStd::size_t paddedSize, AZStd::vector<int8_t>& output)
+    {
+        const AZStd::size_t dimensionality = source.GetDimensionality();
+        AZ_Assert(paddedSize >= dimensionality, "Padded size must be at least the dimensionality of the source vector");
+
+        // The unused trailing elements of a VectorN are always zero, so it's safe to include them in the magnitude computation
+        AZ::Vector4 maxMagnitude = AZ::Vector4::CreateZero();
+        for (const AZ::Vector4& element : source.GetVectorValues())
+        {
+            maxMagnitude = maxMagnitude.GetMax(element.GetAbs());
+        }
+        const float magnitude = AZStd::max(AZStd::max(maxMagnitude.GetX(), maxMagnitude.GetY()), AZStd::max(maxMagnitude.GetZ(), maxMagnitude.GetW()));
+        const float scale = (magnitude > 0.0f) ? magnitude / QuantizedMaxValue : 1.0f;
+        const float inverseScale = 1.0f / scale;
+
+        output.resize(paddedSize);
+        for (AZStd::size_t iter = 0; iter < dimensionality; ++iter)
+        {
+            output[iter] = QuantizeValue(source.GetElement(iter), inverseScale);
+        }
+        AZStd::fill(output.begin() + dimensionality, output.end(), int8_t(0));
+        return scale;
+    }
+
+    int32_t DotProductInt8_Scalar(const int8_t* lhs, const int8_t* rhs, AZStd::size_t count)
+    {
+        int32_t result = 0;
+        for (AZStd::size_t iter = 0; iter < count; ++iter)
+        {
+            result += static_cast<int32_t>(lhs[iter]) * static_cast<int32_t>(rhs[iter]);
+        }
+        return result;
+    }
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+    // pmaddubsw multiplies unsigned bytes by signed bytes, so the sign of lhs is moved onto rhs and the magnitude of lhs is used instead.
+    // As both operands are limited to [-127, 127], each pair of products sums to at most 32258 and the int16 intermediates never saturate.
+    ML_TARGET_SSSE3 static int32_t DotProductInt8_SSSE3(const int8_t* lhs, const int8_t* rhs, AZStd::size_t count)
+    {
+        const __m128i ones = _mm_set1_epi16(1);
+        __m128i accumulator = _mm_setzero_si128();
+        for (AZStd::size_t iter = 0; iter < count; iter += 16)
+        {
+            const __m128i lhsValues = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + iter));
+            const __m128i rhsValues = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + iter));
+            const __m128i products = _mm_maddubs_epi16(_mm_sign_epi8(lhsValues, lhsValues), _mm_sign_epi8(rhsValues, lhsValues));
+            accumulator = _mm_add_epi32(accumulator, _mm_madd_epi16(products, ones));
+        }
+        accumulator = _mm_add_epi32(accumulator, _mm_shuffle_epi32(accumulator, _MM_SHUFFLE(1, 0, 3, 2)));
+        accumulator = _mm_add_epi32(accumulator, _mm_shuffle_epi32(accumulator, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(accumulator);
+    }
+
+    ML_TARGET_AVX2 static int32_t DotProductInt8_AVX2(const int8_t* lhs, const int8_t* rhs, AZStd::size_t count)
+    {
+        const __m256i ones = _mm256_set1_epi16(1);
+        __m256i accumulator = _mm256_setzero_si256();
+        for (AZStd::size_t iter = 0; iter < count; iter += 32)
+        {
+            const __m256i lhsValues = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + iter));
+            const __m256i rhsValues = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + iter));
+            const __m256i products = _mm256_maddubs_epi16(_mm256_sign_epi8(lhsValues, lhsValues), _mm256_sign_epi8(rhsValues, lhsValues));
+            accumulator = _mm256_add_epi32(accumulator, _mm256_madd_epi16(products, ones));
+        }
+        __m128i reduced = _mm_add_epi32(_mm256_castsi256_si128(accumulator), _mm256_extracti128_si256(accumulator, 1));
+        reduced = _mm_add_epi32(reduced, _mm_shuffle_epi32(reduced, _MM_SHUFFLE(1, 0, 3, 2)));
+        reduced = _mm_add_epi32(reduced, _mm_shuffle_epi32(reduced, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(reduced);
+    }
+
+    static bool IsSsse3Supported()
+    {
+#if defined(AZ_COMPILER_MSVC)
+        int cpuInfo[4];
+        __cpuid(cpuInfo, 1);
+        return (cpuInfo[2] & (1 << 9)) != 0;
+#else
+        return __builtin_cpu_supports("ssse3");
+#endif
+    }
+
+    static bool IsAvx2Supported()
+    {
+#if defined(AZ_COMPILER_MSVC)
+        int cpuInfo[4];
+        __cpuid(cpuInfo, 0);
+        if (cpuInfo[0] < 7)
+        {
+            return false;
+        }
+
+        // The OS must also preserve the ymm registers across context switches
+        __cpuid(cpuInfo, 1);
+        const bool osxsave = (cpuInfo[2] & (1 << 27)) != 0;
+        if (!osxsave || ((_xgetbv(0) & 0x6) != 0x6))
+        {
+            return false;
+        }
+        __cpuidex(cpuInfo, 7, 0);
+        return (cpuInfo[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+#endif
+
+    using DotProductInt8Function = int32_t(*)(const int8_t*, const int8_t*, AZStd::size_t);
+
+    struct Int8Kernel
+    {
+        DotProductInt8Function m_function = &DotProductInt8_Scalar;
+        const char* m_name = "Scalar";
+    };
+
+    static const Int8Kernel& GetInt8Kernel()
+    {
+        static const Int8Kernel kernel = []()
+        {
+            Int8Kernel result;
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            if (IsAvx2Supported())
+            {
+                result.m_function = &DotProductInt8_AVX2;
+                result.m_name = "AVX2";
+            }
+            else if (IsSsse3Supported())
+            {
+                result.m_function = &DotProductInt8_SSSE3;
+                result.m_name = "SSSE3";
+            }
+#endif
+            return result;
+        }();
+        return kernel;
+    }
+
+    int32_t DotProductInt8(const int8_t* lhs, const int8_t* rhs, AZStd::size_t count)
+    {
+        AZ_Assert((count % QuantizedRowAlignment) == 0, "Int8 dot products require padded inputs");
+        return GetInt8Kernel().m_function(lhs, rhs, count);
+    }
+
+    const char* GetInt8KernelName()
+    {
+        return GetInt8Kernel().m_name;
+    }
+
+    void QuantizedVectorMatrixMultiply
+    (
+        const AZStd::vector<int8_t>& weights,
+        const AZStd::vector<float>& rowScales,
+        AZStd::size_t paddedColumns,
+        const AZStd::vector<int8_t>& input,
+        float inputScale,
+        AZ::VectorN& output
+    )
+    {
+        const AZStd::size_t rowCount = rowScales.size();
+        AZ_Assert(output.GetDimensionality() == rowCount, "Output dimensionality must match the row count of the matrix");
+        AZ_Assert(input.size() == paddedColumns, "Input must be padded to the padded column count of the matrix");
+        const DotProductInt8Function dotProduct = GetInt8Kernel().m_function;
+
+        // Process four rows at a time so the dequantized results can be written as a single Vector4
+        AZStd::vector<AZ::Vector4>& outputValues = output.GetVectorValues();
+        for (AZStd::size_t rowGroup = 0; rowGroup < outputValues.size(); ++rowGroup)
+        {
+            float results[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            const AZStd::size_t firstRow = rowGroup * 4;
+            const AZStd::size_t rowEnd = AZStd::min(firstRow + 4, rowCount);
+            for (AZStd::size_t row = firstRow; row < rowEnd; ++row)
+            {
+                const int32_t dot = dotProduct(weights.data() + row * paddedColumns, input.data(), paddedColumns);
+                results[row - firstRow] = static_cast<float>(dot) * rowScales[row] * inputScale;
+            }
+            outputValues[rowGroup] += AZ::Vector4::CreateFromFloat4(results);
+        }
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/VectorN.h>
+#include <AzCore/Math/MatrixMxN.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace MachineLearning
+{
+    //! Quantized rows are padded to a multiple of this many elements so the SIMD kernels never need to handle a remainder.
+    static constexpr AZStd::size_t QuantizedRowAlignment = 32;
+
+    //! Quantized values are symmetric and limited to [-127, 127], which keeps every pairwise product sum within int16 range for pmaddubsw.
+    static constexpr int32_t QuantizedMaxValue = 127;
+
+    //! Returns the number of elements a quantized row of the provided length occupies, including padding.
+    AZStd::size_t GetPaddedQuantizedSize(AZStd::size_t elementCount);
+
+    //! Quantizes each row of the source matrix to int8 using a separate scale per row (per output channel).
+    //! Rows are stored contiguously in weights, each padded with zeros to paddedColumns elements.
+    void QuantizeMatrix(const AZ::MatrixMxN& source, AZStd::size_t paddedColumns, AZStd::vector<int8_t>& weights, AZStd::vector<float>& scales);
+
+    //! Quantizes a vector to int8 using a single scale, the output is padded with zeros to paddedSize elements.
+    //! @return the scale which maps quantized values back to their original range
+    float QuantizeVector(const AZ::VectorN& source, AZStd::size_t paddedSize, AZStd::vector<int8_t>& output);
+
+    //! Computes the dot product of two int8 vectors, count must be a multiple of QuantizedRowAlignment.
+    //! This dispatches to the fastest kernel supported by the executing processor.
+    int32_t DotProductInt8(const int8_t* lhs, const int8_t* rhs, AZStd::size_t count);
+
+    //! Portable reference implementation of DotProductInt8.
+    int32_t DotProductInt8_Scalar(const int8_t* lhs, const int8_t* rhs, AZStd::size_t count);
+
+    //! Returns the name of the int8 kernel selected for the executing processor.
+    const char* GetInt8KernelName();
+
+    //! Computes output += dequantize(weights * input) for a quantized row-major matrix and a quantized vector.
+    //! This is the int8 equivalent of AZ::VectorMatrixMultiply, output must already be sized to the row count of the matrix.
+    void QuantizedVectorMatrixMultiply
+    (
+        const AZStd::vector<int8_t>& weights,
+        const AZStd::vector<float>& rowScales,
+        AZStd::size_t paddedColumns,
+        const AZStd::vector<int8_t>& input,
+        float inputScale,
+        AZ::VectorN& output
+    );
+}
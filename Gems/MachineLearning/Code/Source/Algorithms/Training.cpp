@@ -8,15 +8,22 @@
 
 #include <Algorithms/Training.h>
 #include <Algorithms/LossFunctions.h>
+#include <MachineLearning/IMachineLearning.h>
 #include <AzCore/Math/SimdMath.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/parallel/thread.h>
 #include <numeric>
 #include <random>
 
 namespace MachineLearning
 {
+    static double ToSeconds(AZStd::chrono::steady_clock::duration duration)
+    {
+        return AZStd::chrono::duration<double>(duration).count();
+    }
+
     SupervisedLearningCycle::SupervisedLearningCycle()
     {
         AZ::JobManagerDesc jobDesc;
@@ -24,6 +31,10 @@ namespace MachineLearning
         jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc()); // Just one thread
         m_trainingJobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
         m_trainingjobContext = AZStd::make_unique<AZ::JobContext>(*m_trainingJobManager);
+
+        // Leave a hardware thread for the training thread itself, which mostly waits on the workers
+        const AZStd::size_t hardwareThreads = AZStd::thread::hardware_concurrency();
+        m_workerCount = (hardwareThreads > 2) ? hardwareThreads - 1 : 1;
     }
 
     SupervisedLearningCycle::SupervisedLearningCycle
@@ -50,19 +61,177 @@ namespace MachineLearning
         m_earlyStopCost = earlyStopCost;
     }
 
+    SupervisedLearningCycle::~SupervisedLearningCycle()
+    {
+        StopTraining();
+        WaitForTrainingToStop();
+    }
+
     void SupervisedLearningCycle::InitializeContexts()
     {
+        AZ_Assert(!IsTrainingRunning(), "Contexts can't be reinitialized while the training job is using them");
         if (m_inferenceContext == nullptr)
         {
             m_inferenceContext.reset(m_model->CreateInferenceContext());
-            m_trainingContext.reset(m_model->CreateTrainingContext());
+        }
+        InitializeWorkers();
+    }
+
+    void SupervisedLearningCycle::InitializeWorkers()
+    {
+        const AZStd::size_t workerCount = AZStd::max<AZStd::size_t>(m_workerCount, 1);
+        if (m_workerTrainingContexts.size() == workerCount)
+        {
+            return;
+        }
+
+        m_workerJobContext.reset();
+        m_workerJobManager.reset();
+        if (workerCount > 1)
+        {
+            AZ::JobManagerDesc jobDesc;
+            jobDesc.m_jobManagerName = "MachineLearning Training Workers";
+            for (AZStd::size_t iter = 0; iter < workerCount; ++iter)
+            {
+                jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_workerJobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+            m_workerJobContext = AZStd::make_unique<AZ::JobContext>(*m_workerJobManager);
+        }
+
+        m_workerInferenceContexts.clear();
+        m_workerTrainingContexts.clear();
+        for (AZStd::size_t iter = 0; iter < workerCount; ++iter)
+        {
+            m_workerInferenceContexts.emplace_back(m_model->CreateInferenceContext());
+            m_workerTrainingContexts.emplace_back(m_model->CreateTrainingContext());
+        }
+    }
+
+    void SupervisedLearningCycle::ParallelFor(AZStd::size_t taskCount, const AZStd::function<void(AZStd::size_t)>& task)
+    {
+        if ((taskCount <= 1) || (m_workerJobContext == nullptr))
+        {
+            for (AZStd::size_t iter = 0; iter < taskCount; ++iter)
+            {
+                task(iter);
+            }
+            return;
+        }
+
+        AZ::JobCompletion completion(m_workerJobContext.get());
+        for (AZStd::size_t iter = 0; iter < taskCount; ++iter)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([&task, iter]() { task(iter); }, true, m_workerJobContext.get());
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        completion.StartAndWaitForCompletion();
+    }
+
+    void SupervisedLearningCycle::GetWorkerRange(AZStd::size_t worker, AZStd::size_t sampleCount, AZStd::size_t& first, AZStd::size_t& count) const
+    {
+        const AZStd::size_t workerCount = m_workerTrainingContexts.size();
+        const AZStd::size_t samplesPerWorker = (sampleCount + workerCount - 1) / workerCount;
+        first = AZStd::min(worker * samplesPerWorker, sampleCount);
+        count = AZStd::min(samplesPerWorker, sampleCount - first);
+    }
+
+    void SupervisedLearningCycle::GatherSamples(const ILabeledTrainingData& data, AZStd::size_t first, AZStd::size_t count)
+    {
+        m_batchIndices.resize(count);
+        std::iota(m_batchIndices.begin(), m_batchIndices.end(), first);
+        m_batchActivations.resize(count);
+        m_batchLabels.resize(count);
+        if (data.SupportsConcurrentBatches())
+        {
+            // The ranges match the ones the workers train on, so each worker dequantizes the samples it is about to use
+            ParallelFor(m_workerTrainingContexts.size(), [this, &data, count](AZStd::size_t worker)
+            {
+                AZStd::size_t workerFirst = 0;
+                AZStd::size_t workerCount = 0;
+                GetWorkerRange(worker, count, workerFirst, workerCount);
+                if (workerCount > 0)
+                {
+                    data.GetBatch
+                    (
+                        AZStd::span<const AZStd::size_t>(m_batchIndices).subspan(workerFirst, workerCount),
+                        AZStd::span<AZ::VectorN>(m_batchActivations).subspan(workerFirst, workerCount),
+                        AZStd::span<AZ::VectorN>(m_batchLabels).subspan(workerFirst, workerCount)
+                    );
+                }
+            });
+        }
+        else
+        {
+            data.GetBatch(m_batchIndices, m_batchActivations, m_batchLabels);
+        }
+
+        m_batchActivationPointers.resize(count);
+        m_batchLabelPointers.resize(count);
+        for (AZStd::size_t iter = 0; iter < count; ++iter)
+        {
+            m_batchActivationPointers[iter] = &m_batchActivations[iter];
+            m_batchLabelPointers[iter] = &m_batchLabels[iter];
+        }
+    }
+
+    void SupervisedLearningCycle::ReduceWorkerGradients()
+    {
+        // Pairwise tree reduction, each level halves the number of contexts holding gradients and all pairs within a level are reduced in parallel
+        const AZStd::size_t workerCount = m_workerTrainingContexts.size();
+        for (AZStd::size_t stride = 1; stride < workerCount; stride *= 2)
+        {
+            const AZStd::size_t pairStride = stride * 2;
+            ParallelFor((workerCount + pairStride - 1) / pairStride, [this, stride, pairStride, workerCount](AZStd::size_t pair)
+            {
+                const AZStd::size_t destination = pair * pairStride;
+                const AZStd::size_t source = destination + stride;
+                if (source < workerCount)
+                {
+                    m_model->ReduceGradients(m_workerTrainingContexts[destination].get(), m_workerTrainingContexts[source].get());
+                }
+            });
         }
     }
 
     void SupervisedLearningCycle::StartTraining()
     {
+        // A previous training job may still be finishing its last mini-batch after being stopped
+        StopTraining();
+        WaitForTrainingToStop();
+
+        // The quantized layers would go stale as the float layers are trained, so training runs at float precision
+        // This happens here rather than in the training job, as inference may be running on the main thread
+        if (m_model->GetInferencePrecision() == InferencePrecision::Int8)
+        {
+            AZStd::lock_guard modelLock(m_mutex);
+            m_model->SetInferencePrecision(InferencePrecision::Float);
+            if (m_model->GetInferencePrecision() == InferencePrecision::Int8)
+            {
+                AZLOG_ERROR("Model %s has no float layers and cannot be trained", m_model->GetName().c_str());
+                return;
+            }
+            m_restoreInt8Precision = true;
+        }
         InitializeContexts();
 
+        for (auto& trainingContext : m_workerTrainingContexts)
+        {
+            trainingContext->m_forwardTime = AZStd::chrono::steady_clock::duration::zero();
+            trainingContext->m_backwardTime = AZStd::chrono::steady_clock::duration::zero();
+        }
+
+        {
+            AZStd::lock_guard lock(m_metricsMutex);
+            m_metrics = TrainingMetrics();
+            m_metrics.m_workerCount = m_workerTrainingContexts.size();
+        }
+
+        // Apply ranges edited through m_first and m_last, GetBatch only reads the index tables of the views
+        m_trainData.SetRange(m_trainData.m_first, m_trainData.m_last);
+        m_testData.SetRange(m_testData.m_first, m_testData.m_last);
+
         // Start training
         m_currentEpoch = 0;
         m_trainingComplete = false;
@@ -72,9 +241,17 @@ namespace MachineLearning
             m_trainData.ShuffleSamples();
         }
 
+        {
+            AZStd::lock_guard lock(m_trainingRunningMutex);
+            m_trainingRunning = true;
+        }
+
         auto job = [this]()
         {
             ExecTraining();
+            AZStd::lock_guard lock(m_trainingRunningMutex);
+            m_trainingRunning = false;
+            m_trainingStopped.notify_all();
         };
         AZ::Job* trainingJob = AZ::CreateJobFunction(job, true, m_trainingjobContext.get());
         trainingJob->Start();
@@ -85,13 +262,66 @@ namespace MachineLearning
         m_trainingComplete = true;
     }
 
+    void SupervisedLearningCycle::WaitForTrainingToStop()
+    {
+        {
+            AZStd::unique_lock lock(m_trainingRunningMutex);
+            m_trainingStopped.wait(lock, [this]() { return !m_trainingRunning; });
+        }
+        CompleteTraining();
+    }
+
+    bool SupervisedLearningCycle::WaitForTrainingToStop(AZStd::chrono::milliseconds timeout)
+    {
+        bool stopped = false;
+        {
+            AZStd::unique_lock lock(m_trainingRunningMutex);
+            stopped = m_trainingStopped.wait_for(lock, timeout, [this]() { return !m_trainingRunning; });
+        }
+        if (stopped)
+        {
+            CompleteTraining();
+        }
+        return stopped;
+    }
+
+    void SupervisedLearningCycle::CompleteTraining()
+    {
+        if (!m_restoreInt8Precision || IsTrainingRunning())
+        {
+            return;
+        }
+
+        // The trained weights are quantized once, rather than after every gradient step
+        m_restoreInt8Precision = false;
+        AZStd::lock_guard modelLock(m_mutex);
+        m_model->SetInferencePrecision(InferencePrecision::Int8);
+    }
+
+    bool SupervisedLearningCycle::IsTrainingRunning() const
+    {
+        AZStd::lock_guard lock(m_trainingRunningMutex);
+        return m_trainingRunning;
+    }
+
+    TrainingMetrics SupervisedLearningCycle::GetMetrics() const
+    {
+        AZStd::lock_guard lock(m_metricsMutex);
+        return m_metrics;
+    }
+
     void SupervisedLearningCycle::ExecTraining()
     {
+        using Clock = AZStd::chrono::steady_clock;
+
         const AZStd::size_t totalTrainingSize = m_trainData.GetSampleCount();
+        Clock::duration epochTime = Clock::duration::zero();
         while (!m_trainingComplete)
         {
             if (m_currentIndex >= totalTrainingSize)
             {
+                const Clock::time_point evaluationStart = Clock::now();
+
                 // If we run out of training samples, we increment our epoch and reset for a new pass of the training data
                 m_currentIndex = 0;
                 m_learningRate *= m_learningRateDecay;
@@ -110,36 +340,172 @@ namespace MachineLearning
                 float currentTrainCost = ComputeCurrentCost(m_trainData, m_costFunction);
                 m_testCosts.PushBackItem(currentTestCost);
                 m_trainCosts.PushBackItem(currentTrainCost);
+                CompleteEpochMetrics(Clock::now() - evaluationStart);
                 if ((currentTestCost < m_earlyStopCost) || (m_currentEpoch >= m_totalIterations))
                 {
+                    // The metrics of the final epoch are left in place so they remain visible after training completes
                     m_trainingComplete = true;
                     return;
                 }
+                ResetEpochMetrics();
+                epochTime = Clock::duration::zero();
             }
 
-            for (uint32_t batch = 0; (batch < m_batchSize) && (m_currentIndex < totalTrainingSize); ++batch, ++m_currentIndex)
+            // Gather the mini-batch, then split it across the workers which each accumulate gradients into their own training context
+            const Clock::time_point gatherStart = Clock::now();
+            const AZStd::size_t batchSize = AZStd::min(m_batchSize, totalTrainingSize - m_currentIndex);
+            GatherSamples(m_trainData, m_currentIndex, batchSize);
+            m_currentIndex += batchSize;
+
+            const Clock::time_point gradientStart = Clock::now();
+            ParallelFor(m_workerTrainingContexts.size(), [this, batchSize](AZStd::size_t worker)
             {
-                const AZ::VectorN& activations = m_trainData.GetDataByIndex(m_currentIndex);
-                const AZ::VectorN& label = m_trainData.GetLabelByIndex(m_currentIndex);
-                m_model->Reverse(m_trainingContext.get(), m_costFunction, activations, label);
+                AZStd::size_t first = 0;
+                AZStd::size_t count = 0;
+                GetWorkerRange(worker, batchSize, first, count);
+                const AZStd::span<const AZ::VectorN* const> activations = m_batchActivationPointers;
+                const AZStd::span<const AZ::VectorN* const> labels = m_batchLabelPointers;
+                m_model->ReverseBatch(m_workerTrainingContexts[worker].get(), m_costFunction, activations.subspan(first, count), labels.subspan(first, count));
+            });
+
+            const Clock::time_point reduceStart = Clock::now();
+            ReduceWorkerGradients();
+
+            const Clock::time_point updateStart = Clock::now();
+            {
+                AZStd::lock_guard lock(m_mutex);
+                m_model->GradientDescent(m_workerTrainingContexts[0].get(), m_learningRate, m_optimizerParameters);
             }
-            AZStd::lock_guard lock(m_mutex);
-            m_model->GradientDescent(m_trainingContext.get(), m_learningRate);
+
+            const Clock::time_point updateEnd = Clock::now();
+            epochTime += updateEnd - gatherStart;
+            AccumulateBatchMetrics(batchSize, gradientStart - gatherStart, reduceStart - gradientStart, updateStart - reduceStart, updateEnd - updateStart, epochTime);
         }
     }
 
+    void SupervisedLearningCycle::AccumulateBatchMetrics
+    (
+        AZStd::size_t batchSize,
+        AZStd::chrono::steady_clock::duration gatherTime,
+        AZStd::chrono::steady_clock::duration gradientTime,
+        AZStd::chrono::steady_clock::duration reduceTime,
+        AZStd::chrono::steady_clock::duration updateTime,
+        AZStd::chrono::steady_clock::duration epochTime
+    )
+    {
+        // The workers have all completed by this point, so their timers can be read and reset from the training thread
+        AZStd::chrono::steady_clock::duration forwardTime = AZStd::chrono::steady_clock::duration::zero();
+        AZStd::chrono::steady_clock::duration backwardTime = AZStd::chrono::steady_clock::duration::zero();
+        for (auto& trainingContext : m_workerTrainingContexts)
+        {
+            forwardTime += trainingContext->m_forwardTime;
+            backwardTime += trainingContext->m_backwardTime;
+            trainingContext->m_forwardTime = AZStd::chrono::steady_clock::duration::zero();
+            trainingContext->m_backwardTime = AZStd::chrono::steady_clock::duration::zero();
+        }
+
+        AZStd::lock_guard lock(m_metricsMutex);
+        m_metrics.m_totalSamples += batchSize;
+        m_metrics.m_epochSamples += batchSize;
+        m_metrics.m_gatherTime += ToSeconds(gatherTime);
+        m_metrics.m_gradientTime += ToSeconds(gradientTime);
+        m_metrics.m_forwardTime += ToSeconds(forwardTime);
+        m_metrics.m_backwardTime += ToSeconds(backwardTime);
+        m_metrics.m_reduceTime += ToSeconds(reduceTime);
+        m_metrics.m_updateTime += ToSeconds(updateTime);
+        m_metrics.m_epochTime = ToSeconds(epochTime);
+        m_metrics.m_samplesPerSecond = (m_metrics.m_epochTime > 0.0) ? static_cast<double>(m_metrics.m_epochSamples) / m_metrics.m_epochTime : 0.0;
+    }
+
+    void SupervisedLearningCycle::CompleteEpochMetrics(AZStd::chrono::steady_clock::duration evaluationTime)
+    {
+        // Context memory is only sampled once per epoch, by which point every buffer has grown to its working size
+        AZStd::size_t inferenceContextMemory = 0;
+        AZStd::size_t trainingContextMemory = 0;
+        for (AZStd::size_t iter = 0; iter < m_workerTrainingContexts.size(); ++iter)
+        {
+            inferenceContextMemory += m_workerInferenceContexts[iter]->GetMemoryUsage();
+            trainingContextMemory += m_workerTrainingContexts[iter]->GetMemoryUsage();
+        }
+
+        TrainingMetrics completedMetrics;
+        {
+            AZStd::lock_guard lock(m_metricsMutex);
+            m_metrics.m_epoch = m_currentEpoch;
+            m_metrics.m_evaluationTime = ToSeconds(evaluationTime);
+            m_metrics.m_workerCount = m_workerTrainingContexts.size();
+            m_metrics.m_inferenceContextMemory = inferenceContextMemory / AZStd::max<AZStd::size_t>(m_workerInferenceContexts.size(), 1);
+            m_metrics.m_trainingContextMemory = trainingContextMemory / AZStd::max<AZStd::size_t>(m_workerTrainingContexts.size(), 1);
+            completedMetrics = m_metrics;
+        }
+
+        if (IMachineLearning* machineLearning = MachineLearningInterface::Get())
+        {
+            machineLearning->ReportTrainingMetrics(m_model, completedMetrics);
+        }
+    }
+
+    void SupervisedLearningCycle::ResetEpochMetrics()
+    {
+        AZStd::lock_guard lock(m_metricsMutex);
+        m_metrics.m_epochSamples = 0;
+        m_metrics.m_samplesPerSecond = 0.0;
+        m_metrics.m_epochTime = 0.0;
+        m_metrics.m_gatherTime = 0.0;
+        m_metrics.m_gradientTime = 0.0;
+        m_metrics.m_forwardTime = 0.0;
+        m_metrics.m_backwardTime = 0.0;
+        m_metrics.m_reduceTime = 0.0;
+        m_metrics.m_updateTime = 0.0;
+        m_metrics.m_evaluationTime = 0.0;
+    }
+
     float SupervisedLearningCycle::ComputeCurrentCost(ILabeledTrainingData& testData, LossFunctions costFunction)
     {
-        InitializeContexts();
+        // Samples are gathered in chunks and each chunk is then evaluated by all workers in parallel
+        static constexpr AZStd::size_t SamplesPerWorker = 64;
 
-        double result = 0.0;
         const AZStd::size_t totalTestSize = testData.GetSampleCount();
-        for (uint32_t iter = 0; iter < totalTestSize; ++iter)
+        if (totalTestSize == 0)
+        {
+            return 0.0f;
+        }
+
+        const AZStd::size_t workerCount = m_workerInferenceContexts.size();
+        const AZStd::size_t chunkSize = workerCount * SamplesPerWorker;
+        m_workerCosts.assign(workerCount, 0.0);
+        for (AZStd::size_t chunk = 0; chunk < totalTestSize; chunk += chunkSize)
+        {
+            const AZStd::size_t chunkCount = AZStd::min(chunkSize, totalTestSize - chunk);
+            GatherSamples(testData, chunk, chunkCount);
+            ParallelFor(workerCount, [this, chunkCount, costFunction](AZStd::size_t worker)
+            {
+                AZStd::size_t first = 0;
+                AZStd::size_t count = 0;
+                GetWorkerRange(worker, chunkCount, first, count);
+                if (count == 0)
+                {
+                    return;
+                }
+
+                IInferenceContextPtr context = m_workerInferenceContexts[worker].get();
+                const AZStd::span<const AZ::VectorN* const> activations = AZStd::span<const AZ::VectorN* const>(m_batchActivationPointers).subspan(first, count);
+                const AZStd::span<const AZ::VectorN* const> outputs = m_model->ForwardBatch(context, activations);
+                double cost = 0.0;
+                for (AZStd::size_t iter = 0; iter < count; ++iter)
+                {
+                    // Fall back to per-sample inference for models without a batched forward pass
+                    const AZ::VectorN* output = (outputs.size() == count) ? outputs[iter] : m_model->Forward(context, *activations[iter]);
+                    cost += static_cast<double>(ComputeTotalCost(costFunction, *m_batchLabelPointers[first + iter], *output));
+                }
+                m_workerCosts[worker] += cost;
+            });
+        }
+
+        double result = 0.0;
+        for (double cost : m_workerCosts)
         {
-            const AZ::VectorN& activations = testData.GetDataByIndex(iter);
-            const AZ::VectorN& label = testData.GetLabelByIndex(iter);
-            const AZ::VectorN* output = m_model->Forward(m_inferenceContext.get(), activations);
-            result += static_cast<double>(ComputeTotalCost(costFunction, label, *output));
+            result += cost;
         }
         result /= static_cast<double>(totalTestSize);
         return static_cast<float>(result);
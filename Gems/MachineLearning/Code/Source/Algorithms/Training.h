@@ -12,6 +12,10 @@
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/conditional_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/function/function_template.h>
 #include <MachineLearning/INeuralNetwork.h>
 #include <Assets/TrainingDataView.h>
 
@@ -41,11 +45,39 @@ namespace MachineLearning
             float earlyStopCost
         );
 
+        //! Stops training and waits for the training job to exit, as it uses the job managers and contexts owned by the cycle.
+        ~SupervisedLearningCycle();
+
+        //! Creates the inference context and the worker contexts.
+        //! This replaces contexts in use by the training job, so it must not be called while training is running.
         void InitializeContexts();
 
+        //! Starts training on the training job manager, waiting for any previous training job to exit first.
+        //! A model using int8 inference is switched to float precision for training, it is quantized again by CompleteTraining.
         void StartTraining();
+
+        //! Requests training to stop, this returns immediately and the training job exits after the mini-batch in progress.
         void StopTraining();
 
+        //! Blocks until the training job has exited, then calls CompleteTraining.
+        void WaitForTrainingToStop();
+
+        //! Blocks until the training job has exited or the timeout elapses, then calls CompleteTraining if the job exited.
+        //! @return true if the training job is no longer running
+        bool WaitForTrainingToStop(AZStd::chrono::milliseconds timeout);
+
+        //! Restores int8 inference precision once the training job has exited, quantizing the trained weights.
+        //! This runs on the calling thread rather than the training job so that it is never concurrent with inference issued from the main thread.
+        //! It does nothing while training is running, callers which poll IsTrainingRunning rather than waiting must call it once the job exits.
+        void CompleteTraining();
+
+        //! Returns true from StartTraining until the training job exits, which may be after m_trainingComplete is set.
+        bool IsTrainingRunning() const;
+
+        //! Returns the metrics of the epoch currently in progress, this is safe to call while training.
+        //! The metrics of each completed epoch are also reported to IMachineLearning.
+        TrainingMetrics GetMetrics() const;
+
         AZStd::atomic<AZStd::size_t> m_currentEpoch = 0;
         std::atomic<bool> m_trainingComplete = true;
 
@@ -62,20 +94,85 @@ namespace MachineLearning
         float m_learningRate = 0.0f;
         float m_learningRateDecay = 0.0f;
         float m_earlyStopCost = 0.0f;
+        OptimizerParameters m_optimizerParameters;
         AZStd::size_t m_currentIndex = 0;
         AZStd::unique_ptr<IInferenceContext> m_inferenceContext;
-        AZStd::unique_ptr<ITrainingContext> m_trainingContext;
+
+        //! The number of workers each mini-batch and each cost evaluation is split across.
+        //! Changes take effect the next time training is started.
+        AZStd::size_t m_workerCount = 1;
 
     private:
 
+        //! Creates the worker threads and the per-worker inference and training contexts.
+        void InitializeWorkers();
+
+        //! Invokes task(index) for every index in [0, taskCount) across the worker threads and waits for all of them to complete.
+        void ParallelFor(AZStd::size_t taskCount, const AZStd::function<void(AZStd::size_t)>& task);
+
+        //! Returns the range of samples out of sampleCount that the requested worker is responsible for.
+        void GetWorkerRange(AZStd::size_t worker, AZStd::size_t sampleCount, AZStd::size_t& first, AZStd::size_t& count) const;
+
+        //! Copies count samples starting at first into the batch buffers.
+        //! If the data supports concurrent batches, each worker gathers its own range of the batch, otherwise this runs on the calling thread.
+        void GatherSamples(const ILabeledTrainingData& data, AZStd::size_t first, AZStd::size_t count);
+
+        //! Tree-reduces the gradients of all workers into the training context of the first worker.
+        void ReduceWorkerGradients();
+
         //! Calculates the average cost of the provided model on the set of labeled test data using the requested loss function.
         float ComputeCurrentCost(ILabeledTrainingData& testData, LossFunctions costFunction);
         void ExecTraining();
 
+        //! Adds the timings of a single mini-batch to the metrics of the epoch in progress.
+        //! The epoch time is the total wall time spent training on the epoch so far.
+        void AccumulateBatchMetrics
+        (
+            AZStd::size_t batchSize,
+            AZStd::chrono::steady_clock::duration gatherTime,
+            AZStd::chrono::steady_clock::duration gradientTime,
+            AZStd::chrono::steady_clock::duration reduceTime,
+            AZStd::chrono::steady_clock::duration updateTime,
+            AZStd::chrono::steady_clock::duration epochTime
+        );
+
+        //! Records the evaluation time and context memory of the completed epoch and reports its metrics to IMachineLearning.
+        void CompleteEpochMetrics(AZStd::chrono::steady_clock::duration evaluationTime);
+
+        //! Clears the per-epoch values at the start of a new epoch, the totals are retained.
+        void ResetEpochMetrics();
+
+        //! Only ever written by the training thread, the mutex guards reads from other threads.
+        TrainingMetrics m_metrics;
+        mutable AZStd::mutex m_metricsMutex;
+
+        //! Each worker accumulates gradients and evaluates costs using its own contexts.
+        AZStd::vector<AZStd::unique_ptr<IInferenceContext>> m_workerInferenceContexts;
+        AZStd::vector<AZStd::unique_ptr<ITrainingContext>> m_workerTrainingContexts;
+        AZStd::vector<double> m_workerCosts;
+
+        //! Copies of the current mini-batch, as training data sources may reuse the storage of the vectors they return.
+        //! These are shared read-only by all workers.
+        AZStd::vector<AZ::VectorN> m_batchActivations;
+        AZStd::vector<AZ::VectorN> m_batchLabels;
+        AZStd::vector<const AZ::VectorN*> m_batchActivationPointers;
+        AZStd::vector<const AZ::VectorN*> m_batchLabelPointers;
+        AZStd::vector<AZStd::size_t> m_batchIndices;
+
         AZStd::unique_ptr<AZ::JobManager> m_trainingJobManager;
         AZStd::unique_ptr<AZ::JobContext> m_trainingjobContext;
+        AZStd::unique_ptr<AZ::JobManager> m_workerJobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_workerJobContext;
 
         //! Guards model state.
         mutable AZStd::recursive_mutex m_mutex;
+
+        //! Set by StartTraining if the model used int8 inference, cleared by CompleteTraining once it is restored.
+        bool m_restoreInt8Precision = false;
+
+        //! Set by StartTraining and cleared by the training job on exit.
+        bool m_trainingRunning = false;
+        mutable AZStd::mutex m_trainingRunningMutex;
+        AZStd::condition_variable m_trainingStopped;
     };
 }
@@ -0,0 +1,395 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Assets/FlatModelFormat.h>
+#include <Assets/ModelAsset.h>
+#include <Algorithms/Activations.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+
+namespace MachineLearning
+{
+    static constexpr AZStd::size_t FloatsPerBlock = 16;
+    static constexpr AZStd::size_t BytesPerBlock = FloatsPerBlock * sizeof(float);
+
+    static AZStd::size_t AlignOffset(AZStd::size_t offset)
+    {
+        return (offset + FlatModelAlignment - 1) & ~(FlatModelAlignment - 1);
+    }
+
+    static AZStd::size_t GetGroupCount(AZStd::size_t elements)
+    {
+        return (elements + 3) / 4;
+    }
+
+    // Returns true if [offset, offset + size) is an aligned range within a buffer of the provided size
+    static bool IsValidBlock(uint64_t offset, uint64_t size, AZStd::size_t bufferSize)
+    {
+        return (offset % FlatModelAlignment == 0) && (offset <= bufferSize) && (size <= bufferSize - offset);
+    }
+
+    // Computes the header and layer table for an asset, the returned size is the exact size of the file
+    static AZStd::size_t ComputeLayout(const ModelAsset& asset, FlatModelHeader& header, AZStd::vector<FlatLayerEntry>& entries)
+    {
+        header = FlatModelHeader();
+        header.m_activationCount = asset.m_activationCount;
+        header.m_layerCount = static_cast<uint32_t>(asset.m_layers.size());
+        header.m_quantizedLayerCount = static_cast<uint32_t>(asset.m_quantizedLayers.size());
+        entries.resize(asset.m_layers.size() + asset.m_quantizedLayers.size());
+
+        AZStd::size_t offset = sizeof(FlatModelHeader) + sizeof(FlatLayerEntry) * entries.size();
+        header.m_nameOffset = static_cast<uint32_t>(offset);
+        header.m_nameLength = static_cast<uint32_t>(asset.m_name.size());
+        offset = AlignOffset(offset + asset.m_name.size());
+
+        AZStd::size_t entryIndex = 0;
+        for (const Layer& layer : asset.m_layers)
+        {
+            FlatLayerEntry& entry = entries[entryIndex++];
+            entry.m_activationFunction = static_cast<uint32_t>(layer.m_activationFunction);
+            entry.m_inputSize = static_cast<uint32_t>(layer.m_inputSize);
+            entry.m_outputSize = static_cast<uint32_t>(layer.m_outputSize);
+            entry.m_weightOffset = offset;
+            entry.m_weightSize = GetGroupCount(layer.m_outputSize) * GetGroupCount(layer.m_inputSize) * BytesPerBlock;
+            offset += entry.m_weightSize;
+            entry.m_biasOffset = offset;
+            offset = AlignOffset(offset + GetGroupCount(layer.m_outputSize) * 4 * sizeof(float));
+        }
+
+        for (const QuantizedLayer& layer : asset.m_quantizedLayers)
+        {
+            FlatLayerEntry& entry = entries[entryIndex++];
+            entry.m_activationFunction = static_cast<uint32_t>(layer.m_activationFunction);
+            entry.m_inputSize = static_cast<uint32_t>(layer.m_inputSize);
+            entry.m_outputSize = static_cast<uint32_t>(layer.m_outputSize);
+            entry.m_paddedInputSize = static_cast<uint32_t>(layer.m_paddedInputSize);
+            entry.m_weightOffset = offset;
+            entry.m_weightSize = layer.m_weights.size();
+            offset = AlignOffset(offset + entry.m_weightSize);
+            entry.m_scaleOffset = offset;
+            offset = AlignOffset(offset + layer.m_outputSize * sizeof(float));
+            entry.m_biasOffset = offset;
+            offset = AlignOffset(offset + GetGroupCount(layer.m_outputSize) * 4 * sizeof(float));
+        }
+
+        header.m_fileSize = offset;
+        return offset;
+    }
+
+    static void WriteBiases(const AZ::VectorN& biases, uint8_t* output)
+    {
+        float* values = reinterpret_cast<float*>(output);
+        for (const AZ::Vector4& element : biases.GetVectorValues())
+        {
+            element.StoreToFloat4(values);
+            values += 4;
+        }
+    }
+
+    static void ReadBiases(const float* values, AZStd::size_t dimensionality, AZ::VectorN& biases)
+    {
+        biases.Resize(dimensionality);
+        for (AZ::Vector4& element : biases.GetVectorValues())
+        {
+            element = AZ::Vector4::CreateFromFloat4(values);
+            values += 4;
+        }
+        biases.FixLastVectorElement();
+    }
+
+    void FlatLayerView::Evaluate(const AZ::VectorN& activations, AZ::VectorN& output) const
+    {
+        AZ_Assert(activations.GetDimensionality() == m_inputSize, "The activation dimensionality does not match the layer input size");
+        output.Resize(m_outputSize);
+
+        const AZStd::vector<AZ::Vector4>& inputValues = activations.GetVectorValues();
+        AZStd::vector<AZ::Vector4>& outputValues = output.GetVectorValues();
+        for (AZStd::size_t rowIter = 0; rowIter < m_rowGroups; ++rowIter)
+        {
+            AZ::Simd::Vec4::FloatType accumulator = AZ::Simd::Vec4::LoadUnaligned(m_biases + rowIter * 4);
+            const float* blockRow = m_weights + rowIter * m_columnGroups * FloatsPerBlock;
+            for (AZStd::size_t colIter = 0; colIter < m_columnGroups; ++colIter)
+            {
+                // Each block holds four columns of four floats, matching the simd layout of AZ::Matrix4x4
+                const float* block = blockRow + colIter * FloatsPerBlock;
+                const AZ::Simd::Vec4::FloatType element = inputValues[colIter].GetSimdValue();
+                const AZ::Simd::Vec4::FloatType partial01 = AZ::Simd::Vec4::Madd(AZ::Simd::Vec4::LoadUnaligned(block), AZ::Simd::Vec4::SplatIndex0(element), AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::LoadUnaligned(block + 4), AZ::Simd::Vec4::SplatIndex1(element)));
+                const AZ::Simd::Vec4::FloatType partial23 = AZ::Simd::Vec4::Madd(AZ::Simd::Vec4::LoadUnaligned(block + 8), AZ::Simd::Vec4::SplatIndex2(element), AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::LoadUnaligned(block + 12), AZ::Simd::Vec4::SplatIndex3(element)));
+                accumulator = AZ::Simd::Vec4::Add(accumulator, AZ::Simd::Vec4::Add(partial01, partial23));
+            }
+            outputValues[rowIter].SetSimdValue(accumulator);
+        }
+        output.FixLastVectorElement();
+        Activate(m_activationFunction, output, output);
+    }
+
+    const AZ::VectorN& FlatLayerView::Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations) const
+    {
+        Evaluate(activations, inferenceData.m_output);
+        return inferenceData.m_output;
+    }
+
+    AZStd::span<const AZ::VectorN* const> FlatLayerView::ForwardBatch(LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN* const> activations) const
+    {
+        inferenceData.m_batchOutput.resize(activations.size());
+        inferenceData.m_batchOutputPointers.resize(activations.size());
+        for (AZStd::size_t iter = 0; iter < activations.size(); ++iter)
+        {
+            Evaluate(*activations[iter], inferenceData.m_batchOutput[iter]);
+            inferenceData.m_batchOutputPointers[iter] = &inferenceData.m_batchOutput[iter];
+        }
+        return inferenceData.m_batchOutputPointers;
+    }
+
+    bool FlatModelView::HasFlatModelTag(const uint8_t* data, AZStd::size_t size)
+    {
+        uint32_t tag = 0;
+        if (size < sizeof(tag))
+        {
+            return false;
+        }
+        memcpy(&tag, data, sizeof(tag));
+        return (tag == FlatModelTag) || (tag == FlatModelSwappedTag);
+    }
+
+    bool FlatModelView::Initialize(const uint8_t* data, AZStd::size_t size)
+    {
+        m_layers.clear();
+        m_quantizedLayers.clear();
+
+        FlatModelHeader header;
+        if ((data == nullptr) || (size < sizeof(header)))
+        {
+            return false;
+        }
+        memcpy(&header, data, sizeof(header));
+        if (header.m_tag == FlatModelSwappedTag)
+        {
+            AZLOG_WARN("Rejecting flat model, it was written on a platform with a different byte order");
+            return false;
+        }
+        if ((header.m_tag != FlatModelTag) || (header.m_version != FlatModelVersion) || (header.m_fileSize > size))
+        {
+            AZLOG_WARN("Rejecting flat model, unrecognized header or truncated file");
+            return false;
+        }
+
+        const AZStd::size_t entryCount = static_cast<AZStd::size_t>(header.m_layerCount) + header.m_quantizedLayerCount;
+        const AZStd::size_t tableEnd = sizeof(header) + entryCount * sizeof(FlatLayerEntry);
+        if ((tableEnd > header.m_fileSize) || (header.m_nameOffset < tableEnd) || (static_cast<uint64_t>(header.m_nameOffset) + header.m_nameLength > header.m_fileSize))
+        {
+            AZLOG_WARN("Rejecting flat model, the layer table or name lies outside the file");
+            return false;
+        }
+
+        const AZStd::size_t fileSize = static_cast<AZStd::size_t>(header.m_fileSize);
+        AZStd::size_t expectedInputSize = static_cast<AZStd::size_t>(header.m_activationCount);
+        for (AZStd::size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+        {
+            FlatLayerEntry entry;
+            memcpy(&entry, data + sizeof(header) + entryIndex * sizeof(FlatLayerEntry), sizeof(entry));
+
+            const ActivationFunctions activationFunction = static_cast<ActivationFunctions>(entry.m_activationFunction);
+            if (ToString(activationFunction).empty() || (entry.m_outputSize == 0))
+            {
+                AZLOG_WARN("Rejecting flat model, layer %zu is malformed", entryIndex);
+                return false;
+            }
+
+            const AZStd::size_t rowGroups = GetGroupCount(entry.m_outputSize);
+            const bool isQuantized = (entryIndex >= header.m_layerCount);
+            if (entryIndex == header.m_layerCount)
+            {
+                // The quantized layers form a second network with the same input
+                expectedInputSize = static_cast<AZStd::size_t>(header.m_activationCount);
+            }
+
+            bool valid = (entry.m_inputSize == expectedInputSize) && IsValidBlock(entry.m_biasOffset, rowGroups * 4 * sizeof(float), fileSize);
+            if (isQuantized)
+            {
+                valid = valid
+                    && (entry.m_paddedInputSize >= entry.m_inputSize)
+                    && (entry.m_weightSize == static_cast<uint64_t>(entry.m_outputSize) * entry.m_paddedInputSize)
+                    && IsValidBlock(entry.m_weightOffset, entry.m_weightSize, fileSize)
+                    && IsValidBlock(entry.m_scaleOffset, entry.m_outputSize * sizeof(float), fileSize);
+            }
+            else
+            {
+                valid = valid
+                    && (entry.m_weightSize == rowGroups * GetGroupCount(entry.m_inputSize) * BytesPerBlock)
+                    && IsValidBlock(entry.m_weightOffset, entry.m_weightSize, fileSize);
+            }
+
+            if (!valid)
+            {
+                AZLOG_WARN("Rejecting flat model, layer %zu has inconsistent sizes or offsets", entryIndex);
+                return false;
+            }
+            expectedInputSize = entry.m_outputSize;
+
+            if (isQuantized)
+            {
+                FlatQuantizedLayerView& layer = m_quantizedLayers.emplace_back();
+                layer.m_inputSize = entry.m_inputSize;
+                layer.m_paddedInputSize = entry.m_paddedInputSize;
+                layer.m_outputSize = entry.m_outputSize;
+                layer.m_activationFunction = activationFunction;
+                layer.m_weights = reinterpret_cast<const int8_t*>(data + entry.m_weightOffset);
+                layer.m_weightScales = reinterpret_cast<const float*>(data + entry.m_scaleOffset);
+                layer.m_biases = reinterpret_cast<const float*>(data + entry.m_biasOffset);
+            }
+            else
+            {
+                FlatLayerView& layer = m_layers.emplace_back();
+                layer.m_inputSize = entry.m_inputSize;
+                layer.m_outputSize = entry.m_outputSize;
+                layer.m_rowGroups = rowGroups;
+                layer.m_columnGroups = GetGroupCount(entry.m_inputSize);
+                layer.m_activationFunction = activationFunction;
+                layer.m_weights = reinterpret_cast<const float*>(data + entry.m_weightOffset);
+                layer.m_biases = reinterpret_cast<const float*>(data + entry.m_biasOffset);
+            }
+        }
+
+        m_name = AZStd::string_view(reinterpret_cast<const char*>(data + header.m_nameOffset), header.m_nameLength);
+        m_activationCount = static_cast<AZStd::size_t>(header.m_activationCount);
+        return true;
+    }
+
+    AZStd::string_view FlatModelView::GetName() const
+    {
+        return m_name;
+    }
+
+    AZStd::size_t FlatModelView::GetActivationCount() const
+    {
+        return m_activationCount;
+    }
+
+    AZStd::size_t FlatModelView::GetLayerCount() const
+    {
+        return m_layers.size();
+    }
+
+    AZStd::size_t FlatModelView::GetQuantizedLayerCount() const
+    {
+        return m_quantizedLayers.size();
+    }
+
+    const FlatLayerView& FlatModelView::GetLayer(AZStd::size_t layerIndex) const
+    {
+        return m_layers[layerIndex];
+    }
+
+    const FlatQuantizedLayerView& FlatModelView::GetQuantizedLayer(AZStd::size_t layerIndex) const
+    {
+        return m_quantizedLayers[layerIndex];
+    }
+
+    AZStd::size_t GetFlatModelSize(const ModelAsset& asset)
+    {
+        FlatModelHeader header;
+        AZStd::vector<FlatLayerEntry> entries;
+        return ComputeLayout(asset, header, entries);
+    }
+
+    bool WriteFlatModel(const ModelAsset& asset, AZ::IO::GenericStream& stream)
+    {
+        AZ_Assert(asset.m_featureLayers.empty(), "The flat model format only holds dense layers, models with feature extraction layers must be serialized");
+        FlatModelHeader header;
+        AZStd::vector<FlatLayerEntry> entries;
+        const AZStd::size_t fileSize = ComputeLayout(asset, header, entries);
+
+        // The file is assembled in memory and written with a single call, all padding is zero filled
+        AZStd::vector<uint8_t> buffer(fileSize, 0);
+        memcpy(buffer.data(), &header, sizeof(header));
+        memcpy(buffer.data() + sizeof(header), entries.data(), entries.size() * sizeof(FlatLayerEntry));
+        memcpy(buffer.data() + header.m_nameOffset, asset.m_name.data(), asset.m_name.size());
+
+        AZStd::size_t entryIndex = 0;
+        for (const Layer& layer : asset.m_layers)
+        {
+            const FlatLayerEntry& entry = entries[entryIndex++];
+            AZ_Assert(layer.m_weights.GetRowGroups() * layer.m_weights.GetColumnGroups() * BytesPerBlock == entry.m_weightSize, "Layer weights do not match the layer dimensions");
+            float* block = reinterpret_cast<float*>(buffer.data() + entry.m_weightOffset);
+            for (AZStd::size_t rowIter = 0; rowIter < layer.m_weights.GetRowGroups(); ++rowIter)
+            {
+                for (AZStd::size_t colIter = 0; colIter < layer.m_weights.GetColumnGroups(); ++colIter)
+                {
+                    layer.m_weights.GetSubmatrix(rowIter, colIter).StoreToColumnMajorFloat16(block);
+                    block += FloatsPerBlock;
+                }
+            }
+            WriteBiases(layer.m_biases, buffer.data() + entry.m_biasOffset);
+        }
+
+        for (const QuantizedLayer& layer : asset.m_quantizedLayers)
+        {
+            const FlatLayerEntry& entry = entries[entryIndex++];
+            memcpy(buffer.data() + entry.m_weightOffset, layer.m_weights.data(), layer.m_weights.size());
+            memcpy(buffer.data() + entry.m_scaleOffset, layer.m_weightScales.data(), layer.m_weightScales.size() * sizeof(float));
+            WriteBiases(layer.m_biases, buffer.data() + entry.m_biasOffset);
+        }
+
+        return stream.Write(buffer.size(), buffer.data()) == buffer.size();
+    }
+
+    void ReadFlatLayer(const FlatLayerView& view, Layer& layer)
+    {
+        layer.m_inputSize = view.m_inputSize;
+        layer.m_outputSize = view.m_outputSize;
+        layer.m_activationFunction = view.m_activationFunction;
+        layer.m_weights.Resize(view.m_outputSize, view.m_inputSize);
+
+        // Blocks are copied through an aligned temporary as the source buffer is only guaranteed to be aligned when memory mapped
+        alignas(16) float block[FloatsPerBlock];
+        const float* source = view.m_weights;
+        for (AZStd::size_t rowIter = 0; rowIter < view.m_rowGroups; ++rowIter)
+        {
+            for (AZStd::size_t colIter = 0; colIter < view.m_columnGroups; ++colIter)
+            {
+                memcpy(block, source, BytesPerBlock);
+                layer.m_weights.GetSubmatrix(rowIter, colIter) = AZ::Matrix4x4::CreateFromColumnMajorFloat16(block);
+                source += FloatsPerBlock;
+            }
+        }
+        ReadBiases(view.m_biases, view.m_outputSize, layer.m_biases);
+    }
+
+    void ReadFlatQuantizedLayer(const FlatQuantizedLayerView& view, QuantizedLayer& layer)
+    {
+        layer.m_inputSize = view.m_inputSize;
+        layer.m_paddedInputSize = view.m_paddedInputSize;
+        layer.m_outputSize = view.m_outputSize;
+        layer.m_activationFunction = view.m_activationFunction;
+        layer.m_weights.assign(view.m_weights, view.m_weights + view.m_outputSize * view.m_paddedInputSize);
+        layer.m_weightScales.resize(view.m_outputSize);
+        memcpy(layer.m_weightScales.data(), view.m_weightScales, view.m_outputSize * sizeof(float));
+        ReadBiases(view.m_biases, view.m_outputSize, layer.m_biases);
+    }
+
+    void ReadFlatModel(const FlatModelView& view, ModelAsset& asset)
+    {
+        asset.m_name = view.GetName();
+        asset.m_activationCount = view.GetActivationCount();
+        asset.m_featureLayers.clear();
+
+        asset.m_layers.resize(view.GetLayerCount());
+        for (AZStd::size_t iter = 0; iter < view.GetLayerCount(); ++iter)
+        {
+            ReadFlatLayer(view.GetLayer(iter), asset.m_layers[iter]);
+        }
+
+        asset.m_quantizedLayers.resize(view.GetQuantizedLayerCount());
+        for (AZStd::size_t iter = 0; iter < view.GetQuantizedLayerCount(); ++iter)
+        {
+            ReadFlatQuantizedLayer(view.GetQuantizedLayer(iter), asset.m_quantizedLayers[iter]);
+        }
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/string/string_view.h>
+#include <Models/Layer.h>
+#include <Models/QuantizedLayer.h>
+
+namespace MachineLearning
+{
+    class ModelAsset;
+
+    //! The flat model format is a fixed layout binary file which can be memory mapped and used for inference without deserialization.
+    //! The file begins with a FlatModelHeader, followed by a table of FlatLayerEntry records, the model name, and then the layer data.
+    //! Every weight and bias block begins on a FlatModelAlignment byte boundary so that blocks never straddle cache lines and mapped pages can be shared between processes.
+    //! Float weights are stored as the 4x4 submatrices used by AZ::MatrixMxN, ordered by row group then column group, each block holding 16 floats in column-major order.
+    //! All values are little-endian, the byte order of every supported platform, and are read in place without conversion.
+
+    //! Identifies flat model files, this differs from ModelAsset::FormatTag so the two formats can never be confused.
+    static constexpr uint32_t FlatModelTag = 0x464D4C4D; // 'MLMF'
+
+    //! The tag as read on a platform of the opposite byte order, the tag doubles as a byte order mark so such files are rejected rather than misread.
+    static constexpr uint32_t FlatModelSwappedTag = 0x4D4C4D46;
+
+    //! The flat format layout version, this is incremented whenever the layout changes.
+    static constexpr uint32_t FlatModelVersion = 1;
+
+    //! The alignment in bytes of every block in the file.
+    static constexpr AZStd::size_t FlatModelAlignment = 64;
+
+    struct FlatModelHeader
+    {
+        uint32_t m_tag = FlatModelTag;
+        uint32_t m_version = FlatModelVersion;
+        uint64_t m_fileSize = 0;
+        uint64_t m_activationCount = 0;
+        uint32_t m_layerCount = 0;
+        uint32_t m_quantizedLayerCount = 0;
+        uint32_t m_nameOffset = 0;
+        uint32_t m_nameLength = 0;
+        uint32_t m_reserved[6] = {};
+    };
+    static_assert(sizeof(FlatModelHeader) == FlatModelAlignment, "The flat model header must occupy exactly one aligned block");
+
+    //! Describes a single float or quantized layer, the layer table holds the float layers followed by the quantized layers.
+    struct FlatLayerEntry
+    {
+        uint32_t m_activationFunction = 0;
+        uint32_t m_inputSize = 0;
+        uint32_t m_outputSize = 0;
+        uint32_t m_paddedInputSize = 0; //!< Only used by quantized layers, the stride in bytes between weight rows.
+        uint64_t m_weightOffset = 0;
+        uint64_t m_weightSize = 0;
+        uint64_t m_scaleOffset = 0; //!< Only used by quantized layers, one float scale per output.
+        uint64_t m_biasOffset = 0;
+        uint64_t m_reserved[2] = {};
+    };
+    static_assert(sizeof(FlatLayerEntry) == FlatModelAlignment, "Flat layer entries must occupy exactly one aligned block");
+
+    //! A read-only view of a float layer inside a flat model buffer.
+    struct FlatLayerView
+    {
+        AZStd::size_t m_inputSize = 0;
+        AZStd::size_t m_outputSize = 0;
+        AZStd::size_t m_rowGroups = 0;
+        AZStd::size_t m_columnGroups = 0;
+        ActivationFunctions m_activationFunction = ActivationFunctions::ReLU;
+        const float* m_weights = nullptr; //!< m_rowGroups * m_columnGroups blocks of 16 floats.
+        const float* m_biases = nullptr; //!< m_rowGroups * 4 floats, trailing elements are zero.
+
+        //! Performs a forward pass directly against the weights in the buffer, outputs are stored in m_output.
+        //! This is inference only, unlike Layer::Forward the activation input is never retained.
+        const AZ::VectorN& Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations) const;
+
+        //! Performs a forward pass on a batch of activation vectors, outputs are stored in m_batchOutput.
+        AZStd::span<const AZ::VectorN* const> ForwardBatch(LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN* const> activations) const;
+
+    private:
+
+        void Evaluate(const AZ::VectorN& activations, AZ::VectorN& output) const;
+    };
+
+    //! A read-only view of a quantized layer inside a flat model buffer.
+    struct FlatQuantizedLayerView
+    {
+        AZStd::size_t m_inputSize = 0;
+        AZStd::size_t m_paddedInputSize = 0;
+        AZStd::size_t m_outputSize = 0;
+        ActivationFunctions m_activationFunction = ActivationFunctions::ReLU;
+        const int8_t* m_weights = nullptr;
+        const float* m_weightScales = nullptr;
+        const float* m_biases = nullptr;
+    };
+
+    //! Validates a flat model buffer and provides access to its contents without copying.
+    //! The buffer must outlive the view.
+    class FlatModelView
+    {
+    public:
+
+        //! Returns true if the buffer begins with the flat model tag in either byte order, this does not validate the rest of the buffer.
+        static bool HasFlatModelTag(const uint8_t* data, AZStd::size_t size);
+
+        //! Validates the byte order, header, layer table and every block range against the size of the buffer.
+        //! @return boolean true if the buffer holds a well formed flat model written with the byte order of this platform
+        bool Initialize(const uint8_t* data, AZStd::size_t size);
+
+        AZStd::string_view GetName() const;
+        AZStd::size_t GetActivationCount() const;
+        AZStd::size_t GetLayerCount() const;
+        AZStd::size_t GetQuantizedLayerCount() const;
+        const FlatLayerView& GetLayer(AZStd::size_t layerIndex) const;
+        const FlatQuantizedLayerView& GetQuantizedLayer(AZStd::size_t layerIndex) const;
+
+    private:
+
+        AZStd::string_view m_name;
+        AZStd::size_t m_activationCount = 0;
+        AZStd::vector<FlatLayerView> m_layers;
+        AZStd::vector<FlatQuantizedLayerView> m_quantizedLayers;
+    };
+
+    //! Returns the exact size in bytes of the flat model file for the provided asset.
+    AZStd::size_t GetFlatModelSize(const ModelAsset& asset);
+
+    //! Writes the provided asset to the stream in the flat model format, the asset must not have any feature extraction layers.
+    //! @return boolean true if every byte was written
+    bool WriteFlatModel(const ModelAsset& asset, AZ::IO::GenericStream& stream);
+
+    //! Copies every layer out of a flat model view into the provided asset.
+    void ReadFlatModel(const FlatModelView& view, ModelAsset& asset);
+
+    //! Copies a single float layer out of a flat model view.
+    void ReadFlatLayer(const FlatLayerView& view, Layer& layer);
+
+    //! Copies a single quantized layer out of a flat model view.
+    void ReadFlatQuantizedLayer(const FlatQuantizedLayerView& view, QuantizedLayer& layer);
+}
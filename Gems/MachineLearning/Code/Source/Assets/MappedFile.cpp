@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Assets/MappedFile.h>
+#include <AzCore/IO/SystemFile.h>
+
+namespace MachineLearning
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    bool MappedFile::Open(const char* filePath)
+    {
+        Close();
+        if (MapFile(filePath))
+        {
+            m_isMapped = true;
+            return true;
+        }
+        return ReadFile(filePath);
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_isMapped)
+        {
+            UnmapFile();
+        }
+        m_buffer = {};
+        m_data = nullptr;
+        m_size = 0;
+        m_isMapped = false;
+    }
+
+    bool MappedFile::IsMapped() const
+    {
+        return m_isMapped;
+    }
+
+    const uint8_t* MappedFile::GetData() const
+    {
+        return m_data;
+    }
+
+    AZStd::size_t MappedFile::GetSize() const
+    {
+        return m_size;
+    }
+
+    bool MappedFile::ReadFile(const char* filePath)
+    {
+        AZ::IO::SystemFile file;
+        if (!file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+        {
+            return false;
+        }
+
+        const AZ::IO::SizeType length = file.Length();
+        m_buffer.resize(length);
+        if (file.Read(length, m_buffer.data()) != length)
+        {
+            m_buffer = {};
+            return false;
+        }
+
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+        return true;
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace MachineLearning
+{
+    //! A read-only view of the complete contents of a file.
+    //! The file is memory mapped where the platform supports it, so that data sets larger than physical memory are paged in on demand.
+    //! If the file cannot be mapped it is read into memory instead, so callers never need to handle both cases.
+    class MappedFile
+    {
+    public:
+
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        //! Opens the requested file, closing any previously opened file.
+        //! @param filePath the resolved path of the file to open
+        //! @return boolean true on success, false if the file could not be opened
+        bool Open(const char* filePath);
+
+        //! Releases the mapping or buffer holding the file contents.
+        void Close();
+
+        //! Returns true if the file contents are memory mapped rather than buffered.
+        bool IsMapped() const;
+
+        //! Returns the file contents, these are safe to read concurrently from any number of threads.
+        const uint8_t* GetData() const;
+
+        //! Returns the size of the file contents in bytes.
+        AZStd::size_t GetSize() const;
+
+    private:
+
+        //! Platform specific memory mapping, implemented per platform.
+        //! @{
+        bool MapFile(const char* filePath);
+        void UnmapFile();
+        //! @}
+
+        bool ReadFile(const char* filePath);
+
+        const uint8_t* m_data = nullptr;
+        AZStd::size_t m_size = 0;
+        bool m_isMapped = false;
+
+        //! Holds the file contents if the file could not be memory mapped.
+        AZStd::vector<uint8_t> m_buffer;
+    };
+}
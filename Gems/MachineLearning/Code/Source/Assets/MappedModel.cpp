@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Assets/MappedModel.h>
+
+namespace MachineLearning
+{
+    AZStd::shared_ptr<MappedModel> MappedModel::Open(const char* filePath)
+    {
+        AZStd::shared_ptr<MappedModel> model = AZStd::make_shared<MappedModel>();
+        if (!model->m_file.Open(filePath))
+        {
+            return nullptr;
+        }
+
+        // Only the tag is checked before validating, so that other model formats are rejected without logging
+        if (!FlatModelView::HasFlatModelTag(model->m_file.GetData(), model->m_file.GetSize())
+         || !model->m_view.Initialize(model->m_file.GetData(), model->m_file.GetSize()))
+        {
+            return nullptr;
+        }
+        return model;
+    }
+
+    const FlatModelView& MappedModel::GetView() const
+    {
+        return m_view;
+    }
+
+    AZStd::size_t MappedModel::GetSize() const
+    {
+        return m_file.GetSize();
+    }
+}
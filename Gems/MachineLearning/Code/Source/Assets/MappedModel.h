@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Assets/FlatModelFormat.h>
+#include <Assets/MappedFile.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace MachineLearning
+{
+    //! A flat model file opened for in place inference.
+    //! Models holding the same MappedModel read their weights from the same mapped pages rather than each holding a copy.
+    class MappedModel
+    {
+    public:
+
+        AZ_CLASS_ALLOCATOR(MappedModel, AZ::SystemAllocator);
+
+        //! Opens and validates the requested flat model file.
+        //! @param filePath the resolved path of the file to open
+        //! @return the opened model, or nullptr if the file could not be opened or is not a well formed flat model
+        static AZStd::shared_ptr<MappedModel> Open(const char* filePath);
+
+        //! Returns the validated contents of the file.
+        const FlatModelView& GetView() const;
+
+        //! Returns the size of the file in bytes.
+        AZStd::size_t GetSize() const;
+
+    private:
+
+        MappedFile m_file;
+        FlatModelView m_view;
+    };
+}
@@ -13,6 +13,7 @@
 #include <AzCore/IO/FileReader.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzNetworking/Utilities/Endian.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -60,116 +61,180 @@ namespace MachineLearning
         return m_dataHeader.m_imageCount;
     }
 
+    // The MNIST label and image data immediately follows their respective archive headers
+    static constexpr AZStd::size_t MnistLabelDataOffset = 2 * sizeof(uint32_t);
+    static constexpr AZStd::size_t MnistImageDataOffset = 4 * sizeof(uint32_t);
+    static constexpr AZStd::size_t MnistLabelCount = 10;
+
     const AZ::VectorN& MnistDataLoader::GetLabelByIndex(AZStd::size_t index)
     {
-        OneHotEncode(m_labelBuffer[index], 10, m_labelVector);
+        AZ_Assert(index < GetSampleCount(), "Out of range index requested");
+        OneHotEncode(m_labelFile->GetData()[MnistLabelDataOffset + index], MnistLabelCount, m_labelVector);
         return m_labelVector;
     }
 
     const AZ::VectorN& MnistDataLoader::GetDataByIndex(AZStd::size_t index)
     {
+        DequantizeImage(index, m_imageVector);
+        return m_imageVector;
+    }
+
+    void MnistDataLoader::GetBatch(AZStd::span<const AZStd::size_t> indices, AZStd::span<AZ::VectorN> data, AZStd::span<AZ::VectorN> labels) const
+    {
+        AZ_Assert(data.size() >= indices.size() && labels.size() >= indices.size(), "Batch storage is too small for the requested samples");
+        const uint8_t* labelData = m_labelFile->GetData() + MnistLabelDataOffset;
+        for (AZStd::size_t iter = 0; iter < indices.size(); ++iter)
+        {
+            AZ_Assert(indices[iter] < GetSampleCount(), "Out of range index requested");
+            DequantizeImage(indices[iter], data[iter]);
+            OneHotEncode(labelData[indices[iter]], MnistLabelCount, labels[iter]);
+        }
+    }
+
+    bool MnistDataLoader::SupportsConcurrentBatches() const
+    {
+        return true;
+    }
+
+    void MnistDataLoader::DequantizeImage(AZStd::size_t index, AZ::VectorN& output) const
+    {
+        AZ_Assert(index < GetSampleCount(), "Out of range index requested");
         const AZStd::size_t imageDataStride = m_dataHeader.m_height * m_dataHeader.m_width;
-        m_imageVector.Resize(imageDataStride);
-        for (AZStd::size_t iter = 0; iter < imageDataStride; ++iter)
+        const uint8_t* imageData = m_imageFile->GetData() + MnistImageDataOffset + index * imageDataStride;
+        output.Resize(imageDataStride);
+
+        // Pixels are converted in blocks of 16, the fixed trip count of the widening loop lets the compiler emit packed
+        // uint8 to float conversions, and the converted block is then moved into the vector's storage with aligned loads
+        static constexpr AZStd::size_t BlockSize = 16;
+        static constexpr AZStd::size_t VectorsPerBlock = BlockSize / 4;
+        const AZ::Simd::Vec4::FloatType scale = AZ::Simd::Vec4::Splat(1.0f / 255.0f);
+        AZStd::vector<AZ::Vector4>& outputValues = output.GetVectorValues();
+        alignas(16) float block[BlockSize];
+        for (AZStd::size_t first = 0; first < imageDataStride; first += BlockSize)
         {
-            m_imageVector.SetElement(iter, static_cast<float>(m_imageBuffer[index * imageDataStride + iter]) / 255.0f);
+            const AZStd::size_t count = AZStd::min(BlockSize, imageDataStride - first);
+            if (count == BlockSize)
+            {
+                for (AZStd::size_t iter = 0; iter < BlockSize; ++iter)
+                {
+                    block[iter] = static_cast<float>(imageData[first + iter]);
+                }
+            }
+            else
+            {
+                // The padding of the last vector must be zero
+                for (AZStd::size_t iter = 0; iter < BlockSize; ++iter)
+                {
+                    block[iter] = (iter < count) ? static_cast<float>(imageData[first + iter]) : 0.0f;
+                }
+            }
+
+            const AZStd::size_t vectorCount = AZStd::min(VectorsPerBlock, (count + 3) / 4);
+            for (AZStd::size_t iter = 0; iter < vectorCount; ++iter)
+            {
+                const AZ::Simd::Vec4::FloatType values = AZ::Simd::Vec4::LoadAligned(block + iter * 4);
+                outputValues[first / 4 + iter].SetSimdValue(AZ::Simd::Vec4::Mul(values, scale));
+            }
         }
-        return m_imageVector;
+        output.FixLastVectorElement();
     }
 
-    bool MnistDataLoader::LoadImageFile(const AZ::IO::Path& imageFilename)
+    //! Resolves and maps the requested file, returning nullptr on failure.
+    static AZStd::shared_ptr<MappedFile> OpenArchive(const AZ::IO::Path& filename, AZ::IO::FixedMaxPath& filePathFixed)
     {
-        AZ::IO::FixedMaxPath filePathFixed = imageFilename.c_str();
+        filePathFixed = filename.c_str();
         if (AZ::IO::FileIOBase* fileIOBase = AZ::IO::FileIOBase::GetInstance())
         {
-            fileIOBase->ResolvePath(filePathFixed, imageFilename.c_str());
+            fileIOBase->ResolvePath(filePathFixed, filename.c_str());
         }
 
-        if (!m_imageFile.Open(filePathFixed.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+        AZStd::shared_ptr<MappedFile> file = AZStd::make_shared<MappedFile>();
+        if (!file->Open(filePathFixed.c_str()))
         {
             AZLOG_ERROR("Failed to load '%s'. File could not be opened.", filePathFixed.c_str());
-            return false;
+            return nullptr;
         }
 
-        const AZ::IO::SizeType length = m_imageFile.Length();
-        if (length == 0)
+        if (file->GetSize() == 0)
         {
             AZLOG_ERROR("Failed to load '%s'. File is empty.", filePathFixed.c_str());
-            return false;
+            return nullptr;
         }
+        return file;
+    }
 
-        m_imageFile.Seek(0, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+    bool MnistDataLoader::LoadImageFile(const AZ::IO::Path& imageFilename)
+    {
+        m_dataHeader = MnistDataHeader();
+        m_imageFile.reset();
 
-        AZ::IO::SizeType bytesRead = m_imageFile.Read(sizeof(MnistDataHeader), &m_dataHeader);
+        AZ::IO::FixedMaxPath filePathFixed;
+        AZStd::shared_ptr<MappedFile> imageFile = OpenArchive(imageFilename, filePathFixed);
+        if (imageFile == nullptr)
+        {
+            return false;
+        }
 
-        if (bytesRead != sizeof(MnistDataHeader))
+        if (imageFile->GetSize() < sizeof(MnistDataHeader))
         {
             // Failed to read the whole header
             AZLOG_ERROR("Failed to load '%s', failed to read archive header.", filePathFixed.c_str());
-            m_imageFile.Close();
             return false;
         }
 
-        m_dataHeader.m_imageHeader = ntohl(m_dataHeader.m_imageHeader);
-        m_dataHeader.m_imageCount = ntohl(m_dataHeader.m_imageCount);
-        m_dataHeader.m_height = ntohl(m_dataHeader.m_height);
-        m_dataHeader.m_width = ntohl(m_dataHeader.m_width);
+        MnistDataHeader dataHeader;
+        memcpy(&dataHeader, imageFile->GetData(), sizeof(MnistDataHeader));
+        dataHeader.m_imageHeader = ntohl(dataHeader.m_imageHeader);
+        dataHeader.m_imageCount = ntohl(dataHeader.m_imageCount);
+        dataHeader.m_height = ntohl(dataHeader.m_height);
+        dataHeader.m_width = ntohl(dataHeader.m_width);
 
         constexpr uint32_t MnistImageHeaderValue = 2051;
-        if (m_dataHeader.m_imageHeader != MnistImageHeaderValue)
+        if (dataHeader.m_imageHeader != MnistImageHeaderValue)
         {
             // Invalid format
-            AZLOG_ERROR("Failed to load '%s', file is not an MNIST archive (expected %u, encountered %u).", filePathFixed.c_str(), MnistImageHeaderValue, m_dataHeader.m_imageHeader);
-            m_imageFile.Close();
+            AZLOG_ERROR("Failed to load '%s', file is not an MNIST archive (expected %u, encountered %u).", filePathFixed.c_str(), MnistImageHeaderValue, dataHeader.m_imageHeader);
             return false;
         }
 
-        const AZStd::size_t imageDataStride = m_dataHeader.m_height * m_dataHeader.m_width;
-        m_imageBuffer.resize(m_dataHeader.m_imageCount * imageDataStride);
-        m_imageFile.Read(m_dataHeader.m_imageCount * imageDataStride, m_imageBuffer.data());
+        const AZStd::size_t imageDataStride = static_cast<AZStd::size_t>(dataHeader.m_height) * dataHeader.m_width;
+        if (imageFile->GetSize() < MnistImageDataOffset + dataHeader.m_imageCount * imageDataStride)
+        {
+            AZLOG_ERROR("Failed to load '%s', archive is truncated.", filePathFixed.c_str());
+            return false;
+        }
+
+        m_dataHeader = dataHeader;
+        m_imageFile = AZStd::move(imageFile);
         return true;
     }
 
     bool MnistDataLoader::LoadLabelFile(const AZ::IO::Path& labelFilename)
     {
-        AZ::IO::FixedMaxPath filePathFixed = labelFilename.c_str();
-        if (AZ::IO::FileIOBase* fileIOBase = AZ::IO::FileIOBase::GetInstance())
-        {
-            fileIOBase->ResolvePath(filePathFixed, labelFilename.c_str());
-        }
+        m_labelFile.reset();
 
-        if (!m_labelFile.Open(filePathFixed.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+        AZ::IO::FixedMaxPath filePathFixed;
+        AZStd::shared_ptr<MappedFile> labelFile = OpenArchive(labelFilename, filePathFixed);
+        if (labelFile == nullptr)
         {
-            AZLOG_ERROR("Failed to load '%s'. File could not be opened.", filePathFixed.c_str());
             return false;
         }
 
-        const AZ::IO::SizeType length = m_labelFile.Length();
-        if (length == 0)
-        {
-            AZLOG_ERROR("Failed to load '%s'. File is empty.", filePathFixed.c_str());
-            return false;
-        }
-
-        m_labelFile.Seek(0, AZ::IO::SystemFile::SF_SEEK_BEGIN);
-
         struct MnistLabelHeader
         {
             uint32_t m_labelHeader = 0;
             uint32_t m_labelCount = 0;
         };
 
-        MnistLabelHeader labelHeader;
-        AZ::IO::SizeType bytesRead = m_labelFile.Read(sizeof(MnistLabelHeader), &labelHeader);
-
-        if (bytesRead != sizeof(MnistLabelHeader))
+        if (labelFile->GetSize() < sizeof(MnistLabelHeader))
         {
             // Failed to read the whole header
             AZLOG_ERROR("Failed to load '%s', failed to read label header.", filePathFixed.c_str());
-            m_labelFile.Close();
             return false;
         }
 
+        MnistLabelHeader labelHeader;
+        memcpy(&labelHeader, labelFile->GetData(), sizeof(MnistLabelHeader));
         labelHeader.m_labelHeader = ntohl(labelHeader.m_labelHeader);
         labelHeader.m_labelCount = ntohl(labelHeader.m_labelCount);
 
@@ -178,21 +243,23 @@ namespace MachineLearning
         {
             // Invalid format
             AZLOG_ERROR("Failed to load '%s', file is not an MNIST archive (expected %u, encountered %u).", filePathFixed.c_str(), MnistLabelHeaderValue, labelHeader.m_labelHeader);
-            m_labelFile.Close();
             return false;
         }
 
         if (m_dataHeader.m_imageCount != labelHeader.m_labelCount)
         {
             AZLOG_ERROR("Failed to load '%s', mismatch between image count (%u) and label count (%u).", filePathFixed.c_str(), m_dataHeader.m_imageCount, labelHeader.m_labelCount);
-            m_labelFile.Close();
             return false;
         }
 
-        m_labelBuffer.resize(labelHeader.m_labelCount);
-        m_labelFile.Read(labelHeader.m_labelCount, m_labelBuffer.data());
-        AZLOG_INFO("Loaded MNIST archive %s containing %u samples", filePathFixed.c_str(), m_dataHeader.m_imageCount);
+        if (labelFile->GetSize() < MnistLabelDataOffset + labelHeader.m_labelCount)
+        {
+            AZLOG_ERROR("Failed to load '%s', archive is truncated.", filePathFixed.c_str());
+            return false;
+        }
+
+        m_labelFile = AZStd::move(labelFile);
+        AZLOG_INFO("Loaded MNIST archive %s containing %u samples (%s)", filePathFixed.c_str(), m_dataHeader.m_imageCount, m_labelFile->IsMapped() ? "memory mapped" : "buffered");
         return true;
     }
 }
-
@@ -12,11 +12,13 @@
 #include <MachineLearning/ILabeledTrainingData.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/IO/FileIO.h>
+#include <Assets/MappedFile.h>
 
 namespace MachineLearning
 {
     //! A class that can load the MNIST training data set.
     //! https://en.wikipedia.org/wiki/MNIST_database
+    //! The archives are memory mapped and samples are kept in their native uint8 form, they are only dequantized into float vectors on access.
     class MnistDataLoader
         : public ILabeledTrainingData
     {
@@ -36,6 +38,8 @@ namespace MachineLearning
         AZStd::size_t GetSampleCount() const override;
         const AZ::VectorN& GetLabelByIndex(AZStd::size_t index) override;
         const AZ::VectorN& GetDataByIndex(AZStd::size_t index) override;
+        void GetBatch(AZStd::span<const AZStd::size_t> indices, AZStd::span<AZ::VectorN> data, AZStd::span<AZ::VectorN> labels) const override;
+        bool SupportsConcurrentBatches() const override;
         //! @}
 
     private:
@@ -43,6 +47,9 @@ namespace MachineLearning
         bool LoadImageFile(const AZ::IO::Path& imageFilename);
         bool LoadLabelFile(const AZ::IO::Path& labelFilename);
 
+        //! Converts the index-th image from uint8 to float in the range [0, 1], this only reads shared state and is safe for concurrent callers.
+        void DequantizeImage(AZStd::size_t index, AZ::VectorN& output) const;
+
         struct MnistDataHeader
         {
             uint32_t m_imageHeader = 0;
@@ -53,16 +60,11 @@ namespace MachineLearning
 
         MnistDataHeader m_dataHeader;
 
-        AZ::IO::SystemFile m_imageFile;
-        AZ::IO::SystemFile m_labelFile;
-
-        AZStd::size_t m_imageDataStart = 0;
-        AZStd::size_t m_labelDataStart = 0;
-
-        AZStd::size_t m_currentIndex = 0xFFFFFFFF;
-        AZStd::vector<uint8_t> m_imageBuffer;
-        AZStd::vector<uint8_t> m_labelBuffer;
+        //! The mapped archives are shared between copies of the loader, as they are never written to.
+        AZStd::shared_ptr<MappedFile> m_imageFile;
+        AZStd::shared_ptr<MappedFile> m_labelFile;
 
+        //! Scratch vectors returned by GetDataByIndex and GetLabelByIndex.
         AZ::VectorN m_imageVector;
         AZ::VectorN m_labelVector;
     };
@@ -7,17 +7,23 @@
  */
 
 #include <Assets/ModelAsset.h>
+#include <Assets/FlatModelFormat.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/FileIO.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 
 namespace MachineLearning
 {
+    AZ_CVAR(bool, ml_mapModelAssets, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Memory maps flat model assets and runs inference against the mapped weights rather than copying them.");
+
     void ModelAsset::Reflect(AZ::ReflectContext* context)
     {
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<ModelAsset>()
-                ->Version(1);
+                ->Version(3);
 
             if (AZ::EditContext* editContext = serializeContext->GetEditContext())
             {
@@ -29,26 +35,155 @@ namespace MachineLearning
 
     bool ModelAsset::Serialize(AzNetworking::ISerializer& serializer)
     {
-        return serializer.Serialize(m_name, "Name")
+        uint32_t formatTag = FormatTag;
+        if (!serializer.Serialize(formatTag, "formatTag") || (formatTag != FormatTag))
+        {
+            return false;
+        }
+
+        // Anything written through a serializer uses the latest serialized layout, regardless of the version the asset will be saved as
+        uint32_t version = SerializedVersion;
+        // The flat format has its own tag, so a serialized stream claiming its version is malformed
+        if (!serializer.Serialize(version, "version") || (version < 2) || (version == CurrentVersion) || (version > SerializedVersion))
+        {
+            return false;
+        }
+
+        if (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject)
+        {
+            m_version = version;
+        }
+        if (version < 4)
+        {
+            m_featureLayers.clear();
+        }
+        const bool result = serializer.Serialize(m_name, "Name")
             && serializer.Serialize(m_activationCount, "activationCount")
-            && serializer.Serialize(m_layers, "layers");
+            && ((version < 5) || serializer.Serialize(m_inputShape.m_width, "inputWidth"))
+            && ((version < 5) || serializer.Serialize(m_inputShape.m_height, "inputHeight"))
+            && ((version < 5) || serializer.Serialize(m_inputShape.m_channels, "inputChannels"))
+            && ((version < 4) || SerializeLayers(serializer, m_featureLayers, "featureLayers"))
+            && serializer.Serialize(m_layers, "layers")
+            && serializer.Serialize(m_quantizedLayers, "quantizedLayers");
+        if (!result || (serializer.GetSerializerMode() != AzNetworking::SerializerMode::WriteToObject))
+        {
+            return result;
+        }
+
+        if (version < 5)
+        {
+            // Earlier versions did not store the input shape, the first feature extraction layer still records the shape it consumes
+            m_inputShape = m_featureLayers.empty() ? ImageShape{ m_activationCount, 1, 1 } : m_featureLayers.front()->GetInputShape();
+        }
+
+        // The feature extraction layers must consume the input and each other's outputs, otherwise inference would read past the activations
+        bool validShapes = m_featureLayers.empty() || (m_inputShape.GetSize() == m_activationCount);
+        ImageShape lastShape = m_inputShape;
+        for (const LayerPtr& featureLayer : m_featureLayers)
+        {
+            validShapes = validShapes && (featureLayer->GetInputShape() == lastShape);
+            lastShape = featureLayer->GetOutputShape();
+        }
+        if (!validShapes)
+        {
+            AZLOG_ERROR("Model %s has feature extraction layers which do not match its input shape", m_name.c_str());
+        }
+        return validShapes;
+    }
+
+    bool ModelAsset::SerializeLegacy(AzNetworking::ISerializer& serializer)
+    {
+        // Assets are never written in the legacy format, so this only ever reads into the asset
+        if (serializer.GetSerializerMode() != AzNetworking::SerializerMode::WriteToObject)
+        {
+            return false;
+        }
+
+        AZStd::string name;
+        AZStd::size_t activationCount = 0;
+        AZStd::vector<Layer> layers;
+        if (!serializer.Serialize(name, "Name")
+         || !serializer.Serialize(activationCount, "activationCount")
+         || !serializer.Serialize(layers, "layers"))
+        {
+            return false;
+        }
+
+        m_name = AZStd::move(name);
+        m_activationCount = activationCount;
+        m_featureLayers.clear();
+        m_layers = AZStd::move(layers);
+        m_quantizedLayers.clear();
+        m_version = 1;
+        return true;
     }
 
     AZStd::size_t ModelAsset::EstimateSerializeSize() const
     {
         const AZStd::size_t padding = 64; // 64 bytes of extra padding just in case
         AZStd::size_t estimatedSize = padding
+            + sizeof(FormatTag)
+            + sizeof(m_version)
             + sizeof(AZStd::size_t)
             + m_name.size()
             + sizeof(m_activationCount)
-            + sizeof(AZStd::size_t);
+            + sizeof(AZStd::size_t) * 3 // for m_inputShape
+            + sizeof(AZStd::size_t)
+            + sizeof(AZStd::size_t)
+            + MachineLearning::EstimateSerializeSize(m_featureLayers);
         for (const Layer& layer : m_layers)
         {
             estimatedSize += layer.EstimateSerializeSize();
         }
+        for (const QuantizedLayer& layer : m_quantizedLayers)
+        {
+            estimatedSize += layer.EstimateSerializeSize();
+        }
         return estimatedSize;
     }
 
+    void ModelAsset::DiscardStaleQuantizedLayers()
+    {
+        // The quantized layers are rebuilt by the model whenever the float layers change, so a mismatch means they were saved out of date
+        if (m_layers.empty() || m_quantizedLayers.empty())
+        {
+            return;
+        }
+
+        bool stale = (m_quantizedLayers.size() != m_layers.size());
+        for (AZStd::size_t iter = 0; !stale && iter < m_layers.size(); ++iter)
+        {
+            stale = (m_quantizedLayers[iter].m_inputSize != m_layers[iter].m_inputSize) || (m_quantizedLayers[iter].m_outputSize != m_layers[iter].m_outputSize);
+        }
+        if (stale)
+        {
+            AZLOG_WARN("Model %s has quantized layers which do not match its float layers, they are discarded", m_name.c_str());
+            m_quantizedLayers = AZStd::vector<QuantizedLayer>();
+        }
+    }
+
+    void ModelAsset::SetMappedModel(AZStd::shared_ptr<MappedModel> mappedModel)
+    {
+        const FlatModelView& view = mappedModel->GetView();
+        m_name = view.GetName();
+        m_activationCount = view.GetActivationCount();
+        m_featureLayers.clear();
+        m_layers.clear();
+        m_quantizedLayers.clear();
+        m_version = CurrentVersion;
+        m_mappedModel = AZStd::move(mappedModel);
+    }
+
+    void ModelAsset::LoadLayers()
+    {
+        if (m_mappedModel)
+        {
+            ReadFlatModel(m_mappedModel->GetView(), *this);
+            DiscardStaleQuantizedLayers();
+            m_mappedModel.reset();
+        }
+    }
+
     ModelAssetHandler::ModelAssetHandler()
         : AzFramework::GenericAssetHandler<ModelAsset>(ModelAsset::DisplayName, ModelAsset::Group, ModelAsset::Extension)
     {
@@ -66,11 +201,51 @@ namespace MachineLearning
 
         const AZ::IO::SizeType length = stream->GetLength();
 
+        // Flat models are mapped directly from the product file where possible, so the weights are never copied
+        // This is skipped if the stream is only part of the file, for example when the asset is packed into an archive
+        // Mapped inference only runs float layers, so quantized models are always copied
+        const char* filename = stream->GetFilename();
+        AZ::IO::FixedMaxPath resolvedPath;
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (ml_mapModelAssets && (filename != nullptr) && (filename[0] != '\0') && (fileIO != nullptr) && fileIO->ResolvePath(resolvedPath, filename))
+        {
+            AZStd::shared_ptr<MappedModel> mappedModel = MappedModel::Open(resolvedPath.c_str());
+            if (mappedModel && (mappedModel->GetSize() == length) && (mappedModel->GetView().GetQuantizedLayerCount() == 0))
+            {
+                assetData->SetMappedModel(AZStd::move(mappedModel));
+                return AZ::Data::AssetHandler::LoadResult::LoadComplete;
+            }
+        }
+
         AZStd::vector<uint8_t> serializeBuffer;
         serializeBuffer.resize(length);
         stream->Read(length, serializeBuffer.data());
+
+        // Flat models which could not be mapped are copied out of the buffer
+        if (FlatModelView::HasFlatModelTag(serializeBuffer.data(), serializeBuffer.size()))
+        {
+            FlatModelView view;
+            if (!view.Initialize(serializeBuffer.data(), serializeBuffer.size()))
+            {
+                return AZ::Data::AssetHandler::LoadResult::Error;
+            }
+            ReadFlatModel(view, *assetData);
+            assetData->DiscardStaleQuantizedLayers();
+            assetData->m_mappedModel.reset();
+            assetData->m_version = ModelAsset::CurrentVersion;
+            return AZ::Data::AssetHandler::LoadResult::LoadComplete;
+        }
+
         AzNetworking::NetworkOutputSerializer serializer(serializeBuffer.data(), static_cast<uint32_t>(serializeBuffer.size()));
         if (assetData->Serialize(serializer))
+        {
+            assetData->DiscardStaleQuantizedLayers();
+            return AZ::Data::AssetHandler::LoadResult::LoadComplete;
+        }
+
+        // Fall back to the untagged legacy format
+        AzNetworking::NetworkOutputSerializer legacySerializer(serializeBuffer.data(), static_cast<uint32_t>(serializeBuffer.size()));
+        if (assetData->SerializeLegacy(legacySerializer))
         {
             return AZ::Data::AssetHandler::LoadResult::LoadComplete;
         }
@@ -83,15 +258,24 @@ namespace MachineLearning
         ModelAsset* assetData = asset.GetAs<ModelAsset>();
         AZ_Assert(assetData, "Asset is of the wrong type.");
 
+        // Assets are always saved in the current format, which requires the layers in memory
+        assetData->LoadLayers();
+        assetData->DiscardStaleQuantizedLayers();
+        if (assetData->m_featureLayers.empty())
+        {
+            assetData->m_version = ModelAsset::CurrentVersion;
+            return WriteFlatModel(*assetData, *stream);
+        }
+
+        // The flat format only holds dense layers, so models with feature extraction layers are serialized instead
+        assetData->m_version = ModelAsset::SerializedVersion;
         AZStd::vector<uint8_t> serializeBuffer;
         serializeBuffer.resize(assetData->EstimateSerializeSize());
         AzNetworking::NetworkInputSerializer serializer(serializeBuffer.data(), static_cast<uint32_t>(serializeBuffer.size()));
         if (assetData->Serialize(serializer))
         {
-            stream->Write(serializer.GetSize(), serializeBuffer.data());
-            return true;
+            return stream->Write(serializer.GetSize(), serializeBuffer.data()) == serializer.GetSize();
         }
-
         return false;
     }
 }
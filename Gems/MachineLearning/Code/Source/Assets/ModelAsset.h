@@ -12,7 +12,10 @@
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzFramework/Asset/GenericAssetHandler.h>
+#include <Assets/MappedModel.h>
+#include <Models/ILayer.h>
 #include <Models/Layer.h>
+#include <Models/QuantizedLayer.h>
 
 namespace MachineLearning
 {
@@ -31,22 +34,67 @@ namespace MachineLearning
 
         ~ModelAsset() = default;
 
+        //! Identifies versioned model assets, legacy assets begin directly with the model name.
+        static constexpr uint32_t FormatTag = 0x4C4D4C4D; // 'MLML'
+
+        //! Version 1 is the untagged legacy format, version 2 adds int8 quantized layers.
+        //! Version 3 is the flat binary format described in FlatModelFormat.h, which is what assets with only dense layers are saved as.
+        //! Version 4 adds convolution and pooling layers to the serialized format, the flat format only holds dense layers so these assets are serialized instead.
+        //! Version 5 adds the input image shape consumed by the convolution and pooling layers.
+        //! Versions 2, 4 and 5 are serialized layouts, version 3 is never written through a serializer.
+        static constexpr uint32_t CurrentVersion = 3;
+
+        //! The last version written through an ISerializer, Serialize reads versions 2, 4 and 5 and rejects CurrentVersion.
+        static constexpr uint32_t SerializedVersion = 5;
+
         //! Base serialize method for all serializable structures or classes to implement.
         //! @param serializer ISerializer instance to use for serialization
         //! @return boolean true for success, false for serialization failure
         bool Serialize(AzNetworking::ISerializer& serializer);
 
+        //! Reads the legacy (version 1) format, which predates the format tag and quantized layers.
+        //! Assets are never written in the legacy format, so this fails without modifying the asset if the serializer reads from the object.
+        //! @param serializer ISerializer instance to read from
+        //! @return boolean true for success, false for serialization failure
+        bool SerializeLegacy(AzNetworking::ISerializer& serializer);
+
         //! Returns the estimated size required to serialize this model.
         AZStd::size_t EstimateSerializeSize() const;
 
+        //! Releases the quantized layers if they do not match the float layers they were derived from, assets without float layers keep them.
+        void DiscardStaleQuantizedLayers();
+
+        //! Uses a mapped flat model file in place of the layers, which are left empty until LoadLayers is called.
+        void SetMappedModel(AZStd::shared_ptr<MappedModel> mappedModel);
+
+        //! Copies the layers out of the mapped flat model file, if any, and releases the mapping.
+        void LoadLayers();
+
         //! The model name.
         AZStd::string m_name;
 
         //! The number of neurons in the activation layer.
         AZStd::size_t m_activationCount = 0;
 
-        //! The set of layers in the network.
+        //! The shape of the input image, this is only meaningful for models with feature extraction layers.
+        ImageShape m_inputShape;
+
+        //! The convolution and pooling layers which run ahead of the dense layers.
+        LayerPtrList m_featureLayers;
+
+        //! The set of dense layers in the network, these are the master copy of the weights.
+        //! Assets written before the float layers were kept alongside the quantized layers may only hold quantized layers.
         AZStd::vector<Layer> m_layers;
+
+        //! The int8 dense layers of a model saved with int8 inference precision, these are derived from and accompany m_layers.
+        AZStd::vector<QuantizedLayer> m_quantizedLayers;
+
+        //! The version the asset was loaded from or will be saved as.
+        uint32_t m_version = CurrentVersion;
+
+        //! If set, the layers are read in place from this mapped file and m_featureLayers, m_layers and m_quantizedLayers are empty.
+        //! Every model assigned from this asset shares the mapping.
+        AZStd::shared_ptr<MappedModel> m_mappedModel;
     };
 
     class ModelAssetHandler final
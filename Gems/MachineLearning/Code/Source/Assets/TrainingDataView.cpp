@@ -87,6 +87,32 @@ namespace MachineLearning
         return m_sourceData->GetDataByIndex(m_indices[index]);
     }
 
+    void TrainingDataView::GetBatch(AZStd::span<const AZStd::size_t> indices, AZStd::span<AZ::VectorN> data, AZStd::span<AZ::VectorN> labels) const
+    {
+        AZ_Assert(m_sourceData, "No datasource assigned to view");
+        AZ_Assert(m_firstCache == m_first && m_lastCache == m_last, "The range of the view must be applied with SetRange before requesting batches");
+
+        // Remap the requested indices into the source data set in fixed size chunks on the stack
+        // Nothing is written to the view and nothing is allocated, so disjoint batches can be requested concurrently
+        static constexpr AZStd::size_t ChunkSize = 64;
+        AZStd::size_t sourceIndices[ChunkSize];
+        for (AZStd::size_t first = 0; first < indices.size(); first += ChunkSize)
+        {
+            const AZStd::size_t count = AZStd::min(ChunkSize, indices.size() - first);
+            for (AZStd::size_t iter = 0; iter < count; ++iter)
+            {
+                AZ_Assert(indices[first + iter] < m_lastCache - m_firstCache, "Out of range index requested");
+                sourceIndices[iter] = m_indices[indices[first + iter]];
+            }
+            m_sourceData->GetBatch(AZStd::span<const AZStd::size_t>(sourceIndices, count), data.subspan(first, count), labels.subspan(first, count));
+        }
+    }
+
+    bool TrainingDataView::SupportsConcurrentBatches() const
+    {
+        return m_sourceData && m_sourceData->SupportsConcurrentBatches();
+    }
+
     void TrainingDataView::FillIndicies()
     {
         // Generate a set of training indices that we can later optionally shuffle
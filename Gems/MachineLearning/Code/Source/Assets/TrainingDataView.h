@@ -32,6 +32,8 @@ namespace MachineLearning
 
         bool IsValid() const;
         void SetSourceData(ILabeledTrainingDataPtr sourceData);
+        //! Restricts the view to the samples [first, last) of the source data and resets the shuffled order.
+        //! GetBatch only reads the index table, so the range must be applied through this rather than by writing m_first and m_last.
         void SetRange(AZStd::size_t first, AZStd::size_t last);
         AZStd::size_t GetOriginalSize() const;
         void ShuffleSamples();
@@ -42,6 +44,8 @@ namespace MachineLearning
         AZStd::size_t GetSampleCount() const override;
         const AZ::VectorN& GetLabelByIndex(AZStd::size_t index) override;
         const AZ::VectorN& GetDataByIndex(AZStd::size_t index) override;
+        void GetBatch(AZStd::span<const AZStd::size_t> indices, AZStd::span<AZ::VectorN> data, AZStd::span<AZ::VectorN> labels) const override;
+        bool SupportsConcurrentBatches() const override;
         //! @}
 
         AZStd::size_t m_first = 0;
@@ -11,6 +11,7 @@
 #include <Source/Algorithms/Activations.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/parallel/thread.h>
 
 #ifdef IMGUI_ENABLED
 #   include <ImGuiContextScope.h>
@@ -75,14 +76,14 @@ namespace MachineLearning
         {
             ILabeledTrainingDataPtr dataPtr = AZStd::make_shared<MnistDataLoader>();
             trainingInstance->m_trainingCycle.m_trainData.SetSourceData(dataPtr);
-            trainingInstance->m_trainingCycle.m_trainData.LoadArchive(trainingInstance->m_trainDataName, trainingInstance->m_trainLabelName);
+            trainingInstance->m_trainingCycle.m_trainData.LoadArchive(trainingInstance->m_trainDataName, trainingInstance->m_trainLabelName, trainingInstance->m_trainingCycle.IsTrainingRunning());
         }
 
         if (!trainingInstance->m_trainingCycle.m_testData.IsValid())
         {
             ILabeledTrainingDataPtr dataPtr = AZStd::make_shared<MnistDataLoader>();
             trainingInstance->m_trainingCycle.m_testData.SetSourceData(dataPtr);
-            trainingInstance->m_trainingCycle.m_testData.LoadArchive(trainingInstance->m_testDataName, trainingInstance->m_testLabelName);
+            trainingInstance->m_trainingCycle.m_testData.LoadArchive(trainingInstance->m_testDataName, trainingInstance->m_testLabelName, trainingInstance->m_trainingCycle.IsTrainingRunning());
         }
     }
 
@@ -98,6 +99,9 @@ namespace MachineLearning
 
     void MachineLearningDebugTrainingWindow::RecalculateAccuracy(TrainingInstance* trainingInstance, ILabeledTrainingData& data)
     {
+        // The contexts and the model can only be touched once the training job has exited
+        trainingInstance->m_trainingCycle.StopTraining();
+        trainingInstance->m_trainingCycle.WaitForTrainingToStop();
         trainingInstance->m_trainingCycle.InitializeContexts();
         trainingInstance->m_totalSamples = static_cast<int32_t>(data.GetSampleCount());
         trainingInstance->m_correctPredictions = 0;
@@ -126,7 +130,7 @@ namespace MachineLearning
         }
     }
 
-    void DrawDataPanel(TrainingDataView& data, AZStd::string& dataName, AZStd::string& labelName)
+    void DrawDataPanel(TrainingDataView& data, AZStd::string& dataName, AZStd::string& labelName, bool trainingRunning)
     {
         ImGui::PushID(&data);
         int32_t firstElement = static_cast<int32_t>(data.m_first);
@@ -136,8 +140,12 @@ namespace MachineLearning
         ImGui::SliderInt("First", &firstElement, 0, static_cast<int32_t>(data.GetOriginalSize()));
         ImGui::SameLine();
         ImGui::SliderInt("Count", &span, 0, static_cast<int32_t>(data.GetOriginalSize() - firstElement));
-        data.m_first = firstElement;
-        data.m_last = firstElement + span;
+        // The training job reads the index table of the view, so the range can only change once it has exited
+        const bool rangeChanged = static_cast<AZStd::size_t>(firstElement) != data.m_first || static_cast<AZStd::size_t>(firstElement + span) != data.m_last;
+        if (rangeChanged && !trainingRunning)
+        {
+            data.SetRange(firstElement, firstElement + span);
+        }
         ImGui::PopID();
     }
 
@@ -215,9 +223,14 @@ namespace MachineLearning
             int32_t batchSize = static_cast<int32_t>(trainingInstance->m_trainingCycle.m_batchSize);
             int32_t totalIterations = static_cast<int32_t>(trainingInstance->m_trainingCycle.m_totalIterations);
 
-            if (!trainingInstance->m_trainingCycle.m_trainingComplete)
+            // The training controls stay hidden until the training job has exited, not just until it has been asked to stop
+            if (trainingInstance->m_trainingCycle.IsTrainingRunning())
             {
-                if (ImGui::Button("Stop training"))
+                if (trainingInstance->m_trainingCycle.m_trainingComplete)
+                {
+                    ImGui::Text("Stopping...");
+                }
+                else if (ImGui::Button("Stop training"))
                 {
                     trainingInstance->m_trainingCycle.StopTraining();
                 }
@@ -227,6 +240,8 @@ namespace MachineLearning
             }
             else
             {
+                // Training that ran to completion is only finalized here, as the window polls rather than waiting for the job
+                trainingInstance->m_trainingCycle.CompleteTraining();
                 if (ImGui::Button("Start training"))
                 {
                     LoadTestTrainData(trainingInstance);
@@ -301,6 +316,36 @@ namespace MachineLearning
                 ImGui::NewLine();
             }
 
+            if (ImGui::BeginTable("Throughput", 2, flags))
+            {
+                const TrainingMetrics metrics = trainingInstance->m_trainingCycle.GetMetrics();
+                const auto metricRow = [](const char* name, const char* format, auto value)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", name);
+                    ImGui::TableNextColumn();
+                    ImGui::Text(format, value);
+                };
+
+                ImGui::TableSetupColumn("Metric", ImGuiTableColumnFlags_WidthFixed, TEXT_BASE_WIDTH * 32.0f);
+                ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableHeadersRow();
+                metricRow("Samples per second", "%.1f", metrics.m_samplesPerSecond);
+                metricRow("Epoch time (s)", "%.3f", metrics.m_epochTime);
+                metricRow("Gather time (s)", "%.3f", metrics.m_gatherTime);
+                metricRow("Gradient time (s)", "%.3f", metrics.m_gradientTime);
+                metricRow("Forward time, all workers (s)", "%.3f", metrics.m_forwardTime);
+                metricRow("Backward time, all workers (s)", "%.3f", metrics.m_backwardTime);
+                metricRow("Reduce time (s)", "%.3f", metrics.m_reduceTime);
+                metricRow("Update time (s)", "%.3f", metrics.m_updateTime);
+                metricRow("Evaluation time (s)", "%.3f", metrics.m_evaluationTime);
+                metricRow("Inference context memory (KiB)", "%.1f", static_cast<double>(metrics.m_inferenceContextMemory) / 1024.0);
+                metricRow("Training context memory (KiB)", "%.1f", static_cast<double>(metrics.m_trainingContextMemory) / 1024.0);
+                ImGui::EndTable();
+                ImGui::NewLine();
+            }
+
             trainingInstance->m_testHistogram.Draw(ImGui::GetColumnWidth(), 200.0f);
             trainingInstance->m_trainHistogram.Draw(ImGui::GetColumnWidth(), 200.0f);
             ImGui::NewLine();
@@ -309,14 +354,24 @@ namespace MachineLearning
             trainingInstance->m_trainingCycle.m_batchSize = batchSize;
             ImGui::SliderInt("Number of iterations", &totalIterations, 1, 1000);
             trainingInstance->m_trainingCycle.m_totalIterations = totalIterations;
+            int32_t workerCount = static_cast<int32_t>(trainingInstance->m_trainingCycle.m_workerCount);
+            ImGui::SliderInt("Worker threads", &workerCount, 1, AZStd::max(1, static_cast<int32_t>(AZStd::thread::hardware_concurrency())));
+            trainingInstance->m_trainingCycle.m_workerCount = workerCount;
 
             int32_t costMetric = static_cast<int32_t>(trainingInstance->m_trainingCycle.m_costFunction);
-            ImGui::Combo("Cost metric", &costMetric, "MeanSquaredError\0");
+            ImGui::Combo("Cost metric", &costMetric, "MeanSquaredError\0CategoricalCrossEntropy\0");
             trainingInstance->m_trainingCycle.m_costFunction = static_cast<LossFunctions>(costMetric);
             ImGui::NewLine();
 
             ImGui::SliderFloat("LearningRate", &trainingInstance->m_trainingCycle.m_learningRate, 0.0f, 0.1f);
             ImGui::SliderFloat("LearningRateDecay", &trainingInstance->m_trainingCycle.m_learningRateDecay, 0.0f, 1.0f);
+
+            OptimizerParameters& optimizer = trainingInstance->m_trainingCycle.m_optimizerParameters;
+            int32_t optimizerFunction = static_cast<int32_t>(optimizer.m_optimizer);
+            ImGui::Combo("Optimizer", &optimizerFunction, "StochasticGradientDescent\0Momentum\0RMSProp\0Adam\0");
+            optimizer.m_optimizer = static_cast<OptimizerFunctions>(optimizerFunction);
+            ImGui::SliderFloat("Beta1", &optimizer.m_beta1, 0.0f, 1.0f);
+            ImGui::SliderFloat("Beta2", &optimizer.m_beta2, 0.0f, 1.0f);
             ImGui::SliderFloat("EarlyStop", &trainingInstance->m_trainingCycle.m_earlyStopCost, 0.0f, 1.0f);
             ImGui::NewLine();
 
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "InferenceSystemComponent.h"
+#include <MachineLearning/MachineLearningTypeIds.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace MachineLearning
+{
+    AZ_CVAR(uint32_t, ml_inferenceSamplesPerJob, 64, nullptr, AZ::ConsoleFunctorFlags::Null, "The minimum number of samples evaluated by a single job, batches smaller than twice this value are not split across jobs");
+    AZ_CVAR(bool, ml_inferenceUseJobs, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Splits large inference batches across the global job system");
+
+    AZ_COMPONENT_IMPL(InferenceSystemComponent, "InferenceSystemComponent", InferenceSystemComponentTypeId);
+
+    void InferenceSystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<InferenceSystemComponent, AZ::Component>()->Version(0);
+        }
+    }
+
+    void InferenceSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("MachineLearningInferenceService"));
+    }
+
+    void InferenceSystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("MachineLearningInferenceService"));
+    }
+
+    InferenceSystemComponent::InferenceSystemComponent()
+    {
+        if (InferenceSystemInterface::Get() == nullptr)
+        {
+            InferenceSystemInterface::Register(this);
+        }
+    }
+
+    InferenceSystemComponent::~InferenceSystemComponent()
+    {
+        if (InferenceSystemInterface::Get() == this)
+        {
+            InferenceSystemInterface::Unregister(this);
+        }
+    }
+
+    void InferenceSystemComponent::Activate()
+    {
+        InferenceSystemRequestBus::Handler::BusConnect();
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void InferenceSystemComponent::Deactivate()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        InferenceSystemRequestBus::Handler::BusDisconnect();
+    }
+
+    void InferenceSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        ExecutePendingInferences();
+    }
+
+    int InferenceSystemComponent::GetTickOrder()
+    {
+        // Agents submit their requests during the regular tick, running last ensures every result is delivered before the next tick
+        return AZ::TICK_LAST;
+    }
+
+    void InferenceSystemComponent::SubmitInference(INeuralNetworkPtr model, const AZ::VectorN& activations, InferenceCallback callback)
+    {
+        m_inferenceQueue.Submit(model, activations, AZStd::move(callback));
+    }
+
+    void InferenceSystemComponent::ExecutePendingInferences()
+    {
+        AZ::JobContext* jobContext = ml_inferenceUseJobs ? AZ::JobContext::GetGlobalContext() : nullptr;
+        m_inferenceQueue.Execute(m_contextPool, jobContext, ml_inferenceSamplesPerJob);
+    }
+
+    IInferenceContextPtr InferenceSystemComponent::AcquireInferenceContext(INeuralNetworkPtr model)
+    {
+        return m_contextPool.Acquire(model);
+    }
+
+    void InferenceSystemComponent::ReleaseInferenceContext(INeuralNetworkPtr model, IInferenceContextPtr context)
+    {
+        m_contextPool.Release(model, context);
+    }
+
+    void InferenceSystemComponent::ReleaseModel(INeuralNetworkPtr model)
+    {
+        m_inferenceQueue.Remove(model);
+        m_contextPool.Clear(model);
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <MachineLearning/IInferenceSystem.h>
+#include <Algorithms/BatchInference.h>
+
+namespace MachineLearning
+{
+    //! Gathers inference requests submitted by runtime agents during a tick and evaluates them as one batched forward pass per model.
+    class InferenceSystemComponent
+        : public AZ::Component
+        , public AZ::TickBus::Handler
+        , protected InferenceSystemRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT_DECL(InferenceSystemComponent);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        InferenceSystemComponent();
+        ~InferenceSystemComponent();
+
+    protected:
+
+        //! AZ::Component interface
+        //! @{
+        void Activate() override;
+        void Deactivate() override;
+        //! @}
+
+        //! AZ::TickBus::Handler interface
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //! @}
+
+        //! IInferenceSystem interface
+        //! @{
+        void SubmitInference(INeuralNetworkPtr model, const AZ::VectorN& activations, InferenceCallback callback) override;
+        void ExecutePendingInferences() override;
+        IInferenceContextPtr AcquireInferenceContext(INeuralNetworkPtr model) override;
+        void ReleaseInferenceContext(INeuralNetworkPtr model, IInferenceContextPtr context) override;
+        void ReleaseModel(INeuralNetworkPtr model) override;
+        //! @}
+
+    private:
+
+        InferenceContextPool m_contextPool;
+        BatchInferenceQueue m_inferenceQueue;
+    };
+}
@@ -10,6 +10,7 @@
 #include <AzCore/Memory/Memory.h>
 #include <MachineLearning/MachineLearningTypeIds.h>
 #include <MachineLearningSystemComponent.h>
+#include <InferenceSystemComponent.h>
 #include <Components/MultilayerPerceptronComponent.h>
 
 namespace MachineLearning
@@ -26,6 +27,7 @@ namespace MachineLearning
         // This happens through the [MyComponent]::Reflect() function.
         m_descriptors.insert(m_descriptors.end(), {
             MachineLearningSystemComponent::CreateDescriptor(),
+            InferenceSystemComponent::CreateDescriptor(),
             MultilayerPerceptronComponent::CreateDescriptor()
         });
     }
@@ -34,6 +36,7 @@ namespace MachineLearning
     {
         return AZ::ComponentTypeList{
             azrtti_typeid<MachineLearningSystemComponent>(),
+            azrtti_typeid<InferenceSystemComponent>(),
         };
     }
 } // namespace MachineLearning
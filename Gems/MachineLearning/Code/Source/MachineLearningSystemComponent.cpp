@@ -8,6 +8,7 @@
 
 #include "MachineLearningSystemComponent.h"
 #include <MachineLearning/MachineLearningTypeIds.h>
+#include <MachineLearning/IInferenceSystem.h>
 #include <MachineLearning/Types.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -122,11 +123,37 @@ namespace MachineLearning
 
     void MachineLearningSystemComponent::UnregisterModel(INeuralNetworkPtr model)
     {
+        // Make sure no pooled inference state outlives the model
+        if (IInferenceSystem* inferenceSystem = InferenceSystemInterface::Get())
+        {
+            inferenceSystem->ReleaseModel(model);
+        }
         m_registeredModels.erase(model);
+
+        AZStd::lock_guard lock(m_trainingMetricsMutex);
+        m_trainingMetrics.erase(model.get());
     }
 
     ModelSet& MachineLearningSystemComponent::GetModelSet()
     {
         return m_registeredModels;
     }
+
+    void MachineLearningSystemComponent::ReportTrainingMetrics(INeuralNetworkPtr model, const TrainingMetrics& metrics)
+    {
+        AZStd::lock_guard lock(m_trainingMetricsMutex);
+        m_trainingMetrics[model.get()] = metrics;
+    }
+
+    bool MachineLearningSystemComponent::GetTrainingMetrics(INeuralNetworkPtr model, TrainingMetrics& metrics) const
+    {
+        AZStd::lock_guard lock(m_trainingMetricsMutex);
+        auto iter = m_trainingMetrics.find(model.get());
+        if (iter == m_trainingMetrics.end())
+        {
+            return false;
+        }
+        metrics = iter->second;
+        return true;
+    }
 }
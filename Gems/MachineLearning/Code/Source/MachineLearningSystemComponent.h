@@ -11,6 +11,8 @@
 #include <AzCore/Component/Component.h>
 #include <MachineLearning/IMachineLearning.h>
 #include <Assets/ModelAsset.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace MachineLearning
 {
@@ -45,11 +47,18 @@ namespace MachineLearning
         void RegisterModel(INeuralNetworkPtr model) override;
         void UnregisterModel(INeuralNetworkPtr model) override;
         ModelSet& GetModelSet() override;
+        void ReportTrainingMetrics(INeuralNetworkPtr model, const TrainingMetrics& metrics) override;
+        bool GetTrainingMetrics(INeuralNetworkPtr model, TrainingMetrics& metrics) const override;
         //! @}
 
     private:
 
         ModelSet m_registeredModels;
+
+        //! Training metrics are reported from training threads, so these are guarded separately from the model set.
+        AZStd::unordered_map<const INeuralNetwork*, TrainingMetrics> m_trainingMetrics;
+        mutable AZStd::mutex m_trainingMetricsMutex;
+
         AZStd::unique_ptr<ModelAssetHandler> m_assetHandler;
     };
 }
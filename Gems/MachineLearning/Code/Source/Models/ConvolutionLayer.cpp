@@ -0,0 +1,479 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Models/ConvolutionLayer.h>
+#include <Algorithms/Activations.h>
+#include <Algorithms/BatchOperations.h>
+#include <Algorithms/Optimizers.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/MathUtils.h>
+#include <random>
+
+namespace MachineLearning
+{
+    ConvolutionLayer::ConvolutionLayer
+    (
+        ActivationFunctions activationFunction,
+        const ImageShape& inputShape,
+        AZStd::size_t filterCount,
+        AZStd::size_t kernelSize,
+        AZStd::size_t stride,
+        AZStd::size_t padding
+    )
+        : m_inputShape(inputShape)
+        , m_filterCount(filterCount)
+        , m_kernelSize(kernelSize)
+        , m_stride(stride)
+        , m_padding(padding)
+        , m_activationFunction(activationFunction)
+    {
+        OnSizesChanged();
+    }
+
+    LayerTypes ConvolutionLayer::GetLayerType() const
+    {
+        return LayerTypes::Convolution;
+    }
+
+    AZStd::size_t ConvolutionLayer::GetInputSize() const
+    {
+        return m_inputShape.GetSize();
+    }
+
+    AZStd::size_t ConvolutionLayer::GetOutputSize() const
+    {
+        return m_outputShape.GetSize();
+    }
+
+    ImageShape ConvolutionLayer::GetOutputShape() const
+    {
+        return m_outputShape;
+    }
+
+    ImageShape ConvolutionLayer::GetInputShape() const
+    {
+        return m_inputShape;
+    }
+
+    void ConvolutionLayer::SetInputShape(const ImageShape& inputShape)
+    {
+        m_inputShape = inputShape;
+        OnSizesChanged();
+    }
+
+    AZStd::size_t ConvolutionLayer::GetParameterCount() const
+    {
+        return m_filterCount * GetKernelElementCount() + m_filterCount;
+    }
+
+    AZStd::unique_ptr<ILayer> ConvolutionLayer::Clone() const
+    {
+        return AZStd::make_unique<ConvolutionLayer>(*this);
+    }
+
+    AZStd::size_t ConvolutionLayer::GetKernelElementCount() const
+    {
+        return m_kernelSize * m_kernelSize * m_inputShape.m_channels;
+    }
+
+    AZStd::size_t ConvolutionLayer::GetPixelCount() const
+    {
+        return m_outputShape.m_width * m_outputShape.m_height;
+    }
+
+    const AZ::VectorN& ConvolutionLayer::Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations)
+    {
+        const AZ::VectorN* activationPointer = &activations;
+        ComputePixelOutputs(inferenceData, AZStd::span<const AZ::VectorN* const>(&activationPointer, 1));
+        PackPixels(inferenceData.m_pixelOutputs, inferenceData.m_output);
+        if (RequiresActivationInput(m_activationFunction))
+        {
+            inferenceData.m_activationInput = inferenceData.m_output;
+        }
+        Activate(m_activationFunction, inferenceData.m_output, inferenceData.m_output);
+        return inferenceData.m_output;
+    }
+
+    void ConvolutionLayer::AccumulateGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, const AZ::VectorN& previousLayerGradients, bool skipActivationDerivative)
+    {
+        AZ_Assert(samples > 0, "The accumulated sample count must include the current sample");
+
+        // Compute the partial derivatives of the output with respect to the activation function
+        if (skipActivationDerivative)
+        {
+            trainingData.m_activationGradients = previousLayerGradients;
+        }
+        else
+        {
+            Activate_Derivative(m_activationFunction, inferenceData.m_activationInput, inferenceData.m_output, previousLayerGradients, trainingData.m_activationGradients);
+        }
+
+        trainingData.m_pixelGradients.resize(GetPixelCount());
+        UnpackPixels(trainingData.m_activationGradients, trainingData.m_pixelGradients);
+        AccumulatePixelGradients(samples, 1, trainingData, inferenceData);
+        ColumnsToImage(trainingData.m_columnGradients, trainingData.m_backpropagationGradients);
+    }
+
+    AZStd::span<const AZ::VectorN* const> ConvolutionLayer::ForwardBatch(LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN* const> activations)
+    {
+        // The columns of the whole batch are multiplied by the filters in a single GEMM, so the filters are only streamed through cache once per batch
+        ComputePixelOutputs(inferenceData, activations);
+
+        const AZStd::size_t pixelCount = GetPixelCount();
+        inferenceData.m_batchOutput.resize(activations.size());
+        inferenceData.m_batchOutputPointers.resize(activations.size());
+        for (AZStd::size_t iter = 0; iter < activations.size(); ++iter)
+        {
+            PackPixels(AZStd::span<const AZ::VectorN>(inferenceData.m_pixelOutputs.data() + iter * pixelCount, pixelCount), inferenceData.m_batchOutput[iter]);
+            inferenceData.m_batchOutputPointers[iter] = &inferenceData.m_batchOutput[iter];
+        }
+
+        if (RequiresActivationInput(m_activationFunction))
+        {
+            inferenceData.m_batchActivationInput.assign(inferenceData.m_batchOutput.begin(), inferenceData.m_batchOutput.end());
+        }
+        for (AZ::VectorN& output : inferenceData.m_batchOutput)
+        {
+            Activate(m_activationFunction, output, output);
+        }
+        return inferenceData.m_batchOutputPointers;
+    }
+
+    void ConvolutionLayer::AccumulateBatchGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN> previousLayerGradients, bool skipActivationDerivative)
+    {
+        const AZStd::size_t batchSize = previousLayerGradients.size();
+        const AZStd::size_t pixelCount = GetPixelCount();
+        AZ_Assert(samples >= batchSize, "The accumulated sample count must include the current batch");
+        AZ_Assert(inferenceData.m_batchOutput.size() == batchSize, "The batch size of the forward and backward passes must match");
+        if (batchSize == 0)
+        {
+            return;
+        }
+
+        // Compute the partial derivatives of the output with respect to the activation function
+        trainingData.m_batchActivationGradients.resize(batchSize);
+        trainingData.m_pixelGradients.resize(batchSize * pixelCount);
+        const bool requiresActivationInput = RequiresActivationInput(m_activationFunction);
+        for (AZStd::size_t iter = 0; iter < batchSize; ++iter)
+        {
+            if (skipActivationDerivative)
+            {
+                trainingData.m_batchActivationGradients[iter] = previousLayerGradients[iter];
+            }
+            else if (requiresActivationInput)
+            {
+                Activate_Derivative(m_activationFunction, inferenceData.m_batchActivationInput[iter], inferenceData.m_batchOutput[iter], previousLayerGradients[iter], trainingData.m_batchActivationGradients[iter]);
+            }
+            else
+            {
+                Activate_Derivative(m_activationFunction, inferenceData.m_batchOutput[iter], previousLayerGradients[iter], trainingData.m_batchActivationGradients[iter]);
+            }
+            UnpackPixels(trainingData.m_batchActivationGradients[iter], AZStd::span<AZ::VectorN>(trainingData.m_pixelGradients.data() + iter * pixelCount, pixelCount));
+        }
+
+        AccumulatePixelGradients(samples, batchSize, trainingData, inferenceData);
+
+        trainingData.m_batchBackpropagationGradients.resize(batchSize);
+        for (AZStd::size_t iter = 0; iter < batchSize; ++iter)
+        {
+            ColumnsToImage(AZStd::span<const AZ::VectorN>(trainingData.m_columnGradients.data() + iter * pixelCount, pixelCount), trainingData.m_batchBackpropagationGradients[iter]);
+        }
+    }
+
+    void ConvolutionLayer::ReduceGradients(LayerTrainingData& destination, AZStd::size_t destinationSamples, LayerTrainingData& source, AZStd::size_t sourceSamples)
+    {
+        const AZStd::size_t totalSamples = destinationSamples + sourceSamples;
+        if (sourceSamples == 0)
+        {
+            return;
+        }
+
+        const AZStd::size_t kernelElements = GetKernelElementCount();
+        if (destination.m_biasGradients.GetDimensionality() != m_filterCount)
+        {
+            destination.m_biasGradients = AZ::VectorN::CreateZero(m_filterCount);
+        }
+        if ((destination.m_weightGradients.GetRowCount() != m_filterCount) || (destination.m_weightGradients.GetColumnCount() != kernelElements))
+        {
+            destination.m_weightGradients = AZ::MatrixMxN::CreateZero(m_filterCount, kernelElements);
+        }
+
+        // Both sides hold running averages, so the combined average weights each side by its share of the samples
+        const float destinationWeight = static_cast<float>(destinationSamples) / static_cast<float>(totalSamples);
+        const float sourceWeight = static_cast<float>(sourceSamples) / static_cast<float>(totalSamples);
+        WeightedAccumulate(source.m_weightGradients, sourceWeight, destinationWeight, destination.m_weightGradients);
+        WeightedAccumulate(source.m_biasGradients, sourceWeight, destinationWeight, destination.m_biasGradients);
+
+        source.m_biasGradients.SetZero();
+        source.m_weightGradients.SetZero();
+    }
+
+    void ConvolutionLayer::ApplyGradients(LayerTrainingData& trainingData, float learningRate, const OptimizerParameters& optimizer)
+    {
+        PrepareOptimizerState(trainingData, optimizer, m_filterCount, GetKernelElementCount());
+
+        ApplyOptimizer(optimizer, learningRate, trainingData.m_optimizerStep, m_weights, trainingData.m_weightGradients, trainingData.m_weightFirstMoments, trainingData.m_weightSecondMoments);
+        ApplyOptimizer(optimizer, learningRate, trainingData.m_optimizerStep, m_biases, trainingData.m_biasGradients, trainingData.m_biasFirstMoments, trainingData.m_biasSecondMoments);
+    }
+
+    bool ConvolutionLayer::Serialize(AzNetworking::ISerializer& serializer)
+    {
+        const bool result = serializer.Serialize(m_inputShape.m_width, "inputWidth")
+            && serializer.Serialize(m_inputShape.m_height, "inputHeight")
+            && serializer.Serialize(m_inputShape.m_channels, "inputChannels")
+            && serializer.Serialize(m_filterCount, "filterCount")
+            && serializer.Serialize(m_kernelSize, "kernelSize")
+            && serializer.Serialize(m_stride, "stride")
+            && serializer.Serialize(m_padding, "padding")
+            && serializer.Serialize(m_weights, "weights")
+            && serializer.Serialize(m_biases, "biases")
+            && serializer.Serialize(m_activationFunction, "activationFunction");
+        if (!result)
+        {
+            return false;
+        }
+
+        if (serializer.GetSerializerMode() != AzNetworking::SerializerMode::WriteToObject)
+        {
+            return true;
+        }
+
+        // Inference indexes the filters by the layer configuration, so a layer whose parameters do not match it is rejected on load
+        const AZStd::size_t paddedWidth = m_inputShape.m_width + 2 * m_padding;
+        const AZStd::size_t paddedHeight = m_inputShape.m_height + 2 * m_padding;
+        const bool validConfiguration = (m_stride > 0) && (m_kernelSize > 0) && (m_kernelSize <= paddedWidth) && (m_kernelSize <= paddedHeight);
+        if (!validConfiguration
+         || (m_weights.GetRowCount() != m_filterCount)
+         || (m_weights.GetColumnCount() != GetKernelElementCount())
+         || (m_biases.GetDimensionality() != m_filterCount))
+        {
+            AZLOG_ERROR("Convolution layer parameters do not match its configuration, the layer is corrupt");
+            return false;
+        }
+
+        // The output shape is derived from the layer configuration, so it is not persisted
+        UpdateOutputShape();
+        return true;
+    }
+
+    AZStd::size_t ConvolutionLayer::EstimateSerializeSize() const
+    {
+        const AZStd::size_t padding = 64; // 64 bytes of extra padding just in case
+        return padding
+             + sizeof(AZStd::size_t) * 3 // for m_inputShape
+             + sizeof(m_filterCount)
+             + sizeof(m_kernelSize)
+             + sizeof(m_stride)
+             + sizeof(m_padding)
+             + sizeof(AZStd::size_t) // for m_weights row count
+             + sizeof(AZStd::size_t) // for m_weights column count
+             + sizeof(AZStd::size_t) // for m_weights vector size
+             + sizeof(float) * m_filterCount * GetKernelElementCount() // m_weights buffer
+             + sizeof(AZStd::size_t) // for m_biases dimensionality
+             + sizeof(AZStd::size_t) // for m_biases vector size
+             + sizeof(float) * m_filterCount // m_biases buffer
+             + sizeof(m_activationFunction);
+    }
+
+    void ConvolutionLayer::OnSizesChanged()
+    {
+        UpdateOutputShape();
+
+        // Every filter sees kernelSize * kernelSize * channels inputs, so that is the fan-in used to scale the initial weights
+        // Kaiming He initialization is used for ReLU and its variants, otherwise the variance is simply the reciprocal of the fan-in
+        const bool rectifiedActivation = (m_activationFunction == ActivationFunctions::ReLU)
+                                      || (m_activationFunction == ActivationFunctions::LeakyReLU)
+                                      || (m_activationFunction == ActivationFunctions::GELU);
+        const float fanIn = static_cast<float>(AZStd::max<AZStd::size_t>(GetKernelElementCount(), 1));
+        const float standardDeviation = AZ::Sqrt(rectifiedActivation ? 2.0f / fanIn : 1.0f / fanIn);
+        std::random_device rd{};
+        std::mt19937 gen{ rd() };
+        auto dist = std::normal_distribution<float>{ 0.0f, standardDeviation };
+        m_weights = AZ::MatrixMxN::CreateZero(m_filterCount, GetKernelElementCount());
+        for (AZStd::size_t row = 0; row < m_weights.GetRowCount(); ++row)
+        {
+            for (AZStd::size_t col = 0; col < m_weights.GetColumnCount(); ++col)
+            {
+                m_weights.SetElement(row, col, dist(gen));
+            }
+        }
+
+        m_biases = AZ::VectorN(m_filterCount, 0.01f);
+    }
+
+    void ConvolutionLayer::UpdateOutputShape()
+    {
+        const AZStd::size_t paddedWidth = m_inputShape.m_width + 2 * m_padding;
+        const AZStd::size_t paddedHeight = m_inputShape.m_height + 2 * m_padding;
+        AZ_Assert(m_stride > 0, "The convolution stride must be at least one");
+        AZ_Assert((m_kernelSize <= paddedWidth) && (m_kernelSize <= paddedHeight), "The convolution kernel is larger than the padded input image");
+        const bool valid = (m_stride > 0) && (m_kernelSize > 0) && (m_kernelSize <= paddedWidth) && (m_kernelSize <= paddedHeight);
+        m_outputShape.m_width = valid ? (paddedWidth - m_kernelSize) / m_stride + 1 : 0;
+        m_outputShape.m_height = valid ? (paddedHeight - m_kernelSize) / m_stride + 1 : 0;
+        m_outputShape.m_channels = m_filterCount;
+    }
+
+    void ConvolutionLayer::ComputePixelOutputs(LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN* const> activations) const
+    {
+        const AZStd::size_t pixelCount = GetPixelCount();
+        const AZStd::size_t columnCount = pixelCount * activations.size();
+        inferenceData.m_columns.resize(columnCount);
+        inferenceData.m_columnPointers.resize(columnCount);
+        inferenceData.m_pixelOutputs.resize(columnCount);
+        for (AZStd::size_t iter = 0; iter < activations.size(); ++iter)
+        {
+            AZ_Assert(activations[iter]->GetDimensionality() == GetInputSize(), "The activation vector does not match the input shape of the convolution layer");
+            ImageToColumns(*activations[iter], AZStd::span<AZ::VectorN>(inferenceData.m_columns.data() + iter * pixelCount, pixelCount));
+        }
+
+        for (AZStd::size_t iter = 0; iter < columnCount; ++iter)
+        {
+            inferenceData.m_columnPointers[iter] = &inferenceData.m_columns[iter];
+            inferenceData.m_pixelOutputs[iter] = m_biases;
+        }
+        BatchVectorMatrixMultiply(m_weights, inferenceData.m_columnPointers, inferenceData.m_pixelOutputs);
+    }
+
+    void ConvolutionLayer::PackPixels(AZStd::span<const AZ::VectorN> pixels, AZ::VectorN& image) const
+    {
+        if (image.GetDimensionality() != GetOutputSize())
+        {
+            image = AZ::VectorN::CreateZero(GetOutputSize());
+        }
+
+        // Each pixel holds one output per filter, which are the contiguous channels of that pixel in the output image
+        for (AZStd::size_t pixel = 0; pixel < pixels.size(); ++pixel)
+        {
+            for (AZStd::size_t filter = 0; filter < m_filterCount; ++filter)
+            {
+                image.SetElement(pixel * m_filterCount + filter, pixels[pixel].GetElement(filter));
+            }
+        }
+    }
+
+    void ConvolutionLayer::UnpackPixels(const AZ::VectorN& image, AZStd::span<AZ::VectorN> pixels) const
+    {
+        for (AZStd::size_t pixel = 0; pixel < pixels.size(); ++pixel)
+        {
+            if (pixels[pixel].GetDimensionality() != m_filterCount)
+            {
+                pixels[pixel] = AZ::VectorN::CreateZero(m_filterCount);
+            }
+            for (AZStd::size_t filter = 0; filter < m_filterCount; ++filter)
+            {
+                pixels[pixel].SetElement(filter, image.GetElement(pixel * m_filterCount + filter));
+            }
+        }
+    }
+
+    void ConvolutionLayer::ImageToColumns(const AZ::VectorN& image, AZStd::span<AZ::VectorN> columns) const
+    {
+        const AZStd::size_t kernelElements = GetKernelElementCount();
+        const int64_t inputWidth = static_cast<int64_t>(m_inputShape.m_width);
+        const int64_t inputHeight = static_cast<int64_t>(m_inputShape.m_height);
+        const AZStd::size_t channels = m_inputShape.m_channels;
+        for (AZStd::size_t outputY = 0; outputY < m_outputShape.m_height; ++outputY)
+        {
+            for (AZStd::size_t outputX = 0; outputX < m_outputShape.m_width; ++outputX)
+            {
+                AZ::VectorN& column = columns[outputY * m_outputShape.m_width + outputX];
+                if (column.GetDimensionality() != kernelElements)
+                {
+                    column = AZ::VectorN::CreateZero(kernelElements);
+                }
+
+                AZStd::size_t element = 0;
+                for (AZStd::size_t kernelY = 0; kernelY < m_kernelSize; ++kernelY)
+                {
+                    const int64_t inputY = static_cast<int64_t>(outputY * m_stride + kernelY) - static_cast<int64_t>(m_padding);
+                    for (AZStd::size_t kernelX = 0; kernelX < m_kernelSize; ++kernelX)
+                    {
+                        const int64_t inputX = static_cast<int64_t>(outputX * m_stride + kernelX) - static_cast<int64_t>(m_padding);
+                        const bool inside = (inputY >= 0) && (inputY < inputHeight) && (inputX >= 0) && (inputX < inputWidth);
+                        const AZStd::size_t inputOffset = inside ? static_cast<AZStd::size_t>(inputY * inputWidth + inputX) * channels : 0;
+                        for (AZStd::size_t channel = 0; channel < channels; ++channel, ++element)
+                        {
+                            // Elements outside the input image are zero padding
+                            column.SetElement(element, inside ? image.GetElement(inputOffset + channel) : 0.0f);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void ConvolutionLayer::ColumnsToImage(AZStd::span<const AZ::VectorN> columns, AZ::VectorN& image) const
+    {
+        if (image.GetDimensionality() != GetInputSize())
+        {
+            image = AZ::VectorN::CreateZero(GetInputSize());
+        }
+        else
+        {
+            image.SetZero();
+        }
+
+        // Input windows overlap whenever the stride is smaller than the kernel, so each input element sums the gradients of every window it contributed to
+        const int64_t inputWidth = static_cast<int64_t>(m_inputShape.m_width);
+        const int64_t inputHeight = static_cast<int64_t>(m_inputShape.m_height);
+        const AZStd::size_t channels = m_inputShape.m_channels;
+        for (AZStd::size_t outputY = 0; outputY < m_outputShape.m_height; ++outputY)
+        {
+            for (AZStd::size_t outputX = 0; outputX < m_outputShape.m_width; ++outputX)
+            {
+                const AZ::VectorN& column = columns[outputY * m_outputShape.m_width + outputX];
+                AZStd::size_t element = 0;
+                for (AZStd::size_t kernelY = 0; kernelY < m_kernelSize; ++kernelY)
+                {
+                    const int64_t inputY = static_cast<int64_t>(outputY * m_stride + kernelY) - static_cast<int64_t>(m_padding);
+                    for (AZStd::size_t kernelX = 0; kernelX < m_kernelSize; ++kernelX)
+                    {
+                        const int64_t inputX = static_cast<int64_t>(outputX * m_stride + kernelX) - static_cast<int64_t>(m_padding);
+                        if ((inputY < 0) || (inputY >= inputHeight) || (inputX < 0) || (inputX >= inputWidth))
+                        {
+                            element += channels;
+                            continue;
+                        }
+
+                        const AZStd::size_t inputOffset = static_cast<AZStd::size_t>(inputY * inputWidth + inputX) * channels;
+                        for (AZStd::size_t channel = 0; channel < channels; ++channel, ++element)
+                        {
+                            image.SetElement(inputOffset + channel, image.GetElement(inputOffset + channel) + column.GetElement(element));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void ConvolutionLayer::AccumulatePixelGradients(AZStd::size_t samples, AZStd::size_t batchSize, LayerTrainingData& trainingData, LayerInferenceData& inferenceData) const
+    {
+        AZ_Assert(inferenceData.m_columnPointers.size() == trainingData.m_pixelGradients.size(), "The batch size of the forward and backward passes must match");
+
+        const AZStd::size_t kernelElements = GetKernelElementCount();
+        if (trainingData.m_biasGradients.GetDimensionality() != m_filterCount)
+        {
+            trainingData.m_biasGradients = AZ::VectorN::CreateZero(m_filterCount);
+        }
+        if ((trainingData.m_weightGradients.GetRowCount() != m_filterCount) || (trainingData.m_weightGradients.GetColumnCount() != kernelElements))
+        {
+            trainingData.m_weightGradients = AZ::MatrixMxN::CreateZero(m_filterCount, kernelElements);
+        }
+
+        // The filters are shared by every pixel, so the gradient of a single sample is the sum over all of its pixels
+        // That sum is folded into the running average once per batch, exactly as the dense layers fold in the sum over a batch
+        const float decay = static_cast<float>(samples - batchSize) / static_cast<float>(samples);
+        const float scale = 1.0f / static_cast<float>(samples);
+        BatchOuterProductAccumulate(trainingData.m_pixelGradients, inferenceData.m_columnPointers, decay, scale, trainingData.m_weightGradients);
+        BatchVectorAccumulate(trainingData.m_pixelGradients, decay, scale, trainingData.m_biasGradients);
+
+        // Compute the gradients of every gathered input window, these are scattered back onto the input images by ColumnsToImage
+        trainingData.m_columnGradients.resize(trainingData.m_pixelGradients.size());
+        BatchVectorMatrixMultiplyLeft(trainingData.m_pixelGradients, m_weights, trainingData.m_columnGradients);
+    }
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/MatrixMxN.h>
+#include <Models/ILayer.h>
+#include <Models/Layer.h>
+
+namespace MachineLearning
+{
+    //! A two dimensional convolution layer operating on images stored in height, width, channel order.
+    //! The convolution is lowered to a matrix multiply (im2col), each output pixel gathers its input window into a column vector
+    //! so that every filter is applied to every pixel by the same GEMM kernels the dense layers use for mini-batches.
+    class ConvolutionLayer
+        : public ILayer
+    {
+    public:
+
+        AZ_RTTI(ConvolutionLayer, "{6B0D2B8E-1C9A-4F0E-8E55-3C7A5D9F2B61}", ILayer);
+
+        ConvolutionLayer() = default;
+        ConvolutionLayer(ConvolutionLayer&&) = default;
+        ConvolutionLayer(const ConvolutionLayer&) = default;
+        ConvolutionLayer
+        (
+            ActivationFunctions activationFunction,
+            const ImageShape& inputShape,
+            AZStd::size_t filterCount,
+            AZStd::size_t kernelSize,
+            AZStd::size_t stride = 1,
+            AZStd::size_t padding = 0
+        );
+        ~ConvolutionLayer() = default;
+
+        ConvolutionLayer& operator=(ConvolutionLayer&&) = default;
+        ConvolutionLayer& operator=(const ConvolutionLayer&) = default;
+
+        //! ILayer interface
+        //! @{
+        LayerTypes GetLayerType() const override;
+        AZStd::size_t GetInputSize() const override;
+        AZStd::size_t GetOutputSize() const override;
+        ImageShape GetOutputShape() const override;
+        ImageShape GetInputShape() const override;
+        void SetInputShape(const ImageShape& inputShape) override;
+        AZStd::size_t GetParameterCount() const override;
+        AZStd::unique_ptr<ILayer> Clone() const override;
+        const AZ::VectorN& Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations) override;
+        void AccumulateGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, const AZ::VectorN& previousLayerGradients, bool skipActivationDerivative = false) override;
+        AZStd::span<const AZ::VectorN* const> ForwardBatch(LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN* const> activations) override;
+        void AccumulateBatchGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN> previousLayerGradients, bool skipActivationDerivative = false) override;
+        void ReduceGradients(LayerTrainingData& destination, AZStd::size_t destinationSamples, LayerTrainingData& source, AZStd::size_t sourceSamples) override;
+        void ApplyGradients(LayerTrainingData& trainingData, float learningRate, const OptimizerParameters& optimizer = OptimizerParameters()) override;
+        bool Serialize(AzNetworking::ISerializer& serializer) override;
+        AZStd::size_t EstimateSerializeSize() const override;
+        //! @}
+
+        //! Returns the number of input elements each filter is applied to, kernelSize * kernelSize * input channels.
+        AZStd::size_t GetKernelElementCount() const;
+
+        //! Returns the number of output pixels, which is the number of columns gathered per sample.
+        AZStd::size_t GetPixelCount() const;
+
+        //! Updates the output shape and reinitializes the filters for the requested dimensionalities.
+        void OnSizesChanged();
+
+        // These are intentionally left public so that unit testing can exhaustively examine all layer state
+        ImageShape m_inputShape;
+        ImageShape m_outputShape;
+        AZStd::size_t m_filterCount = 0;
+        AZStd::size_t m_kernelSize = 0;
+        AZStd::size_t m_stride = 1;
+        AZStd::size_t m_padding = 0;
+
+        //! One row per filter, the columns are ordered by kernel row, kernel column and then input channel to match the gathered input windows.
+        AZ::MatrixMxN m_weights;
+        AZ::VectorN m_biases;
+        ActivationFunctions m_activationFunction = ActivationFunctions::ReLU;
+
+    private:
+
+        void UpdateOutputShape();
+
+        //! Gathers the input windows of every sample and computes the pre-activation output of every pixel into m_pixelOutputs.
+        void ComputePixelOutputs(LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN* const> activations) const;
+
+        //! Copies the pixel outputs of a single sample into an image vector.
+        void PackPixels(AZStd::span<const AZ::VectorN> pixels, AZ::VectorN& image) const;
+
+        //! Splits the gradients of a single output image into per pixel gradient vectors.
+        void UnpackPixels(const AZ::VectorN& image, AZStd::span<AZ::VectorN> pixels) const;
+
+        //! Gathers the input window of every output pixel of a single sample (im2col).
+        void ImageToColumns(const AZ::VectorN& image, AZStd::span<AZ::VectorN> columns) const;
+
+        //! Scatter-adds per pixel column gradients back onto the input image of a single sample (col2im).
+        void ColumnsToImage(AZStd::span<const AZ::VectorN> columns, AZ::VectorN& image) const;
+
+        //! Accumulates the filter and bias gradients of the gathered batch and computes the column gradients for back-propagation.
+        void AccumulatePixelGradients(AZStd::size_t samples, AZStd::size_t batchSize, LayerTrainingData& trainingData, LayerInferenceData& inferenceData) const;
+    };
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Models/ILayer.h>
+#include <Models/ConvolutionLayer.h>
+#include <Models/Layer.h>
+#include <Models/MaxPoolLayer.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace MachineLearning
+{
+    AZStd::unique_ptr<ILayer> CreateLayer(LayerTypes layerType)
+    {
+        switch (layerType)
+        {
+        case LayerTypes::Dense:
+            return AZStd::make_unique<Layer>();
+        case LayerTypes::Convolution:
+            return AZStd::make_unique<ConvolutionLayer>();
+        case LayerTypes::MaxPool:
+            return AZStd::make_unique<MaxPoolLayer>();
+        }
+        AZLOG_ERROR("Unknown layer type %u", static_cast<uint32_t>(layerType));
+        return nullptr;
+    }
+
+    bool SerializeLayers(AzNetworking::ISerializer& serializer, LayerPtrList& layers, const char* name)
+    {
+        const bool reading = (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject);
+        uint32_t layerCount = static_cast<uint32_t>(layers.size());
+        if (!serializer.Serialize(layerCount, name))
+        {
+            return false;
+        }
+
+        if (reading)
+        {
+            layers.clear();
+            layers.resize(layerCount);
+        }
+
+        for (LayerPtr& layer : layers)
+        {
+            LayerTypes layerType = reading ? LayerTypes::Dense : layer->GetLayerType();
+            if (!serializer.Serialize(layerType, "layerType"))
+            {
+                return false;
+            }
+
+            if (reading)
+            {
+                layer = CreateLayer(layerType);
+                if (!layer)
+                {
+                    return false;
+                }
+            }
+
+            if (!layer->Serialize(serializer))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    AZStd::size_t EstimateSerializeSize(const LayerPtrList& layers)
+    {
+        AZStd::size_t estimatedSize = sizeof(uint32_t);
+        for (const LayerPtr& layer : layers)
+        {
+            estimatedSize += sizeof(LayerTypes) + layer->EstimateSerializeSize();
+        }
+        return estimatedSize;
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/VectorN.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <MachineLearning/INeuralNetwork.h>
+
+namespace MachineLearning
+{
+    struct LayerInferenceData;
+    struct LayerTrainingData;
+
+    //! The dimensions of an image-like activation vector.
+    //! Elements are stored in height, width, channel order, so the channels of a single pixel are contiguous.
+    struct ImageShape
+    {
+        AZStd::size_t m_width = 0;
+        AZStd::size_t m_height = 0;
+        AZStd::size_t m_channels = 0;
+
+        AZStd::size_t GetSize() const { return m_width * m_height * m_channels; }
+
+        bool operator==(const ImageShape& rhs) const { return (m_width == rhs.m_width) && (m_height == rhs.m_height) && (m_channels == rhs.m_channels); }
+        bool operator!=(const ImageShape& rhs) const { return !(*this == rhs); }
+    };
+
+    //! The interface shared by every type of layer within a neural network.
+    //! Layers are stateless with respect to inference and training, all intermediate values are written to the provided layer data.
+    class ILayer
+    {
+    public:
+
+        AZ_RTTI(ILayer, "{0C6E3C55-0B8B-4C4B-9E2B-6B1E5A3E8F52}");
+
+        virtual ~ILayer() = default;
+
+        //! Returns the type of the layer, this is used to recreate the layer when it is deserialized.
+        virtual LayerTypes GetLayerType() const = 0;
+
+        //! Returns the number of elements in the activation vector the layer accepts.
+        virtual AZStd::size_t GetInputSize() const = 0;
+
+        //! Returns the number of elements in the output vector the layer produces.
+        virtual AZStd::size_t GetOutputSize() const = 0;
+
+        //! Returns the shape of the output vector, layers which do not operate on images return a single row with one channel.
+        virtual ImageShape GetOutputShape() const = 0;
+
+        //! Returns the shape of the input vector, layers which do not operate on images return a single row with one channel.
+        virtual ImageShape GetInputShape() const = 0;
+
+        //! Resizes the layer to accept the provided input shape, any trainable parameters are reinitialized for the new dimensions.
+        virtual void SetInputShape(const ImageShape& inputShape) = 0;
+
+        //! Returns the number of trainable weights and biases.
+        virtual AZStd::size_t GetParameterCount() const = 0;
+
+        //! Returns a deep copy of the layer.
+        virtual AZStd::unique_ptr<ILayer> Clone() const = 0;
+
+        //! Performs a basic forward pass on this layer, outputs are stored in m_output.
+        virtual const AZ::VectorN& Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations) = 0;
+
+        //! Accumulates the gradients of the layer parameters given the gradients of the loss with respect to the layer output.
+        //! This presumes that Forward was called immediately prior, the gradients with respect to the layer input are stored in m_backpropagationGradients.
+        virtual void AccumulateGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, const AZ::VectorN& previousLayerGradients, bool skipActivationDerivative = false) = 0;
+
+        //! Performs a forward pass on a batch of activation vectors, outputs are stored in m_batchOutput.
+        virtual AZStd::span<const AZ::VectorN* const> ForwardBatch(LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN* const> activations) = 0;
+
+        //! Batched equivalent of AccumulateGradients, samples is the total number of accumulated samples including this batch.
+        //! The gradients with respect to each layer input are stored in m_batchBackpropagationGradients.
+        virtual void AccumulateBatchGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN> previousLayerGradients, bool skipActivationDerivative = false) = 0;
+
+        //! Folds the gradients accumulated in source into destination, weighting each by its number of accumulated samples, then resets source.
+        virtual void ReduceGradients(LayerTrainingData& destination, AZStd::size_t destinationSamples, LayerTrainingData& source, AZStd::size_t sourceSamples) = 0;
+
+        //! Applies the accumulated gradients to the layer parameters using the requested optimizer and resets the gradients.
+        virtual void ApplyGradients(LayerTrainingData& trainingData, float learningRate, const OptimizerParameters& optimizer = OptimizerParameters()) = 0;
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        virtual bool Serialize(AzNetworking::ISerializer& serializer) = 0;
+
+        //! Returns the estimated size required to serialize this layer.
+        virtual AZStd::size_t EstimateSerializeSize() const = 0;
+    };
+
+    //! An owning pointer to a layer of any type.
+    //! Copying the pointer deep copies the layer, so that models and assets holding lists of layers keep their value semantics.
+    class LayerPtr
+    {
+    public:
+
+        LayerPtr() = default;
+        LayerPtr(AZStd::unique_ptr<ILayer> layer) : m_layer(AZStd::move(layer)) {}
+        LayerPtr(const LayerPtr& rhs) : m_layer(rhs.m_layer ? rhs.m_layer->Clone() : nullptr) {}
+        LayerPtr(LayerPtr&&) = default;
+        ~LayerPtr() = default;
+
+        LayerPtr& operator=(const LayerPtr& rhs)
+        {
+            if (this != &rhs)
+            {
+                m_layer = rhs.m_layer ? rhs.m_layer->Clone() : nullptr;
+            }
+            return *this;
+        }
+        LayerPtr& operator=(LayerPtr&&) = default;
+
+        ILayer* get() const { return m_layer.get(); }
+        ILayer* operator->() const { return m_layer.get(); }
+        ILayer& operator*() const { return *m_layer; }
+        explicit operator bool() const { return m_layer != nullptr; }
+
+    private:
+
+        AZStd::unique_ptr<ILayer> m_layer;
+    };
+
+    using LayerPtrList = AZStd::vector<LayerPtr>;
+
+    //! Creates an empty layer of the requested type, ready to be deserialized.
+    AZStd::unique_ptr<ILayer> CreateLayer(LayerTypes layerType);
+
+    //! Serializes a list of layers of any type, each layer is preceded by its type so that it can be recreated when reading.
+    //! @param serializer ISerializer instance to use for serialization
+    //! @return boolean true for success, false for serialization failure
+    bool SerializeLayers(AzNetworking::ISerializer& serializer, LayerPtrList& layers, const char* name);
+
+    //! Returns the estimated size required to serialize a list of layers.
+    AZStd::size_t EstimateSerializeSize(const LayerPtrList& layers);
+}
@@ -8,7 +8,9 @@
 
 #include <Models/MultilayerPerceptron.h>
 #include <Algorithms/Activations.h>
+#include <Algorithms/BatchOperations.h>
 #include <Algorithms/LossFunctions.h>
+#include <Algorithms/Optimizers.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -127,6 +129,108 @@ namespace MachineLearning
         }
     }
 
+    void ResizeGradients(LayerTrainingData& trainingData, AZStd::size_t inputSize, AZStd::size_t outputSize)
+    {
+        // Ensure our bias gradient vector is appropriately sized
+        if (trainingData.m_biasGradients.GetDimensionality() != outputSize)
+        {
+            trainingData.m_biasGradients = AZ::VectorN::CreateZero(outputSize);
+        }
+
+        // Ensure our weight gradient matrix is appropriately sized
+        if ((trainingData.m_weightGradients.GetRowCount() != outputSize) || (trainingData.m_weightGradients.GetColumnCount() != inputSize))
+        {
+            trainingData.m_weightGradients = AZ::MatrixMxN::CreateZero(outputSize, inputSize);
+        }
+
+        // Ensure our backpropagation gradient vector is appropriately sized
+        if (trainingData.m_backpropagationGradients.GetDimensionality() != inputSize)
+        {
+            trainingData.m_backpropagationGradients = AZ::VectorN::CreateZero(inputSize);
+        }
+    }
+
+    void LogGradients(LayerTrainingData& trainingData)
+    {
+        if (ml_logGradients)
+        {
+            float min = 0.f;
+            float max = 0.f;
+            GetMinMaxElements(trainingData.m_weightGradients, min, max);
+            AZLOG_INFO("Weight gradients: min value %f, max value %f", min, max);
+
+            GetMinMaxElements(trainingData.m_biasGradients, min, max);
+            AZLOG_INFO("Bias gradients: min value %f, max value %f", min, max);
+
+            GetMinMaxElements(trainingData.m_backpropagationGradients, min, max);
+            AZLOG_INFO("Back-propagation gradients: min value %f, max value %f", min, max);
+        }
+
+        if (ml_logGradientsVerbose)
+        {
+            DumpMatrixGradients(trainingData.m_weightGradients, "WeightGradients");
+            DumpVectorGradients(trainingData.m_biasGradients, "BiasGradients");
+        }
+    }
+
+    namespace
+    {
+        AZStd::size_t GetVectorMemoryUsage(const AZ::VectorN& value)
+        {
+            return value.GetVectorValues().capacity() * sizeof(AZ::Vector4);
+        }
+
+        AZStd::size_t GetVectorMemoryUsage(const AZStd::vector<AZ::VectorN>& values)
+        {
+            AZStd::size_t result = values.capacity() * sizeof(AZ::VectorN);
+            for (const AZ::VectorN& value : values)
+            {
+                result += GetVectorMemoryUsage(value);
+            }
+            return result;
+        }
+
+        AZStd::size_t GetMatrixMemoryUsage(const AZ::MatrixMxN& value)
+        {
+            return value.GetRowGroups() * value.GetColumnGroups() * sizeof(AZ::Matrix4x4);
+        }
+    }
+
+    AZStd::size_t GetMemoryUsage(const Layer& layer)
+    {
+        return GetMatrixMemoryUsage(layer.m_weights) + GetVectorMemoryUsage(layer.m_biases);
+    }
+
+    AZStd::size_t GetMemoryUsage(const LayerInferenceData& inferenceData)
+    {
+        return GetVectorMemoryUsage(inferenceData.m_output)
+             + GetVectorMemoryUsage(inferenceData.m_activationInput)
+             + GetVectorMemoryUsage(inferenceData.m_batchOutput)
+             + inferenceData.m_batchOutputPointers.capacity() * sizeof(const AZ::VectorN*)
+             + GetVectorMemoryUsage(inferenceData.m_batchActivationInput)
+             + inferenceData.m_quantizedActivations.capacity() * sizeof(int8_t)
+             + GetVectorMemoryUsage(inferenceData.m_columns)
+             + inferenceData.m_columnPointers.capacity() * sizeof(const AZ::VectorN*)
+             + GetVectorMemoryUsage(inferenceData.m_pixelOutputs)
+             + inferenceData.m_poolIndices.capacity() * sizeof(uint32_t);
+    }
+
+    AZStd::size_t GetMemoryUsage(const LayerTrainingData& trainingData)
+    {
+        return GetVectorMemoryUsage(trainingData.m_activationGradients)
+             + GetVectorMemoryUsage(trainingData.m_biasGradients)
+             + GetMatrixMemoryUsage(trainingData.m_weightGradients)
+             + GetVectorMemoryUsage(trainingData.m_backpropagationGradients)
+             + GetVectorMemoryUsage(trainingData.m_batchActivationGradients)
+             + GetVectorMemoryUsage(trainingData.m_batchBackpropagationGradients)
+             + GetVectorMemoryUsage(trainingData.m_pixelGradients)
+             + GetVectorMemoryUsage(trainingData.m_columnGradients)
+             + GetMatrixMemoryUsage(trainingData.m_weightFirstMoments)
+             + GetMatrixMemoryUsage(trainingData.m_weightSecondMoments)
+             + GetVectorMemoryUsage(trainingData.m_biasFirstMoments)
+             + GetVectorMemoryUsage(trainingData.m_biasSecondMoments);
+    }
+
     void Layer::Reflect(AZ::ReflectContext* context)
     {
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -172,75 +276,184 @@ namespace MachineLearning
         OnSizesChanged();
     }
 
+    LayerTypes Layer::GetLayerType() const
+    {
+        return LayerTypes::Dense;
+    }
+
+    AZStd::size_t Layer::GetInputSize() const
+    {
+        return m_inputSize;
+    }
+
+    AZStd::size_t Layer::GetOutputSize() const
+    {
+        return m_outputSize;
+    }
+
+    ImageShape Layer::GetOutputShape() const
+    {
+        return ImageShape{ m_outputSize, 1, 1 };
+    }
+
+    ImageShape Layer::GetInputShape() const
+    {
+        return ImageShape{ m_inputSize, 1, 1 };
+    }
+
+    void Layer::SetInputShape(const ImageShape& inputShape)
+    {
+        m_inputSize = inputShape.GetSize();
+        OnSizesChanged();
+    }
+
+    AZStd::size_t Layer::GetParameterCount() const
+    {
+        return m_inputSize * m_outputSize + m_outputSize;
+    }
+
+    AZStd::unique_ptr<ILayer> Layer::Clone() const
+    {
+        return AZStd::make_unique<Layer>(*this);
+    }
+
     const AZ::VectorN& Layer::Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations)
     {
         inferenceData.m_output = m_biases;
         AZ::VectorMatrixMultiply(m_weights, activations, inferenceData.m_output);
+        if (RequiresActivationInput(m_activationFunction))
+        {
+            inferenceData.m_activationInput = inferenceData.m_output;
+        }
         Activate(m_activationFunction, inferenceData.m_output, inferenceData.m_output);
         return inferenceData.m_output;
     }
 
-    void Layer::AccumulateGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, const AZ::VectorN& previousLayerGradients)
+    void Layer::AccumulateGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, const AZ::VectorN& previousLayerGradients, bool skipActivationDerivative)
     {
-        // Ensure our bias gradient vector is appropriately sized
-        if (trainingData.m_biasGradients.GetDimensionality() != m_outputSize)
-        {
-            trainingData.m_biasGradients = AZ::VectorN::CreateZero(m_outputSize);
-        }
+        ResizeGradients(trainingData, m_inputSize, m_outputSize);
 
-        // Ensure our weight gradient matrix is appropriately sized
-        if ((trainingData.m_weightGradients.GetRowCount() != m_outputSize) || (trainingData.m_weightGradients.GetColumnCount() != m_inputSize))
+        // Compute the partial derivatives of the output with respect to the activation function
+        if (skipActivationDerivative)
         {
-            trainingData.m_weightGradients = AZ::MatrixMxN::CreateZero(m_outputSize, m_inputSize);
+            trainingData.m_activationGradients = previousLayerGradients;
         }
-
-        // Ensure our backpropagation gradient vector is appropriately sized
-        if (trainingData.m_backpropagationGradients.GetDimensionality() != m_inputSize)
+        else
         {
-            trainingData.m_backpropagationGradients = AZ::VectorN::CreateZero(m_inputSize);
+            Activate_Derivative(m_activationFunction, inferenceData.m_activationInput, inferenceData.m_output, previousLayerGradients, trainingData.m_activationGradients);
         }
 
-        // Compute the partial derivatives of the output with respect to the activation function
-        Activate_Derivative(m_activationFunction, inferenceData.m_output, previousLayerGradients, trainingData.m_activationGradients);
-
         // Accumulate the partial derivatives of the weight matrix with respect to the loss function
         AccumulateWeightGradients(trainingData.m_activationGradients, *trainingData.m_lastInput, trainingData.m_weightGradients, samples);
 
         // Accumulate the partial derivatives of the bias vector with respect to the loss function
         AccumulateBiasGradients(trainingData.m_biasGradients, trainingData.m_activationGradients, samples);
 
-        // Accumulate the gradients to pass to the preceding layer for back-propagation
+        // Compute the gradients to pass to the preceding layer for back-propagation
+        trainingData.m_backpropagationGradients.SetZero();
         AZ::VectorMatrixMultiplyLeft(trainingData.m_activationGradients, m_weights, trainingData.m_backpropagationGradients);
 
-        if (ml_logGradients)
+        LogGradients(trainingData);
+    }
+
+    AZStd::span<const AZ::VectorN* const> Layer::ForwardBatch(LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN* const> activations)
+    {
+        inferenceData.m_batchOutput.resize(activations.size());
+        inferenceData.m_batchOutputPointers.resize(activations.size());
+        for (AZStd::size_t iter = 0; iter < activations.size(); ++iter)
         {
-            float min = 0.f;
-            float max = 0.f;
-            GetMinMaxElements(trainingData.m_weightGradients, min, max);
-            AZLOG_INFO("Weight gradients: min value %f, max value %f", min, max);
+            inferenceData.m_batchOutput[iter] = m_biases;
+            inferenceData.m_batchOutputPointers[iter] = &inferenceData.m_batchOutput[iter];
+        }
 
-            GetMinMaxElements(trainingData.m_biasGradients, min, max);
-            AZLOG_INFO("Bias gradients: min value %f, max value %f", min, max);
+        BatchVectorMatrixMultiply(m_weights, activations, inferenceData.m_batchOutput);
+        if (RequiresActivationInput(m_activationFunction))
+        {
+            inferenceData.m_batchActivationInput.assign(inferenceData.m_batchOutput.begin(), inferenceData.m_batchOutput.end());
+        }
+        for (AZ::VectorN& output : inferenceData.m_batchOutput)
+        {
+            Activate(m_activationFunction, output, output);
+        }
+        return inferenceData.m_batchOutputPointers;
+    }
 
-            GetMinMaxElements(trainingData.m_backpropagationGradients, min, max);
-            AZLOG_INFO("Back-propagation gradients: min value %f, max value %f", min, max);
+    void Layer::AccumulateBatchGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN> previousLayerGradients, bool skipActivationDerivative)
+    {
+        const AZStd::size_t batchSize = previousLayerGradients.size();
+        AZ_Assert(samples >= batchSize, "The accumulated sample count must include the current batch");
+        AZ_Assert(trainingData.m_lastBatchInput.size() == batchSize, "The batch size of the forward and backward passes must match");
+        if (batchSize == 0)
+        {
+            return;
         }
 
-        if (ml_logGradientsVerbose)
+        ResizeGradients(trainingData, m_inputSize, m_outputSize);
+
+        // Compute the partial derivatives of the output with respect to the activation function
+        trainingData.m_batchActivationGradients.resize(batchSize);
+        const bool requiresActivationInput = RequiresActivationInput(m_activationFunction);
+        for (AZStd::size_t iter = 0; iter < batchSize; ++iter)
         {
-            DumpMatrixGradients(trainingData.m_weightGradients, "WeightGradients");
-            DumpVectorGradients(trainingData.m_biasGradients, "BiasGradients");
+            if (skipActivationDerivative)
+            {
+                trainingData.m_batchActivationGradients[iter] = previousLayerGradients[iter];
+            }
+            else if (requiresActivationInput)
+            {
+                Activate_Derivative(m_activationFunction, inferenceData.m_batchActivationInput[iter], inferenceData.m_batchOutput[iter], previousLayerGradients[iter], trainingData.m_batchActivationGradients[iter]);
+            }
+            else
+            {
+                Activate_Derivative(m_activationFunction, inferenceData.m_batchOutput[iter], previousLayerGradients[iter], trainingData.m_batchActivationGradients[iter]);
+            }
+        }
+
+        // Rather than a running average per sample, the batch sum is folded into the running average once per batch
+        // average = average * (previousSamples / samples) + batchSum / samples
+        const float decay = static_cast<float>(samples - batchSize) / static_cast<float>(samples);
+        const float scale = 1.0f / static_cast<float>(samples);
+
+        // Accumulate the partial derivatives of the weight matrix with respect to the loss function
+        BatchOuterProductAccumulate(trainingData.m_batchActivationGradients, trainingData.m_lastBatchInput, decay, scale, trainingData.m_weightGradients);
+
+        // Accumulate the partial derivatives of the bias vector with respect to the loss function
+        BatchVectorAccumulate(trainingData.m_batchActivationGradients, decay, scale, trainingData.m_biasGradients);
+
+        // Accumulate the gradients to pass to the preceding layer for back-propagation
+        trainingData.m_batchBackpropagationGradients.resize(batchSize);
+        BatchVectorMatrixMultiplyLeft(trainingData.m_batchActivationGradients, m_weights, trainingData.m_batchBackpropagationGradients);
+
+        LogGradients(trainingData);
+    }
+
+    void Layer::ReduceGradients(LayerTrainingData& destination, AZStd::size_t destinationSamples, LayerTrainingData& source, AZStd::size_t sourceSamples)
+    {
+        const AZStd::size_t totalSamples = destinationSamples + sourceSamples;
+        if (sourceSamples == 0)
+        {
+            return;
         }
+
+        ResizeGradients(destination, m_inputSize, m_outputSize);
+
+        // Both sides hold running averages, so the combined average weights each side by its share of the samples
+        const float destinationWeight = static_cast<float>(destinationSamples) / static_cast<float>(totalSamples);
+        const float sourceWeight = static_cast<float>(sourceSamples) / static_cast<float>(totalSamples);
+        WeightedAccumulate(source.m_weightGradients, sourceWeight, destinationWeight, destination.m_weightGradients);
+        WeightedAccumulate(source.m_biasGradients, sourceWeight, destinationWeight, destination.m_biasGradients);
+
+        source.m_biasGradients.SetZero();
+        source.m_weightGradients.SetZero();
     }
 
-    void Layer::ApplyGradients(LayerTrainingData& trainingData, float learningRate)
+    void Layer::ApplyGradients(LayerTrainingData& trainingData, float learningRate, const OptimizerParameters& optimizer)
     {
-        m_weights -= trainingData.m_weightGradients * learningRate;
-        m_biases -= trainingData.m_biasGradients * learningRate;
+        PrepareOptimizerState(trainingData, optimizer, m_outputSize, m_inputSize);
 
-        trainingData.m_biasGradients.SetZero();
-        trainingData.m_weightGradients.SetZero();
-        trainingData.m_backpropagationGradients.SetZero();
+        // Each update is a single in-place pass that also resets the gradients for the next accumulation pass
+        ApplyOptimizer(optimizer, learningRate, trainingData.m_optimizerStep, m_weights, trainingData.m_weightGradients, trainingData.m_weightFirstMoments, trainingData.m_weightSecondMoments);
+        ApplyOptimizer(optimizer, learningRate, trainingData.m_optimizerStep, m_biases, trainingData.m_biasGradients, trainingData.m_biasFirstMoments, trainingData.m_biasSecondMoments);
     }
 
     bool Layer::Serialize(AzNetworking::ISerializer& serializer)
@@ -270,10 +483,13 @@ namespace MachineLearning
 
     void Layer::OnSizesChanged()
     {
-        // Specifically for ReLU, we use Kaiming He initialization as this is optimal for convergence
+        // Specifically for ReLU and its variants, we use Kaiming He initialization as this is optimal for convergence
         // For other activation functions we just use a standard normal distribution
-        float standardDeviation = (m_activationFunction == ActivationFunctions::ReLU) ? 2.0f / m_inputSize 
-                                                                                      : 1.0f / m_inputSize;
+        const bool rectifiedActivation = (m_activationFunction == ActivationFunctions::ReLU)
+                                      || (m_activationFunction == ActivationFunctions::LeakyReLU)
+                                      || (m_activationFunction == ActivationFunctions::GELU);
+        float standardDeviation = rectifiedActivation ? 2.0f / m_inputSize 
+                                                      : 1.0f / m_inputSize;
         std::random_device rd{};
         std::mt19937 gen{ rd() };
         auto dist = std::normal_distribution<float>{ 0.0f, standardDeviation };
@@ -288,4 +504,33 @@ namespace MachineLearning
 
         m_biases = AZ::VectorN(m_outputSize, 0.01f);
     }
+
+    void PrepareOptimizerState(LayerTrainingData& trainingData, const OptimizerParameters& optimizer, AZStd::size_t rowCount, AZStd::size_t columnCount)
+    {
+        // Moments accumulated by one optimizer are meaningless to another (momentum velocity is not an Adam first moment),
+        // and a change in dimensionality invalidates any accumulated state as well
+        const bool usesMoments = optimizer.m_optimizer != OptimizerFunctions::StochasticGradientDescent;
+        const bool optimizerChanged = trainingData.m_optimizerFunction != optimizer.m_optimizer;
+        const bool sizeChanged = (trainingData.m_weightFirstMoments.GetRowCount() != rowCount) || (trainingData.m_weightFirstMoments.GetColumnCount() != columnCount);
+        if (optimizerChanged || (usesMoments && sizeChanged))
+        {
+            trainingData.m_optimizerFunction = optimizer.m_optimizer;
+            trainingData.m_optimizerStep = 0;
+            if (usesMoments)
+            {
+                trainingData.m_weightFirstMoments = AZ::MatrixMxN::CreateZero(rowCount, columnCount);
+                trainingData.m_weightSecondMoments = AZ::MatrixMxN::CreateZero(rowCount, columnCount);
+                trainingData.m_biasFirstMoments = AZ::VectorN::CreateZero(rowCount);
+                trainingData.m_biasSecondMoments = AZ::VectorN::CreateZero(rowCount);
+            }
+            else
+            {
+                trainingData.m_weightFirstMoments = AZ::MatrixMxN();
+                trainingData.m_weightSecondMoments = AZ::MatrixMxN();
+                trainingData.m_biasFirstMoments = AZ::VectorN();
+                trainingData.m_biasSecondMoments = AZ::VectorN();
+            }
+        }
+        ++trainingData.m_optimizerStep;
+    }
 }
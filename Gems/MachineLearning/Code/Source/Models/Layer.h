@@ -9,8 +9,10 @@
 #pragma once
 
 #include <AzCore/Math/MatrixMxN.h>
+#include <AzCore/std/containers/span.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <MachineLearning/INeuralNetwork.h>
+#include <Models/ILayer.h>
 
 namespace MachineLearning
 {
@@ -18,12 +20,13 @@ namespace MachineLearning
     struct LayerInferenceData;
     struct LayerTrainingData;
 
-    //! A class representing a single layer within a neural network.
+    //! A class representing a single fully connected (dense) layer within a neural network.
     class Layer
+        : public ILayer
     {
     public:
 
-        AZ_TYPE_INFO(Layer, "{FB91E0A7-86C0-4431-83A8-04F8D8E1C9E2}");
+        AZ_RTTI(Layer, "{FB91E0A7-86C0-4431-83A8-04F8D8E1C9E2}", ILayer);
 
         //! AzCore Reflection.
         //! @param context reflection context
@@ -38,23 +41,47 @@ namespace MachineLearning
         Layer& operator=(Layer&&) = default;
         Layer& operator=(const Layer&) = default;
 
+        //! ILayer interface
+        //! @{
+        LayerTypes GetLayerType() const override;
+        AZStd::size_t GetInputSize() const override;
+        AZStd::size_t GetOutputSize() const override;
+        ImageShape GetOutputShape() const override;
+        ImageShape GetInputShape() const override;
+        void SetInputShape(const ImageShape& inputShape) override;
+        AZStd::size_t GetParameterCount() const override;
+        AZStd::unique_ptr<ILayer> Clone() const override;
+        //! @}
+
         //! Performs a basic forward pass on this layer, outputs are stored in m_output.
-        const AZ::VectorN& Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations);
+        const AZ::VectorN& Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations) override;
 
         //! Performs a gradient computation against the provided expected output using the provided gradients from the previous layer.
         //! This method presumes that we've completed a forward pass immediately prior to fill all the relevant vectors
-        void AccumulateGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, const AZ::VectorN& expected);
+        //! If skipActivationDerivative is true, the provided gradients are already taken with respect to the activation input (as for a fused softmax cross-entropy loss).
+        void AccumulateGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, const AZ::VectorN& expected, bool skipActivationDerivative = false) override;
+
+        //! Performs a forward pass on a batch of activation vectors, outputs are stored in m_batchOutput.
+        AZStd::span<const AZ::VectorN* const> ForwardBatch(LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN* const> activations) override;
+
+        //! Batched equivalent of AccumulateGradients, samples is the total number of accumulated samples including this batch.
+        //! This method presumes that we've completed a ForwardBatch immediately prior to fill all the relevant vectors
+        void AccumulateBatchGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN> previousLayerGradients, bool skipActivationDerivative = false) override;
+
+        //! Folds the gradients accumulated in source into destination, weighting each by its number of accumulated samples, then resets source.
+        //! This allows separate workers to accumulate gradients for disjoint parts of a mini-batch in parallel.
+        void ReduceGradients(LayerTrainingData& destination, AZStd::size_t destinationSamples, LayerTrainingData& source, AZStd::size_t sourceSamples) override;
 
-        //! Applies the current gradient values to the layers weights and biases and resets the gradient values for a new accumulation pass.
-        void ApplyGradients(LayerTrainingData& trainingData, float learningRate);
+        //! Applies the current gradient values to the layers weights and biases using the requested optimizer and resets the gradient values for a new accumulation pass.
+        void ApplyGradients(LayerTrainingData& trainingData, float learningRate, const OptimizerParameters& optimizer = OptimizerParameters()) override;
 
         //! Base serialize method for all serializable structures or classes to implement.
         //! @param serializer ISerializer instance to use for serialization
         //! @return boolean true for success, false for serialization failure
-        bool Serialize(AzNetworking::ISerializer& serializer);
+        bool Serialize(AzNetworking::ISerializer& serializer) override;
 
         //! Returns the estimated size required to serialize this layer.
-        AZStd::size_t EstimateSerializeSize() const;
+        AZStd::size_t EstimateSerializeSize() const override;
 
         //! Updates layer internals for it's requested dimensionalities.
         void OnSizesChanged();
@@ -71,6 +98,26 @@ namespace MachineLearning
     struct LayerInferenceData
     {
         AZ::VectorN m_output;
+
+        // This value will only be populated if the activation function derivative requires the activation input
+        AZ::VectorN m_activationInput;
+
+        // These values will only be populated if a batched forward pass is performed
+        AZStd::vector<AZ::VectorN> m_batchOutput;
+        AZStd::vector<const AZ::VectorN*> m_batchOutputPointers;
+        AZStd::vector<AZ::VectorN> m_batchActivationInput;
+
+        // This value will only be populated if quantized inference is performed
+        AZStd::vector<int8_t> m_quantizedActivations;
+
+        // These values will only be populated by convolution layers, each column holds the input window of a single output pixel (im2col)
+        // The columns of all samples of a batch are stored consecutively
+        AZStd::vector<AZ::VectorN> m_columns;
+        AZStd::vector<const AZ::VectorN*> m_columnPointers;
+        AZStd::vector<AZ::VectorN> m_pixelOutputs;
+
+        // This value will only be populated by pooling layers, the input element selected for each output element
+        AZStd::vector<uint32_t> m_poolIndices;
     };
 
     //! These values are read and written during training.
@@ -82,5 +129,38 @@ namespace MachineLearning
         AZ::VectorN m_biasGradients;
         AZ::MatrixMxN m_weightGradients;
         AZ::VectorN m_backpropagationGradients;
+
+        // These values will only be populated if batched backward propagation is performed
+        // m_lastBatchInput views the previous layer's output pointers in the inference context (or the caller's batch for the first layer),
+        // which are reallocated by the next forward pass, so it is only valid within a single ReverseBatch call and is cleared at its end
+        AZStd::span<const AZ::VectorN* const> m_lastBatchInput;
+        AZStd::vector<AZ::VectorN> m_batchActivationGradients;
+        AZStd::vector<AZ::VectorN> m_batchBackpropagationGradients;
+
+        // These values will only be populated by convolution layers, the per pixel output and column gradients
+        AZStd::vector<AZ::VectorN> m_pixelGradients;
+        AZStd::vector<AZ::VectorN> m_columnGradients;
+
+        // Optimizer state, these values will only be populated if an optimizer other than plain stochastic gradient descent is used
+        // The moments belong to m_optimizerFunction and are reset whenever a different optimizer is applied
+        OptimizerFunctions m_optimizerFunction = OptimizerFunctions::StochasticGradientDescent;
+        AZStd::size_t m_optimizerStep = 0;
+        AZ::MatrixMxN m_weightFirstMoments;
+        AZ::MatrixMxN m_weightSecondMoments;
+        AZ::VectorN m_biasFirstMoments;
+        AZ::VectorN m_biasSecondMoments;
     };
+
+    //! Returns the number of bytes held by the weights and biases of the provided layer.
+    AZStd::size_t GetMemoryUsage(const Layer& layer);
+
+    //! Returns the number of bytes of working memory held by the provided layer inference data.
+    AZStd::size_t GetMemoryUsage(const LayerInferenceData& inferenceData);
+
+    //! Returns the number of bytes of working memory held by the provided layer training data.
+    AZStd::size_t GetMemoryUsage(const LayerTrainingData& trainingData);
+
+    //! Prepares the optimizer state of the provided training data for the next step of the requested optimizer and advances its step count.
+    //! The moments are reset if the optimizer or the dimensionality of the parameters has changed since the previous step.
+    void PrepareOptimizerState(LayerTrainingData& trainingData, const OptimizerParameters& optimizer, AZStd::size_t rowCount, AZStd::size_t columnCount);
 }
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Models/MaxPoolLayer.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace MachineLearning
+{
+    MaxPoolLayer::MaxPoolLayer(const ImageShape& inputShape, AZStd::size_t poolSize, AZStd::size_t stride)
+        : m_inputShape(inputShape)
+        , m_poolSize(poolSize)
+        , m_stride((stride > 0) ? stride : poolSize)
+    {
+        UpdateOutputShape();
+    }
+
+    LayerTypes MaxPoolLayer::GetLayerType() const
+    {
+        return LayerTypes::MaxPool;
+    }
+
+    AZStd::size_t MaxPoolLayer::GetInputSize() const
+    {
+        return m_inputShape.GetSize();
+    }
+
+    AZStd::size_t MaxPoolLayer::GetOutputSize() const
+    {
+        return m_outputShape.GetSize();
+    }
+
+    ImageShape MaxPoolLayer::GetOutputShape() const
+    {
+        return m_outputShape;
+    }
+
+    ImageShape MaxPoolLayer::GetInputShape() const
+    {
+        return m_inputShape;
+    }
+
+    void MaxPoolLayer::SetInputShape(const ImageShape& inputShape)
+    {
+        m_inputShape = inputShape;
+        UpdateOutputShape();
+    }
+
+    AZStd::size_t MaxPoolLayer::GetParameterCount() const
+    {
+        return 0;
+    }
+
+    AZStd::unique_ptr<ILayer> MaxPoolLayer::Clone() const
+    {
+        return AZStd::make_unique<MaxPoolLayer>(*this);
+    }
+
+    const AZ::VectorN& MaxPoolLayer::Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations)
+    {
+        inferenceData.m_poolIndices.resize(GetOutputSize());
+        Pool(activations, inferenceData.m_output, inferenceData.m_poolIndices.data());
+        return inferenceData.m_output;
+    }
+
+    void MaxPoolLayer::AccumulateGradients(AZStd::size_t, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, const AZ::VectorN& previousLayerGradients, bool)
+    {
+        Unpool(previousLayerGradients, inferenceData.m_poolIndices.data(), trainingData.m_backpropagationGradients);
+    }
+
+    AZStd::span<const AZ::VectorN* const> MaxPoolLayer::ForwardBatch(LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN* const> activations)
+    {
+        const AZStd::size_t outputSize = GetOutputSize();
+        inferenceData.m_poolIndices.resize(activations.size() * outputSize);
+        inferenceData.m_batchOutput.resize(activations.size());
+        inferenceData.m_batchOutputPointers.resize(activations.size());
+        for (AZStd::size_t iter = 0; iter < activations.size(); ++iter)
+        {
+            Pool(*activations[iter], inferenceData.m_batchOutput[iter], inferenceData.m_poolIndices.data() + iter * outputSize);
+            inferenceData.m_batchOutputPointers[iter] = &inferenceData.m_batchOutput[iter];
+        }
+        return inferenceData.m_batchOutputPointers;
+    }
+
+    void MaxPoolLayer::AccumulateBatchGradients(AZStd::size_t, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN> previousLayerGradients, bool)
+    {
+        const AZStd::size_t batchSize = previousLayerGradients.size();
+        const AZStd::size_t outputSize = GetOutputSize();
+        AZ_Assert(inferenceData.m_poolIndices.size() == batchSize * outputSize, "The batch size of the forward and backward passes must match");
+        trainingData.m_batchBackpropagationGradients.resize(batchSize);
+        for (AZStd::size_t iter = 0; iter < batchSize; ++iter)
+        {
+            Unpool(previousLayerGradients[iter], inferenceData.m_poolIndices.data() + iter * outputSize, trainingData.m_batchBackpropagationGradients[iter]);
+        }
+    }
+
+    void MaxPoolLayer::ReduceGradients(LayerTrainingData&, AZStd::size_t, LayerTrainingData&, AZStd::size_t)
+    {
+        // Pooling layers have no parameters, so there are no gradients to reduce
+    }
+
+    void MaxPoolLayer::ApplyGradients(LayerTrainingData&, float, const OptimizerParameters&)
+    {
+        // Pooling layers have no parameters, so there are no gradients to apply
+    }
+
+    bool MaxPoolLayer::Serialize(AzNetworking::ISerializer& serializer)
+    {
+        const bool result = serializer.Serialize(m_inputShape.m_width, "inputWidth")
+            && serializer.Serialize(m_inputShape.m_height, "inputHeight")
+            && serializer.Serialize(m_inputShape.m_channels, "inputChannels")
+            && serializer.Serialize(m_poolSize, "poolSize")
+            && serializer.Serialize(m_stride, "stride");
+        if (!result)
+        {
+            return false;
+        }
+
+        if (serializer.GetSerializerMode() != AzNetworking::SerializerMode::WriteToObject)
+        {
+            return true;
+        }
+
+        if ((m_stride == 0) || (m_poolSize == 0) || (m_poolSize > m_inputShape.m_width) || (m_poolSize > m_inputShape.m_height))
+        {
+            AZLOG_ERROR("Max pooling layer configuration is invalid, the layer is corrupt");
+            return false;
+        }
+
+        // The output shape is derived from the layer configuration, so it is not persisted
+        UpdateOutputShape();
+        return true;
+    }
+
+    AZStd::size_t MaxPoolLayer::EstimateSerializeSize() const
+    {
+        const AZStd::size_t padding = 64; // 64 bytes of extra padding just in case
+        return padding
+             + sizeof(AZStd::size_t) * 3 // for m_inputShape
+             + sizeof(m_poolSize)
+             + sizeof(m_stride);
+    }
+
+    void MaxPoolLayer::UpdateOutputShape()
+    {
+        AZ_Assert(m_stride > 0, "The pooling stride must be at least one");
+        AZ_Assert((m_poolSize <= m_inputShape.m_width) && (m_poolSize <= m_inputShape.m_height), "The pooling window is larger than the input image");
+        const bool valid = (m_stride > 0) && (m_poolSize > 0) && (m_poolSize <= m_inputShape.m_width) && (m_poolSize <= m_inputShape.m_height);
+        m_outputShape.m_width = valid ? (m_inputShape.m_width - m_poolSize) / m_stride + 1 : 0;
+        m_outputShape.m_height = valid ? (m_inputShape.m_height - m_poolSize) / m_stride + 1 : 0;
+        m_outputShape.m_channels = m_inputShape.m_channels;
+    }
+
+    void MaxPoolLayer::Pool(const AZ::VectorN& image, AZ::VectorN& output, uint32_t* poolIndices) const
+    {
+        AZ_Assert(image.GetDimensionality() == GetInputSize(), "The activation vector does not match the input shape of the pooling layer");
+        if (output.GetDimensionality() != GetOutputSize())
+        {
+            output = AZ::VectorN::CreateZero(GetOutputSize());
+        }
+
+        const AZStd::size_t channels = m_inputShape.m_channels;
+        for (AZStd::size_t outputY = 0; outputY < m_outputShape.m_height; ++outputY)
+        {
+            for (AZStd::size_t outputX = 0; outputX < m_outputShape.m_width; ++outputX)
+            {
+                const AZStd::size_t outputOffset = (outputY * m_outputShape.m_width + outputX) * channels;
+                for (AZStd::size_t channel = 0; channel < channels; ++channel)
+                {
+                    AZStd::size_t maxIndex = ((outputY * m_stride) * m_inputShape.m_width + outputX * m_stride) * channels + channel;
+                    float maxValue = image.GetElement(maxIndex);
+                    for (AZStd::size_t poolY = 0; poolY < m_poolSize; ++poolY)
+                    {
+                        for (AZStd::size_t poolX = 0; poolX < m_poolSize; ++poolX)
+                        {
+                            const AZStd::size_t inputIndex = ((outputY * m_stride + poolY) * m_inputShape.m_width + outputX * m_stride + poolX) * channels + channel;
+                            const float value = image.GetElement(inputIndex);
+                            if (value > maxValue)
+                            {
+                                maxValue = value;
+                                maxIndex = inputIndex;
+                            }
+                        }
+                    }
+                    output.SetElement(outputOffset + channel, maxValue);
+                    poolIndices[outputOffset + channel] = static_cast<uint32_t>(maxIndex);
+                }
+            }
+        }
+    }
+
+    void MaxPoolLayer::Unpool(const AZ::VectorN& gradients, const uint32_t* poolIndices, AZ::VectorN& image) const
+    {
+        if (image.GetDimensionality() != GetInputSize())
+        {
+            image = AZ::VectorN::CreateZero(GetInputSize());
+        }
+        else
+        {
+            image.SetZero();
+        }
+
+        // Overlapping windows may select the same input element, in which case its gradients are summed
+        for (AZStd::size_t iter = 0; iter < GetOutputSize(); ++iter)
+        {
+            const AZStd::size_t inputIndex = poolIndices[iter];
+            image.SetElement(inputIndex, image.GetElement(inputIndex) + gradients.GetElement(iter));
+        }
+    }
+}
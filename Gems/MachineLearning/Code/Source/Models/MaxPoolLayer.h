@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Models/ILayer.h>
+#include <Models/Layer.h>
+
+namespace MachineLearning
+{
+    //! A two dimensional max pooling layer operating on images stored in height, width, channel order.
+    //! Each channel is pooled independently, the layer has no trainable parameters.
+    class MaxPoolLayer
+        : public ILayer
+    {
+    public:
+
+        AZ_RTTI(MaxPoolLayer, "{2F4E8A1D-7B3C-4E6A-9D05-8C1B6F3A7E42}", ILayer);
+
+        MaxPoolLayer() = default;
+        MaxPoolLayer(MaxPoolLayer&&) = default;
+        MaxPoolLayer(const MaxPoolLayer&) = default;
+
+        //! If stride is zero, the stride is equal to the pool size so that the pooling windows do not overlap.
+        MaxPoolLayer(const ImageShape& inputShape, AZStd::size_t poolSize, AZStd::size_t stride = 0);
+        ~MaxPoolLayer() = default;
+
+        MaxPoolLayer& operator=(MaxPoolLayer&&) = default;
+        MaxPoolLayer& operator=(const MaxPoolLayer&) = default;
+
+        //! ILayer interface
+        //! @{
+        LayerTypes GetLayerType() const override;
+        AZStd::size_t GetInputSize() const override;
+        AZStd::size_t GetOutputSize() const override;
+        ImageShape GetOutputShape() const override;
+        ImageShape GetInputShape() const override;
+        void SetInputShape(const ImageShape& inputShape) override;
+        AZStd::size_t GetParameterCount() const override;
+        AZStd::unique_ptr<ILayer> Clone() const override;
+        const AZ::VectorN& Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations) override;
+        void AccumulateGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, const AZ::VectorN& previousLayerGradients, bool skipActivationDerivative = false) override;
+        AZStd::span<const AZ::VectorN* const> ForwardBatch(LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN* const> activations) override;
+        void AccumulateBatchGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN> previousLayerGradients, bool skipActivationDerivative = false) override;
+        void ReduceGradients(LayerTrainingData& destination, AZStd::size_t destinationSamples, LayerTrainingData& source, AZStd::size_t sourceSamples) override;
+        void ApplyGradients(LayerTrainingData& trainingData, float learningRate, const OptimizerParameters& optimizer = OptimizerParameters()) override;
+        bool Serialize(AzNetworking::ISerializer& serializer) override;
+        AZStd::size_t EstimateSerializeSize() const override;
+        //! @}
+
+        // These are intentionally left public so that unit testing can exhaustively examine all layer state
+        ImageShape m_inputShape;
+        ImageShape m_outputShape;
+        AZStd::size_t m_poolSize = 0;
+        AZStd::size_t m_stride = 0;
+
+    private:
+
+        void UpdateOutputShape();
+
+        //! Pools a single image, the index of the input element selected for each output element is written to poolIndices.
+        void Pool(const AZ::VectorN& image, AZ::VectorN& output, uint32_t* poolIndices) const;
+
+        //! Routes the gradient of each output element back to the input element it was selected from.
+        void Unpool(const AZ::VectorN& gradients, const uint32_t* poolIndices, AZ::VectorN& image) const;
+    };
+}
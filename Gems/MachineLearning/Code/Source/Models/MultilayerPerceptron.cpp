@@ -7,6 +7,8 @@
  */
 
 #include <Models/MultilayerPerceptron.h>
+#include <Models/ConvolutionLayer.h>
+#include <Models/MaxPoolLayer.h>
 #include <Algorithms/LossFunctions.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -81,7 +83,12 @@ namespace MachineLearning
         , m_trainDataFile(rhs.m_trainDataFile)
         , m_trainLabelFile(rhs.m_trainLabelFile)
         , m_activationCount(rhs.m_activationCount)
+        , m_inputShape(rhs.m_inputShape)
+        , m_featureLayers(rhs.m_featureLayers)
         , m_layers(rhs.m_layers)
+        , m_quantizedLayers(rhs.m_quantizedLayers)
+        , m_inferencePrecision(rhs.m_inferencePrecision)
+        , m_mappedModel(rhs.GetMappedModel())
     {
     }
 
@@ -102,17 +109,29 @@ namespace MachineLearning
         m_trainDataFile = rhs.m_trainDataFile;
         m_trainLabelFile = rhs.m_trainLabelFile;
         m_activationCount = rhs.m_activationCount;
+        m_inputShape = rhs.m_inputShape;
+        m_featureLayers = rhs.m_featureLayers;
         m_layers = rhs.m_layers;
+        m_quantizedLayers = rhs.m_quantizedLayers;
+        m_inferencePrecision = rhs.m_inferencePrecision;
+        SetMappedModel(rhs.GetMappedModel());
         OnActivationCountChanged();
         return *this;
     }
 
     MultilayerPerceptron& MultilayerPerceptron::operator=(const ModelAsset& asset)
     {
+        // The asset layers are already sized for the asset activation count, so unlike copying a model they must not be reinitialized
         m_name = asset.m_name;
         m_activationCount = asset.m_activationCount;
+        m_inputShape = (asset.m_inputShape.GetSize() == asset.m_activationCount) ? asset.m_inputShape : ImageShape{ asset.m_activationCount, 1, 1 };
+        m_featureLayers = asset.m_featureLayers;
         m_layers = asset.m_layers;
-        OnActivationCountChanged();
+        m_quantizedLayers = asset.m_quantizedLayers;
+        SetMappedModel(asset.m_mappedModel);
+
+        // Assets only hold quantized layers if the model was saved using int8 inference
+        m_inferencePrecision = m_quantizedLayers.empty() ? InferencePrecision::Float : InferencePrecision::Int8;
         return *this;
     }
 
@@ -144,34 +163,96 @@ namespace MachineLearning
 
     AZStd::size_t MultilayerPerceptron::GetOutputDimensionality() const
     {
+        if (const AZStd::shared_ptr<MappedModel> mappedModel = GetMappedModel())
+        {
+            const FlatModelView& view = mappedModel->GetView();
+            return (view.GetLayerCount() > 0) ? view.GetLayer(view.GetLayerCount() - 1).m_outputSize : m_activationCount;
+        }
+
         if (!m_layers.empty())
         {
             return m_layers.back().m_biases.GetDimensionality();
         }
+        if (!m_quantizedLayers.empty())
+        {
+            return m_quantizedLayers.back().m_outputSize;
+        }
+        if (!m_featureLayers.empty())
+        {
+            return m_featureLayers.back()->GetOutputSize();
+        }
         return m_activationCount;
     }
 
     AZStd::size_t MultilayerPerceptron::GetLayerCount() const
     {
-        return m_layers.size();
+        if (const AZStd::shared_ptr<MappedModel> mappedModel = GetMappedModel())
+        {
+            return mappedModel->GetView().GetLayerCount();
+        }
+        return m_layers.empty() ? m_quantizedLayers.size() : m_layers.size();
     }
 
     AZ::MatrixMxN MultilayerPerceptron::GetLayerWeights(AZStd::size_t layerIndex) const
     {
+        if (const AZStd::shared_ptr<MappedModel> mappedModel = GetMappedModel())
+        {
+            Layer layer;
+            ReadFlatLayer(mappedModel->GetView().GetLayer(layerIndex), layer);
+            return layer.m_weights;
+        }
+        if (m_layers.empty())
+        {
+            Layer layer;
+            m_quantizedLayers[layerIndex].Dequantize(layer);
+            return layer.m_weights;
+        }
         return m_layers[layerIndex].m_weights;
     }
 
     AZ::VectorN MultilayerPerceptron::GetLayerBiases(AZStd::size_t layerIndex) const
     {
+        if (const AZStd::shared_ptr<MappedModel> mappedModel = GetMappedModel())
+        {
+            Layer layer;
+            ReadFlatLayer(mappedModel->GetView().GetLayer(layerIndex), layer);
+            return layer.m_biases;
+        }
+        if (m_layers.empty())
+        {
+            return m_quantizedLayers[layerIndex].m_biases;
+        }
         return m_layers[layerIndex].m_biases;
     }
 
     AZStd::size_t MultilayerPerceptron::GetParameterCount() const
     {
         AZStd::size_t parameterCount = 0;
+        if (const AZStd::shared_ptr<MappedModel> mappedModel = GetMappedModel())
+        {
+            const FlatModelView& view = mappedModel->GetView();
+            for (AZStd::size_t iter = 0; iter < view.GetLayerCount(); ++iter)
+            {
+                parameterCount += view.GetLayer(iter).m_inputSize * view.GetLayer(iter).m_outputSize + view.GetLayer(iter).m_outputSize;
+            }
+            return parameterCount;
+        }
+
+        for (const LayerPtr& layer : m_featureLayers)
+        {
+            parameterCount += layer->GetParameterCount();
+        }
         for (const Layer& layer : m_layers)
         {
-            parameterCount += layer.m_inputSize * layer.m_outputSize + layer.m_outputSize;
+            parameterCount += layer.GetParameterCount();
+        }
+        if (m_layers.empty())
+        {
+            // The quantized layers are only counted if there are no float layers, otherwise they hold the same parameters
+            for (const QuantizedLayer& layer : m_quantizedLayers)
+            {
+                parameterCount += layer.m_inputSize * layer.m_outputSize + layer.m_outputSize;
+            }
         }
         return parameterCount;
     }
@@ -183,15 +264,60 @@ namespace MachineLearning
 
     ITrainingContextPtr MultilayerPerceptron::CreateTrainingContext()
     {
+        // Training modifies the float layers, so they must be in memory before any worker begins accumulating gradients
+        // The quantized layers would go stale as the weights change, inference runs on the float layers until they are rebuilt from the trained weights
+        LoadLayers();
+        ReleaseQuantizedLayers();
         return new MlpTrainingContext();
     }
 
+    void MultilayerPerceptron::SetInferencePrecision(InferencePrecision precision)
+    {
+        if (precision == InferencePrecision::Int8)
+        {
+            m_inferencePrecision = precision;
+            QuantizeLayers();
+        }
+        else if (ReleaseQuantizedLayers())
+        {
+            m_inferencePrecision = precision;
+        }
+    }
+
+    InferencePrecision MultilayerPerceptron::GetInferencePrecision() const
+    {
+        return m_inferencePrecision;
+    }
+
     const AZ::VectorN* MultilayerPerceptron::Forward(IInferenceContextPtr context, const AZ::VectorN& activations)
     {
         MlpInferenceContext* forwardContext = static_cast<MlpInferenceContext*>(context);
-        forwardContext->m_layerData.resize(m_layers.size());
-
         const AZ::VectorN* lastLayerOutput = &activations;
+
+        // The local reference keeps the mapping alive if LoadLayers releases it while this pass is reading the mapped weights
+        if (const AZStd::shared_ptr<MappedModel> mappedModel = GetMappedModel())
+        {
+            const FlatModelView& view = mappedModel->GetView();
+            forwardContext->m_layerData.resize(view.GetLayerCount());
+            for (AZStd::size_t iter = 0; iter < view.GetLayerCount(); ++iter)
+            {
+                lastLayerOutput = &view.GetLayer(iter).Forward(forwardContext->m_layerData[iter], *lastLayerOutput);
+            }
+            return lastLayerOutput;
+        }
+
+        lastLayerOutput = ForwardFeatures(forwardContext, activations);
+        if (UseQuantizedLayers())
+        {
+            forwardContext->m_layerData.resize(m_quantizedLayers.size());
+            for (AZStd::size_t iter = 0; iter < m_quantizedLayers.size(); ++iter)
+            {
+                lastLayerOutput = &m_quantizedLayers[iter].Forward(forwardContext->m_layerData[iter], *lastLayerOutput);
+            }
+            return lastLayerOutput;
+        }
+
+        forwardContext->m_layerData.resize(m_layers.size());
         for (AZStd::size_t iter = 0; iter < m_layers.size(); ++iter)
         {
             m_layers[iter].Forward(forwardContext->m_layerData[iter], *lastLayerOutput);
@@ -202,8 +328,10 @@ namespace MachineLearning
 
     void MultilayerPerceptron::Reverse(ITrainingContextPtr context, LossFunctions lossFunction, const AZ::VectorN& activations, const AZ::VectorN& expected)
     {
+        AZ_Assert(!IsMapped() && !UseQuantizedLayers(), "The float layers must be loaded before training, this is done by CreateTrainingContext");
         MlpTrainingContext* reverseContext = static_cast<MlpTrainingContext*>(context);
         MlpInferenceContext* forwardContext = &reverseContext->m_forward;
+        reverseContext->m_featureLayerData.resize(m_featureLayers.size());
         reverseContext->m_layerData.resize(m_layers.size());
         forwardContext->m_layerData.resize(m_layers.size());
 
@@ -211,7 +339,7 @@ namespace MachineLearning
 
         // First feed-forward the activations to get our current model predictions
         // We do additional book-keeping over a standard forward pass to make gradient calculations easier
-        const AZ::VectorN* lastLayerOutput = &activations;
+        const AZ::VectorN* lastLayerOutput = ForwardFeatures(forwardContext, activations);
         for (AZStd::size_t iter = 0; iter < m_layers.size(); ++iter)
         {
             reverseContext->m_layerData[iter].m_lastInput = lastLayerOutput;
@@ -220,25 +348,172 @@ namespace MachineLearning
         }
 
         // Compute the partial derivatives of the loss function with respect to the final layer output
+        // If the loss is fused with the final activation function, the gradients are instead with respect to the final activation input
+        const bool fusedLoss = !m_layers.empty() && IsLossFusedWithActivation(lossFunction, m_layers.back().m_activationFunction);
         AZ::VectorN costGradients;
-        ComputeLoss_Derivative(lossFunction, *lastLayerOutput, expected, costGradients);
+        if (fusedLoss)
+        {
+            SoftmaxCrossEntropy_Derivative(expected, *lastLayerOutput, costGradients);
+        }
+        else
+        {
+            ComputeLoss_Derivative(lossFunction, expected, *lastLayerOutput, costGradients);
+        }
 
         AZ::VectorN* lossGradient = &costGradients;
         for (int64_t iter = static_cast<int64_t>(m_layers.size()) - 1; iter >= 0; --iter)
         {
-            m_layers[iter].AccumulateGradients(reverseContext->m_trainingSampleSize, reverseContext->m_layerData[iter], forwardContext->m_layerData[iter], *lossGradient);
+            const bool skipActivationDerivative = fusedLoss && (iter == static_cast<int64_t>(m_layers.size()) - 1);
+            m_layers[iter].AccumulateGradients(reverseContext->m_trainingSampleSize, reverseContext->m_layerData[iter], forwardContext->m_layerData[iter], *lossGradient, skipActivationDerivative);
             lossGradient = &reverseContext->m_layerData[iter].m_backpropagationGradients;
         }
+
+        // The gradients with respect to the input of the first dense layer continue back through the feature extraction layers
+        for (int64_t iter = static_cast<int64_t>(m_featureLayers.size()) - 1; iter >= 0; --iter)
+        {
+            m_featureLayers[iter]->AccumulateGradients(reverseContext->m_trainingSampleSize, reverseContext->m_featureLayerData[iter], forwardContext->m_featureLayerData[iter], *lossGradient);
+            lossGradient = &reverseContext->m_featureLayerData[iter].m_backpropagationGradients;
+        }
     }
 
-    void MultilayerPerceptron::GradientDescent(ITrainingContextPtr context, float learningRate)
+    AZStd::span<const AZ::VectorN* const> MultilayerPerceptron::ForwardBatch(IInferenceContextPtr context, AZStd::span<const AZ::VectorN* const> activations)
+    {
+        MlpInferenceContext* forwardContext = static_cast<MlpInferenceContext*>(context);
+        AZStd::span<const AZ::VectorN* const> lastLayerOutput = activations;
+
+        // The local reference keeps the mapping alive if LoadLayers releases it while this pass is reading the mapped weights
+        if (const AZStd::shared_ptr<MappedModel> mappedModel = GetMappedModel())
+        {
+            const FlatModelView& view = mappedModel->GetView();
+            forwardContext->m_layerData.resize(view.GetLayerCount());
+            for (AZStd::size_t iter = 0; iter < view.GetLayerCount(); ++iter)
+            {
+                lastLayerOutput = view.GetLayer(iter).ForwardBatch(forwardContext->m_layerData[iter], lastLayerOutput);
+            }
+            return lastLayerOutput;
+        }
+
+        lastLayerOutput = ForwardFeaturesBatch(forwardContext, activations);
+        if (UseQuantizedLayers())
+        {
+            forwardContext->m_layerData.resize(m_quantizedLayers.size());
+            for (AZStd::size_t iter = 0; iter < m_quantizedLayers.size(); ++iter)
+            {
+                lastLayerOutput = m_quantizedLayers[iter].ForwardBatch(forwardContext->m_layerData[iter], lastLayerOutput);
+            }
+            return lastLayerOutput;
+        }
+
+        forwardContext->m_layerData.resize(m_layers.size());
+        for (AZStd::size_t iter = 0; iter < m_layers.size(); ++iter)
+        {
+            lastLayerOutput = m_layers[iter].ForwardBatch(forwardContext->m_layerData[iter], lastLayerOutput);
+        }
+        return lastLayerOutput;
+    }
+
+    void MultilayerPerceptron::ReverseBatch(ITrainingContextPtr context, LossFunctions lossFunction, AZStd::span<const AZ::VectorN* const> activations, AZStd::span<const AZ::VectorN* const> expected)
+    {
+        AZ_Assert(activations.size() == expected.size(), "The number of activation and label vectors in a batch must match");
+        const AZStd::size_t batchSize = activations.size();
+        if (batchSize == 0)
+        {
+            return;
+        }
+
+        AZ_Assert(!IsMapped() && !UseQuantizedLayers(), "The float layers must be loaded before training, this is done by CreateTrainingContext");
+        MlpTrainingContext* reverseContext = static_cast<MlpTrainingContext*>(context);
+        MlpInferenceContext* forwardContext = &reverseContext->m_forward;
+        reverseContext->m_featureLayerData.resize(m_featureLayers.size());
+        reverseContext->m_layerData.resize(m_layers.size());
+        forwardContext->m_layerData.resize(m_layers.size());
+
+        reverseContext->m_trainingSampleSize += batchSize;
+
+        const auto forwardStart = AZStd::chrono::steady_clock::now();
+
+        // First feed-forward the whole batch, keeping track of each layer's inputs for the weight gradient calculations
+        AZStd::span<const AZ::VectorN* const> lastLayerOutput = ForwardFeaturesBatch(forwardContext, activations);
+        for (AZStd::size_t iter = 0; iter < m_layers.size(); ++iter)
+        {
+            reverseContext->m_layerData[iter].m_lastBatchInput = lastLayerOutput;
+            lastLayerOutput = m_layers[iter].ForwardBatch(forwardContext->m_layerData[iter], lastLayerOutput);
+        }
+
+        const auto backwardStart = AZStd::chrono::steady_clock::now();
+        reverseContext->m_forwardTime += backwardStart - forwardStart;
+
+        // Compute the partial derivatives of the loss function with respect to the final layer output for each sample
+        const bool fusedLoss = !m_layers.empty() && IsLossFusedWithActivation(lossFunction, m_layers.back().m_activationFunction);
+        reverseContext->m_batchLossGradients.resize(batchSize);
+        for (AZStd::size_t iter = 0; iter < batchSize; ++iter)
+        {
+            if (fusedLoss)
+            {
+                SoftmaxCrossEntropy_Derivative(*expected[iter], *lastLayerOutput[iter], reverseContext->m_batchLossGradients[iter]);
+            }
+            else
+            {
+                ComputeLoss_Derivative(lossFunction, *expected[iter], *lastLayerOutput[iter], reverseContext->m_batchLossGradients[iter]);
+            }
+        }
+
+        AZStd::span<const AZ::VectorN> lossGradients = reverseContext->m_batchLossGradients;
+        for (int64_t iter = static_cast<int64_t>(m_layers.size()) - 1; iter >= 0; --iter)
+        {
+            const bool skipActivationDerivative = fusedLoss && (iter == static_cast<int64_t>(m_layers.size()) - 1);
+            m_layers[iter].AccumulateBatchGradients(reverseContext->m_trainingSampleSize, reverseContext->m_layerData[iter], forwardContext->m_layerData[iter], lossGradients, skipActivationDerivative);
+            lossGradients = reverseContext->m_layerData[iter].m_batchBackpropagationGradients;
+        }
+
+        for (int64_t iter = static_cast<int64_t>(m_featureLayers.size()) - 1; iter >= 0; --iter)
+        {
+            m_featureLayers[iter]->AccumulateBatchGradients(reverseContext->m_trainingSampleSize, reverseContext->m_featureLayerData[iter], forwardContext->m_featureLayerData[iter], lossGradients);
+            lossGradients = reverseContext->m_featureLayerData[iter].m_batchBackpropagationGradients;
+        }
+
+        // The batch inputs are views into buffers owned by the forward pass and the caller, don't keep them past this call
+        for (LayerTrainingData& layerData : reverseContext->m_layerData)
+        {
+            layerData.m_lastBatchInput = {};
+        }
+
+        reverseContext->m_backwardTime += AZStd::chrono::steady_clock::now() - backwardStart;
+    }
+
+    void MultilayerPerceptron::ReduceGradients(ITrainingContextPtr destination, ITrainingContextPtr source)
+    {
+        MlpTrainingContext* destinationContext = static_cast<MlpTrainingContext*>(destination);
+        MlpTrainingContext* sourceContext = static_cast<MlpTrainingContext*>(source);
+        if (sourceContext->m_trainingSampleSize > 0)
+        {
+            destinationContext->m_featureLayerData.resize(m_featureLayers.size());
+            for (AZStd::size_t iter = 0; iter < m_featureLayers.size(); ++iter)
+            {
+                m_featureLayers[iter]->ReduceGradients(destinationContext->m_featureLayerData[iter], destinationContext->m_trainingSampleSize, sourceContext->m_featureLayerData[iter], sourceContext->m_trainingSampleSize);
+            }
+            destinationContext->m_layerData.resize(m_layers.size());
+            for (AZStd::size_t iter = 0; iter < m_layers.size(); ++iter)
+            {
+                m_layers[iter].ReduceGradients(destinationContext->m_layerData[iter], destinationContext->m_trainingSampleSize, sourceContext->m_layerData[iter], sourceContext->m_trainingSampleSize);
+            }
+            destinationContext->m_trainingSampleSize += sourceContext->m_trainingSampleSize;
+        }
+        sourceContext->m_trainingSampleSize = 0;
+    }
+
+    void MultilayerPerceptron::GradientDescent(ITrainingContextPtr context, float learningRate, const OptimizerParameters& optimizer)
     {
         MlpTrainingContext* reverseContext = static_cast<MlpTrainingContext*>(context);
         if (reverseContext->m_trainingSampleSize > 0)
         {
+            for (AZStd::size_t iter = 0; iter < m_featureLayers.size(); ++iter)
+            {
+                m_featureLayers[iter]->ApplyGradients(reverseContext->m_featureLayerData[iter], learningRate, optimizer);
+            }
             for (AZStd::size_t iter = 0; iter < m_layers.size(); ++iter)
             {
-                m_layers[iter].ApplyGradients(reverseContext->m_layerData[iter], learningRate);
+                m_layers[iter].ApplyGradients(reverseContext->m_layerData[iter], learningRate, optimizer);
             }
         }
         reverseContext->m_trainingSampleSize = 0;
@@ -246,13 +521,41 @@ namespace MachineLearning
 
     void MultilayerPerceptron::OnActivationCountChanged()
     {
-        AZStd::size_t lastLayerDimensionality = m_activationCount;
+        LoadLayers();
+        if (m_inputShape.GetSize() != m_activationCount)
+        {
+            // An activation count set on its own carries no image dimensions, so the input is taken as a single row with one channel
+            m_inputShape = ImageShape{ m_activationCount, 1, 1 };
+        }
+
+        ImageShape lastShape = m_inputShape;
+        for (LayerPtr& featureLayer : m_featureLayers)
+        {
+            // Only layers whose input actually changed are resized, as that reinitializes their filters
+            if (featureLayer->GetInputShape() != lastShape)
+            {
+                featureLayer->SetInputShape(lastShape);
+            }
+            lastShape = featureLayer->GetOutputShape();
+        }
+
+        AZStd::size_t lastLayerDimensionality = lastShape.GetSize();
         for (Layer& layer : m_layers)
         {
             layer.m_inputSize = lastLayerDimensionality;
             layer.OnSizesChanged();
             lastLayerDimensionality = layer.m_outputSize;
         }
+
+        if (m_layers.empty() && !m_quantizedLayers.empty() && (m_quantizedLayers.front().m_inputSize != lastShape.GetSize()))
+        {
+            AZLOG_ERROR("Model %s only holds quantized layers, these cannot be resized for the new input", m_name.c_str());
+        }
+        else if (!m_layers.empty() && !m_quantizedLayers.empty())
+        {
+            // Resizing reinitializes the float layers, so the quantized layers must be rebuilt from the new weights
+            QuantizeLayers();
+        }
     }
 
     bool MultilayerPerceptron::LoadModel()
@@ -276,13 +579,226 @@ namespace MachineLearning
     void MultilayerPerceptron::AddLayer(AZStd::size_t layerDimensionality, ActivationFunctions activationFunction)
     {
         // This is not thread safe, this should only be used during model configuration
+        LoadLayers();
+        if (m_layers.empty() && !m_quantizedLayers.empty())
+        {
+            AZLOG_ERROR("Model %s only holds quantized layers, layers cannot be added to it", m_name.c_str());
+            return;
+        }
+
         const AZStd::size_t lastLayerDimensionality = GetOutputDimensionality();
         m_layers.push_back(AZStd::move(Layer(activationFunction, lastLayerDimensionality, layerDimensionality)));
+        if (!m_quantizedLayers.empty())
+        {
+            m_quantizedLayers.emplace_back(m_layers.back());
+        }
+    }
+
+    void MultilayerPerceptron::SetInputShape(const ImageShape& inputShape)
+    {
+        m_inputShape = inputShape;
+        m_activationCount = inputShape.GetSize();
+        OnActivationCountChanged();
+    }
+
+    ImageShape MultilayerPerceptron::GetFeatureOutputShape() const
+    {
+        if (!m_featureLayers.empty())
+        {
+            return m_featureLayers.back()->GetOutputShape();
+        }
+        return m_inputShape;
+    }
+
+    void MultilayerPerceptron::AddConvolutionLayer(AZStd::size_t filterCount, AZStd::size_t kernelSize, AZStd::size_t stride, AZStd::size_t padding, ActivationFunctions activationFunction)
+    {
+        // This is not thread safe, this should only be used during model configuration
+        LoadLayers();
+        AZ_Assert(m_layers.empty() && m_quantizedLayers.empty(), "Feature extraction layers must be added before any dense layers");
+        const ImageShape inputShape = GetFeatureOutputShape();
+        AZ_Assert(inputShape.GetSize() > 0, "SetInputShape must be called before adding a convolution layer");
+        m_featureLayers.emplace_back(AZStd::make_unique<ConvolutionLayer>(activationFunction, inputShape, filterCount, kernelSize, stride, padding));
+    }
+
+    void MultilayerPerceptron::AddMaxPoolLayer(AZStd::size_t poolSize, AZStd::size_t stride)
+    {
+        // This is not thread safe, this should only be used during model configuration
+        LoadLayers();
+        AZ_Assert(m_layers.empty() && m_quantizedLayers.empty(), "Feature extraction layers must be added before any dense layers");
+        const ImageShape inputShape = GetFeatureOutputShape();
+        AZ_Assert(inputShape.GetSize() > 0, "SetInputShape must be called before adding a pooling layer");
+        m_featureLayers.emplace_back(AZStd::make_unique<MaxPoolLayer>(inputShape, poolSize, stride));
+    }
+
+    AZStd::size_t MultilayerPerceptron::GetFeatureLayerCount() const
+    {
+        return m_featureLayers.size();
+    }
+
+    ILayer* MultilayerPerceptron::GetFeatureLayer(AZStd::size_t layerIndex)
+    {
+        return m_featureLayers[layerIndex].get();
+    }
+
+    void MultilayerPerceptron::QuantizeLayers()
+    {
+        LoadLayers();
+        if (m_layers.empty())
+        {
+            return;
+        }
+
+        m_quantizedLayers.resize(m_layers.size());
+        for (AZStd::size_t iter = 0; iter < m_layers.size(); ++iter)
+        {
+            m_quantizedLayers[iter].Quantize(m_layers[iter]);
+        }
+    }
+
+    bool MultilayerPerceptron::ReleaseQuantizedLayers()
+    {
+        LoadLayers();
+        if (m_layers.empty() && !m_quantizedLayers.empty())
+        {
+            // Reconstructing float layers from the quantized weights would bake the quantization error into any later training or saved asset
+            AZLOG_ERROR("Model %s only holds quantized layers, it cannot be dequantized and only supports int8 inference", m_name.c_str());
+            return false;
+        }
+        m_quantizedLayers = AZStd::vector<QuantizedLayer>();
+        return true;
+    }
+
+    AZStd::size_t MultilayerPerceptron::GetMemoryUsage() const
+    {
+        AZStd::size_t result = 0;
+        for (const Layer& layer : m_layers)
+        {
+            result += MachineLearning::GetMemoryUsage(layer);
+        }
+        for (const QuantizedLayer& layer : m_quantizedLayers)
+        {
+            result += MachineLearning::GetMemoryUsage(layer);
+        }
+        return result;
+    }
+
+    QuantizedLayer* MultilayerPerceptron::GetQuantizedLayer(AZStd::size_t layerIndex)
+    {
+        // This is not thread safe, this method should only be used by unit testing to inspect quantized layer parameters
+        LoadLayers();
+        return &m_quantizedLayers[layerIndex];
+    }
+
+    bool MultilayerPerceptron::UseQuantizedLayers() const
+    {
+        return (m_inferencePrecision == InferencePrecision::Int8) && !m_quantizedLayers.empty();
     }
 
     Layer* MultilayerPerceptron::GetLayer(AZStd::size_t layerIndex)
     {
         // This is not thread safe, this method should only be used by unit testing to inspect layer weights and biases for correctness
+        LoadLayers();
+        if (m_layers.empty())
+        {
+            AZLOG_ERROR("Model %s only holds quantized layers", m_name.c_str());
+            return nullptr;
+        }
         return &m_layers[layerIndex];
     }
+
+    void MultilayerPerceptron::LoadLayers()
+    {
+        if (const AZStd::shared_ptr<MappedModel> mappedModel = GetMappedModel())
+        {
+            const FlatModelView& view = mappedModel->GetView();
+            m_layers.resize(view.GetLayerCount());
+            for (AZStd::size_t iter = 0; iter < view.GetLayerCount(); ++iter)
+            {
+                ReadFlatLayer(view.GetLayer(iter), m_layers[iter]);
+            }
+
+            m_quantizedLayers.resize(view.GetQuantizedLayerCount());
+            for (AZStd::size_t iter = 0; iter < m_quantizedLayers.size(); ++iter)
+            {
+                ReadFlatQuantizedLayer(view.GetQuantizedLayer(iter), m_quantizedLayers[iter]);
+            }
+
+            // The layers are complete before the mapping is released, so inference which no longer sees the mapping always finds them
+            // Passes still reading the mapped weights hold their own reference, the file is unmapped once the last of them completes
+            SetMappedModel(nullptr);
+        }
+    }
+
+    bool MultilayerPerceptron::IsMapped() const
+    {
+        return GetMappedModel() != nullptr;
+    }
+
+    AZStd::shared_ptr<MappedModel> MultilayerPerceptron::GetMappedModel() const
+    {
+        AZStd::lock_guard lock(m_mappedModelMutex);
+        return m_mappedModel;
+    }
+
+    void MultilayerPerceptron::SetMappedModel(AZStd::shared_ptr<MappedModel> mappedModel)
+    {
+        // The previous mapping is released once the lock is no longer held, as releasing the last reference unmaps the file
+        AZStd::lock_guard lock(m_mappedModelMutex);
+        m_mappedModel.swap(mappedModel);
+    }
+
+    const AZ::VectorN* MultilayerPerceptron::ForwardFeatures(MlpInferenceContext* context, const AZ::VectorN& activations)
+    {
+        const AZ::VectorN* lastLayerOutput = &activations;
+        context->m_featureLayerData.resize(m_featureLayers.size());
+        for (AZStd::size_t iter = 0; iter < m_featureLayers.size(); ++iter)
+        {
+            lastLayerOutput = &m_featureLayers[iter]->Forward(context->m_featureLayerData[iter], *lastLayerOutput);
+        }
+        return lastLayerOutput;
+    }
+
+    AZStd::span<const AZ::VectorN* const> MultilayerPerceptron::ForwardFeaturesBatch(MlpInferenceContext* context, AZStd::span<const AZ::VectorN* const> activations)
+    {
+        AZStd::span<const AZ::VectorN* const> lastLayerOutput = activations;
+        context->m_featureLayerData.resize(m_featureLayers.size());
+        for (AZStd::size_t iter = 0; iter < m_featureLayers.size(); ++iter)
+        {
+            lastLayerOutput = m_featureLayers[iter]->ForwardBatch(context->m_featureLayerData[iter], lastLayerOutput);
+        }
+        return lastLayerOutput;
+    }
+
+    AZStd::size_t MlpInferenceContext::GetMemoryUsage() const
+    {
+        AZStd::size_t result = (m_featureLayerData.capacity() + m_layerData.capacity()) * sizeof(LayerInferenceData);
+        for (const LayerInferenceData& layerData : m_featureLayerData)
+        {
+            result += MachineLearning::GetMemoryUsage(layerData);
+        }
+        for (const LayerInferenceData& layerData : m_layerData)
+        {
+            result += MachineLearning::GetMemoryUsage(layerData);
+        }
+        return result;
+    }
+
+    AZStd::size_t MlpTrainingContext::GetMemoryUsage() const
+    {
+        AZStd::size_t result = m_forward.GetMemoryUsage() + (m_featureLayerData.capacity() + m_layerData.capacity()) * sizeof(LayerTrainingData);
+        for (const LayerTrainingData& layerData : m_featureLayerData)
+        {
+            result += MachineLearning::GetMemoryUsage(layerData);
+        }
+        for (const LayerTrainingData& layerData : m_layerData)
+        {
+            result += MachineLearning::GetMemoryUsage(layerData);
+        }
+        result += m_batchLossGradients.capacity() * sizeof(AZ::VectorN);
+        for (const AZ::VectorN& lossGradients : m_batchLossGradients)
+        {
+            result += lossGradients.GetVectorValues().capacity() * sizeof(AZ::Vector4);
+        }
+        return result;
+    }
 }
@@ -9,12 +9,17 @@
 #pragma once
 
 #include <AzCore/Math/MatrixMxN.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <MachineLearning/INeuralNetwork.h>
+#include <Models/ILayer.h>
 #include <Models/Layer.h>
+#include <Models/QuantizedLayer.h>
 #include <Assets/ModelAsset.h>
 
 namespace MachineLearning
 {
+    struct MlpInferenceContext;
+
     //! This is a basic multilayer perceptron neural network capable of basic training and feed forward operations.
     class MultilayerPerceptron
         : public INeuralNetwork
@@ -47,9 +52,14 @@ namespace MachineLearning
         AZStd::size_t GetParameterCount() const override;
         IInferenceContextPtr CreateInferenceContext() override;
         ITrainingContextPtr CreateTrainingContext() override;
+        void SetInferencePrecision(InferencePrecision precision) override;
+        InferencePrecision GetInferencePrecision() const override;
         const AZ::VectorN* Forward(IInferenceContextPtr context, const AZ::VectorN& activations) override;
         void Reverse(ITrainingContextPtr context, LossFunctions lossFunction, const AZ::VectorN& activations, const AZ::VectorN& expected) override;
-        void GradientDescent(ITrainingContextPtr context, float learningRate) override;
+        AZStd::span<const AZ::VectorN* const> ForwardBatch(IInferenceContextPtr context, AZStd::span<const AZ::VectorN* const> activations) override;
+        void ReverseBatch(ITrainingContextPtr context, LossFunctions lossFunction, AZStd::span<const AZ::VectorN* const> activations, AZStd::span<const AZ::VectorN* const> expected) override;
+        void ReduceGradients(ITrainingContextPtr destination, ITrainingContextPtr source) override;
+        void GradientDescent(ITrainingContextPtr context, float learningRate, const OptimizerParameters& optimizer = OptimizerParameters()) override;
         bool LoadModel() override;
         bool SaveModel() override;
         //! @}
@@ -57,13 +67,74 @@ namespace MachineLearning
         //! Adds a new layer to the model.
         void AddLayer(AZStd::size_t layerDimensionality, ActivationFunctions activationFunction = ActivationFunctions::ReLU);
 
+        //! Sets the shape of the input image consumed by the feature extraction layers, this also sets the activation count.
+        //! This must be called before any convolution or pooling layers are added, if it is called later every layer is resized and reinitialized for the new shape.
+        void SetInputShape(const ImageShape& inputShape);
+
+        //! Returns the shape of the output of the last feature extraction layer, or the input shape if there are none.
+        ImageShape GetFeatureOutputShape() const;
+
+        //! Adds a convolution layer to the feature extraction layers, these run ahead of the dense layers.
+        //! Feature extraction layers must be added before any dense layers.
+        void AddConvolutionLayer(AZStd::size_t filterCount, AZStd::size_t kernelSize, AZStd::size_t stride = 1, AZStd::size_t padding = 0, ActivationFunctions activationFunction = ActivationFunctions::ReLU);
+
+        //! Adds a max pooling layer to the feature extraction layers, if stride is zero the stride is equal to the pool size.
+        //! Feature extraction layers must be added before any dense layers.
+        void AddMaxPoolLayer(AZStd::size_t poolSize, AZStd::size_t stride = 0);
+
+        //! Returns the number of convolution and pooling layers, these are not included in GetLayerCount which only counts the dense layers.
+        AZStd::size_t GetFeatureLayerCount() const;
+
+        //! Retrieves a specific feature extraction layer from the model, this is not thread safe and should only be used during unit testing to validate model parameters.
+        ILayer* GetFeatureLayer(AZStd::size_t layerIndex);
+
+        //! Rebuilds the int8 quantized layers used when inference precision is set to Int8 from the float dense layers.
+        //! The float layers remain the master copy of the weights, so this must be called again whenever they change.
+        //! This is not thread safe and should not be called while inference is in progress.
+        void QuantizeLayers();
+
+        //! Releases the quantized layers so that inference runs on the float layers, which are never reconstructed from the quantized weights.
+        //! A model loaded without float layers cannot be dequantized, an error is reported and false is returned.
+        //! This is not thread safe and should not be called while inference is in progress.
+        bool ReleaseQuantizedLayers();
+
+        //! Returns the number of bytes held by the weights and biases of the dense layers, including the quantized layers but excluding any mapped model file.
+        AZStd::size_t GetMemoryUsage() const;
+
+        //! Retrieves a specific quantized layer from the model, this is not thread safe and should only be used during unit testing to validate model parameters.
+        QuantizedLayer* GetQuantizedLayer(AZStd::size_t layerIndex);
+
         //! Retrieves a specific layer from the model, this is not thread safe and should only be used during unit testing to validate model parameters.
+        //! Returns null if the model only holds quantized layers, changes to the returned layer are not quantized until the precision is set again.
         Layer* GetLayer(AZStd::size_t layerIndex);
 
+        //! If inference is reading the weights in place from a mapped model file, copies the layers into memory so that they can be trained or modified.
+        //! Inference may run concurrently, passes which began against the mapped file complete against it and later passes use the loaded layers.
+        //! This must not be called concurrently with itself or with anything else that modifies the layers.
+        void LoadLayers();
+
+        //! Returns true if inference is reading the weights in place from a mapped model file.
+        bool IsMapped() const;
+
     private:
 
         void OnActivationCountChanged();
 
+        //! Returns true if inference runs on the quantized layers rather than the float layers.
+        bool UseQuantizedLayers() const;
+
+        //! Returns the mapped model, if any, the returned reference keeps the file mapped even if LoadLayers releases the mapping concurrently.
+        AZStd::shared_ptr<MappedModel> GetMappedModel() const;
+
+        //! Replaces the mapped model, the previous mapping remains valid for any inference still holding a reference to it.
+        void SetMappedModel(AZStd::shared_ptr<MappedModel> mappedModel);
+
+        //! Runs the feature extraction layers and returns the input to the first dense layer.
+        const AZ::VectorN* ForwardFeatures(MlpInferenceContext* context, const AZ::VectorN& activations);
+
+        //! Runs the feature extraction layers on a batch and returns the inputs to the first dense layer.
+        AZStd::span<const AZ::VectorN* const> ForwardFeaturesBatch(MlpInferenceContext* context, AZStd::span<const AZ::VectorN* const> activations);
+
         //! The model name.
         AZStd::string m_name;
 
@@ -76,9 +147,31 @@ namespace MachineLearning
         //! The number of neurons in the activation layer.
         AZStd::size_t m_activationCount = 0;
 
-        //! The set of layers in the network.
+        //! The shape of the input image, this is only required by models with feature extraction layers.
+        //! If the activation count is changed on its own, the input is taken to be a single row with one channel.
+        ImageShape m_inputShape;
+
+        //! The convolution and pooling layers which run ahead of the dense layers.
+        //! These are not reflected, so models with feature extraction layers can only be configured through code or loaded from an asset.
+        LayerPtrList m_featureLayers;
+
+        //! The set of dense layers in the network, these are the master copy of the weights.
+        //! This is only empty for a model loaded from an asset saved without float layers, which can be used for int8 inference but not trained or edited.
         AZStd::vector<Layer> m_layers;
 
+        //! The int8 dense layers used for inference when the precision is Int8, these are derived from m_layers and rebuilt whenever the weights change.
+        AZStd::vector<QuantizedLayer> m_quantizedLayers;
+
+        //! The numeric precision used for inference.
+        //! Training always runs on the float layers, so the quantized layers are released for training and rebuilt from the trained weights once it completes.
+        InferencePrecision m_inferencePrecision = InferencePrecision::Float;
+
+        //! If set, m_layers and m_quantizedLayers are empty and inference reads the weights from the mapped file.
+        //! The layers are only loaded into memory once they are needed for training or editing.
+        //! This is only accessed through GetMappedModel and SetMappedModel, as LoadLayers may release it while inference is in progress.
+        AZStd::shared_ptr<MappedModel> m_mappedModel;
+        mutable AZStd::mutex m_mappedModelMutex;
+
         IAssetPersistenceProxy* m_proxy = nullptr;
         friend class MultilayerPerceptronEditorComponent;
     };
@@ -86,7 +179,13 @@ namespace MachineLearning
     struct MlpInferenceContext
         : public IInferenceContext
     {
+        AZStd::vector<LayerInferenceData> m_featureLayerData;
         AZStd::vector<LayerInferenceData> m_layerData;
+
+        //! IInferenceContext interface
+        //! @{
+        AZStd::size_t GetMemoryUsage() const override;
+        //! @}
     };
 
     struct MlpTrainingContext
@@ -99,6 +198,15 @@ namespace MachineLearning
         AZStd::size_t m_trainingSampleSize = 0;
 
         //! The set of layer training data.
+        AZStd::vector<LayerTrainingData> m_featureLayerData;
         AZStd::vector<LayerTrainingData> m_layerData;
+
+        //! The per-sample loss gradients of the last batched backward pass.
+        AZStd::vector<AZ::VectorN> m_batchLossGradients;
+
+        //! ITrainingContext interface
+        //! @{
+        AZStd::size_t GetMemoryUsage() const override;
+        //! @}
     };
 }
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Models/QuantizedLayer.h>
+#include <Algorithms/Activations.h>
+#include <Algorithms/QuantizedOperations.h>
+
+namespace MachineLearning
+{
+    QuantizedLayer::QuantizedLayer(const Layer& layer)
+    {
+        Quantize(layer);
+    }
+
+    void QuantizedLayer::Quantize(const Layer& layer)
+    {
+        m_inputSize = layer.m_inputSize;
+        m_paddedInputSize = GetPaddedQuantizedSize(layer.m_inputSize);
+        m_outputSize = layer.m_outputSize;
+        m_biases = layer.m_biases;
+        m_activationFunction = layer.m_activationFunction;
+        QuantizeMatrix(layer.m_weights, m_paddedInputSize, m_weights, m_weightScales);
+    }
+
+    void QuantizedLayer::Dequantize(Layer& layer) const
+    {
+        layer.m_inputSize = m_inputSize;
+        layer.m_outputSize = m_outputSize;
+        layer.m_biases = m_biases;
+        layer.m_activationFunction = m_activationFunction;
+        layer.m_weights = AZ::MatrixMxN::CreateZero(m_outputSize, m_inputSize);
+        for (AZStd::size_t row = 0; row < m_outputSize; ++row)
+        {
+            const int8_t* rowWeights = m_weights.data() + row * m_paddedInputSize;
+            for (AZStd::size_t col = 0; col < m_inputSize; ++col)
+            {
+                layer.m_weights.SetElement(row, col, static_cast<float>(rowWeights[col]) * m_weightScales[row]);
+            }
+        }
+    }
+
+    const AZ::VectorN& QuantizedLayer::Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations)
+    {
+        const float activationScale = QuantizeVector(activations, m_paddedInputSize, inferenceData.m_quantizedActivations);
+        inferenceData.m_output = m_biases;
+        QuantizedVectorMatrixMultiply(m_weights, m_weightScales, m_paddedInputSize, inferenceData.m_quantizedActivations, activationScale, inferenceData.m_output);
+        Activate(m_activationFunction, inferenceData.m_output, inferenceData.m_output);
+        return inferenceData.m_output;
+    }
+
+    AZStd::span<const AZ::VectorN* const> QuantizedLayer::ForwardBatch(LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN* const> activations)
+    {
+        // Each sample is quantized with its own scale, so samples are evaluated independently
+        inferenceData.m_batchOutput.resize(activations.size());
+        inferenceData.m_batchOutputPointers.resize(activations.size());
+        for (AZStd::size_t iter = 0; iter < activations.size(); ++iter)
+        {
+            AZ::VectorN& output = inferenceData.m_batchOutput[iter];
+            const float activationScale = QuantizeVector(*activations[iter], m_paddedInputSize, inferenceData.m_quantizedActivations);
+            output = m_biases;
+            QuantizedVectorMatrixMultiply(m_weights, m_weightScales, m_paddedInputSize, inferenceData.m_quantizedActivations, activationScale, output);
+            Activate(m_activationFunction, output, output);
+            inferenceData.m_batchOutputPointers[iter] = &output;
+        }
+        return inferenceData.m_batchOutputPointers;
+    }
+
+    bool QuantizedLayer::Serialize(AzNetworking::ISerializer& serializer)
+    {
+        uint32_t weightCount = static_cast<uint32_t>(m_weights.size());
+        if (!serializer.Serialize(m_inputSize, "inputSize")
+         || !serializer.Serialize(m_paddedInputSize, "paddedInputSize")
+         || !serializer.Serialize(m_outputSize, "outputSize")
+         || !serializer.Serialize(weightCount, "weightCount"))
+        {
+            return false;
+        }
+
+        // The weights are stored as a raw byte blob rather than element by element
+        m_weights.resize(weightCount);
+        return serializer.SerializeBytes(reinterpret_cast<uint8_t*>(m_weights.data()), weightCount, false, weightCount, "weights")
+            && serializer.Serialize(m_weightScales, "weightScales")
+            && serializer.Serialize(m_biases, "biases")
+            && serializer.Serialize(m_activationFunction, "activationFunction")
+            && (m_weights.size() == m_outputSize * m_paddedInputSize)
+            && (m_weightScales.size() == m_outputSize);
+    }
+
+    AZStd::size_t QuantizedLayer::EstimateSerializeSize() const
+    {
+        const AZStd::size_t padding = 64; // 64 bytes of extra padding just in case
+        return padding
+             + sizeof(m_inputSize)
+             + sizeof(m_paddedInputSize)
+             + sizeof(m_outputSize)
+             + sizeof(uint32_t) // for m_weights size
+             + sizeof(uint32_t) // for m_weights byte count
+             + sizeof(int8_t) * m_weights.size() // m_weights buffer
+             + sizeof(uint32_t) // for m_weightScales size
+             + sizeof(float) * m_weightScales.size() // m_weightScales buffer
+             + sizeof(AZStd::size_t) // for m_biases dimensionality
+             + sizeof(AZStd::size_t) // for m_biases vector size
+             + sizeof(float) * m_outputSize // m_biases buffer
+             + sizeof(m_activationFunction);
+    }
+
+    AZStd::size_t GetMemoryUsage(const QuantizedLayer& layer)
+    {
+        return layer.m_weights.capacity() * sizeof(int8_t)
+             + layer.m_weightScales.capacity() * sizeof(float)
+             + layer.m_biases.GetVectorValues().capacity() * sizeof(AZ::Vector4);
+    }
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Models/Layer.h>
+
+namespace MachineLearning
+{
+    //! An inference-only copy of a Layer with its weights quantized to int8.
+    //! Each output channel (row of the weight matrix) has its own scale, activations are quantized per sample during the forward pass.
+    class QuantizedLayer
+    {
+    public:
+
+        QuantizedLayer() = default;
+        QuantizedLayer(const Layer& layer);
+
+        //! Quantizes the weights of the provided layer, replacing any previously quantized values.
+        void Quantize(const Layer& layer);
+
+        //! Reconstructs a float layer from the quantized weights, this only reverses Quantize up to the quantization error.
+        void Dequantize(Layer& layer) const;
+
+        //! Performs a basic forward pass on this layer using int8 arithmetic, outputs are stored in m_output.
+        const AZ::VectorN& Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations);
+
+        //! Performs a forward pass on a batch of activation vectors, outputs are stored in m_batchOutput.
+        AZStd::span<const AZ::VectorN* const> ForwardBatch(LayerInferenceData& inferenceData, AZStd::span<const AZ::VectorN* const> activations);
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(AzNetworking::ISerializer& serializer);
+
+        //! Returns the estimated size required to serialize this layer.
+        AZStd::size_t EstimateSerializeSize() const;
+
+        // These are intentionally left public so that unit testing can exhaustively examine all layer state
+        AZStd::size_t m_inputSize = 0;
+        AZStd::size_t m_paddedInputSize = 0;
+        AZStd::size_t m_outputSize = 0;
+        AZStd::vector<int8_t> m_weights;
+        AZStd::vector<float> m_weightScales;
+        AZ::VectorN m_biases;
+        ActivationFunctions m_activationFunction = ActivationFunctions::ReLU;
+    };
+
+    //! Returns the number of bytes held by the weights, scales and biases of the provided quantized layer.
+    AZStd::size_t GetMemoryUsage(const QuantizedLayer& layer);
+}
@@ -8,11 +8,21 @@
 
 #include <Nodes/FeedForward.h>
 #include <Models/MultilayerPerceptron.h>
+#include <MachineLearning/IInferenceSystem.h>
 
 namespace MachineLearning
 {
     AZ::VectorN FeedForward::In(INeuralNetworkPtr Model, AZ::VectorN Activations)
     {
+        // Reuse a pooled inference context if the inference system is available, rather than allocating a new context on every call
+        if (IInferenceSystem* inferenceSystem = InferenceSystemInterface::Get())
+        {
+            IInferenceContextPtr inferenceContext = inferenceSystem->AcquireInferenceContext(Model);
+            AZ::VectorN results = *Model->Forward(inferenceContext, Activations);
+            inferenceSystem->ReleaseInferenceContext(Model, inferenceContext);
+            return results;
+        }
+
         AZStd::unique_ptr<IInferenceContext> inferenceContext;
         inferenceContext.reset(Model->CreateInferenceContext());
         AZ::VectorN results = *Model->Forward(inferenceContext.get(), Activations);
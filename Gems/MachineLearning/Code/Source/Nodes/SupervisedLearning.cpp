@@ -31,11 +31,7 @@ namespace MachineLearning
         SupervisedLearningCycle trainingInstance(Model, TrainingData, TestData, static_cast<LossFunctions>(CostFunction), TotalIterations, BatchSize, LearningRate, LearningRateDecay, EarlyStopCost);
 
         trainingInstance.StartTraining();
-        while (!trainingInstance.m_trainingComplete)
-        {
-            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
-        }
-        trainingInstance.StopTraining();
+        trainingInstance.WaitForTrainingToStop();
 
         return Model;
     }
@@ -118,6 +118,9 @@ namespace MachineLearning
         if ((asset == m_asset) && (modelAsset != nullptr))
         {
             m_model = *modelAsset;
+
+            // The editor displays and edits the layers, so they are always loaded into memory rather than read from a mapped file
+            m_model.LoadLayers();
             AzToolsFramework::ToolsApplicationNotificationBus::Broadcast
             (
                 &AzToolsFramework::ToolsApplicationNotificationBus::Events::InvalidatePropertyDisplay, 
@@ -177,7 +180,11 @@ namespace MachineLearning
         {
             m_asset->m_name = m_model.m_name;
             m_asset->m_activationCount = m_model.m_activationCount;
+            m_asset->m_inputShape = m_model.m_inputShape;
+            m_asset->m_featureLayers = m_model.m_featureLayers;
             m_asset->m_layers = m_model.m_layers;
+            m_asset->m_quantizedLayers = m_model.m_quantizedLayers;
+            m_asset->m_mappedModel.reset();
             return m_asset.Save();
         }
 
@@ -196,7 +203,11 @@ namespace MachineLearning
         m_asset = CreateOrFindAsset<ModelAsset>(absolutePath, m_asset.GetAutoLoadBehavior());
         m_asset->m_name = m_model.m_name;
         m_asset->m_activationCount = m_model.m_activationCount;
+        m_asset->m_inputShape = m_model.m_inputShape;
+        m_asset->m_featureLayers = m_model.m_featureLayers;
         m_asset->m_layers = m_model.m_layers;
+        m_asset->m_quantizedLayers = m_model.m_quantizedLayers;
+        m_asset->m_mappedModel.reset();
 
         AZ::Data::AssetBus::Handler::BusDisconnect();
         AZ::Data::AssetBus::Handler::BusConnect(m_asset.GetId());
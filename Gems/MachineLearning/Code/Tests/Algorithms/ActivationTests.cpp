@@ -9,6 +9,12 @@
 #include <AzTest/AzTest.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <Algorithms/Activations.h>
+#include <AzCore/std/math.h>
+#include <random>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
 
 namespace UnitTest
 {
@@ -109,4 +115,260 @@ namespace UnitTest
             ASSERT_EQ(output.GetElement(iter), sourceVector.GetElement(iter));
         }
     }
+
+    // Fills a vector with evenly spaced values across [minValue, maxValue], a dimensionality which isn't a multiple of four exercises the padded lanes
+    static AZ::VectorN CreateRange(AZStd::size_t dimensionality, float minValue, float maxValue)
+    {
+        AZ::VectorN result(dimensionality);
+        for (AZStd::size_t iter = 0; iter < dimensionality; ++iter)
+        {
+            const float t = static_cast<float>(iter) / static_cast<float>(dimensionality - 1);
+            result.SetElement(iter, minValue + t * (maxValue - minValue));
+        }
+        return result;
+    }
+
+    static float ReferenceGelu(float x)
+    {
+        return 0.5f * x * (1.0f + std::tanh(0.7978845608028654f * (x + 0.044715f * x * x * x)));
+    }
+
+    TEST_F(MachineLearning_Activations, TestExpAccuracy)
+    {
+        const AZ::VectorN sourceVector = CreateRange(1023, -80.0f, 80.0f);
+        AZ::VectorN output;
+        MachineLearning::Exp(sourceVector, output);
+
+        for (AZStd::size_t iter = 0; iter < output.GetDimensionality(); ++iter)
+        {
+            const double expected = std::exp(static_cast<double>(sourceVector.GetElement(iter)));
+            const double relativeError = AZStd::abs(output.GetElement(iter) - expected) / expected;
+            ASSERT_LT(relativeError, 1e-6);
+        }
+    }
+
+    TEST_F(MachineLearning_Activations, TestSigmoidAccuracy)
+    {
+        const AZ::VectorN sourceVector = CreateRange(1023, -50.0f, 50.0f);
+        AZ::VectorN output;
+        MachineLearning::Sigmoid(sourceVector, output);
+
+        for (AZStd::size_t iter = 0; iter < output.GetDimensionality(); ++iter)
+        {
+            const float expected = 1.0f / (1.0f + std::exp(-sourceVector.GetElement(iter)));
+            ASSERT_NEAR(output.GetElement(iter), expected, 1e-6f);
+        }
+    }
+
+    TEST_F(MachineLearning_Activations, TestTanhAccuracy)
+    {
+        const AZ::VectorN sourceVector = CreateRange(1023, -20.0f, 20.0f);
+        AZ::VectorN output;
+        MachineLearning::Tanh(sourceVector, output);
+
+        for (AZStd::size_t iter = 0; iter < output.GetDimensionality(); ++iter)
+        {
+            ASSERT_NEAR(output.GetElement(iter), std::tanh(sourceVector.GetElement(iter)), 1e-6f);
+        }
+    }
+
+    TEST_F(MachineLearning_Activations, TestLeakyRelu)
+    {
+        const AZ::VectorN sourceVector = CreateRange(1023, -50.0f, 50.0f);
+        AZ::VectorN output;
+        MachineLearning::LeakyReLU(sourceVector, output);
+
+        for (AZStd::size_t iter = 0; iter < output.GetDimensionality(); ++iter)
+        {
+            const float x = sourceVector.GetElement(iter);
+            ASSERT_FLOAT_EQ(output.GetElement(iter), (x >= 0.0f) ? x : x * MachineLearning::LeakyReLUSlope);
+        }
+    }
+
+    TEST_F(MachineLearning_Activations, TestGeluAccuracy)
+    {
+        const AZ::VectorN sourceVector = CreateRange(1023, -10.0f, 10.0f);
+        AZ::VectorN output;
+        MachineLearning::GELU(sourceVector, output);
+
+        for (AZStd::size_t iter = 0; iter < output.GetDimensionality(); ++iter)
+        {
+            const float x = sourceVector.GetElement(iter);
+            // Compare against the same tanh formulation evaluated with libm
+            ASSERT_NEAR(output.GetElement(iter), ReferenceGelu(x), 1e-5f);
+            // And against the exact definition x * Phi(x), which the tanh formulation approximates
+            const float exact = 0.5f * x * (1.0f + std::erf(x * 0.7071067811865475f));
+            ASSERT_NEAR(output.GetElement(iter), exact, 1e-3f);
+        }
+    }
+
+    TEST_F(MachineLearning_Activations, TestSoftmaxAccuracy)
+    {
+        // An odd dimensionality ensures the zero padding in the final vector element does not contribute to the sum
+        const AZ::VectorN sourceVector = CreateRange(10, -4.0f, 5.0f);
+        AZ::VectorN output;
+        MachineLearning::Softmax(sourceVector, output);
+
+        double sum = 0.0;
+        for (AZStd::size_t iter = 0; iter < sourceVector.GetDimensionality(); ++iter)
+        {
+            sum += std::exp(static_cast<double>(sourceVector.GetElement(iter)));
+        }
+
+        for (AZStd::size_t iter = 0; iter < output.GetDimensionality(); ++iter)
+        {
+            const double expected = std::exp(static_cast<double>(sourceVector.GetElement(iter))) / sum;
+            ASSERT_NEAR(output.GetElement(iter), expected, 1e-6);
+        }
+    }
+
+    TEST_F(MachineLearning_Activations, TestDerivativesMatchFiniteDifferences)
+    {
+        const MachineLearning::ActivationFunctions functions[] =
+        {
+            MachineLearning::ActivationFunctions::Sigmoid,
+            MachineLearning::ActivationFunctions::Tanh,
+            MachineLearning::ActivationFunctions::LeakyReLU,
+            MachineLearning::ActivationFunctions::GELU
+        };
+
+        // Offset the range so no sample lands exactly on the leaky ReLU discontinuity
+        const AZ::VectorN sourceVector = CreateRange(63, -4.1f, 3.9f);
+        const AZ::VectorN backGradients = AZ::VectorN::CreateOne(sourceVector.GetDimensionality());
+        const float delta = 1e-3f;
+
+        for (MachineLearning::ActivationFunctions function : functions)
+        {
+            AZ::VectorN activationOutput;
+            AZ::VectorN derivative;
+            MachineLearning::Activate(function, sourceVector, activationOutput);
+            MachineLearning::Activate_Derivative(function, sourceVector, activationOutput, backGradients, derivative);
+
+            AZ::VectorN plus = sourceVector;
+            AZ::VectorN minus = sourceVector;
+            for (AZStd::size_t iter = 0; iter < sourceVector.GetDimensionality(); ++iter)
+            {
+                plus.SetElement(iter, sourceVector.GetElement(iter) + delta);
+                minus.SetElement(iter, sourceVector.GetElement(iter) - delta);
+            }
+
+            AZ::VectorN plusOutput;
+            AZ::VectorN minusOutput;
+            MachineLearning::Activate(function, plus, plusOutput);
+            MachineLearning::Activate(function, minus, minusOutput);
+            for (AZStd::size_t iter = 0; iter < sourceVector.GetDimensionality(); ++iter)
+            {
+                const float numeric = (plusOutput.GetElement(iter) - minusOutput.GetElement(iter)) / (2.0f * delta);
+                EXPECT_NEAR(derivative.GetElement(iter), numeric, 1e-2f);
+            }
+        }
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Measures every activation function and its derivative against the vector dimensionality.
+    //! The benchmarks take the dimensionality and the activation function index as arguments.
+    class MachineLearning_Activation_Benchmark
+        : public ::benchmark::Fixture
+    {
+    public:
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            InternalSetUp(static_cast<AZStd::size_t>(state.range(0)));
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            InternalSetUp(static_cast<AZStd::size_t>(state.range(0)));
+        }
+
+        void TearDown(const ::benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+
+        void TearDown(::benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+
+    protected:
+
+        static MachineLearning::ActivationFunctions GetActivationFunction(::benchmark::State& state)
+        {
+            const auto activationFunction = static_cast<MachineLearning::ActivationFunctions>(state.range(1));
+            const AZStd::string_view name = MachineLearning::ToString(activationFunction);
+            state.SetLabel(std::string(name.data(), name.size()));
+            return activationFunction;
+        }
+
+        void InternalSetUp(AZStd::size_t dimensionality)
+        {
+            std::mt19937 generator(1234);
+            std::uniform_real_distribution<float> distribution(-4.0f, 4.0f);
+            m_input = AZ::VectorN::CreateZero(dimensionality);
+            m_gradients = AZ::VectorN::CreateZero(dimensionality);
+            for (AZStd::size_t iter = 0; iter < dimensionality; ++iter)
+            {
+                m_input.SetElement(iter, distribution(generator));
+                m_gradients.SetElement(iter, distribution(generator));
+            }
+        }
+
+        void InternalTearDown()
+        {
+            m_input = AZ::VectorN();
+            m_gradients = AZ::VectorN();
+            m_output = AZ::VectorN();
+            m_derivative = AZ::VectorN();
+        }
+
+        AZ::VectorN m_input;
+        AZ::VectorN m_gradients;
+        AZ::VectorN m_output;
+        AZ::VectorN m_derivative;
+    };
+
+    BENCHMARK_DEFINE_F(MachineLearning_Activation_Benchmark, Activate)(::benchmark::State& state)
+    {
+        const MachineLearning::ActivationFunctions activationFunction = GetActivationFunction(state);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MachineLearning::Activate(activationFunction, m_input, m_output);
+            ::benchmark::DoNotOptimize(m_output);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(MachineLearning_Activation_Benchmark, Activate_Derivative)(::benchmark::State& state)
+    {
+        const MachineLearning::ActivationFunctions activationFunction = GetActivationFunction(state);
+        MachineLearning::Activate(activationFunction, m_input, m_output);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MachineLearning::Activate_Derivative(activationFunction, m_input, m_output, m_gradients, m_derivative);
+            ::benchmark::DoNotOptimize(m_derivative);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    static void ActivationArguments(::benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgNames({ "Dimensionality", "Function" });
+        for (int64_t dimensionality : { 10, 128, 1024 })
+        {
+            for (int64_t activationFunction = 0; activationFunction <= static_cast<int64_t>(MachineLearning::ActivationFunctions::GELU); ++activationFunction)
+            {
+                benchmark->Args({ dimensionality, activationFunction });
+            }
+        }
+        benchmark->Unit(::benchmark::kNanosecond);
+    }
+
+    BENCHMARK_REGISTER_F(MachineLearning_Activation_Benchmark, Activate)->Apply(ActivationArguments);
+    BENCHMARK_REGISTER_F(MachineLearning_Activation_Benchmark, Activate_Derivative)->Apply(ActivationArguments);
 }
+#endif
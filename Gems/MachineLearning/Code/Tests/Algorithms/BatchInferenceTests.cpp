@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Algorithms/BatchInference.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <Models/MultilayerPerceptron.h>
+#include <random>
+
+namespace UnitTest
+{
+    class MachineLearning_BatchInference
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    static AZ::VectorN CreateRandomVector(AZStd::size_t dimensionality, std::mt19937& generator)
+    {
+        std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+        AZ::VectorN result = AZ::VectorN::CreateZero(dimensionality);
+        for (AZStd::size_t iter = 0; iter < dimensionality; ++iter)
+        {
+            result.SetElement(iter, distribution(generator));
+        }
+        return result;
+    }
+
+    TEST_F(MachineLearning_BatchInference, TestBatchMatchesForward)
+    {
+        const AZStd::size_t sampleCount = 10;
+        MachineLearning::MultilayerPerceptron mlp(6);
+        mlp.AddLayer(5, MachineLearning::ActivationFunctions::ReLU);
+        mlp.AddLayer(3, MachineLearning::ActivationFunctions::Sigmoid);
+        MachineLearning::INeuralNetworkPtr model(&mlp);
+
+        std::mt19937 generator(1234);
+        AZStd::vector<AZ::VectorN> activations;
+        AZStd::vector<AZ::VectorN> results(sampleCount);
+        MachineLearning::InferenceContextPool contextPool;
+        MachineLearning::BatchInferenceQueue inferenceQueue;
+        for (AZStd::size_t sample = 0; sample < sampleCount; ++sample)
+        {
+            activations.push_back(CreateRandomVector(6, generator));
+            inferenceQueue.Submit(model, activations.back(), [&results, sample](const AZ::VectorN& output) { results[sample] = output; });
+        }
+        EXPECT_EQ(inferenceQueue.GetPendingCount(), sampleCount);
+        EXPECT_EQ(inferenceQueue.Execute(contextPool, nullptr, 4), sampleCount);
+        EXPECT_EQ(inferenceQueue.GetPendingCount(), 0);
+
+        MachineLearning::MlpInferenceContext inferenceData;
+        for (AZStd::size_t sample = 0; sample < sampleCount; ++sample)
+        {
+            const AZ::VectorN* expected = mlp.Forward(&inferenceData, activations[sample]);
+            ASSERT_EQ(results[sample].GetDimensionality(), expected->GetDimensionality());
+            for (AZStd::size_t iter = 0; iter < expected->GetDimensionality(); ++iter)
+            {
+                EXPECT_NEAR(results[sample].GetElement(iter), expected->GetElement(iter), 1.0e-5f);
+            }
+        }
+    }
+
+    TEST_F(MachineLearning_BatchInference, TestContextsArePooled)
+    {
+        MachineLearning::MultilayerPerceptron mlp(4);
+        mlp.AddLayer(2, MachineLearning::ActivationFunctions::Sigmoid);
+        MachineLearning::INeuralNetworkPtr model(&mlp);
+
+        MachineLearning::InferenceContextPool contextPool;
+        MachineLearning::BatchInferenceQueue inferenceQueue;
+        inferenceQueue.Submit(model, AZ::VectorN::CreateOne(4), nullptr);
+        inferenceQueue.Execute(contextPool, nullptr, 64);
+        EXPECT_EQ(contextPool.GetFreeCount(model), 1);
+
+        // Subsequent acquisitions should reuse the context released by the batch
+        MachineLearning::IInferenceContextPtr context = contextPool.Acquire(model);
+        EXPECT_NE(context, nullptr);
+        EXPECT_EQ(contextPool.GetFreeCount(model), 0);
+        contextPool.Release(model, context);
+        EXPECT_EQ(contextPool.Acquire(model), context);
+        contextPool.Release(model, context);
+
+        contextPool.Clear(model);
+        EXPECT_EQ(contextPool.GetFreeCount(model), 0);
+    }
+
+    TEST_F(MachineLearning_BatchInference, TestContextsReleasedAfterClearAreNotPooled)
+    {
+        MachineLearning::MultilayerPerceptron mlp(4);
+        mlp.AddLayer(2, MachineLearning::ActivationFunctions::Sigmoid);
+        MachineLearning::INeuralNetworkPtr model(&mlp);
+
+        // A context still in use when its model is cleared is destroyed on release, as the model may no longer exist by then
+        MachineLearning::InferenceContextPool contextPool;
+        MachineLearning::IInferenceContextPtr clearedContext = contextPool.Acquire(model);
+        MachineLearning::IInferenceContextPtr activeContext = contextPool.Acquire(model);
+        contextPool.Release(model, activeContext);
+        EXPECT_EQ(contextPool.GetFreeCount(model), 1);
+        contextPool.Clear(model);
+        contextPool.Release(model, clearedContext);
+        EXPECT_EQ(contextPool.GetFreeCount(model), 0);
+
+        // Contexts acquired after the model was cleared are pooled as usual
+        MachineLearning::IInferenceContextPtr context = contextPool.Acquire(model);
+        contextPool.Release(model, context);
+        EXPECT_EQ(contextPool.GetFreeCount(model), 1);
+        contextPool.Clear(model);
+    }
+
+    TEST_F(MachineLearning_BatchInference, TestSubmissionsDuringExecuteAreDeferred)
+    {
+        MachineLearning::MultilayerPerceptron mlp(4);
+        mlp.AddLayer(2, MachineLearning::ActivationFunctions::Sigmoid);
+        MachineLearning::INeuralNetworkPtr model(&mlp);
+
+        MachineLearning::InferenceContextPool contextPool;
+        MachineLearning::BatchInferenceQueue inferenceQueue;
+        AZStd::size_t callbackCount = 0;
+        inferenceQueue.Submit(model, AZ::VectorN::CreateOne(4), [&](const AZ::VectorN&)
+        {
+            ++callbackCount;
+            inferenceQueue.Submit(model, AZ::VectorN::CreateZero(4), [&callbackCount](const AZ::VectorN&) { ++callbackCount; });
+        });
+
+        EXPECT_EQ(inferenceQueue.Execute(contextPool, nullptr, 64), 1);
+        EXPECT_EQ(callbackCount, 1);
+        EXPECT_EQ(inferenceQueue.GetPendingCount(), 1);
+        EXPECT_EQ(inferenceQueue.Execute(contextPool, nullptr, 64), 1);
+        EXPECT_EQ(callbackCount, 2);
+
+        inferenceQueue.Remove(model);
+        contextPool.Clear(model);
+    }
+
+    TEST_F(MachineLearning_BatchInference, TestChunksHoldAtLeastSamplesPerJob)
+    {
+        MachineLearning::MultilayerPerceptron mlp(4);
+        mlp.AddLayer(2, MachineLearning::ActivationFunctions::Sigmoid);
+        MachineLearning::INeuralNetworkPtr model(&mlp);
+
+        AZ::JobManagerDesc jobDesc;
+        jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+        jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+        AZ::JobManager jobManager(jobDesc);
+        AZ::JobContext jobContext(jobManager);
+
+        MachineLearning::InferenceContextPool contextPool;
+        MachineLearning::BatchInferenceQueue inferenceQueue;
+        AZStd::size_t callbackCount = 0;
+        for (AZStd::size_t sample = 0; sample < 10; ++sample)
+        {
+            inferenceQueue.Submit(model, AZ::VectorN::CreateOne(4), [&callbackCount](const AZ::VectorN&) { ++callbackCount; });
+        }
+
+        // Each chunk acquires its own context, 10 samples with at least 4 per job are split into two chunks of 5
+        EXPECT_EQ(inferenceQueue.Execute(contextPool, &jobContext, 4), 10);
+        EXPECT_EQ(callbackCount, 10);
+        EXPECT_EQ(contextPool.GetFreeCount(model), 2);
+
+        inferenceQueue.Remove(model);
+        contextPool.Clear(model);
+    }
+
+    TEST_F(MachineLearning_BatchInference, TestRemoveDuringExecuteIsDeferred)
+    {
+        MachineLearning::MultilayerPerceptron firstMlp(4);
+        firstMlp.AddLayer(2, MachineLearning::ActivationFunctions::Sigmoid);
+        MachineLearning::INeuralNetworkPtr firstModel(&firstMlp);
+        MachineLearning::MultilayerPerceptron secondMlp(4);
+        secondMlp.AddLayer(2, MachineLearning::ActivationFunctions::Sigmoid);
+        MachineLearning::INeuralNetworkPtr secondModel(&secondMlp);
+
+        MachineLearning::InferenceContextPool contextPool;
+        MachineLearning::BatchInferenceQueue inferenceQueue;
+        AZStd::size_t firstCallbacks = 0;
+        AZStd::size_t secondCallbacks = 0;
+
+        // Whichever batch is scattered first removes both models, the remaining callbacks of both must be skipped
+        for (AZStd::size_t sample = 0; sample < 3; ++sample)
+        {
+            inferenceQueue.Submit(firstModel, AZ::VectorN::CreateOne(4), [&](const AZ::VectorN&)
+            {
+                ++firstCallbacks;
+                inferenceQueue.Remove(firstModel);
+                inferenceQueue.Remove(secondModel);
+            });
+            inferenceQueue.Submit(secondModel, AZ::VectorN::CreateOne(4), [&](const AZ::VectorN&)
+            {
+                ++secondCallbacks;
+                inferenceQueue.Remove(firstModel);
+                inferenceQueue.Remove(secondModel);
+            });
+        }
+
+        EXPECT_EQ(inferenceQueue.Execute(contextPool, nullptr, 64), 6);
+        EXPECT_EQ(firstCallbacks + secondCallbacks, 1);
+
+        // The removed batches are gone once Execute completes, new requests start from an empty batch
+        inferenceQueue.Submit(firstModel, AZ::VectorN::CreateOne(4), [&firstCallbacks](const AZ::VectorN&) { ++firstCallbacks; });
+        EXPECT_EQ(inferenceQueue.GetPendingCount(), 1);
+        EXPECT_EQ(inferenceQueue.Execute(contextPool, nullptr, 64), 1);
+        EXPECT_EQ(firstCallbacks + secondCallbacks, 2);
+
+        inferenceQueue.Remove(firstModel);
+        contextPool.Clear(firstModel);
+        contextPool.Clear(secondModel);
+    }
+}
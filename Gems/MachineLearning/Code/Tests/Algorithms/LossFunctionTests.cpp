@@ -25,4 +25,49 @@ namespace UnitTest
         const float totalLoss1 = MachineLearning::ComputeTotalCost(MachineLearning::LossFunctions::MeanSquaredError, expected, actual);
         EXPECT_EQ(totalLoss1, 1024.0f);
     }
+
+    TEST_F(MachineLearning_LossFunctions, TestCategoricalCrossEntropy)
+    {
+        AZ::VectorN expected = AZ::VectorN::CreateZero(10);
+        expected.SetElement(3, 1.0f);
+
+        // A uniform prediction over 10 classes has a cross-entropy of log(10)
+        AZ::VectorN actual = AZ::VectorN(10, 0.1f);
+        const float totalLoss = MachineLearning::ComputeTotalCost(MachineLearning::LossFunctions::CategoricalCrossEntropy, expected, actual);
+        EXPECT_NEAR(totalLoss, logf(10.0f), 1e-5f);
+
+        // A confident correct prediction should have a much smaller loss than a confident incorrect one
+        actual = AZ::VectorN::CreateZero(10);
+        actual.SetElement(3, 0.99f);
+        actual.SetElement(4, 0.01f);
+        const float correctLoss = MachineLearning::ComputeTotalCost(MachineLearning::LossFunctions::CategoricalCrossEntropy, expected, actual);
+        EXPECT_NEAR(correctLoss, -logf(0.99f), 1e-5f);
+
+        // Zero probabilities are clamped so the loss stays finite
+        actual.SetElement(3, 0.0f);
+        const float incorrectLoss = MachineLearning::ComputeTotalCost(MachineLearning::LossFunctions::CategoricalCrossEntropy, expected, actual);
+        EXPECT_GT(incorrectLoss, correctLoss);
+        EXPECT_LT(incorrectLoss, AZStd::numeric_limits<float>::infinity());
+    }
+
+    TEST_F(MachineLearning_LossFunctions, TestSoftmaxCrossEntropyFusion)
+    {
+        EXPECT_TRUE(MachineLearning::IsLossFusedWithActivation(MachineLearning::LossFunctions::CategoricalCrossEntropy, MachineLearning::ActivationFunctions::Softmax));
+        EXPECT_FALSE(MachineLearning::IsLossFusedWithActivation(MachineLearning::LossFunctions::CategoricalCrossEntropy, MachineLearning::ActivationFunctions::Sigmoid));
+        EXPECT_FALSE(MachineLearning::IsLossFusedWithActivation(MachineLearning::LossFunctions::MeanSquaredError, MachineLearning::ActivationFunctions::Softmax));
+
+        AZ::VectorN expected = AZ::VectorN::CreateZero(5);
+        expected.SetElement(1, 1.0f);
+        AZ::VectorN actual = AZ::VectorN::CreateZero(5);
+        actual.SetElement(0, 0.2f);
+        actual.SetElement(1, 0.5f);
+        actual.SetElement(2, 0.3f);
+
+        AZ::VectorN gradients;
+        MachineLearning::SoftmaxCrossEntropy_Derivative(expected, actual, gradients);
+        EXPECT_FLOAT_EQ(gradients.GetElement(0), 0.2f);
+        EXPECT_FLOAT_EQ(gradients.GetElement(1), -0.5f);
+        EXPECT_FLOAT_EQ(gradients.GetElement(2), 0.3f);
+        EXPECT_FLOAT_EQ(gradients.GetElement(3), 0.0f);
+    }
 }
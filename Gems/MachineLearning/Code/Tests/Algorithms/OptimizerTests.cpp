@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Algorithms/Optimizers.h>
+#include <Models/Layer.h>
+#include <cmath>
+
+namespace UnitTest
+{
+    class MachineLearning_Optimizers
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    //! Textbook scalar reference of a single optimizer step, without the folding of the Adam bias correction used by ApplyOptimizer.
+    struct ReferenceOptimizer
+    {
+        double m_value = 0.0;
+        double m_firstMoment = 0.0;
+        double m_secondMoment = 0.0;
+        AZStd::size_t m_step = 0;
+
+        void Step(const MachineLearning::OptimizerParameters& optimizer, double learningRate, double gradient)
+        {
+            const double beta1 = optimizer.m_beta1;
+            const double beta2 = optimizer.m_beta2;
+            const double epsilon = optimizer.m_epsilon;
+            ++m_step;
+            switch (optimizer.m_optimizer)
+            {
+            case MachineLearning::OptimizerFunctions::StochasticGradientDescent:
+                m_value -= learningRate * gradient;
+                break;
+            case MachineLearning::OptimizerFunctions::Momentum:
+                m_firstMoment = beta1 * m_firstMoment + gradient;
+                m_value -= learningRate * m_firstMoment;
+                break;
+            case MachineLearning::OptimizerFunctions::RMSProp:
+                m_secondMoment = beta2 * m_secondMoment + (1.0 - beta2) * gradient * gradient;
+                m_value -= learningRate * gradient / (std::sqrt(m_secondMoment) + epsilon);
+                break;
+            case MachineLearning::OptimizerFunctions::Adam:
+            {
+                m_firstMoment = beta1 * m_firstMoment + (1.0 - beta1) * gradient;
+                m_secondMoment = beta2 * m_secondMoment + (1.0 - beta2) * gradient * gradient;
+                const double firstCorrected = m_firstMoment / (1.0 - std::pow(beta1, static_cast<double>(m_step)));
+                const double secondCorrected = m_secondMoment / (1.0 - std::pow(beta2, static_cast<double>(m_step)));
+                m_value -= learningRate * firstCorrected / (std::sqrt(secondCorrected) + epsilon);
+                break;
+            }
+            }
+        }
+    };
+
+    // Five elements cover a whole Vector4 and the padded remainder of a second one
+    static constexpr AZStd::size_t TestElementCount = 5;
+    static constexpr float TestLearningRate = 0.05f;
+
+    static float GetTestValue(AZStd::size_t element)
+    {
+        return 0.25f * static_cast<float>(element) - 0.5f;
+    }
+
+    static float GetTestGradient(AZStd::size_t step, AZStd::size_t element)
+    {
+        return (step == 0) ? (0.3f * static_cast<float>(element) - 0.7f) : (0.9f - 0.2f * static_cast<float>(element));
+    }
+
+    TEST_F(MachineLearning_Optimizers, TestStepsMatchClosedForm)
+    {
+        const MachineLearning::OptimizerFunctions optimizers[] =
+        {
+            MachineLearning::OptimizerFunctions::StochasticGradientDescent,
+            MachineLearning::OptimizerFunctions::Momentum,
+            MachineLearning::OptimizerFunctions::RMSProp,
+            MachineLearning::OptimizerFunctions::Adam
+        };
+
+        for (MachineLearning::OptimizerFunctions optimizerFunction : optimizers)
+        {
+            MachineLearning::OptimizerParameters optimizer;
+            optimizer.m_optimizer = optimizerFunction;
+
+            AZ::VectorN values = AZ::VectorN::CreateZero(TestElementCount);
+            AZ::VectorN firstMoments = AZ::VectorN::CreateZero(TestElementCount);
+            AZ::VectorN secondMoments = AZ::VectorN::CreateZero(TestElementCount);
+            ReferenceOptimizer reference[TestElementCount];
+            for (AZStd::size_t element = 0; element < TestElementCount; ++element)
+            {
+                values.SetElement(element, GetTestValue(element));
+                reference[element].m_value = GetTestValue(element);
+            }
+
+            // The first step checks the initialization of the moments, the second the decay of the first step's moments
+            for (AZStd::size_t step = 0; step < 2; ++step)
+            {
+                AZ::VectorN gradients = AZ::VectorN::CreateZero(TestElementCount);
+                for (AZStd::size_t element = 0; element < TestElementCount; ++element)
+                {
+                    gradients.SetElement(element, GetTestGradient(step, element));
+                    reference[element].Step(optimizer, TestLearningRate, GetTestGradient(step, element));
+                }
+
+                MachineLearning::ApplyOptimizer(optimizer, TestLearningRate, step + 1, values, gradients, firstMoments, secondMoments);
+                for (AZStd::size_t element = 0; element < TestElementCount; ++element)
+                {
+                    EXPECT_NEAR(values.GetElement(element), reference[element].m_value, 1.0e-5)
+                        << "Optimizer " << static_cast<int>(optimizerFunction) << " step " << step + 1 << " element " << element;
+                    EXPECT_EQ(gradients.GetElement(element), 0.0f);
+                }
+            }
+        }
+    }
+
+    TEST_F(MachineLearning_Optimizers, TestAdamFirstStepIsSignedLearningRate)
+    {
+        // With bias correction the first Adam step moves every parameter by learningRate * g / (|g| + epsilon)
+        MachineLearning::OptimizerParameters optimizer;
+        optimizer.m_optimizer = MachineLearning::OptimizerFunctions::Adam;
+
+        AZ::MatrixMxN values = AZ::MatrixMxN::CreateZero(3, TestElementCount);
+        AZ::MatrixMxN gradients = AZ::MatrixMxN::CreateZero(3, TestElementCount);
+        AZ::MatrixMxN firstMoments = AZ::MatrixMxN::CreateZero(3, TestElementCount);
+        AZ::MatrixMxN secondMoments = AZ::MatrixMxN::CreateZero(3, TestElementCount);
+        for (AZStd::size_t row = 0; row < 3; ++row)
+        {
+            for (AZStd::size_t column = 0; column < TestElementCount; ++column)
+            {
+                gradients.SetElement(row, column, GetTestGradient(row, column) * static_cast<float>(row + 1));
+            }
+        }
+
+        const AZ::MatrixMxN initialGradients = gradients;
+        MachineLearning::ApplyOptimizer(optimizer, TestLearningRate, 1, values, gradients, firstMoments, secondMoments);
+        for (AZStd::size_t row = 0; row < 3; ++row)
+        {
+            for (AZStd::size_t column = 0; column < TestElementCount; ++column)
+            {
+                const float gradient = initialGradients.GetElement(row, column);
+                const float expected = -TestLearningRate * gradient / (std::abs(gradient) + optimizer.m_epsilon);
+                EXPECT_NEAR(values.GetElement(row, column), expected, 1.0e-6f);
+            }
+        }
+    }
+
+    TEST_F(MachineLearning_Optimizers, TestSwitchingOptimizerResetsMoments)
+    {
+        MachineLearning::Layer layer(MachineLearning::ActivationFunctions::Linear, TestElementCount, 3);
+        layer.m_weights.SetZero();
+        layer.m_biases.SetZero();
+
+        const auto setGradients = [](MachineLearning::LayerTrainingData& trainingData)
+        {
+            trainingData.m_weightGradients = AZ::MatrixMxN::CreateZero(3, TestElementCount);
+            trainingData.m_biasGradients = AZ::VectorN::CreateZero(3);
+            for (AZStd::size_t row = 0; row < 3; ++row)
+            {
+                for (AZStd::size_t column = 0; column < TestElementCount; ++column)
+                {
+                    trainingData.m_weightGradients.SetElement(row, column, GetTestGradient(0, column));
+                }
+                trainingData.m_biasGradients.SetElement(row, 0.5f);
+            }
+        };
+
+        MachineLearning::LayerTrainingData trainingData;
+        MachineLearning::OptimizerParameters adam;
+        adam.m_optimizer = MachineLearning::OptimizerFunctions::Adam;
+        setGradients(trainingData);
+        layer.ApplyGradients(trainingData, TestLearningRate, adam);
+        EXPECT_EQ(trainingData.m_optimizerStep, 1);
+
+        // Momentum must start from a zero velocity and step one, not reuse the Adam moments and step count
+        const AZ::MatrixMxN weightsBefore = layer.m_weights;
+        MachineLearning::OptimizerParameters momentum;
+        momentum.m_optimizer = MachineLearning::OptimizerFunctions::Momentum;
+        setGradients(trainingData);
+        layer.ApplyGradients(trainingData, TestLearningRate, momentum);
+        EXPECT_EQ(trainingData.m_optimizerStep, 1);
+        EXPECT_EQ(trainingData.m_optimizerFunction, MachineLearning::OptimizerFunctions::Momentum);
+        for (AZStd::size_t row = 0; row < 3; ++row)
+        {
+            for (AZStd::size_t column = 0; column < TestElementCount; ++column)
+            {
+                const float expected = weightsBefore.GetElement(row, column) - TestLearningRate * GetTestGradient(0, column);
+                EXPECT_NEAR(layer.m_weights.GetElement(row, column), expected, 1.0e-6f);
+            }
+        }
+
+        // Plain gradient descent holds no moments at all
+        MachineLearning::OptimizerParameters sgd;
+        setGradients(trainingData);
+        layer.ApplyGradients(trainingData, TestLearningRate, sgd);
+        EXPECT_EQ(trainingData.m_weightFirstMoments.GetRowCount(), 0);
+        EXPECT_EQ(trainingData.m_biasSecondMoments.GetDimensionality(), 0);
+    }
+}
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <Algorithms/Activations.h>
+#include <Algorithms/Training.h>
+#include <Models/MultilayerPerceptron.h>
+#include <random>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    //! An in-memory labeled data set of uniformly random activations and one-hot encoded labels.
+    class RandomTrainingData
+        : public MachineLearning::ILabeledTrainingData
+    {
+    public:
+
+        RandomTrainingData(AZStd::size_t sampleCount, AZStd::size_t inputSize, AZStd::size_t outputSize, uint32_t seed)
+        {
+            std::mt19937 generator(seed);
+            std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+            std::uniform_int_distribution<AZStd::size_t> labelDistribution(0, outputSize - 1);
+            m_data.resize(sampleCount);
+            m_labels.resize(sampleCount);
+            for (AZStd::size_t sample = 0; sample < sampleCount; ++sample)
+            {
+                m_data[sample] = AZ::VectorN::CreateZero(inputSize);
+                for (AZStd::size_t iter = 0; iter < inputSize; ++iter)
+                {
+                    m_data[sample].SetElement(iter, distribution(generator));
+                }
+                MachineLearning::OneHotEncode(labelDistribution(generator), outputSize, m_labels[sample]);
+            }
+        }
+
+        bool LoadArchive(const AZ::IO::Path&, const AZ::IO::Path&) override { return true; }
+        AZStd::size_t GetSampleCount() const override { return m_data.size(); }
+        const AZ::VectorN& GetLabelByIndex(AZStd::size_t index) override { return m_labels[index]; }
+        const AZ::VectorN& GetDataByIndex(AZStd::size_t index) override { return m_data[index]; }
+        bool SupportsConcurrentBatches() const override { return true; }
+
+        void GetBatch(AZStd::span<const AZStd::size_t> indices, AZStd::span<AZ::VectorN> data, AZStd::span<AZ::VectorN> labels) const override
+        {
+            for (AZStd::size_t iter = 0; iter < indices.size(); ++iter)
+            {
+                data[iter] = m_data[indices[iter]];
+                labels[iter] = m_labels[indices[iter]];
+            }
+        }
+
+    private:
+
+        AZStd::vector<AZ::VectorN> m_data;
+        AZStd::vector<AZ::VectorN> m_labels;
+    };
+
+    //! Starts training and blocks until the training cycle completes, failing rather than hanging if it does not complete in time.
+    static void TrainToCompletion(MachineLearning::SupervisedLearningCycle& cycle)
+    {
+        cycle.StartTraining();
+        if (!cycle.WaitForTrainingToStop(AZStd::chrono::milliseconds(60000)))
+        {
+            ADD_FAILURE() << "Training did not complete within the timeout";
+            cycle.StopTraining();
+            cycle.WaitForTrainingToStop();
+        }
+    }
+
+    static void InitializeCycle
+    (
+        MachineLearning::SupervisedLearningCycle& cycle,
+        MachineLearning::INeuralNetworkPtr model,
+        MachineLearning::ILabeledTrainingDataPtr trainingData,
+        AZStd::size_t testSampleCount,
+        AZStd::size_t epochs,
+        AZStd::size_t batchSize
+    )
+    {
+        cycle.m_model = model;
+        cycle.m_trainData.SetSourceData(trainingData);
+        cycle.m_trainData.SetRange(0, trainingData->GetSampleCount());
+        cycle.m_testData.SetSourceData(trainingData);
+        cycle.m_testData.SetRange(0, testSampleCount);
+        cycle.m_costFunction = MachineLearning::LossFunctions::CategoricalCrossEntropy;
+        cycle.m_totalIterations = epochs;
+        cycle.m_batchSize = batchSize;
+        cycle.m_learningRate = 0.01f;
+        cycle.m_learningRateDecay = 1.0f;
+        cycle.m_earlyStopCost = 0.0f;
+    }
+
+    class MachineLearning_Training
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    TEST_F(MachineLearning_Training, TestTrainingMetrics)
+    {
+        MachineLearning::MultilayerPerceptron mlp(13);
+        mlp.AddLayer(16, MachineLearning::ActivationFunctions::ReLU);
+        mlp.AddLayer(5, MachineLearning::ActivationFunctions::Softmax);
+        MachineLearning::ILabeledTrainingDataPtr trainingData = AZStd::make_shared<RandomTrainingData>(250, 13, 5, 1234);
+
+        MachineLearning::SupervisedLearningCycle cycle;
+        InitializeCycle(cycle, &mlp, trainingData, 50, 2, 32);
+        cycle.m_workerCount = 2;
+        TrainToCompletion(cycle);
+
+        // The metrics of the final epoch remain available once training completes
+        const MachineLearning::TrainingMetrics metrics = cycle.GetMetrics();
+        EXPECT_EQ(metrics.m_epoch, 2);
+        EXPECT_EQ(metrics.m_totalSamples, 500);
+        EXPECT_EQ(metrics.m_epochSamples, 250);
+        EXPECT_EQ(metrics.m_workerCount, 2);
+        EXPECT_GT(metrics.m_samplesPerSecond, 0.0);
+        EXPECT_GT(metrics.m_epochTime, 0.0);
+        EXPECT_GT(metrics.m_gradientTime, 0.0);
+        EXPECT_GT(metrics.m_forwardTime, 0.0);
+        EXPECT_GT(metrics.m_backwardTime, 0.0);
+        EXPECT_GT(metrics.m_evaluationTime, 0.0);
+        EXPECT_LE(metrics.m_gatherTime + metrics.m_gradientTime + metrics.m_reduceTime + metrics.m_updateTime, metrics.m_epochTime * 1.001);
+
+        // Training contexts hold the inference state of their forward pass in addition to all of the gradients
+        EXPECT_GT(metrics.m_inferenceContextMemory, 0);
+        EXPECT_GT(metrics.m_trainingContextMemory, metrics.m_inferenceContextMemory);
+    }
+
+    TEST_F(MachineLearning_Training, TestTrainingQuantizedModel)
+    {
+        MachineLearning::MultilayerPerceptron mlp(13);
+        mlp.AddLayer(16, MachineLearning::ActivationFunctions::ReLU);
+        mlp.AddLayer(5, MachineLearning::ActivationFunctions::Softmax);
+        mlp.SetInferencePrecision(MachineLearning::InferencePrecision::Int8);
+        MachineLearning::ILabeledTrainingDataPtr trainingData = AZStd::make_shared<RandomTrainingData>(100, 13, 5, 1234);
+
+        MachineLearning::SupervisedLearningCycle cycle;
+        InitializeCycle(cycle, &mlp, trainingData, 50, 1, 16);
+        cycle.m_workerCount = 2;
+        cycle.StartTraining();
+
+        // Training runs at float precision, int8 inference is only restored once the caller has waited for the job to exit
+        EXPECT_EQ(mlp.GetInferencePrecision(), MachineLearning::InferencePrecision::Float);
+        EXPECT_TRUE(cycle.WaitForTrainingToStop(AZStd::chrono::milliseconds(60000)));
+        EXPECT_EQ(mlp.GetInferencePrecision(), MachineLearning::InferencePrecision::Int8);
+
+        // The quantized layers are rebuilt from the trained float layers, which remain the master copy
+        for (AZStd::size_t layerIndex = 0; layerIndex < mlp.GetLayerCount(); ++layerIndex)
+        {
+            MachineLearning::QuantizedLayer expected(*mlp.GetLayer(layerIndex));
+            EXPECT_EQ(mlp.GetQuantizedLayer(layerIndex)->m_weights, expected.m_weights);
+        }
+    }
+
+    TEST_F(MachineLearning_Training, TestContextMemoryUsage)
+    {
+        MachineLearning::MultilayerPerceptron mlp(13);
+        mlp.AddLayer(16, MachineLearning::ActivationFunctions::ReLU);
+        mlp.AddLayer(5, MachineLearning::ActivationFunctions::Sigmoid);
+
+        AZStd::unique_ptr<MachineLearning::ITrainingContext> trainingContext(mlp.CreateTrainingContext());
+        const AZStd::size_t initialMemory = trainingContext->GetMemoryUsage();
+
+        RandomTrainingData data(8, 13, 5, 1234);
+        mlp.Reverse(trainingContext.get(), MachineLearning::LossFunctions::MeanSquaredError, data.GetDataByIndex(0), data.GetLabelByIndex(0));
+        const AZStd::size_t trainedMemory = trainingContext->GetMemoryUsage();
+
+        // The 16x13 and 5x16 weight gradient matrices alone occupy 4x4 and 2x4 grids of 4x4 submatrices
+        EXPECT_GE(trainedMemory, initialMemory + 24 * sizeof(AZ::Matrix4x4));
+        EXPECT_GT(trainingContext->m_forwardTime.count(), 0);
+        EXPECT_GT(trainingContext->m_backwardTime.count(), 0);
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Measures a full training epoch over an MNIST shaped data set (784 inputs, 10 classes) against the hidden layer size.
+    //! Random data is used so the benchmark does not depend on the MNIST archives being available.
+    class MachineLearning_Training_Benchmark
+        : public ::benchmark::Fixture
+    {
+    public:
+
+        static constexpr AZStd::size_t SampleCount = 10000;
+        static constexpr AZStd::size_t TestSampleCount = 1000;
+        static constexpr AZStd::size_t BatchSize = 32;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            InternalSetUp(static_cast<AZStd::size_t>(state.range(0)));
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            InternalSetUp(static_cast<AZStd::size_t>(state.range(0)));
+        }
+
+        void TearDown(const ::benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+
+        void TearDown(::benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+
+    protected:
+
+        void InternalSetUp(AZStd::size_t hiddenSize)
+        {
+            m_mlp = AZStd::make_unique<MachineLearning::MultilayerPerceptron>(784);
+            m_mlp->AddLayer(hiddenSize, MachineLearning::ActivationFunctions::ReLU);
+            m_mlp->AddLayer(10, MachineLearning::ActivationFunctions::Softmax);
+            m_trainingData = AZStd::make_shared<UnitTest::RandomTrainingData>(SampleCount, 784, 10, 1234);
+        }
+
+        void InternalTearDown()
+        {
+            m_mlp.reset();
+            m_trainingData.reset();
+        }
+
+        AZStd::unique_ptr<MachineLearning::MultilayerPerceptron> m_mlp;
+        MachineLearning::ILabeledTrainingDataPtr m_trainingData;
+    };
+
+    //! A single-threaded epoch of batched back-propagation and gradient descent, this isolates the model kernels from the training cycle.
+    BENCHMARK_DEFINE_F(MachineLearning_Training_Benchmark, SerialEpoch)(::benchmark::State& state)
+    {
+        AZStd::unique_ptr<MachineLearning::ITrainingContext> trainingContext(m_mlp->CreateTrainingContext());
+        AZStd::vector<AZStd::size_t> indices(BatchSize);
+        AZStd::vector<AZ::VectorN> activations(BatchSize);
+        AZStd::vector<AZ::VectorN> labels(BatchSize);
+        AZStd::vector<const AZ::VectorN*> activationPointers;
+        AZStd::vector<const AZ::VectorN*> labelPointers;
+        for (AZStd::size_t iter = 0; iter < BatchSize; ++iter)
+        {
+            activationPointers.push_back(&activations[iter]);
+            labelPointers.push_back(&labels[iter]);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (AZStd::size_t first = 0; first + BatchSize <= SampleCount; first += BatchSize)
+            {
+                for (AZStd::size_t iter = 0; iter < BatchSize; ++iter)
+                {
+                    indices[iter] = first + iter;
+                }
+                m_trainingData->GetBatch(indices, activations, labels);
+                m_mlp->ReverseBatch(trainingContext.get(), MachineLearning::LossFunctions::CategoricalCrossEntropy, activationPointers, labelPointers);
+                m_mlp->GradientDescent(trainingContext.get(), 0.01f);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * (SampleCount / BatchSize) * BatchSize);
+    }
+
+    //! A complete epoch of the supervised learning cycle, including the parallel workers and the cost evaluation at the end of the epoch.
+    BENCHMARK_DEFINE_F(MachineLearning_Training_Benchmark, SupervisedLearningCycleEpoch)(::benchmark::State& state)
+    {
+        MachineLearning::TrainingMetrics metrics;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MachineLearning::SupervisedLearningCycle cycle;
+            UnitTest::InitializeCycle(cycle, m_mlp.get(), m_trainingData, TestSampleCount, 1, BatchSize);
+            UnitTest::TrainToCompletion(cycle);
+            metrics = cycle.GetMetrics();
+        }
+        state.SetItemsProcessed(state.iterations() * SampleCount);
+        state.counters["SamplesPerSecond"] = metrics.m_samplesPerSecond;
+        state.counters["GradientTime"] = metrics.m_gradientTime;
+        state.counters["ReduceTime"] = metrics.m_reduceTime;
+        state.counters["UpdateTime"] = metrics.m_updateTime;
+        state.counters["EvaluationTime"] = metrics.m_evaluationTime;
+        state.counters["TrainingContextMemory"] = static_cast<double>(metrics.m_trainingContextMemory);
+    }
+
+    BENCHMARK_REGISTER_F(MachineLearning_Training_Benchmark, SerialEpoch)->ArgName("Hidden")->Arg(32)->Arg(128)->Arg(512)->Unit(::benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(MachineLearning_Training_Benchmark, SupervisedLearningCycleEpoch)->ArgName("Hidden")->Arg(32)->Arg(128)->Arg(512)->Unit(::benchmark::kMillisecond)->UseRealTime();
+}
+#endif
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/Utils.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <Assets/FlatModelFormat.h>
+#include <Assets/MappedModel.h>
+#include <Assets/ModelAsset.h>
+#include <Models/MultilayerPerceptron.h>
+#include <random>
+
+namespace UnitTest
+{
+    class MachineLearning_FlatModelFormat
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    // Dimensionalities are deliberately not multiples of four to exercise the padding of the 4x4 blocks
+    static MachineLearning::ModelAsset CreateTestAsset()
+    {
+        std::mt19937 generator(1357);
+        std::normal_distribution<float> distribution(0.0f, 0.5f);
+
+        MachineLearning::ModelAsset asset;
+        asset.m_name = "FlatModel";
+        asset.m_activationCount = 13;
+        asset.m_layers.emplace_back(MachineLearning::ActivationFunctions::ReLU, 13, 9);
+        asset.m_layers.emplace_back(MachineLearning::ActivationFunctions::Softmax, 9, 6);
+        for (MachineLearning::Layer& layer : asset.m_layers)
+        {
+            for (AZStd::size_t row = 0; row < layer.m_outputSize; ++row)
+            {
+                for (AZStd::size_t col = 0; col < layer.m_inputSize; ++col)
+                {
+                    layer.m_weights.SetElement(row, col, distribution(generator));
+                }
+                layer.m_biases.SetElement(row, distribution(generator));
+            }
+            asset.m_quantizedLayers.emplace_back(layer);
+        }
+        return asset;
+    }
+
+    static AZStd::vector<uint8_t> WriteToBuffer(const MachineLearning::ModelAsset& asset)
+    {
+        AZStd::vector<uint8_t> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>> stream(&buffer);
+        EXPECT_TRUE(MachineLearning::WriteFlatModel(asset, stream));
+        return buffer;
+    }
+
+    TEST_F(MachineLearning_FlatModelFormat, TestRoundTrip)
+    {
+        const MachineLearning::ModelAsset asset = CreateTestAsset();
+        const AZStd::vector<uint8_t> buffer = WriteToBuffer(asset);
+        EXPECT_EQ(buffer.size(), MachineLearning::GetFlatModelSize(asset));
+
+        MachineLearning::FlatModelView view;
+        ASSERT_TRUE(view.Initialize(buffer.data(), buffer.size()));
+        EXPECT_EQ(view.GetName(), asset.m_name);
+        EXPECT_EQ(view.GetActivationCount(), asset.m_activationCount);
+        ASSERT_EQ(view.GetLayerCount(), asset.m_layers.size());
+        ASSERT_EQ(view.GetQuantizedLayerCount(), asset.m_quantizedLayers.size());
+
+        // Every block must be aligned relative to the start of the file so that it is aligned when mapped
+        for (AZStd::size_t iter = 0; iter < view.GetLayerCount(); ++iter)
+        {
+            EXPECT_EQ((reinterpret_cast<const uint8_t*>(view.GetLayer(iter).m_weights) - buffer.data()) % MachineLearning::FlatModelAlignment, 0);
+            EXPECT_EQ((reinterpret_cast<const uint8_t*>(view.GetLayer(iter).m_biases) - buffer.data()) % MachineLearning::FlatModelAlignment, 0);
+        }
+
+        MachineLearning::ModelAsset loaded;
+        MachineLearning::ReadFlatModel(view, loaded);
+        EXPECT_EQ(loaded.m_name, asset.m_name);
+        ASSERT_EQ(loaded.m_layers.size(), asset.m_layers.size());
+        for (AZStd::size_t layer = 0; layer < asset.m_layers.size(); ++layer)
+        {
+            const MachineLearning::Layer& expected = asset.m_layers[layer];
+            const MachineLearning::Layer& actual = loaded.m_layers[layer];
+            EXPECT_EQ(actual.m_activationFunction, expected.m_activationFunction);
+            for (AZStd::size_t row = 0; row < expected.m_outputSize; ++row)
+            {
+                for (AZStd::size_t col = 0; col < expected.m_inputSize; ++col)
+                {
+                    EXPECT_EQ(actual.m_weights.GetElement(row, col), expected.m_weights.GetElement(row, col));
+                }
+                EXPECT_EQ(actual.m_biases.GetElement(row), expected.m_biases.GetElement(row));
+            }
+
+            EXPECT_EQ(loaded.m_quantizedLayers[layer].m_weights, asset.m_quantizedLayers[layer].m_weights);
+            EXPECT_EQ(loaded.m_quantizedLayers[layer].m_weightScales, asset.m_quantizedLayers[layer].m_weightScales);
+        }
+    }
+
+    TEST_F(MachineLearning_FlatModelFormat, TestMalformedFilesRejected)
+    {
+        const MachineLearning::ModelAsset asset = CreateTestAsset();
+        AZStd::vector<uint8_t> buffer = WriteToBuffer(asset);
+        MachineLearning::FlatModelView view;
+
+        // Truncated files
+        EXPECT_FALSE(view.Initialize(buffer.data(), buffer.size() - 1));
+        EXPECT_FALSE(view.Initialize(buffer.data(), sizeof(MachineLearning::FlatModelHeader) - 1));
+
+        // A weight block which points past the end of the file
+        AZStd::vector<uint8_t> badOffset = buffer;
+        MachineLearning::FlatLayerEntry entry;
+        memcpy(&entry, badOffset.data() + sizeof(MachineLearning::FlatModelHeader), sizeof(entry));
+        entry.m_weightOffset = badOffset.size();
+        memcpy(badOffset.data() + sizeof(MachineLearning::FlatModelHeader), &entry, sizeof(entry));
+        EXPECT_FALSE(view.Initialize(badOffset.data(), badOffset.size()));
+
+        // Files written with the opposite byte order are recognized as flat models but rejected, as the values are read in place
+        AZStd::vector<uint8_t> swapped = buffer;
+        AZStd::reverse(swapped.begin(), swapped.begin() + sizeof(uint32_t));
+        EXPECT_TRUE(MachineLearning::FlatModelView::HasFlatModelTag(swapped.data(), swapped.size()));
+        EXPECT_FALSE(view.Initialize(swapped.data(), swapped.size()));
+
+        // Other formats must not be mistaken for a flat model
+        AZStd::vector<uint8_t> serialized(asset.EstimateSerializeSize());
+        EXPECT_FALSE(MachineLearning::FlatModelView::HasFlatModelTag(serialized.data(), serialized.size()));
+        EXPECT_TRUE(view.Initialize(buffer.data(), buffer.size()));
+    }
+
+    TEST_F(MachineLearning_FlatModelFormat, TestMappedInferenceMatchesLoaded)
+    {
+        const MachineLearning::ModelAsset asset = CreateTestAsset();
+        const AZStd::vector<uint8_t> buffer = WriteToBuffer(asset);
+
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZ::IO::FixedMaxPath filePath = tempDirectory.Resolve("model.mlmodel");
+        {
+            AZ::IO::SystemFile file;
+            ASSERT_TRUE(file.Open(filePath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY));
+            ASSERT_EQ(file.Write(buffer.data(), buffer.size()), buffer.size());
+        }
+
+        AZStd::shared_ptr<MachineLearning::MappedModel> mappedModel = MachineLearning::MappedModel::Open(filePath.c_str());
+        ASSERT_NE(mappedModel, nullptr);
+
+        MachineLearning::ModelAsset mappedAsset;
+        mappedAsset.SetMappedModel(mappedModel);
+        EXPECT_TRUE(mappedAsset.m_layers.empty());
+
+        // Models assigned from the same asset share the mapping rather than copying the weights
+        MachineLearning::MultilayerPerceptron mapped;
+        MachineLearning::MultilayerPerceptron sharedMapping;
+        mapped = mappedAsset;
+        sharedMapping = mappedAsset;
+        EXPECT_TRUE(mapped.IsMapped());
+        EXPECT_TRUE(sharedMapping.IsMapped());
+        EXPECT_EQ(mappedModel.use_count(), 4);
+        EXPECT_EQ(mapped.GetLayerCount(), asset.m_layers.size());
+        EXPECT_EQ(mapped.GetOutputDimensionality(), 6);
+
+        MachineLearning::MultilayerPerceptron loaded;
+        loaded = asset;
+        EXPECT_FALSE(loaded.IsMapped());
+        EXPECT_EQ(mapped.GetParameterCount(), loaded.GetParameterCount());
+
+        std::mt19937 generator(2468);
+        std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+        AZStd::vector<AZ::VectorN> samples(5, AZ::VectorN::CreateZero(13));
+        AZStd::vector<const AZ::VectorN*> samplePointers;
+        for (AZ::VectorN& sample : samples)
+        {
+            for (AZStd::size_t iter = 0; iter < sample.GetDimensionality(); ++iter)
+            {
+                sample.SetElement(iter, distribution(generator));
+            }
+            samplePointers.push_back(&sample);
+        }
+
+        MachineLearning::MlpInferenceContext mappedContext;
+        MachineLearning::MlpInferenceContext loadedContext;
+        MachineLearning::MlpInferenceContext batchContext;
+        AZStd::span<const AZ::VectorN* const> batchOutputs = mapped.ForwardBatch(&batchContext, samplePointers);
+        ASSERT_EQ(batchOutputs.size(), samples.size());
+        for (AZStd::size_t sample = 0; sample < samples.size(); ++sample)
+        {
+            const AZ::VectorN* mappedOutput = mapped.Forward(&mappedContext, samples[sample]);
+            const AZ::VectorN* loadedOutput = loaded.Forward(&loadedContext, samples[sample]);
+            ASSERT_EQ(mappedOutput->GetDimensionality(), loadedOutput->GetDimensionality());
+            for (AZStd::size_t iter = 0; iter < loadedOutput->GetDimensionality(); ++iter)
+            {
+                EXPECT_NEAR(mappedOutput->GetElement(iter), loadedOutput->GetElement(iter), 1.0e-5f);
+                EXPECT_NEAR(batchOutputs[sample]->GetElement(iter), loadedOutput->GetElement(iter), 1.0e-5f);
+            }
+        }
+
+        // Training or inspecting the layers copies them into memory and releases this model's reference to the mapping
+        AZStd::unique_ptr<MachineLearning::ITrainingContext> trainingContext(mapped.CreateTrainingContext());
+        EXPECT_FALSE(mapped.IsMapped());
+        EXPECT_TRUE(sharedMapping.IsMapped());
+        EXPECT_EQ(mapped.GetLayer(1)->m_weights.GetElement(5, 8), asset.m_layers[1].m_weights.GetElement(5, 8));
+    }
+
+    TEST_F(MachineLearning_FlatModelFormat, TestLoadLayersDuringInference)
+    {
+        const MachineLearning::ModelAsset asset = CreateTestAsset();
+        const AZStd::vector<uint8_t> buffer = WriteToBuffer(asset);
+
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZ::IO::FixedMaxPath filePath = tempDirectory.Resolve("model.mlmodel");
+        {
+            AZ::IO::SystemFile file;
+            ASSERT_TRUE(file.Open(filePath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY));
+            ASSERT_EQ(file.Write(buffer.data(), buffer.size()), buffer.size());
+        }
+
+        // The model holds the only reference, so releasing the mapping unmaps the file unless inference in progress keeps it alive
+        MachineLearning::MultilayerPerceptron mapped;
+        {
+            MachineLearning::ModelAsset mappedAsset;
+            mappedAsset.SetMappedModel(MachineLearning::MappedModel::Open(filePath.c_str()));
+            mapped = mappedAsset;
+        }
+        ASSERT_TRUE(mapped.IsMapped());
+
+        MachineLearning::MultilayerPerceptron loaded;
+        loaded = asset;
+        const AZ::VectorN sample = AZ::VectorN(13, 0.5f);
+        MachineLearning::MlpInferenceContext loadedContext;
+        const AZ::VectorN expected = *loaded.Forward(&loadedContext, sample);
+
+        AZStd::atomic<bool> started = false;
+        AZStd::atomic<bool> stop = false;
+        AZStd::atomic<AZStd::size_t> mismatches = 0;
+        AZStd::thread inferenceThread([&]()
+        {
+            MachineLearning::MlpInferenceContext context;
+            while (!stop)
+            {
+                const AZ::VectorN* output = mapped.Forward(&context, sample);
+                for (AZStd::size_t iter = 0; iter < expected.GetDimensionality(); ++iter)
+                {
+                    mismatches += (AZStd::abs(output->GetElement(iter) - expected.GetElement(iter)) > 1.0e-5f) ? 1 : 0;
+                }
+                started = true;
+            }
+        });
+
+        while (!started)
+        {
+            AZStd::this_thread::yield();
+        }
+        mapped.LoadLayers();
+        EXPECT_FALSE(mapped.IsMapped());
+        stop = true;
+        inferenceThread.join();
+        EXPECT_EQ(mismatches, 0);
+    }
+}
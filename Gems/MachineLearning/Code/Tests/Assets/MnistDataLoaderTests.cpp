@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/Utils.h>
+#include <AzCore/IO/SystemFile.h>
+#include <Assets/MappedFile.h>
+#include <Assets/MnistDataLoader.h>
+#include <Assets/TrainingDataView.h>
+#include <numeric>
+
+namespace UnitTest
+{
+    class MachineLearning_MnistDataLoader
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    // 5x7 images are deliberately not a multiple of the 16 pixel conversion blocks or of the four element vectors
+    static constexpr uint32_t TestImageWidth = 5;
+    static constexpr uint32_t TestImageHeight = 7;
+    static constexpr uint32_t TestImageCount = 6;
+    static constexpr AZStd::size_t TestImageSize = TestImageWidth * TestImageHeight;
+
+    static void AppendBigEndian(AZStd::vector<uint8_t>& buffer, uint32_t value)
+    {
+        buffer.push_back(static_cast<uint8_t>(value >> 24));
+        buffer.push_back(static_cast<uint8_t>(value >> 16));
+        buffer.push_back(static_cast<uint8_t>(value >> 8));
+        buffer.push_back(static_cast<uint8_t>(value));
+    }
+
+    static uint8_t GetTestPixel(AZStd::size_t image, AZStd::size_t pixel)
+    {
+        return static_cast<uint8_t>((image * 37 + pixel * 11) % 256);
+    }
+
+    static uint8_t GetTestLabel(AZStd::size_t image)
+    {
+        return static_cast<uint8_t>((image * 3) % 10);
+    }
+
+    static AZStd::vector<uint8_t> CreateImageArchive(uint32_t imageCount)
+    {
+        AZStd::vector<uint8_t> buffer;
+        AppendBigEndian(buffer, 2051);
+        AppendBigEndian(buffer, imageCount);
+        AppendBigEndian(buffer, TestImageHeight);
+        AppendBigEndian(buffer, TestImageWidth);
+        for (AZStd::size_t image = 0; image < imageCount; ++image)
+        {
+            for (AZStd::size_t pixel = 0; pixel < TestImageSize; ++pixel)
+            {
+                buffer.push_back(GetTestPixel(image, pixel));
+            }
+        }
+        return buffer;
+    }
+
+    static AZStd::vector<uint8_t> CreateLabelArchive(uint32_t labelCount)
+    {
+        AZStd::vector<uint8_t> buffer;
+        AppendBigEndian(buffer, 2049);
+        AppendBigEndian(buffer, labelCount);
+        for (AZStd::size_t image = 0; image < labelCount; ++image)
+        {
+            buffer.push_back(GetTestLabel(image));
+        }
+        return buffer;
+    }
+
+    static void WriteFile(const AZ::IO::FixedMaxPath& filePath, const AZStd::vector<uint8_t>& buffer)
+    {
+        AZ::IO::SystemFile file;
+        ASSERT_TRUE(file.Open(filePath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY));
+        ASSERT_EQ(file.Write(buffer.data(), buffer.size()), buffer.size());
+    }
+
+    static void ExpectTestSample(AZStd::size_t image, const AZ::VectorN& data, const AZ::VectorN& label)
+    {
+        ASSERT_EQ(data.GetDimensionality(), TestImageSize);
+        for (AZStd::size_t pixel = 0; pixel < TestImageSize; ++pixel)
+        {
+            EXPECT_NEAR(data.GetElement(pixel), static_cast<float>(GetTestPixel(image, pixel)) / 255.0f, 1e-6f);
+        }
+
+        ASSERT_EQ(label.GetDimensionality(), 10);
+        for (AZStd::size_t iter = 0; iter < 10; ++iter)
+        {
+            EXPECT_EQ(label.GetElement(iter), (iter == GetTestLabel(image)) ? 1.0f : 0.0f);
+        }
+    }
+
+    TEST_F(MachineLearning_MnistDataLoader, TestMappedFileContents)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZ::IO::FixedMaxPath filePath = tempDirectory.Resolve("contents.bin");
+        const AZStd::vector<uint8_t> buffer = CreateImageArchive(2);
+        WriteFile(filePath, buffer);
+
+        MachineLearning::MappedFile file;
+        ASSERT_TRUE(file.Open(filePath.c_str()));
+        ASSERT_EQ(file.GetSize(), buffer.size());
+        EXPECT_EQ(memcmp(file.GetData(), buffer.data(), buffer.size()), 0);
+
+        file.Close();
+        EXPECT_EQ(file.GetSize(), 0);
+        EXPECT_EQ(file.GetData(), nullptr);
+        EXPECT_FALSE(file.IsMapped());
+
+        EXPECT_FALSE(file.Open(tempDirectory.Resolve("missing.bin").c_str()));
+        EXPECT_EQ(file.GetSize(), 0);
+    }
+
+    TEST_F(MachineLearning_MnistDataLoader, TestLoadAndDequantize)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZ::IO::FixedMaxPath imagePath = tempDirectory.Resolve("images.idx3");
+        const AZ::IO::FixedMaxPath labelPath = tempDirectory.Resolve("labels.idx1");
+        WriteFile(imagePath, CreateImageArchive(TestImageCount));
+        WriteFile(labelPath, CreateLabelArchive(TestImageCount));
+
+        MachineLearning::MnistDataLoader loader;
+        ASSERT_TRUE(loader.LoadArchive(imagePath.c_str(), labelPath.c_str()));
+        ASSERT_EQ(loader.GetSampleCount(), TestImageCount);
+        EXPECT_TRUE(loader.SupportsConcurrentBatches());
+
+        for (AZStd::size_t image = 0; image < TestImageCount; ++image)
+        {
+            const AZ::VectorN data = loader.GetDataByIndex(image);
+            const AZ::VectorN label = loader.GetLabelByIndex(image);
+            ExpectTestSample(image, data, label);
+        }
+
+        const AZStd::size_t indices[] = { 4, 0, 5 };
+        AZStd::vector<AZ::VectorN> data(3);
+        AZStd::vector<AZ::VectorN> labels(3);
+        loader.GetBatch(indices, data, labels);
+        for (AZStd::size_t iter = 0; iter < 3; ++iter)
+        {
+            ExpectTestSample(indices[iter], data[iter], labels[iter]);
+        }
+    }
+
+    TEST_F(MachineLearning_MnistDataLoader, TestMalformedArchivesRejected)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZ::IO::FixedMaxPath imagePath = tempDirectory.Resolve("images.idx3");
+        const AZ::IO::FixedMaxPath labelPath = tempDirectory.Resolve("labels.idx1");
+        MachineLearning::MnistDataLoader loader;
+
+        // Label archive in place of the image archive
+        WriteFile(imagePath, CreateLabelArchive(TestImageCount));
+        WriteFile(labelPath, CreateLabelArchive(TestImageCount));
+        EXPECT_FALSE(loader.LoadArchive(imagePath.c_str(), labelPath.c_str()));
+
+        // Truncated image data
+        AZStd::vector<uint8_t> truncated = CreateImageArchive(TestImageCount);
+        truncated.resize(truncated.size() - 1);
+        WriteFile(imagePath, truncated);
+        EXPECT_FALSE(loader.LoadArchive(imagePath.c_str(), labelPath.c_str()));
+
+        // Mismatched image and label counts
+        WriteFile(imagePath, CreateImageArchive(TestImageCount));
+        WriteFile(labelPath, CreateLabelArchive(TestImageCount - 1));
+        EXPECT_FALSE(loader.LoadArchive(imagePath.c_str(), labelPath.c_str()));
+
+        // Missing files
+        EXPECT_FALSE(loader.LoadArchive(tempDirectory.Resolve("missing.idx3").c_str(), labelPath.c_str()));
+    }
+
+    TEST_F(MachineLearning_MnistDataLoader, TestViewBatchesMatchSamples)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZ::IO::FixedMaxPath imagePath = tempDirectory.Resolve("images.idx3");
+        const AZ::IO::FixedMaxPath labelPath = tempDirectory.Resolve("labels.idx1");
+        WriteFile(imagePath, CreateImageArchive(TestImageCount));
+        WriteFile(labelPath, CreateLabelArchive(TestImageCount));
+
+        MachineLearning::TrainingDataView view(AZStd::make_shared<MachineLearning::MnistDataLoader>());
+        ASSERT_TRUE(view.LoadArchive(imagePath.c_str(), labelPath.c_str()));
+        view.SetRange(1, TestImageCount);
+        view.ShuffleSamples();
+        ASSERT_EQ(view.GetSampleCount(), TestImageCount - 1);
+        EXPECT_TRUE(view.SupportsConcurrentBatches());
+
+        AZStd::vector<AZStd::size_t> indices(view.GetSampleCount());
+        std::iota(indices.begin(), indices.end(), 0);
+        AZStd::vector<AZ::VectorN> data(indices.size());
+        AZStd::vector<AZ::VectorN> labels(indices.size());
+        view.GetBatch(indices, data, labels);
+
+        // Batches follow the shuffled order of the view, the same one GetDataByIndex and GetLabelByIndex use
+        for (AZStd::size_t iter = 0; iter < indices.size(); ++iter)
+        {
+            const AZ::VectorN expectedData = view.GetDataByIndex(iter);
+            const AZ::VectorN expectedLabel = view.GetLabelByIndex(iter);
+            ASSERT_EQ(data[iter].GetDimensionality(), expectedData.GetDimensionality());
+            for (AZStd::size_t pixel = 0; pixel < TestImageSize; ++pixel)
+            {
+                EXPECT_EQ(data[iter].GetElement(pixel), expectedData.GetElement(pixel));
+            }
+            for (AZStd::size_t element = 0; element < 10; ++element)
+            {
+                EXPECT_EQ(labels[iter].GetElement(element), expectedLabel.GetElement(element));
+            }
+            // The first sample of the source data is outside the range of the view
+            EXPECT_NE(data[iter].GetElement(1), static_cast<float>(GetTestPixel(0, 1)) / 255.0f);
+        }
+    }
+}
@@ -0,0 +1,451 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Algorithms/Activations.h>
+#include <Assets/ModelAsset.h>
+#include <Models/ConvolutionLayer.h>
+#include <Models/MaxPoolLayer.h>
+#include <Models/MultilayerPerceptron.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <random>
+
+namespace UnitTest
+{
+    class MachineLearning_Convolution
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    static AZ::VectorN CreateRandomVector(AZStd::size_t size, std::mt19937& generator)
+    {
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        AZ::VectorN result = AZ::VectorN::CreateZero(size);
+        for (AZStd::size_t iter = 0; iter < size; ++iter)
+        {
+            result.SetElement(iter, distribution(generator));
+        }
+        return result;
+    }
+
+    static float DotProduct(const AZ::VectorN& lhs, const AZ::VectorN& rhs)
+    {
+        float result = 0.0f;
+        for (AZStd::size_t iter = 0; iter < lhs.GetDimensionality(); ++iter)
+        {
+            result += lhs.GetElement(iter) * rhs.GetElement(iter);
+        }
+        return result;
+    }
+
+    TEST_F(MachineLearning_Convolution, TestConvolutionForward)
+    {
+        // A 4x4 single channel image holding the values 0 to 15
+        const MachineLearning::ImageShape inputShape{ 4, 4, 1 };
+        AZ::VectorN image = AZ::VectorN::CreateZero(16);
+        for (AZStd::size_t iter = 0; iter < 16; ++iter)
+        {
+            image.SetElement(iter, static_cast<float>(iter));
+        }
+
+        // A single 2x2 filter of ones sums each input window
+        MachineLearning::ConvolutionLayer layer(MachineLearning::ActivationFunctions::Linear, inputShape, 1, 2);
+        layer.m_weights = AZ::MatrixMxN::CreateZero(1, 4);
+        layer.m_weights += 1.0f;
+        layer.m_biases = AZ::VectorN::CreateZero(1);
+        EXPECT_EQ(layer.GetOutputShape().m_width, 3);
+        EXPECT_EQ(layer.GetOutputShape().m_height, 3);
+        EXPECT_EQ(layer.GetOutputSize(), 9);
+        EXPECT_EQ(layer.GetParameterCount(), 5);
+
+        MachineLearning::LayerInferenceData inferenceData;
+        const AZ::VectorN& output = layer.Forward(inferenceData, image);
+        ASSERT_EQ(output.GetDimensionality(), 9);
+        EXPECT_FLOAT_EQ(output.GetElement(0), 0.0f + 1.0f + 4.0f + 5.0f);
+        EXPECT_FLOAT_EQ(output.GetElement(4), 5.0f + 6.0f + 9.0f + 10.0f);
+        EXPECT_FLOAT_EQ(output.GetElement(8), 10.0f + 11.0f + 14.0f + 15.0f);
+
+        // Zero padding adds a border of zeros, so the corner windows only cover a single input element
+        MachineLearning::ConvolutionLayer paddedLayer(MachineLearning::ActivationFunctions::Linear, inputShape, 1, 2, 1, 1);
+        paddedLayer.m_weights = layer.m_weights;
+        paddedLayer.m_biases = layer.m_biases;
+        EXPECT_EQ(paddedLayer.GetOutputShape().m_width, 5);
+        EXPECT_EQ(paddedLayer.GetOutputShape().m_height, 5);
+        const AZ::VectorN& paddedOutput = paddedLayer.Forward(inferenceData, image);
+        EXPECT_FLOAT_EQ(paddedOutput.GetElement(0), 0.0f);
+        EXPECT_FLOAT_EQ(paddedOutput.GetElement(1), 0.0f + 1.0f);
+        EXPECT_FLOAT_EQ(paddedOutput.GetElement(24), 15.0f);
+    }
+
+    TEST_F(MachineLearning_Convolution, TestConvolutionChannels)
+    {
+        // Channels are contiguous per pixel, so a 1x1 filter with weights (1, 10) mixes the channels of each pixel
+        const MachineLearning::ImageShape inputShape{ 2, 2, 2 };
+        AZ::VectorN image = AZ::VectorN::CreateZero(8);
+        for (AZStd::size_t iter = 0; iter < 8; ++iter)
+        {
+            image.SetElement(iter, static_cast<float>(iter));
+        }
+
+        MachineLearning::ConvolutionLayer layer(MachineLearning::ActivationFunctions::Linear, inputShape, 2, 1);
+        layer.m_weights = AZ::MatrixMxN::CreateZero(2, 2);
+        layer.m_weights.SetElement(0, 0, 1.0f);
+        layer.m_weights.SetElement(0, 1, 10.0f);
+        layer.m_weights.SetElement(1, 0, -1.0f);
+        layer.m_biases = AZ::VectorN::CreateOne(2);
+
+        MachineLearning::LayerInferenceData inferenceData;
+        const AZ::VectorN& output = layer.Forward(inferenceData, image);
+        ASSERT_EQ(output.GetDimensionality(), 8);
+        for (AZStd::size_t pixel = 0; pixel < 4; ++pixel)
+        {
+            const float channel0 = image.GetElement(pixel * 2);
+            const float channel1 = image.GetElement(pixel * 2 + 1);
+            EXPECT_FLOAT_EQ(output.GetElement(pixel * 2), channel0 + 10.0f * channel1 + 1.0f);
+            EXPECT_FLOAT_EQ(output.GetElement(pixel * 2 + 1), 1.0f - channel0);
+        }
+    }
+
+    TEST_F(MachineLearning_Convolution, TestConvolutionGradients)
+    {
+        // Compares the analytic gradients against central differences of the loss g . output for a fixed random g
+        std::mt19937 generator(1234);
+        const MachineLearning::ImageShape inputShape{ 5, 5, 2 };
+        MachineLearning::ConvolutionLayer layer(MachineLearning::ActivationFunctions::Linear, inputShape, 3, 3, 2, 1);
+        const AZ::VectorN image = CreateRandomVector(inputShape.GetSize(), generator);
+        const AZ::VectorN outputGradients = CreateRandomVector(layer.GetOutputSize(), generator);
+
+        MachineLearning::LayerInferenceData inferenceData;
+        MachineLearning::LayerTrainingData trainingData;
+        layer.Forward(inferenceData, image);
+        layer.AccumulateGradients(1, trainingData, inferenceData, outputGradients);
+
+        const float epsilon = 1.0e-2f;
+        for (AZStd::size_t row = 0; row < layer.m_weights.GetRowCount(); ++row)
+        {
+            for (AZStd::size_t col = 0; col < layer.m_weights.GetColumnCount(); ++col)
+            {
+                MachineLearning::ConvolutionLayer perturbed = layer;
+                MachineLearning::LayerInferenceData perturbedData;
+                perturbed.m_weights.SetElement(row, col, layer.m_weights.GetElement(row, col) + epsilon);
+                const float upper = DotProduct(outputGradients, perturbed.Forward(perturbedData, image));
+                perturbed.m_weights.SetElement(row, col, layer.m_weights.GetElement(row, col) - epsilon);
+                const float lower = DotProduct(outputGradients, perturbed.Forward(perturbedData, image));
+                EXPECT_NEAR(trainingData.m_weightGradients.GetElement(row, col), (upper - lower) / (2.0f * epsilon), 1.0e-2f);
+            }
+        }
+
+        for (AZStd::size_t iter = 0; iter < layer.m_biases.GetDimensionality(); ++iter)
+        {
+            MachineLearning::ConvolutionLayer perturbed = layer;
+            MachineLearning::LayerInferenceData perturbedData;
+            perturbed.m_biases.SetElement(iter, layer.m_biases.GetElement(iter) + epsilon);
+            const float upper = DotProduct(outputGradients, perturbed.Forward(perturbedData, image));
+            perturbed.m_biases.SetElement(iter, layer.m_biases.GetElement(iter) - epsilon);
+            const float lower = DotProduct(outputGradients, perturbed.Forward(perturbedData, image));
+            EXPECT_NEAR(trainingData.m_biasGradients.GetElement(iter), (upper - lower) / (2.0f * epsilon), 1.0e-2f);
+        }
+
+        ASSERT_EQ(trainingData.m_backpropagationGradients.GetDimensionality(), image.GetDimensionality());
+        for (AZStd::size_t iter = 0; iter < image.GetDimensionality(); ++iter)
+        {
+            MachineLearning::LayerInferenceData perturbedData;
+            AZ::VectorN perturbedImage = image;
+            perturbedImage.SetElement(iter, image.GetElement(iter) + epsilon);
+            const float upper = DotProduct(outputGradients, layer.Forward(perturbedData, perturbedImage));
+            perturbedImage.SetElement(iter, image.GetElement(iter) - epsilon);
+            const float lower = DotProduct(outputGradients, layer.Forward(perturbedData, perturbedImage));
+            EXPECT_NEAR(trainingData.m_backpropagationGradients.GetElement(iter), (upper - lower) / (2.0f * epsilon), 1.0e-2f);
+        }
+    }
+
+    TEST_F(MachineLearning_Convolution, TestConvolutionBatch)
+    {
+        std::mt19937 generator(42);
+        const MachineLearning::ImageShape inputShape{ 6, 5, 3 };
+        MachineLearning::ConvolutionLayer layer(MachineLearning::ActivationFunctions::ReLU, inputShape, 5, 3, 1, 1);
+
+        const AZStd::size_t batchSize = 4;
+        AZStd::vector<AZ::VectorN> images;
+        AZStd::vector<AZ::VectorN> outputGradients;
+        AZStd::vector<const AZ::VectorN*> imagePointers;
+        for (AZStd::size_t iter = 0; iter < batchSize; ++iter)
+        {
+            images.push_back(CreateRandomVector(inputShape.GetSize(), generator));
+            outputGradients.push_back(CreateRandomVector(layer.GetOutputSize(), generator));
+        }
+        for (const AZ::VectorN& image : images)
+        {
+            imagePointers.push_back(&image);
+        }
+
+        // The batched passes must produce the same outputs, averaged gradients and back-propagated gradients as the per-sample passes
+        MachineLearning::LayerInferenceData singleInference;
+        MachineLearning::LayerTrainingData singleTraining;
+        AZStd::vector<AZ::VectorN> singleOutputs;
+        AZStd::vector<AZ::VectorN> singleBackpropagation;
+        for (AZStd::size_t iter = 0; iter < batchSize; ++iter)
+        {
+            singleOutputs.push_back(layer.Forward(singleInference, images[iter]));
+            layer.AccumulateGradients(iter + 1, singleTraining, singleInference, outputGradients[iter]);
+            singleBackpropagation.push_back(singleTraining.m_backpropagationGradients);
+        }
+
+        MachineLearning::LayerInferenceData batchInference;
+        MachineLearning::LayerTrainingData batchTraining;
+        AZStd::span<const AZ::VectorN* const> batchOutputs = layer.ForwardBatch(batchInference, imagePointers);
+        layer.AccumulateBatchGradients(batchSize, batchTraining, batchInference, outputGradients);
+
+        ASSERT_EQ(batchOutputs.size(), batchSize);
+        for (AZStd::size_t sample = 0; sample < batchSize; ++sample)
+        {
+            for (AZStd::size_t iter = 0; iter < layer.GetOutputSize(); ++iter)
+            {
+                EXPECT_NEAR(batchOutputs[sample]->GetElement(iter), singleOutputs[sample].GetElement(iter), 1.0e-5f);
+            }
+            for (AZStd::size_t iter = 0; iter < layer.GetInputSize(); ++iter)
+            {
+                EXPECT_NEAR(batchTraining.m_batchBackpropagationGradients[sample].GetElement(iter), singleBackpropagation[sample].GetElement(iter), 1.0e-4f);
+            }
+        }
+
+        for (AZStd::size_t row = 0; row < layer.m_weights.GetRowCount(); ++row)
+        {
+            for (AZStd::size_t col = 0; col < layer.m_weights.GetColumnCount(); ++col)
+            {
+                EXPECT_NEAR(batchTraining.m_weightGradients.GetElement(row, col), singleTraining.m_weightGradients.GetElement(row, col), 1.0e-4f);
+            }
+        }
+        for (AZStd::size_t iter = 0; iter < layer.m_biases.GetDimensionality(); ++iter)
+        {
+            EXPECT_NEAR(batchTraining.m_biasGradients.GetElement(iter), singleTraining.m_biasGradients.GetElement(iter), 1.0e-4f);
+        }
+    }
+
+    TEST_F(MachineLearning_Convolution, TestMaxPool)
+    {
+        // Two channels of a 4x4 image, the second channel is the negation of the first
+        const MachineLearning::ImageShape inputShape{ 4, 4, 2 };
+        AZ::VectorN image = AZ::VectorN::CreateZero(32);
+        for (AZStd::size_t iter = 0; iter < 16; ++iter)
+        {
+            image.SetElement(iter * 2, static_cast<float>(iter));
+            image.SetElement(iter * 2 + 1, -static_cast<float>(iter));
+        }
+
+        MachineLearning::MaxPoolLayer layer(inputShape, 2);
+        EXPECT_EQ(layer.GetOutputShape().m_width, 2);
+        EXPECT_EQ(layer.GetOutputShape().m_height, 2);
+        EXPECT_EQ(layer.GetOutputShape().m_channels, 2);
+        EXPECT_EQ(layer.GetParameterCount(), 0);
+
+        MachineLearning::LayerInferenceData inferenceData;
+        const AZ::VectorN& output = layer.Forward(inferenceData, image);
+        ASSERT_EQ(output.GetDimensionality(), 8);
+        EXPECT_FLOAT_EQ(output.GetElement(0), 5.0f);
+        EXPECT_FLOAT_EQ(output.GetElement(1), 0.0f);
+        EXPECT_FLOAT_EQ(output.GetElement(2), 7.0f);
+        EXPECT_FLOAT_EQ(output.GetElement(3), -2.0f);
+        EXPECT_FLOAT_EQ(output.GetElement(6), 15.0f);
+        EXPECT_FLOAT_EQ(output.GetElement(7), -10.0f);
+
+        // Gradients are routed back to the selected input elements only
+        MachineLearning::LayerTrainingData trainingData;
+        const AZ::VectorN outputGradients = AZ::VectorN::CreateOne(8);
+        layer.AccumulateGradients(1, trainingData, inferenceData, outputGradients);
+        const AZ::VectorN& inputGradients = trainingData.m_backpropagationGradients;
+        ASSERT_EQ(inputGradients.GetDimensionality(), 32);
+        float gradientSum = 0.0f;
+        for (AZStd::size_t iter = 0; iter < 32; ++iter)
+        {
+            gradientSum += inputGradients.GetElement(iter);
+        }
+        EXPECT_FLOAT_EQ(gradientSum, 8.0f);
+        EXPECT_FLOAT_EQ(inputGradients.GetElement(5 * 2), 1.0f);
+        EXPECT_FLOAT_EQ(inputGradients.GetElement(0 * 2 + 1), 1.0f);
+        EXPECT_FLOAT_EQ(inputGradients.GetElement(4 * 2), 0.0f);
+    }
+
+    TEST_F(MachineLearning_Convolution, TestConvolutionalModel)
+    {
+        std::mt19937 generator(7);
+        MachineLearning::MultilayerPerceptron mlp;
+        mlp.SetInputShape(MachineLearning::ImageShape{ 6, 6, 1 });
+        mlp.AddConvolutionLayer(4, 3);
+        mlp.AddMaxPoolLayer(2);
+        mlp.AddLayer(3, MachineLearning::ActivationFunctions::Softmax);
+
+        EXPECT_EQ(mlp.GetInputDimensionality(), 36);
+        EXPECT_EQ(mlp.GetFeatureLayerCount(), 2);
+        EXPECT_EQ(mlp.GetLayerCount(), 1);
+        EXPECT_EQ(mlp.GetFeatureOutputShape().GetSize(), 16);
+        EXPECT_EQ(mlp.GetOutputDimensionality(), 3);
+        EXPECT_EQ(mlp.GetParameterCount(), (4 * 9 + 4) + (16 * 3 + 3));
+
+        const AZStd::size_t batchSize = 5;
+        AZStd::vector<AZ::VectorN> activations;
+        AZStd::vector<AZ::VectorN> labels(batchSize);
+        AZStd::vector<const AZ::VectorN*> activationPointers;
+        AZStd::vector<const AZ::VectorN*> labelPointers;
+        for (AZStd::size_t iter = 0; iter < batchSize; ++iter)
+        {
+            activations.push_back(CreateRandomVector(36, generator));
+            MachineLearning::OneHotEncode(iter % 3, 3, labels[iter]);
+        }
+        for (AZStd::size_t iter = 0; iter < batchSize; ++iter)
+        {
+            activationPointers.push_back(&activations[iter]);
+            labelPointers.push_back(&labels[iter]);
+        }
+
+        // The batched model passes must match the per-sample passes through every layer type
+        MachineLearning::MlpTrainingContext singleTraining;
+        MachineLearning::MlpTrainingContext batchTraining;
+        for (AZStd::size_t sample = 0; sample < batchSize; ++sample)
+        {
+            mlp.Reverse(&singleTraining, MachineLearning::LossFunctions::CategoricalCrossEntropy, activations[sample], labels[sample]);
+        }
+        mlp.ReverseBatch(&batchTraining, MachineLearning::LossFunctions::CategoricalCrossEntropy, activationPointers, labelPointers);
+
+        ASSERT_EQ(batchTraining.m_featureLayerData.size(), 2);
+        const AZ::MatrixMxN& singleWeights = singleTraining.m_featureLayerData[0].m_weightGradients;
+        const AZ::MatrixMxN& batchWeights = batchTraining.m_featureLayerData[0].m_weightGradients;
+        ASSERT_EQ(batchWeights.GetRowCount(), 4);
+        ASSERT_EQ(batchWeights.GetColumnCount(), 9);
+        for (AZStd::size_t row = 0; row < singleWeights.GetRowCount(); ++row)
+        {
+            for (AZStd::size_t col = 0; col < singleWeights.GetColumnCount(); ++col)
+            {
+                EXPECT_NEAR(batchWeights.GetElement(row, col), singleWeights.GetElement(row, col), 1.0e-4f);
+            }
+        }
+
+        // Gradient descent updates the convolution filters along with the dense layers
+        const AZ::MatrixMxN initialFilters = static_cast<MachineLearning::ConvolutionLayer*>(mlp.GetFeatureLayer(0))->m_weights;
+        mlp.GradientDescent(&batchTraining, 0.1f);
+        const AZ::MatrixMxN& updatedFilters = static_cast<MachineLearning::ConvolutionLayer*>(mlp.GetFeatureLayer(0))->m_weights;
+        bool filtersChanged = false;
+        for (AZStd::size_t row = 0; row < updatedFilters.GetRowCount(); ++row)
+        {
+            for (AZStd::size_t col = 0; col < updatedFilters.GetColumnCount(); ++col)
+            {
+                filtersChanged |= (updatedFilters.GetElement(row, col) != initialFilters.GetElement(row, col));
+            }
+        }
+        EXPECT_TRUE(filtersChanged);
+
+        // Copies of the model deep copy the feature extraction layers
+        MachineLearning::MultilayerPerceptron copy(mlp);
+        EXPECT_NE(copy.GetFeatureLayer(0), mlp.GetFeatureLayer(0));
+        MachineLearning::MlpInferenceContext modelInference;
+        MachineLearning::MlpInferenceContext copyInference;
+        const AZ::VectorN* modelOutput = mlp.Forward(&modelInference, activations[0]);
+        const AZ::VectorN* copyOutput = copy.Forward(&copyInference, activations[0]);
+        for (AZStd::size_t iter = 0; iter < modelOutput->GetDimensionality(); ++iter)
+        {
+            EXPECT_FLOAT_EQ(copyOutput->GetElement(iter), modelOutput->GetElement(iter));
+        }
+    }
+
+    TEST_F(MachineLearning_Convolution, TestConvolutionalModelAsset)
+    {
+        std::mt19937 generator(11);
+        MachineLearning::ModelAsset asset;
+        asset.m_name = "ConvolutionalModel";
+        asset.m_activationCount = 64;
+        asset.m_inputShape = MachineLearning::ImageShape{ 8, 8, 1 };
+        asset.m_featureLayers.emplace_back(AZStd::make_unique<MachineLearning::ConvolutionLayer>(MachineLearning::ActivationFunctions::ReLU, MachineLearning::ImageShape{ 8, 8, 1 }, 2, 3, 1, 1));
+        asset.m_featureLayers.emplace_back(AZStd::make_unique<MachineLearning::MaxPoolLayer>(MachineLearning::ImageShape{ 8, 8, 2 }, 2));
+        asset.m_layers.emplace_back(MachineLearning::ActivationFunctions::Sigmoid, 32, 4);
+
+        AZStd::vector<uint8_t> buffer(asset.EstimateSerializeSize());
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(asset.Serialize(inputSerializer));
+
+        MachineLearning::ModelAsset loaded;
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        EXPECT_TRUE(loaded.Serialize(outputSerializer));
+        EXPECT_EQ(loaded.m_version, MachineLearning::ModelAsset::SerializedVersion);
+        EXPECT_TRUE(loaded.m_inputShape == asset.m_inputShape);
+        ASSERT_EQ(loaded.m_featureLayers.size(), 2);
+        EXPECT_EQ(loaded.m_featureLayers[0]->GetLayerType(), MachineLearning::LayerTypes::Convolution);
+        EXPECT_EQ(loaded.m_featureLayers[1]->GetLayerType(), MachineLearning::LayerTypes::MaxPool);
+        EXPECT_EQ(loaded.m_featureLayers[1]->GetOutputSize(), 32);
+
+        // Models assigned from the original and the loaded asset must produce the same outputs
+        MachineLearning::MultilayerPerceptron original;
+        MachineLearning::MultilayerPerceptron restored;
+        original = asset;
+        restored = loaded;
+        EXPECT_TRUE(restored.GetFeatureOutputShape() == (MachineLearning::ImageShape{ 4, 4, 2 }));
+        const AZ::VectorN image = CreateRandomVector(64, generator);
+        MachineLearning::MlpInferenceContext originalInference;
+        MachineLearning::MlpInferenceContext restoredInference;
+        const AZ::VectorN* originalOutput = original.Forward(&originalInference, image);
+        const AZ::VectorN* restoredOutput = restored.Forward(&restoredInference, image);
+        ASSERT_EQ(restoredOutput->GetDimensionality(), 4);
+        for (AZStd::size_t iter = 0; iter < originalOutput->GetDimensionality(); ++iter)
+        {
+            EXPECT_FLOAT_EQ(restoredOutput->GetElement(iter), originalOutput->GetElement(iter));
+        }
+    }
+
+    TEST_F(MachineLearning_Convolution, TestCorruptLayersRejected)
+    {
+        // Filters sized for a different kernel than the one the layer is configured with
+        MachineLearning::ConvolutionLayer layer(MachineLearning::ActivationFunctions::ReLU, MachineLearning::ImageShape{ 6, 6, 2 }, 3, 3);
+        layer.m_weights = AZ::MatrixMxN::CreateZero(3, 9);
+        AZStd::vector<uint8_t> buffer(layer.EstimateSerializeSize());
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(layer.Serialize(inputSerializer));
+
+        MachineLearning::ConvolutionLayer loaded;
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        EXPECT_FALSE(loaded.Serialize(outputSerializer));
+
+        // Feature extraction layers which do not consume the input shape of the model
+        MachineLearning::ModelAsset asset;
+        asset.m_name = "MismatchedModel";
+        asset.m_activationCount = 64;
+        asset.m_inputShape = MachineLearning::ImageShape{ 8, 8, 1 };
+        asset.m_featureLayers.emplace_back(AZStd::make_unique<MachineLearning::MaxPoolLayer>(MachineLearning::ImageShape{ 4, 4, 4 }, 2));
+        AZStd::vector<uint8_t> assetBuffer(asset.EstimateSerializeSize());
+        AzNetworking::NetworkInputSerializer assetInputSerializer(assetBuffer.data(), static_cast<uint32_t>(assetBuffer.size()));
+        EXPECT_TRUE(asset.Serialize(assetInputSerializer));
+
+        MachineLearning::ModelAsset loadedAsset;
+        AzNetworking::NetworkOutputSerializer assetOutputSerializer(assetBuffer.data(), assetInputSerializer.GetSize());
+        EXPECT_FALSE(loadedAsset.Serialize(assetOutputSerializer));
+    }
+
+    TEST_F(MachineLearning_Convolution, TestInputShapeChangeResizesLayers)
+    {
+        MachineLearning::MultilayerPerceptron mlp;
+        mlp.SetInputShape(MachineLearning::ImageShape{ 8, 8, 1 });
+        mlp.AddConvolutionLayer(2, 3, 1, 1);
+        mlp.AddMaxPoolLayer(2);
+        mlp.AddLayer(4, MachineLearning::ActivationFunctions::Linear);
+        ASSERT_EQ(mlp.GetLayerWeights(0).GetColumnCount(), 32);
+
+        // Changing the input rewires every feature extraction layer as well as the dense layers behind them
+        mlp.SetInputShape(MachineLearning::ImageShape{ 12, 10, 3 });
+        EXPECT_EQ(mlp.GetInputDimensionality(), 360);
+        EXPECT_TRUE(mlp.GetFeatureLayer(0)->GetInputShape() == (MachineLearning::ImageShape{ 12, 10, 3 }));
+        EXPECT_EQ(static_cast<MachineLearning::ConvolutionLayer*>(mlp.GetFeatureLayer(0))->m_weights.GetColumnCount(), 27);
+        EXPECT_TRUE(mlp.GetFeatureLayer(1)->GetInputShape() == (MachineLearning::ImageShape{ 12, 10, 2 }));
+        EXPECT_TRUE(mlp.GetFeatureOutputShape() == (MachineLearning::ImageShape{ 6, 5, 2 }));
+        EXPECT_EQ(mlp.GetLayerWeights(0).GetColumnCount(), 60);
+
+        std::mt19937 generator(5);
+        MachineLearning::MlpInferenceContext inference;
+        const AZ::VectorN* output = mlp.Forward(&inference, CreateRandomVector(360, generator));
+        EXPECT_EQ(output->GetDimensionality(), 4);
+    }
+}
@@ -9,6 +9,11 @@
 #include <AzTest/AzTest.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <Models/Layer.h>
+#include <random>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
 
 namespace UnitTest
 {
@@ -52,3 +57,148 @@ namespace UnitTest
         }
     }
 }
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Measures the forward and gradient kernels of a single layer against its input and output sizes.
+    class MachineLearning_Layer_Benchmark
+        : public ::benchmark::Fixture
+    {
+    public:
+
+        static constexpr AZStd::size_t BatchSize = 32;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            InternalSetUp(static_cast<AZStd::size_t>(state.range(0)), static_cast<AZStd::size_t>(state.range(1)));
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            InternalSetUp(static_cast<AZStd::size_t>(state.range(0)), static_cast<AZStd::size_t>(state.range(1)));
+        }
+
+        void TearDown(const ::benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+
+        void TearDown(::benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+
+    protected:
+
+        static AZ::VectorN CreateRandomVector(AZStd::size_t dimensionality, std::mt19937& generator)
+        {
+            std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+            AZ::VectorN result = AZ::VectorN::CreateZero(dimensionality);
+            for (AZStd::size_t iter = 0; iter < dimensionality; ++iter)
+            {
+                result.SetElement(iter, distribution(generator));
+            }
+            return result;
+        }
+
+        void InternalSetUp(AZStd::size_t inputSize, AZStd::size_t outputSize)
+        {
+            m_layer = AZStd::make_unique<MachineLearning::Layer>(MachineLearning::ActivationFunctions::ReLU, inputSize, outputSize);
+            m_inferenceData = AZStd::make_unique<MachineLearning::LayerInferenceData>();
+            m_trainingData = AZStd::make_unique<MachineLearning::LayerTrainingData>();
+
+            std::mt19937 generator(1234);
+            m_activations = CreateRandomVector(inputSize, generator);
+            m_gradients = CreateRandomVector(outputSize, generator);
+            for (AZStd::size_t iter = 0; iter < BatchSize; ++iter)
+            {
+                m_batchActivations.push_back(CreateRandomVector(inputSize, generator));
+                m_batchGradients.push_back(CreateRandomVector(outputSize, generator));
+            }
+            for (const AZ::VectorN& activations : m_batchActivations)
+            {
+                m_batchActivationPointers.push_back(&activations);
+            }
+        }
+
+        void InternalTearDown()
+        {
+            m_layer.reset();
+            m_inferenceData.reset();
+            m_trainingData.reset();
+            m_activations = AZ::VectorN();
+            m_gradients = AZ::VectorN();
+            m_batchActivations = {};
+            m_batchGradients = {};
+            m_batchActivationPointers = {};
+        }
+
+        AZStd::unique_ptr<MachineLearning::Layer> m_layer;
+        AZStd::unique_ptr<MachineLearning::LayerInferenceData> m_inferenceData;
+        AZStd::unique_ptr<MachineLearning::LayerTrainingData> m_trainingData;
+        AZ::VectorN m_activations;
+        AZ::VectorN m_gradients;
+        AZStd::vector<AZ::VectorN> m_batchActivations;
+        AZStd::vector<AZ::VectorN> m_batchGradients;
+        AZStd::vector<const AZ::VectorN*> m_batchActivationPointers;
+    };
+
+    BENCHMARK_DEFINE_F(MachineLearning_Layer_Benchmark, Forward)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ::benchmark::DoNotOptimize(m_layer->Forward(*m_inferenceData, m_activations));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK_DEFINE_F(MachineLearning_Layer_Benchmark, ForwardBatch)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ::benchmark::DoNotOptimize(m_layer->ForwardBatch(*m_inferenceData, m_batchActivationPointers));
+        }
+        state.SetItemsProcessed(state.iterations() * BatchSize);
+    }
+
+    BENCHMARK_DEFINE_F(MachineLearning_Layer_Benchmark, AccumulateGradients)(::benchmark::State& state)
+    {
+        m_layer->Forward(*m_inferenceData, m_activations);
+        m_trainingData->m_lastInput = &m_activations;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_layer->AccumulateGradients(1, *m_trainingData, *m_inferenceData, m_gradients);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK_DEFINE_F(MachineLearning_Layer_Benchmark, AccumulateBatchGradients)(::benchmark::State& state)
+    {
+        m_layer->ForwardBatch(*m_inferenceData, m_batchActivationPointers);
+        m_trainingData->m_lastBatchInput = m_batchActivationPointers;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_layer->AccumulateBatchGradients(BatchSize, *m_trainingData, *m_inferenceData, m_batchGradients);
+        }
+        state.SetItemsProcessed(state.iterations() * BatchSize);
+    }
+
+    // Input and output sizes covering the hidden and output layers of typical MNIST models, plus a large square layer
+    static void LayerSizes(::benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgNames({ "Inputs", "Outputs" });
+        benchmark->Args({ 784, 32 });
+        benchmark->Args({ 784, 128 });
+        benchmark->Args({ 784, 512 });
+        benchmark->Args({ 128, 10 });
+        benchmark->Args({ 512, 512 });
+        benchmark->Unit(::benchmark::kMicrosecond);
+    }
+
+    BENCHMARK_REGISTER_F(MachineLearning_Layer_Benchmark, Forward)->Apply(LayerSizes);
+    BENCHMARK_REGISTER_F(MachineLearning_Layer_Benchmark, ForwardBatch)->Apply(LayerSizes);
+    BENCHMARK_REGISTER_F(MachineLearning_Layer_Benchmark, AccumulateGradients)->Apply(LayerSizes);
+    BENCHMARK_REGISTER_F(MachineLearning_Layer_Benchmark, AccumulateBatchGradients)->Apply(LayerSizes);
+}
+#endif
@@ -10,6 +10,11 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <Models/MultilayerPerceptron.h>
 #include <Algorithms/LossFunctions.h>
+#include <random>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
 
 namespace UnitTest
 {
@@ -110,4 +115,349 @@ namespace UnitTest
         float trainedCost = MachineLearning::ComputeTotalCost(MachineLearning::LossFunctions::MeanSquaredError, trainingOutput, *trainedOutput);
         EXPECT_LT(trainedCost, 5.0e-6f);
     }
+
+    static void FillRandom(AZStd::vector<AZ::VectorN>& samples, AZStd::size_t sampleCount, AZStd::size_t dimensionality, std::mt19937& generator)
+    {
+        std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+        samples.resize(sampleCount);
+        for (AZ::VectorN& sample : samples)
+        {
+            sample = AZ::VectorN::CreateZero(dimensionality);
+            for (AZStd::size_t iter = 0; iter < dimensionality; ++iter)
+            {
+                sample.SetElement(iter, distribution(generator));
+            }
+        }
+    }
+
+    TEST_F(MachineLearning_MLP, TestBatchMatchesPerSample)
+    {
+        // Dimensionalities are deliberately not multiples of four to exercise the padding of the underlying 4x4 submatrices
+        const AZStd::size_t batchSize = 7;
+        MachineLearning::MultilayerPerceptron mlp(13);
+        mlp.AddLayer(9, MachineLearning::ActivationFunctions::ReLU);
+        mlp.AddLayer(6, MachineLearning::ActivationFunctions::Sigmoid);
+
+        std::mt19937 generator(1234);
+        AZStd::vector<AZ::VectorN> activations;
+        AZStd::vector<AZ::VectorN> labels;
+        FillRandom(activations, batchSize, 13, generator);
+        FillRandom(labels, batchSize, 6, generator);
+
+        AZStd::vector<const AZ::VectorN*> activationPointers;
+        AZStd::vector<const AZ::VectorN*> labelPointers;
+        for (AZStd::size_t iter = 0; iter < batchSize; ++iter)
+        {
+            activationPointers.push_back(&activations[iter]);
+            labelPointers.push_back(&labels[iter]);
+        }
+
+        // The batched feed-forward must produce the same outputs as the per-sample feed-forward
+        MachineLearning::MlpInferenceContext singleInference;
+        MachineLearning::MlpInferenceContext batchInference;
+        AZStd::span<const AZ::VectorN* const> batchOutputs = mlp.ForwardBatch(&batchInference, activationPointers);
+        ASSERT_EQ(batchOutputs.size(), batchSize);
+        for (AZStd::size_t sample = 0; sample < batchSize; ++sample)
+        {
+            const AZ::VectorN* output = mlp.Forward(&singleInference, activations[sample]);
+            for (AZStd::size_t iter = 0; iter < output->GetDimensionality(); ++iter)
+            {
+                EXPECT_NEAR(batchOutputs[sample]->GetElement(iter), output->GetElement(iter), 1.0e-5f);
+            }
+        }
+
+        // Accumulate the same samples one at a time and as two uneven batches, the averaged gradients must match
+        MachineLearning::MlpTrainingContext singleTraining;
+        MachineLearning::MlpTrainingContext batchTraining;
+        for (AZStd::size_t sample = 0; sample < batchSize; ++sample)
+        {
+            mlp.Reverse(&singleTraining, MachineLearning::LossFunctions::MeanSquaredError, activations[sample], labels[sample]);
+        }
+        const AZStd::span<const AZ::VectorN* const> allActivations = activationPointers;
+        const AZStd::span<const AZ::VectorN* const> allLabels = labelPointers;
+        mlp.ReverseBatch(&batchTraining, MachineLearning::LossFunctions::MeanSquaredError, allActivations.first(3), allLabels.first(3));
+        mlp.ReverseBatch(&batchTraining, MachineLearning::LossFunctions::MeanSquaredError, allActivations.subspan(3), allLabels.subspan(3));
+        EXPECT_EQ(singleTraining.m_trainingSampleSize, batchTraining.m_trainingSampleSize);
+
+        for (AZStd::size_t layer = 0; layer < mlp.GetLayerCount(); ++layer)
+        {
+            const AZ::MatrixMxN& singleWeights = singleTraining.m_layerData[layer].m_weightGradients;
+            const AZ::MatrixMxN& batchWeights = batchTraining.m_layerData[layer].m_weightGradients;
+            for (AZStd::size_t row = 0; row < singleWeights.GetRowCount(); ++row)
+            {
+                for (AZStd::size_t col = 0; col < singleWeights.GetColumnCount(); ++col)
+                {
+                    EXPECT_NEAR(batchWeights.GetElement(row, col), singleWeights.GetElement(row, col), 1.0e-5f);
+                }
+            }
+
+            const AZ::VectorN& singleBiases = singleTraining.m_layerData[layer].m_biasGradients;
+            const AZ::VectorN& batchBiases = batchTraining.m_layerData[layer].m_biasGradients;
+            for (AZStd::size_t iter = 0; iter < singleBiases.GetDimensionality(); ++iter)
+            {
+                EXPECT_NEAR(batchBiases.GetElement(iter), singleBiases.GetElement(iter), 1.0e-5f);
+            }
+        }
+    }
+
+    TEST_F(MachineLearning_MLP, TestReduceGradients)
+    {
+        // Gradients accumulated by separate workers over disjoint samples must reduce to the gradients of a single context over all samples
+        const AZStd::size_t sampleCount = 5;
+        MachineLearning::MultilayerPerceptron mlp(10);
+        mlp.AddLayer(7, MachineLearning::ActivationFunctions::ReLU);
+        mlp.AddLayer(3, MachineLearning::ActivationFunctions::Sigmoid);
+
+        std::mt19937 generator(4321);
+        AZStd::vector<AZ::VectorN> activations;
+        AZStd::vector<AZ::VectorN> labels;
+        FillRandom(activations, sampleCount, 10, generator);
+        FillRandom(labels, sampleCount, 3, generator);
+
+        MachineLearning::MlpTrainingContext singleTraining;
+        MachineLearning::MlpTrainingContext workerTraining[2];
+        for (AZStd::size_t sample = 0; sample < sampleCount; ++sample)
+        {
+            mlp.Reverse(&singleTraining, MachineLearning::LossFunctions::MeanSquaredError, activations[sample], labels[sample]);
+            mlp.Reverse(&workerTraining[sample < 2 ? 0 : 1], MachineLearning::LossFunctions::MeanSquaredError, activations[sample], labels[sample]);
+        }
+        mlp.ReduceGradients(&workerTraining[0], &workerTraining[1]);
+        EXPECT_EQ(workerTraining[0].m_trainingSampleSize, sampleCount);
+        EXPECT_EQ(workerTraining[1].m_trainingSampleSize, 0);
+
+        for (AZStd::size_t layer = 0; layer < mlp.GetLayerCount(); ++layer)
+        {
+            const AZ::MatrixMxN& singleWeights = singleTraining.m_layerData[layer].m_weightGradients;
+            const AZ::MatrixMxN& reducedWeights = workerTraining[0].m_layerData[layer].m_weightGradients;
+            for (AZStd::size_t row = 0; row < singleWeights.GetRowCount(); ++row)
+            {
+                for (AZStd::size_t col = 0; col < singleWeights.GetColumnCount(); ++col)
+                {
+                    EXPECT_NEAR(reducedWeights.GetElement(row, col), singleWeights.GetElement(row, col), 1.0e-5f);
+                    EXPECT_EQ(workerTraining[1].m_layerData[layer].m_weightGradients.GetElement(row, col), 0.0f);
+                }
+            }
+
+            const AZ::VectorN& singleBiases = singleTraining.m_layerData[layer].m_biasGradients;
+            const AZ::VectorN& reducedBiases = workerTraining[0].m_layerData[layer].m_biasGradients;
+            for (AZStd::size_t iter = 0; iter < singleBiases.GetDimensionality(); ++iter)
+            {
+                EXPECT_NEAR(reducedBiases.GetElement(iter), singleBiases.GetElement(iter), 1.0e-5f);
+            }
+        }
+    }
+
+    TEST_F(MachineLearning_MLP, TestSoftmaxCrossEntropyGradients)
+    {
+        // The fused softmax cross-entropy gradient must match a finite difference of the total cost
+        // A GELU hidden layer is used so that back-propagation through a layer which retains its activation input is also covered
+        MachineLearning::MultilayerPerceptron mlp(6);
+        mlp.AddLayer(5, MachineLearning::ActivationFunctions::GELU);
+        mlp.AddLayer(3, MachineLearning::ActivationFunctions::Softmax);
+
+        std::mt19937 generator(2468);
+        AZStd::vector<AZ::VectorN> activations;
+        FillRandom(activations, 1, 6, generator);
+        AZ::VectorN label = AZ::VectorN::CreateZero(3);
+        label.SetElement(1, 1.0f);
+
+        MachineLearning::MlpTrainingContext training;
+        mlp.Reverse(&training, MachineLearning::LossFunctions::CategoricalCrossEntropy, activations[0], label);
+
+        // With a single sample the activation gradients of the final layer are exactly the softmax output minus the label
+        MachineLearning::MlpInferenceContext inference;
+        const AZ::VectorN output = *mlp.Forward(&inference, activations[0]);
+        const AZ::VectorN& finalGradients = training.m_layerData[1].m_activationGradients;
+        for (AZStd::size_t iter = 0; iter < output.GetDimensionality(); ++iter)
+        {
+            EXPECT_NEAR(finalGradients.GetElement(iter), output.GetElement(iter) - label.GetElement(iter), 1.0e-6f);
+        }
+
+        const float delta = 1.0e-2f;
+        for (AZStd::size_t layer = 0; layer < mlp.GetLayerCount(); ++layer)
+        {
+            AZ::MatrixMxN& weights = mlp.GetLayer(layer)->m_weights;
+            for (AZStd::size_t row = 0; row < weights.GetRowCount(); ++row)
+            {
+                for (AZStd::size_t col = 0; col < weights.GetColumnCount(); ++col)
+                {
+                    const float original = weights.GetElement(row, col);
+                    weights.SetElement(row, col, original + delta);
+                    const float plusCost = MachineLearning::ComputeTotalCost(MachineLearning::LossFunctions::CategoricalCrossEntropy, label, *mlp.Forward(&inference, activations[0]));
+                    weights.SetElement(row, col, original - delta);
+                    const float minusCost = MachineLearning::ComputeTotalCost(MachineLearning::LossFunctions::CategoricalCrossEntropy, label, *mlp.Forward(&inference, activations[0]));
+                    weights.SetElement(row, col, original);
+
+                    const float numeric = (plusCost - minusCost) / (2.0f * delta);
+                    EXPECT_NEAR(training.m_layerData[layer].m_weightGradients.GetElement(row, col), numeric, 2.0e-3f);
+                }
+            }
+        }
+
+        // The batched path must take the same fused route
+        MachineLearning::MlpTrainingContext batchTraining;
+        const AZ::VectorN* activationPointer = &activations[0];
+        const AZ::VectorN* labelPointer = &label;
+        mlp.ReverseBatch(&batchTraining, MachineLearning::LossFunctions::CategoricalCrossEntropy, AZStd::span<const AZ::VectorN* const>(&activationPointer, 1), AZStd::span<const AZ::VectorN* const>(&labelPointer, 1));
+        for (AZStd::size_t layer = 0; layer < mlp.GetLayerCount(); ++layer)
+        {
+            const AZ::MatrixMxN& singleWeights = training.m_layerData[layer].m_weightGradients;
+            const AZ::MatrixMxN& batchWeights = batchTraining.m_layerData[layer].m_weightGradients;
+            for (AZStd::size_t row = 0; row < singleWeights.GetRowCount(); ++row)
+            {
+                for (AZStd::size_t col = 0; col < singleWeights.GetColumnCount(); ++col)
+                {
+                    EXPECT_NEAR(batchWeights.GetElement(row, col), singleWeights.GetElement(row, col), 1.0e-5f);
+                }
+            }
+        }
+    }
+
+    TEST_F(MachineLearning_MLP, TestOptimizersConverge)
+    {
+        // Every optimizer should drive the simple network from TestGradientCalculations to fit its single training sample
+        const float layer0Weights[] = { 0.15f, 0.20f, 0.25f, 0.30f };
+        const float layer0Biases[] = { 0.35f, 0.35f };
+        const float layer1Weights[] = { 0.40f, 0.45f, 0.50f, 0.55f };
+        const float layer1Biases[] = { 0.60f, 0.60f };
+        const float activations[] = { 0.05f, 0.10f };
+        const float labels[] = { 0.01f, 0.99f };
+
+        const AZ::VectorN trainingInput = AZ::VectorN::CreateFromFloats(2, activations);
+        const AZ::VectorN trainingOutput = AZ::VectorN::CreateFromFloats(2, labels);
+
+        struct OptimizerCase
+        {
+            MachineLearning::OptimizerFunctions m_optimizer;
+            float m_learningRate;
+            float m_beta2;
+        };
+        const OptimizerCase optimizerCases[] =
+        {
+            { MachineLearning::OptimizerFunctions::StochasticGradientDescent, 0.5f, 0.999f },
+            { MachineLearning::OptimizerFunctions::Momentum, 0.5f, 0.999f },
+            { MachineLearning::OptimizerFunctions::RMSProp, 0.01f, 0.9f },
+            { MachineLearning::OptimizerFunctions::Adam, 0.01f, 0.999f },
+        };
+
+        for (const OptimizerCase& optimizerCase : optimizerCases)
+        {
+            MachineLearning::MultilayerPerceptron mlp(2);
+            MachineLearning::MlpInferenceContext inferenceData;
+            MachineLearning::MlpTrainingContext trainingData;
+            mlp.AddLayer(2, MachineLearning::ActivationFunctions::Sigmoid);
+            mlp.AddLayer(2, MachineLearning::ActivationFunctions::Sigmoid);
+            mlp.GetLayer(0)->m_weights = AZ::MatrixMxN::CreateFromPackedFloats(2, 2, layer0Weights);
+            mlp.GetLayer(0)->m_biases = AZ::VectorN::CreateFromFloats(2, layer0Biases);
+            mlp.GetLayer(1)->m_weights = AZ::MatrixMxN::CreateFromPackedFloats(2, 2, layer1Weights);
+            mlp.GetLayer(1)->m_biases = AZ::VectorN::CreateFromFloats(2, layer1Biases);
+
+            MachineLearning::OptimizerParameters optimizer;
+            optimizer.m_optimizer = optimizerCase.m_optimizer;
+            optimizer.m_beta2 = optimizerCase.m_beta2;
+            for (AZStd::size_t step = 0; step < 2000; ++step)
+            {
+                mlp.Reverse(&trainingData, MachineLearning::LossFunctions::MeanSquaredError, trainingInput, trainingOutput);
+                mlp.GradientDescent(&trainingData, optimizerCase.m_learningRate, optimizer);
+            }
+
+            const AZ::VectorN* actualOutput = mlp.Forward(&inferenceData, trainingInput);
+            const float cost = MachineLearning::ComputeTotalCost(MachineLearning::LossFunctions::MeanSquaredError, trainingOutput, *actualOutput);
+            EXPECT_LT(cost, 1.0e-3f) << "Optimizer " << static_cast<int>(optimizerCase.m_optimizer) << " failed to converge";
+        }
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Measures training throughput on MNIST sized layers (784 inputs, 128 hidden neurons, 10 outputs) against the batch size.
+    class MachineLearning_MLP_Benchmark
+        : public ::benchmark::Fixture
+    {
+    public:
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            InternalSetUp(static_cast<AZStd::size_t>(state.range(0)));
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            InternalSetUp(static_cast<AZStd::size_t>(state.range(0)));
+        }
+
+        void TearDown(const ::benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+
+        void TearDown(::benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+
+    protected:
+
+        void InternalSetUp(AZStd::size_t batchSize)
+        {
+            m_mlp = AZStd::make_unique<MachineLearning::MultilayerPerceptron>(784);
+            m_mlp->AddLayer(128, MachineLearning::ActivationFunctions::ReLU);
+            m_mlp->AddLayer(10, MachineLearning::ActivationFunctions::Sigmoid);
+            m_trainingContext = AZStd::make_unique<MachineLearning::MlpTrainingContext>();
+
+            std::mt19937 generator(1234);
+            UnitTest::FillRandom(m_activations, batchSize, 784, generator);
+            UnitTest::FillRandom(m_labels, batchSize, 10, generator);
+            for (AZStd::size_t iter = 0; iter < batchSize; ++iter)
+            {
+                m_activationPointers.push_back(&m_activations[iter]);
+                m_labelPointers.push_back(&m_labels[iter]);
+            }
+        }
+
+        void InternalTearDown()
+        {
+            m_mlp.reset();
+            m_trainingContext.reset();
+            m_activations = {};
+            m_labels = {};
+            m_activationPointers = {};
+            m_labelPointers = {};
+        }
+
+        AZStd::unique_ptr<MachineLearning::MultilayerPerceptron> m_mlp;
+        AZStd::unique_ptr<MachineLearning::MlpTrainingContext> m_trainingContext;
+        AZStd::vector<AZ::VectorN> m_activations;
+        AZStd::vector<AZ::VectorN> m_labels;
+        AZStd::vector<const AZ::VectorN*> m_activationPointers;
+        AZStd::vector<const AZ::VectorN*> m_labelPointers;
+    };
+
+    BENCHMARK_DEFINE_F(MachineLearning_MLP_Benchmark, ReversePerSample)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (AZStd::size_t iter = 0; iter < m_activations.size(); ++iter)
+            {
+                m_mlp->Reverse(m_trainingContext.get(), MachineLearning::LossFunctions::MeanSquaredError, m_activations[iter], m_labels[iter]);
+            }
+            m_mlp->GradientDescent(m_trainingContext.get(), 0.01f);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(MachineLearning_MLP_Benchmark, ReverseBatch)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_mlp->ReverseBatch(m_trainingContext.get(), MachineLearning::LossFunctions::MeanSquaredError, m_activationPointers, m_labelPointers);
+            m_mlp->GradientDescent(m_trainingContext.get(), 0.01f);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(MachineLearning_MLP_Benchmark, ReversePerSample)->RangeMultiplier(4)->Range(1, 256)->Unit(::benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(MachineLearning_MLP_Benchmark, ReverseBatch)->RangeMultiplier(4)->Range(1, 256)->Unit(::benchmark::kMicrosecond);
 }
+#endif
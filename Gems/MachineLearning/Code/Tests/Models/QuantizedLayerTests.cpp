@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Algorithms/Activations.h>
+#include <Algorithms/QuantizedOperations.h>
+#include <Assets/ModelAsset.h>
+#include <Models/MultilayerPerceptron.h>
+#include <Models/QuantizedLayer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <random>
+
+namespace UnitTest
+{
+    class MachineLearning_Quantization
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    static void FillRandomWeights(MachineLearning::Layer& layer, std::mt19937& generator)
+    {
+        std::normal_distribution<float> distribution(0.0f, AZStd::sqrt(2.0f / layer.m_inputSize));
+        for (AZStd::size_t row = 0; row < layer.m_outputSize; ++row)
+        {
+            for (AZStd::size_t col = 0; col < layer.m_inputSize; ++col)
+            {
+                layer.m_weights.SetElement(row, col, distribution(generator));
+            }
+            layer.m_biases.SetElement(row, distribution(generator));
+        }
+    }
+
+    //! Generates inputs with the shape and value distribution of MNIST digits, mostly blank pixels with a band of bright strokes.
+    static AZ::VectorN CreateMnistLikeSample(std::mt19937& generator)
+    {
+        std::uniform_real_distribution<float> intensity(0.0f, 1.0f);
+        std::uniform_int_distribution<int32_t> offset(6, 14);
+        const int32_t strokeStart = offset(generator);
+        AZ::VectorN sample = AZ::VectorN::CreateZero(28 * 28);
+        for (int32_t row = 4; row < 24; ++row)
+        {
+            for (int32_t col = strokeStart; col < strokeStart + 8; ++col)
+            {
+                if (intensity(generator) < 0.6f)
+                {
+                    sample.SetElement(row * 28 + col, intensity(generator));
+                }
+            }
+        }
+        return sample;
+    }
+
+    TEST_F(MachineLearning_Quantization, TestDotProductKernelMatchesScalar)
+    {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int32_t> distribution(-MachineLearning::QuantizedMaxValue, MachineLearning::QuantizedMaxValue);
+        const AZStd::size_t count = MachineLearning::GetPaddedQuantizedSize(784);
+        AZStd::vector<int8_t> lhs(count);
+        AZStd::vector<int8_t> rhs(count);
+        for (AZStd::size_t iter = 0; iter < count; ++iter)
+        {
+            lhs[iter] = static_cast<int8_t>(distribution(generator));
+            rhs[iter] = static_cast<int8_t>(distribution(generator));
+        }
+        EXPECT_EQ(MachineLearning::DotProductInt8(lhs.data(), rhs.data(), count), MachineLearning::DotProductInt8_Scalar(lhs.data(), rhs.data(), count));
+
+        // The extremes of the quantized range must not saturate the int16 intermediates of the SIMD kernels
+        AZStd::fill(lhs.begin(), lhs.end(), int8_t(-MachineLearning::QuantizedMaxValue));
+        AZStd::fill(rhs.begin(), rhs.end(), int8_t(MachineLearning::QuantizedMaxValue));
+        EXPECT_EQ(MachineLearning::DotProductInt8(lhs.data(), rhs.data(), count), -static_cast<int32_t>(count) * 127 * 127);
+    }
+
+    TEST_F(MachineLearning_Quantization, TestQuantizedLayerMatchesFloat)
+    {
+        std::mt19937 generator(7);
+        MachineLearning::Layer layer(MachineLearning::ActivationFunctions::Linear, 37, 11);
+        FillRandomWeights(layer, generator);
+        MachineLearning::QuantizedLayer quantizedLayer(layer);
+        EXPECT_EQ(quantizedLayer.m_paddedInputSize % MachineLearning::QuantizedRowAlignment, 0);
+        EXPECT_EQ(quantizedLayer.m_weightScales.size(), 11);
+
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        AZ::VectorN input = AZ::VectorN::CreateZero(37);
+        for (AZStd::size_t iter = 0; iter < 37; ++iter)
+        {
+            input.SetElement(iter, distribution(generator));
+        }
+
+        MachineLearning::LayerInferenceData floatData;
+        MachineLearning::LayerInferenceData quantizedData;
+        const AZ::VectorN& expected = layer.Forward(floatData, input);
+        const AZ::VectorN& actual = quantizedLayer.Forward(quantizedData, input);
+        for (AZStd::size_t iter = 0; iter < 11; ++iter)
+        {
+            EXPECT_NEAR(actual.GetElement(iter), expected.GetElement(iter), 0.05f);
+        }
+    }
+
+    TEST_F(MachineLearning_Quantization, TestQuantizedMnistClassifierMatchesFloat)
+    {
+        // The network shape matches the MNIST number classifier, 28x28 inputs and 10 output classes
+        std::mt19937 generator(1234);
+        MachineLearning::MultilayerPerceptron mlp(784);
+        mlp.AddLayer(128, MachineLearning::ActivationFunctions::ReLU);
+        mlp.AddLayer(10, MachineLearning::ActivationFunctions::Linear);
+        FillRandomWeights(*mlp.GetLayer(0), generator);
+        FillRandomWeights(*mlp.GetLayer(1), generator);
+
+        const AZStd::size_t sampleCount = 200;
+        AZStd::vector<AZ::VectorN> samples;
+        AZStd::vector<AZ::VectorN> expected;
+        MachineLearning::MlpInferenceContext inferenceData;
+        for (AZStd::size_t iter = 0; iter < sampleCount; ++iter)
+        {
+            samples.push_back(CreateMnistLikeSample(generator));
+            expected.push_back(*mlp.Forward(&inferenceData, samples.back()));
+        }
+
+        const AZStd::size_t floatMemory = mlp.GetMemoryUsage();
+        mlp.SetInferencePrecision(MachineLearning::InferencePrecision::Int8);
+        EXPECT_EQ(mlp.GetInferencePrecision(), MachineLearning::InferencePrecision::Int8);
+        EXPECT_EQ(mlp.GetLayerCount(), 2);
+        EXPECT_EQ(mlp.GetOutputDimensionality(), 10);
+
+        // The float layers are kept as the master copy, the quantized layers used for inference should take roughly a quarter of their memory
+        EXPECT_LT((mlp.GetMemoryUsage() - floatMemory) * 3, floatMemory);
+
+        AZStd::size_t matchingClasses = 0;
+        float maxError = 0.0f;
+        float maxMagnitude = 0.0f;
+        for (AZStd::size_t iter = 0; iter < sampleCount; ++iter)
+        {
+            const AZ::VectorN* actual = mlp.Forward(&inferenceData, samples[iter]);
+            for (AZStd::size_t element = 0; element < 10; ++element)
+            {
+                maxError = AZStd::max(maxError, AZStd::abs(actual->GetElement(element) - expected[iter].GetElement(element)));
+                maxMagnitude = AZStd::max(maxMagnitude, AZStd::abs(expected[iter].GetElement(element)));
+            }
+            matchingClasses += (MachineLearning::ArgMaxDecode(*actual) == MachineLearning::ArgMaxDecode(expected[iter])) ? 1 : 0;
+        }
+
+        // Quantization error must remain a small fraction of the output range, and should almost never change the predicted class
+        EXPECT_LT(maxError, 0.05f * maxMagnitude);
+        EXPECT_GE(matchingClasses, sampleCount * 95 / 100);
+
+        // Switching back to float releases the quantized layers and runs on the original float weights, so nothing is lost to the round trip
+        mlp.SetInferencePrecision(MachineLearning::InferencePrecision::Float);
+        EXPECT_EQ(mlp.GetInferencePrecision(), MachineLearning::InferencePrecision::Float);
+        EXPECT_EQ(mlp.GetMemoryUsage(), floatMemory);
+        const AZ::VectorN* floatOutput = mlp.Forward(&inferenceData, samples[0]);
+        for (AZStd::size_t element = 0; element < 10; ++element)
+        {
+            EXPECT_EQ(floatOutput->GetElement(element), expected[0].GetElement(element));
+        }
+    }
+
+    TEST_F(MachineLearning_Quantization, TestTrainingQuantizedModel)
+    {
+        std::mt19937 generator(321);
+        MachineLearning::MultilayerPerceptron mlp(24);
+        mlp.AddLayer(16, MachineLearning::ActivationFunctions::ReLU);
+        mlp.AddLayer(4, MachineLearning::ActivationFunctions::Linear);
+        FillRandomWeights(*mlp.GetLayer(0), generator);
+        FillRandomWeights(*mlp.GetLayer(1), generator);
+        const AZStd::size_t floatMemory = mlp.GetMemoryUsage();
+
+        mlp.SetInferencePrecision(MachineLearning::InferencePrecision::Int8);
+        const AZStd::size_t quantizedMemory = mlp.GetMemoryUsage();
+        EXPECT_GT(quantizedMemory, floatMemory);
+
+        // Training releases the quantized layers and the gradient steps only update the float layers, rather than quantizing after every step
+        AZStd::unique_ptr<MachineLearning::ITrainingContext> trainingContext(mlp.CreateTrainingContext());
+        EXPECT_EQ(mlp.GetMemoryUsage(), floatMemory);
+        EXPECT_EQ(mlp.GetInferencePrecision(), MachineLearning::InferencePrecision::Int8);
+
+        std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+        AZ::VectorN activations = AZ::VectorN::CreateZero(24);
+        AZ::VectorN expected = AZ::VectorN::CreateZero(4);
+        for (AZStd::size_t iter = 0; iter < 24; ++iter)
+        {
+            activations.SetElement(iter, distribution(generator));
+        }
+        expected.SetElement(1, 1.0f);
+        for (AZStd::size_t step = 0; step < 3; ++step)
+        {
+            mlp.Reverse(trainingContext.get(), MachineLearning::LossFunctions::MeanSquaredError, activations, expected);
+            mlp.GradientDescent(trainingContext.get(), 0.01f);
+            EXPECT_EQ(mlp.GetMemoryUsage(), floatMemory);
+        }
+
+        // Reapplying the precision quantizes the trained weights once, and leaves the trained float weights untouched
+        const AZ::MatrixMxN trainedWeights = mlp.GetLayer(0)->m_weights;
+        mlp.SetInferencePrecision(MachineLearning::InferencePrecision::Int8);
+        EXPECT_EQ(mlp.GetMemoryUsage(), quantizedMemory);
+        EXPECT_EQ(mlp.GetLayerCount(), 2);
+        mlp.SetInferencePrecision(MachineLearning::InferencePrecision::Float);
+        for (AZStd::size_t row = 0; row < trainedWeights.GetRowCount(); ++row)
+        {
+            for (AZStd::size_t col = 0; col < trainedWeights.GetColumnCount(); ++col)
+            {
+                EXPECT_EQ(mlp.GetLayer(0)->m_weights.GetElement(row, col), trainedWeights.GetElement(row, col));
+            }
+        }
+    }
+
+    TEST_F(MachineLearning_Quantization, TestQuantizedOnlyModelIsNotDequantized)
+    {
+        std::mt19937 generator(77);
+        MachineLearning::Layer layer(MachineLearning::ActivationFunctions::ReLU, 12, 4);
+        FillRandomWeights(layer, generator);
+
+        // Assets saved before the float layers were kept only hold the quantized layers
+        MachineLearning::ModelAsset asset;
+        asset.m_name = "QuantizedOnly";
+        asset.m_activationCount = 12;
+        asset.m_quantizedLayers.emplace_back(layer);
+
+        MachineLearning::MultilayerPerceptron mlp;
+        mlp = asset;
+        EXPECT_EQ(mlp.GetInferencePrecision(), MachineLearning::InferencePrecision::Int8);
+        EXPECT_EQ(mlp.GetLayerCount(), 1);
+        EXPECT_EQ(mlp.GetOutputDimensionality(), 4);
+
+        // Reconstructing float weights would be lossy, so the model refuses and remains usable for int8 inference
+        const AZStd::size_t quantizedMemory = mlp.GetMemoryUsage();
+        mlp.SetInferencePrecision(MachineLearning::InferencePrecision::Float);
+        EXPECT_EQ(mlp.GetInferencePrecision(), MachineLearning::InferencePrecision::Int8);
+        EXPECT_EQ(mlp.GetMemoryUsage(), quantizedMemory);
+        EXPECT_EQ(mlp.GetLayer(0), nullptr);
+
+        MachineLearning::MlpInferenceContext inferenceData;
+        const AZ::VectorN activations = AZ::VectorN::CreateOne(12);
+        EXPECT_EQ(mlp.Forward(&inferenceData, activations)->GetDimensionality(), 4);
+    }
+
+    TEST_F(MachineLearning_Quantization, TestModelAssetVersions)
+    {
+        std::mt19937 generator(99);
+        MachineLearning::Layer layer(MachineLearning::ActivationFunctions::ReLU, 20, 6);
+        FillRandomWeights(layer, generator);
+
+        MachineLearning::ModelAsset asset;
+        asset.m_name = "QuantizedModel";
+        asset.m_activationCount = 20;
+        asset.m_layers.push_back(layer);
+        asset.m_quantizedLayers.emplace_back(layer);
+
+        AZStd::vector<uint8_t> buffer(asset.EstimateSerializeSize());
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(asset.Serialize(inputSerializer));
+
+        MachineLearning::ModelAsset loaded;
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        EXPECT_TRUE(loaded.Serialize(outputSerializer));
+        EXPECT_EQ(loaded.m_version, MachineLearning::ModelAsset::SerializedVersion);
+        EXPECT_EQ(loaded.m_name, asset.m_name);
+        ASSERT_EQ(loaded.m_quantizedLayers.size(), 1);
+        EXPECT_EQ(loaded.m_quantizedLayers[0].m_weights, asset.m_quantizedLayers[0].m_weights);
+        EXPECT_EQ(loaded.m_quantizedLayers[0].m_weightScales, asset.m_quantizedLayers[0].m_weightScales);
+
+        // Version 3 is the flat format, which is never serialized, so a serialized stream claiming it is rejected
+        AZStd::vector<uint8_t> flatVersionBuffer(asset.EstimateSerializeSize());
+        AzNetworking::NetworkInputSerializer flatVersionInputSerializer(flatVersionBuffer.data(), static_cast<uint32_t>(flatVersionBuffer.size()));
+        uint32_t formatTag = MachineLearning::ModelAsset::FormatTag;
+        uint32_t flatVersion = MachineLearning::ModelAsset::CurrentVersion;
+        EXPECT_TRUE(flatVersionInputSerializer.Serialize(formatTag, "formatTag"));
+        EXPECT_TRUE(flatVersionInputSerializer.Serialize(flatVersion, "version"));
+        EXPECT_TRUE(flatVersionInputSerializer.Serialize(asset.m_name, "Name"));
+        EXPECT_TRUE(flatVersionInputSerializer.Serialize(asset.m_activationCount, "activationCount"));
+        EXPECT_TRUE(flatVersionInputSerializer.Serialize(asset.m_layers, "layers"));
+        EXPECT_TRUE(flatVersionInputSerializer.Serialize(asset.m_quantizedLayers, "quantizedLayers"));
+
+        MachineLearning::ModelAsset flatVersionAsset;
+        AzNetworking::NetworkOutputSerializer flatVersionOutputSerializer(flatVersionBuffer.data(), flatVersionInputSerializer.GetSize());
+        EXPECT_FALSE(flatVersionAsset.Serialize(flatVersionOutputSerializer));
+
+        // Assets are never written in the legacy format, attempting to must leave the asset untouched
+        AZStd::vector<uint8_t> legacyBuffer(asset.EstimateSerializeSize());
+        AzNetworking::NetworkInputSerializer rejectedSerializer(legacyBuffer.data(), static_cast<uint32_t>(legacyBuffer.size()));
+        EXPECT_FALSE(asset.SerializeLegacy(rejectedSerializer));
+        EXPECT_EQ(asset.m_version, MachineLearning::ModelAsset::CurrentVersion);
+        EXPECT_EQ(asset.m_quantizedLayers.size(), 1);
+
+        // Legacy assets lack the format tag and must be rejected by the versioned reader, then load through the legacy path
+        AzNetworking::NetworkInputSerializer legacyInputSerializer(legacyBuffer.data(), static_cast<uint32_t>(legacyBuffer.size()));
+        AZStd::string legacyName = asset.m_name;
+        AZStd::size_t legacyActivationCount = asset.m_activationCount;
+        AZStd::vector<MachineLearning::Layer> legacyLayers = asset.m_layers;
+        EXPECT_TRUE(legacyInputSerializer.Serialize(legacyName, "Name"));
+        EXPECT_TRUE(legacyInputSerializer.Serialize(legacyActivationCount, "activationCount"));
+        EXPECT_TRUE(legacyInputSerializer.Serialize(legacyLayers, "layers"));
+
+        MachineLearning::ModelAsset legacy;
+        AzNetworking::NetworkOutputSerializer versionedSerializer(legacyBuffer.data(), legacyInputSerializer.GetSize());
+        EXPECT_FALSE(legacy.Serialize(versionedSerializer));
+        AzNetworking::NetworkOutputSerializer legacySerializer(legacyBuffer.data(), legacyInputSerializer.GetSize());
+        EXPECT_TRUE(legacy.SerializeLegacy(legacySerializer));
+        EXPECT_EQ(legacy.m_version, 1);
+        EXPECT_EQ(legacy.m_name, asset.m_name);
+        EXPECT_TRUE(legacy.m_quantizedLayers.empty());
+    }
+}
@@ -8,6 +8,7 @@
 
 set(FILES
     Include/MachineLearning/IInferenceContext.h
+    Include/MachineLearning/IInferenceSystem.h
     Include/MachineLearning/INeuralNetwork.h
     Include/MachineLearning/ILabeledTrainingData.h
     Include/MachineLearning/IMachineLearning.h
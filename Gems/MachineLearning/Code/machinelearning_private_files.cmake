@@ -11,12 +11,28 @@ set(FILES
     Source/MachineLearningModuleInterface.h
     Source/MachineLearningSystemComponent.cpp
     Source/MachineLearningSystemComponent.h
+    Source/InferenceSystemComponent.cpp
+    Source/InferenceSystemComponent.h
     Source/Algorithms/Activations.cpp
     Source/Algorithms/Activations.h
+    Source/Algorithms/BatchInference.cpp
+    Source/Algorithms/BatchInference.h
+    Source/Algorithms/BatchOperations.cpp
+    Source/Algorithms/BatchOperations.h
     Source/Algorithms/LossFunctions.cpp
     Source/Algorithms/LossFunctions.h
+    Source/Algorithms/Optimizers.cpp
+    Source/Algorithms/Optimizers.h
+    Source/Algorithms/QuantizedOperations.cpp
+    Source/Algorithms/QuantizedOperations.h
     Source/Algorithms/Training.cpp
     Source/Algorithms/Training.h
+    Source/Assets/FlatModelFormat.cpp
+    Source/Assets/FlatModelFormat.h
+    Source/Assets/MappedFile.cpp
+    Source/Assets/MappedFile.h
+    Source/Assets/MappedModel.cpp
+    Source/Assets/MappedModel.h
     Source/Assets/MnistDataLoader.cpp
     Source/Assets/MnistDataLoader.h
     Source/Assets/ModelAsset.cpp
@@ -25,10 +41,18 @@ set(FILES
     Source/Assets/TrainingDataView.h
     Source/Components/MultilayerPerceptronComponent.cpp
     Source/Components/MultilayerPerceptronComponent.h
+    Source/Models/ConvolutionLayer.cpp
+    Source/Models/ConvolutionLayer.h
+    Source/Models/ILayer.cpp
+    Source/Models/ILayer.h
     Source/Models/Layer.cpp
     Source/Models/Layer.h
+    Source/Models/MaxPoolLayer.cpp
+    Source/Models/MaxPoolLayer.h
     Source/Models/MultilayerPerceptron.cpp
     Source/Models/MultilayerPerceptron.h
+    Source/Models/QuantizedLayer.cpp
+    Source/Models/QuantizedLayer.h
     Source/Nodes/ArgMax.ScriptCanvasNodeable.xml
     Source/Nodes/ArgMax.cpp
     Source/Nodes/ArgMax.h
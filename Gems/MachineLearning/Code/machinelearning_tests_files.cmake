@@ -7,9 +7,16 @@
 #
 
 set(FILES
+    Tests/Assets/FlatModelFormatTests.cpp
+    Tests/Assets/MnistDataLoaderTests.cpp
     Tests/Algorithms/ActivationTests.cpp
+    Tests/Algorithms/BatchInferenceTests.cpp
     Tests/Algorithms/LossFunctionTests.cpp
+    Tests/Algorithms/OptimizerTests.cpp
+    Tests/Algorithms/TrainingTests.cpp
+    Tests/Models/ConvolutionLayerTests.cpp
     Tests/Models/LayerTests.cpp
     Tests/Models/MultilayerPerceptronTests.cpp
+    Tests/Models/QuantizedLayerTests.cpp
     Tests/MachineLearningTests.cpp
 )
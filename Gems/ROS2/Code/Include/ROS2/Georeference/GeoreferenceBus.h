@@ -12,6 +12,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/std/containers/span.h>
 
 namespace ROS2
 {
@@ -34,6 +35,17 @@ namespace ROS2
         //! Function is useful to fin georeference rotation of the level.
         //! @return Quaternion in ENU coordinate system.
         virtual AZ::Quaternion GetRotationFromLevelToENU() = 0;
+
+        //! Function converts many points from Level's coordinate system to WSG84 at once.
+        //! It is preferred over ConvertFromLevelToWSG84 for whole trajectories or sets of entities, since it costs a single bus call.
+        //! @param xyz points in Level's coordinate system.
+        //! @param latLon output span of the same size as xyz, filled with points in WSG84 coordinate system.
+        virtual void ConvertPointsFromLevelToWSG84(AZStd::span<const AZ::Vector3> xyz, AZStd::span<WGS::WGS84Coordinate> latLon) = 0;
+
+        //! Function converts many points from WSG84 coordinate system to Level's at once.
+        //! @param latLon points in WSG84 coordinate system.
+        //! @param xyz output span of the same size as latLon, filled with points in Level's coordinate system.
+        virtual void ConvertPointsFromWSG84ToLevel(AZStd::span<const WGS::WGS84Coordinate> latLon, AZStd::span<AZ::Vector3> xyz) = 0;
     };
 
     class GeoreferenceRequestsTraits : public AZ::EBusTraits
@@ -32,5 +32,10 @@ namespace ROS2
         static void Reflect(AZ::ReflectContext* context);
 
         Steering m_steering = Steering::Twist;
+        //! When enabled, only the latest control message is kept and sent to the control bus once per physics step.
+        //! Bursts of messages are coalesced instead of each triggering a bus dispatch.
+        bool m_useLatestValueMailbox = false;
+        //! Time in seconds after the last received message when a zero command is sent (deadman). 0 disables the timeout.
+        float m_commandTimeout = 0.0f;
     };
 } // namespace ROS2
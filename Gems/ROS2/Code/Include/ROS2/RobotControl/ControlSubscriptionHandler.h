@@ -7,9 +7,15 @@
  */
 #pragma once
 
+#include <AzCore/std/parallel/atomic.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
 #include <ROS2/Communication/TopicConfiguration.h>
 #include <ROS2/Frame/ROS2FrameComponent.h>
 #include <ROS2/ROS2Bus.h>
+#include <ROS2/RobotControl/ControlConfiguration.h>
+#include <ROS2/RobotControl/LatestValueMailbox.h>
+#include <ROS2/RobotControl/RobotControlBus.h>
 #include <ROS2/Utilities/ROS2Names.h>
 #include <rclcpp/rclcpp.hpp>
 
@@ -23,22 +29,43 @@ namespace ROS2
         //! Only activated IComponentActivationHandler will receive and process control messages.
         //! @param entity Activation context for the owning Component - the entity it belongs to.
         //! @param subscriberConfiguration configuration with topic and qos
-        virtual void Activate(const AZ::Entity* entity, const TopicConfiguration& subscriberConfiguration) = 0;
+        //! @param controlConfiguration configuration of command delivery (mailbox mode and command timeout)
+        virtual void Activate(
+            const AZ::Entity* entity, const TopicConfiguration& subscriberConfiguration, const ControlConfiguration& controlConfiguration) = 0;
         //! Interface handling component deactivation
         virtual void Deactivate() = 0;
+        //! Get counters of received, delivered and coalesced messages since the handler was last activated.
+        virtual ControlSubscriptionStatistics GetStatistics() const = 0;
         virtual ~IControlSubscriptionHandler() = default;
     };
 
     //! The generic class for handling subscriptions to ROS2 control messages of different types.
+    //! Messages are either sent to the control bus as they come, or written to a latest-value mailbox which is consumed once per
+    //! physics step. Optionally, a zero command (default-constructed message) is sent when no message arrives within a timeout.
     //! @see ControlConfiguration::Steering.
     template<typename T>
     class ControlSubscriptionHandler : public IControlSubscriptionHandler
     {
     public:
-        void Activate(const AZ::Entity* entity, const TopicConfiguration& subscriberConfiguration) override final
+        void Activate(
+            const AZ::Entity* entity,
+            const TopicConfiguration& subscriberConfiguration,
+            const ControlConfiguration& controlConfiguration) override final
         {
             m_active = true;
             m_entityId = entity->GetId();
+            m_useMailbox = controlConfiguration.m_useLatestValueMailbox;
+            m_commandTimeout = controlConfiguration.m_commandTimeout;
+            m_timeSinceLastMessage = 0.0f;
+            m_timedOut = false;
+            m_received.store(0, AZStd::memory_order_relaxed);
+            m_delivered.store(0, AZStd::memory_order_relaxed);
+            m_coalesced.store(0, AZStd::memory_order_relaxed);
+            m_timeouts.store(0, AZStd::memory_order_relaxed);
+            if (m_useMailbox || m_commandTimeout > 0.0f)
+            {
+                ConnectToPhysicsStep();
+            }
             if (!m_controlSubscription)
             {
                 auto ros2Frame = entity->FindComponent<ROS2FrameComponent>();
@@ -58,9 +85,20 @@ namespace ROS2
         void Deactivate() override final
         {
             m_active = false;
+            m_onSceneSimulationStartHandler.Disconnect();
             m_controlSubscription.reset(); // Note: topic and qos can change, need to re-subscribe
         };
 
+        ControlSubscriptionStatistics GetStatistics() const override final
+        {
+            ControlSubscriptionStatistics statistics;
+            statistics.m_received = m_received.load(AZStd::memory_order_relaxed);
+            statistics.m_delivered = m_delivered.load(AZStd::memory_order_relaxed);
+            statistics.m_coalesced = m_coalesced.load(AZStd::memory_order_relaxed);
+            statistics.m_timeouts = m_timeouts.load(AZStd::memory_order_relaxed);
+            return statistics;
+        }
+
         virtual ~ControlSubscriptionHandler() = default;
 
     protected:
@@ -77,13 +115,106 @@ namespace ROS2
                 return;
             }
 
-            SendToBus(message);
+            m_received.fetch_add(1, AZStd::memory_order_relaxed);
+            m_messageReceived.store(true, AZStd::memory_order_release);
+            if (m_useMailbox)
+            {
+                if (m_mailbox.Write(message))
+                {
+                    m_coalesced.fetch_add(1, AZStd::memory_order_relaxed);
+                }
+                return;
+            }
+
+            Deliver(message);
         };
 
+        void ConnectToPhysicsStep()
+        {
+            m_onSceneSimulationStartHandler.Disconnect();
+            m_onSceneSimulationStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(
+                [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float deltaTime)
+                {
+                    OnPhysicsStep(deltaTime);
+                });
+
+            auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+            if (sceneInterface == nullptr)
+            {
+                AZ_Warning(
+                    "ControlSubscriptionHandler",
+                    false,
+                    "Physics scene interface is not available, latest-value mailbox and command timeout are disabled for entity %s",
+                    m_entityId.ToString().c_str());
+                m_useMailbox = false;
+                m_commandTimeout = 0.0f;
+                return;
+            }
+            AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+            sceneInterface->RegisterSceneSimulationStartHandler(sceneHandle, m_onSceneSimulationStartHandler);
+        }
+
+        void OnPhysicsStep(float deltaTime)
+        {
+            if (!m_active)
+            {
+                return;
+            }
+
+            if (m_useMailbox)
+            {
+                if (m_mailbox.Read(m_latestMessage))
+                {
+                    Deliver(m_latestMessage);
+                }
+            }
+
+            if (m_commandTimeout <= 0.0f)
+            {
+                return;
+            }
+
+            if (m_messageReceived.exchange(false, AZStd::memory_order_acquire))
+            {
+                m_timeSinceLastMessage = 0.0f;
+                m_timedOut = false;
+                return;
+            }
+
+            m_timeSinceLastMessage += deltaTime;
+            if (!m_timedOut && m_timeSinceLastMessage > m_commandTimeout)
+            {
+                m_timedOut = true;
+                m_timeouts.fetch_add(1, AZStd::memory_order_relaxed);
+                Deliver(T{});
+            }
+        }
+
+        void Deliver(const T& message)
+        {
+            m_delivered.fetch_add(1, AZStd::memory_order_relaxed);
+            SendToBus(message);
+        }
+
         virtual void SendToBus(const T& message) = 0;
 
         AZ::EntityId m_entityId;
         bool m_active = false;
         typename rclcpp::Subscription<T>::SharedPtr m_controlSubscription;
+
+        bool m_useMailbox = false;
+        LatestValueMailbox<T> m_mailbox;
+        T m_latestMessage; //!< Storage for the message taken from the mailbox, reused to avoid per-step allocations.
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_onSceneSimulationStartHandler;
+
+        float m_commandTimeout = 0.0f;
+        float m_timeSinceLastMessage = 0.0f;
+        bool m_timedOut = false;
+        AZStd::atomic_bool m_messageReceived{ false };
+
+        AZStd::atomic<AZ::u64> m_received{ 0 };
+        AZStd::atomic<AZ::u64> m_coalesced{ 0 };
+        AZStd::atomic<AZ::u64> m_delivered{ 0 };
+        AZStd::atomic<AZ::u64> m_timeouts{ 0 };
     };
 } // namespace ROS2
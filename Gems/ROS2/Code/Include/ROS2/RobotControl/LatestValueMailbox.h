@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace ROS2
+{
+    //! Single-slot, lock-free mailbox holding only the most recent value.
+    //! Implemented as a triple buffer: the writer and the reader each own one buffer and exchange it with the shared middle buffer,
+    //! so neither side ever waits for the other. Safe for a single writer thread and a single reader thread.
+    template<typename T>
+    class LatestValueMailbox
+    {
+    public:
+        //! Store a new value, replacing any value that was not read yet.
+        //! @return true if an unread value was overwritten (the previous value was coalesced).
+        bool Write(const T& value)
+        {
+            m_buffers[m_writeIndex] = value;
+            const AZ::u8 previousMiddle = m_middle.exchange(static_cast<AZ::u8>(m_writeIndex | FreshFlag), AZStd::memory_order_acq_rel);
+            m_writeIndex = previousMiddle & IndexMask;
+            return (previousMiddle & FreshFlag) != 0;
+        }
+
+        //! Take the most recent value, if a new one was written since the last read.
+        //! @param value filled with the most recent value when available.
+        //! @return true if a new value was available.
+        bool Read(T& value)
+        {
+            if ((m_middle.load(AZStd::memory_order_relaxed) & FreshFlag) == 0)
+            {
+                return false;
+            }
+            const AZ::u8 previousMiddle = m_middle.exchange(m_readIndex, AZStd::memory_order_acq_rel);
+            m_readIndex = previousMiddle & IndexMask;
+            value = m_buffers[m_readIndex];
+            return true;
+        }
+
+    private:
+        static constexpr AZ::u8 IndexMask = 0x3;
+        static constexpr AZ::u8 FreshFlag = 0x4;
+
+        T m_buffers[3];
+        AZStd::atomic<AZ::u8> m_middle{ 1 };
+        AZ::u8 m_writeIndex = 0; //!< Owned by the writer.
+        AZ::u8 m_readIndex = 2; //!< Owned by the reader.
+    };
+} // namespace ROS2
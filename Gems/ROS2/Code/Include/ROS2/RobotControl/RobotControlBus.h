@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/base.h>
+
+namespace ROS2
+{
+    //! Counters of control messages handled by a robot control subscription.
+    //! The counters start from zero each time the subscription is activated.
+    struct ControlSubscriptionStatistics
+    {
+        AZ::u64 m_received = 0; //!< Messages received from the subscription.
+        AZ::u64 m_delivered = 0; //!< Commands sent to the control bus (including zero commands sent on timeout).
+        AZ::u64 m_coalesced = 0; //!< Messages overwritten in the mailbox by a newer one before they were delivered.
+        AZ::u64 m_timeouts = 0; //!< Times the command timeout elapsed and a zero command was sent.
+    };
+
+    //! Interface for querying the robot control component of an entity.
+    class RobotControlRequests : public AZ::EBusTraits
+    {
+    public:
+        using BusIdType = AZ::EntityId;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+
+        //! Get counters of received, delivered and coalesced control messages of the active subscription.
+        //! @return Counters since the component was last activated, all zero if it has no subscription.
+        virtual ControlSubscriptionStatistics GetSubscriptionStatistics() const = 0;
+    };
+
+    using RobotControlRequestBus = AZ::EBus<RobotControlRequests>;
+} // namespace ROS2
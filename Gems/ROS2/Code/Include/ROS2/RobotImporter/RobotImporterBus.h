@@ -26,6 +26,13 @@ namespace ROS2
         //! @param useArticulation If true, the prefab will be generated with articulation
         virtual bool GeneratePrefabFromFile(const AZStd::string_view filePath, bool importAssetWithUrdf, bool useArticulation) = 0;
 
+        //! Generate prefabs from all robot description files listed in a manifest, without any user interaction.
+        //! Robots are parsed and their assets are copied and built concurrently, prefabs are created afterwards.
+        //! @param manifestPath The path of a JSON manifest listing URDF/SDF/xacro files together with their import options
+        //! @param reportPath The path where a JSON report with the result of every robot is written, nothing is written if empty
+        //! @return true if the prefabs of all robots were created
+        virtual bool GeneratePrefabsFromManifest(const AZStd::string_view manifestPath, const AZStd::string_view reportPath) = 0;
+
         //! Return the reference to the list of sensor importer hooks
         virtual const SDFormat::SensorImporterHooksStorage& GetSensorHooks() const = 0;
     };
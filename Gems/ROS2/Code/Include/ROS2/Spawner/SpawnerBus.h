@@ -34,4 +34,27 @@ namespace ROS2
     };
 
     using SpawnerRequestsBus = AZ::EBus<SpawnerRequests>;
+
+    //! Interface allowing to spawn and despawn many spawnables at once, handled by the game spawner component.
+    class SpawnerBatchRequests : public AZ::ComponentBus
+    {
+    public:
+        AZ_RTTI(SpawnerBatchRequests, "{6B1D7B0E-2C55-4B8E-9E7A-0D4C8E1B5A21}");
+
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+
+        virtual ~SpawnerBatchRequests() = default;
+
+        //! Spawn all given entries. Spawn tickets released by previously deleted instances are reused.
+        //! @param entries list of spawnables to spawn with their names, poses and namespaces.
+        //! @param completionCallback called once, after all the entries are spawned (or rejected).
+        virtual void SpawnEntities(const AZStd::vector<SpawnEntityInfo>& entries, SpawnBatchCompletionCallback completionCallback) = 0;
+
+        //! Despawn all given instances.
+        //! @param ticketNames names of instances, as returned in SpawnEntityResult::ticketName.
+        //! @param completionCallback called once, after all the instances are despawned (or rejected).
+        virtual void DespawnEntities(const AZStd::vector<AZStd::string>& ticketNames, SpawnBatchCompletionCallback completionCallback) = 0;
+    };
+
+    using SpawnerBatchRequestsBus = AZ::EBus<SpawnerBatchRequests>;
 } // namespace ROS2
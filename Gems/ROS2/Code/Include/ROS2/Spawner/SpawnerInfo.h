@@ -12,6 +12,8 @@
 #include <AzCore/Memory/Memory_fwd.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
 #include <AzCore/std/string/string.h>
 
 namespace ROS2
@@ -19,8 +21,29 @@ namespace ROS2
     struct SpawnPointInfo
     {
         AZStd::string info;
-        AZ::Transform pose;
+        AZ::Transform pose = AZ::Transform::CreateIdentity();
     };
 
     using SpawnPointInfoMap = AZStd::unordered_map<AZStd::string, SpawnPointInfo>;
+
+    //! A single entry of a batch spawn request.
+    struct SpawnEntityInfo
+    {
+        AZStd::string spawnableName; //!< Name of the spawnable as registered in the spawner.
+        AZStd::string instanceName; //!< Name of the spawned instance. A unique name is generated when left empty.
+        AZ::Transform pose = AZ::Transform::CreateIdentity(); //!< World pose of the root entity of the spawned instance.
+        AZStd::string robotNamespace; //!< Custom ROS 2 namespace. The namespace is not changed when left empty.
+    };
+
+    //! Outcome of a single entry of a batch spawn or despawn request.
+    struct SpawnEntityResult
+    {
+        bool success = false;
+        AZStd::string ticketName; //!< Name which identifies the spawned instance (can be used to delete it).
+        AZStd::string statusMessage;
+    };
+
+    using SpawnEntityResults = AZStd::vector<SpawnEntityResult>;
+    //! Called once, after all entries of a batch are processed. Results are in the order of the requested entries.
+    using SpawnBatchCompletionCallback = AZStd::function<void(const SpawnEntityResults&)>;
 } // namespace ROS2
@@ -7,6 +7,7 @@
  */
 
 #include "Georeference/GNSSFormatConversions.h"
+#include <AzCore/std/algorithm.h>
 
 constexpr double earthSemimajorAxis = 6378137.0;
 constexpr double reciprocalFlattening = 1.0 / 298.257223563;
@@ -28,86 +29,273 @@ namespace ROS2::Utils::GeodeticConversions
         return radians * 180.0 / M_PI;
     }
 
-    WGS::Vector3d WGS84ToECEF(const WGS::WGS84Coordinate& latitudeLongitudeAltitude)
+    // Closed form conversions of a single point, shared by the scalar conversions and the blocked batch loops
+    inline void GeodeticToECEF(
+        double sinLatitude, double cosLatitude, double sinLongitude, double cosLongitude, double altitude, double& x, double& y, double& z)
     {
-        const double latitudeRad = DegToRad(latitudeLongitudeAltitude.m_latitude);
-        const double longitudeRad = DegToRad(latitudeLongitudeAltitude.m_longitude);
-        const double altitude = latitudeLongitudeAltitude.m_altitude;
+        const double primeVerticalRadius = earthSemimajorAxis / std::sqrt(1.0 - firstEccentricitySquared * sinLatitude * sinLatitude);
+        x = (primeVerticalRadius + altitude) * cosLatitude * cosLongitude;
+        y = (primeVerticalRadius + altitude) * cosLatitude * sinLongitude;
+        z = (primeVerticalRadius * (1.0 - firstEccentricitySquared) + altitude) * sinLatitude;
+    }
+
+    inline void ECEFToLatitudeAltitude(double x, double y, double z, double& latitude, double& altitude)
+    {
+        constexpr double E2 = earthSemimajorAxis * earthSemimajorAxis - earthSemiminorAxis * earthSemiminorAxis;
+        const double radiusSquared = x * x + y * y;
+        const double radius = std::sqrt(radiusSquared);
+        const double zSquared = z * z;
 
-        const double helper = std::sqrt(1.0f - firstEccentricitySquared * std::sin(latitudeRad) * std::sin(latitudeRad));
+        const double F = 54.0 * earthSemiminorAxis * earthSemiminorAxis * zSquared;
+        const double G = radiusSquared + (1.0 - firstEccentricitySquared) * zSquared - firstEccentricitySquared * E2;
+        const double c = (firstEccentricitySquared * firstEccentricitySquared * F * radiusSquared) / (G * G * G);
+        const double s = std::cbrt(1.0 + c + std::sqrt(c * c + 2.0 * c));
+        const double sTerm = s + 1.0 / s + 1.0;
+        const double P = F / (3.0 * sTerm * sTerm * G * G);
+        const double Q = std::sqrt(1.0 + 2.0 * firstEccentricitySquared * firstEccentricitySquared * P);
 
-        const double X = (earthSemimajorAxis / helper + altitude) * std::cos(latitudeRad) * std::cos(longitudeRad);
-        const double Y = (earthSemimajorAxis / helper + altitude) * std::cos(latitudeRad) * std::sin(longitudeRad);
-        const double Z = (earthSemimajorAxis * (1.0 - firstEccentricitySquared) / helper + altitude) * std::sin(latitudeRad);
+        const double ro = -(firstEccentricitySquared * P * radius) / (1.0 + Q) +
+            std::sqrt(
+                (earthSemimajorAxis * earthSemimajorAxis / 2.0) * (1.0 + 1.0 / Q) -
+                ((1.0 - firstEccentricitySquared) * P * zSquared) / (Q * (1.0 + Q)) - P * radiusSquared / 2.0);
+        const double tmp = (radius - firstEccentricitySquared * ro) * (radius - firstEccentricitySquared * ro);
+        const double U = std::sqrt(tmp + zSquared);
+        const double V = std::sqrt(tmp + (1.0 - firstEccentricitySquared) * zSquared);
+        const double zo = (earthSemiminorAxis * earthSemiminorAxis * z) / (earthSemimajorAxis * V);
 
-        return { X, Y, Z };
+        latitude = std::atan((z + secondEccentrictySquared * zo) / radius);
+        altitude = U * (1.0 - earthSemiminorAxis * earthSemiminorAxis / (earthSemimajorAxis * V));
     }
 
-    WGS::Vector3d ECEFToENU(const WGS::WGS84Coordinate& referenceLatitudeLongitudeAltitude, const WGS::Vector3d& ECEFPoint)
+    WGS::Vector3d WGS84ToECEF(const WGS::WGS84Coordinate& latitudeLongitudeAltitude)
     {
-        const WGS::Vector3d referencePointInECEF = WGS84ToECEF(referenceLatitudeLongitudeAltitude);
-        const WGS::Vector3d pointToReferencePointECEF = ECEFPoint - referencePointInECEF;
+        const double latitudeRad = DegToRad(latitudeLongitudeAltitude.m_latitude);
+        const double longitudeRad = DegToRad(latitudeLongitudeAltitude.m_longitude);
+
+        WGS::Vector3d result;
+        GeodeticToECEF(
+            std::sin(latitudeRad),
+            std::cos(latitudeRad),
+            std::sin(longitudeRad),
+            std::cos(longitudeRad),
+            latitudeLongitudeAltitude.m_altitude,
+            result.m_x,
+            result.m_y,
+            result.m_z);
+        return result;
+    }
 
+    ENUReferenceFrame ComputeENUReferenceFrame(const WGS::WGS84Coordinate& referenceLatitudeLongitudeAltitude)
+    {
         const double referenceLatitudeRad = DegToRad(referenceLatitudeLongitudeAltitude.m_latitude);
         const double referenceLongitudeRad = DegToRad(referenceLatitudeLongitudeAltitude.m_longitude);
+        const double sinLatitude = std::sin(referenceLatitudeRad);
+        const double cosLatitude = std::cos(referenceLatitudeRad);
+        const double sinLongitude = std::sin(referenceLongitudeRad);
+        const double cosLongitude = std::cos(referenceLongitudeRad);
 
-        return { -sin(referenceLongitudeRad) * pointToReferencePointECEF.m_x + cos(referenceLongitudeRad) * pointToReferencePointECEF.m_y,
-                 -sin(referenceLatitudeRad) * cos(referenceLongitudeRad) * pointToReferencePointECEF.m_x -
-                     sin(referenceLatitudeRad) * sin(referenceLongitudeRad) * pointToReferencePointECEF.m_y +
-                     cos(referenceLatitudeRad) * pointToReferencePointECEF.m_z,
-                 cos(referenceLatitudeRad) * cos(referenceLongitudeRad) * pointToReferencePointECEF.m_x +
-                     cos(referenceLatitudeRad) * sin(referenceLongitudeRad) * pointToReferencePointECEF.m_y +
-                     sin(referenceLatitudeRad) * pointToReferencePointECEF.m_z };
+        ENUReferenceFrame frame;
+        frame.m_originECEF = WGS84ToECEF(referenceLatitudeLongitudeAltitude);
+        // East
+        frame.m_rotation[0][0] = -sinLongitude;
+        frame.m_rotation[0][1] = cosLongitude;
+        frame.m_rotation[0][2] = 0.0;
+        // North
+        frame.m_rotation[1][0] = -sinLatitude * cosLongitude;
+        frame.m_rotation[1][1] = -sinLatitude * sinLongitude;
+        frame.m_rotation[1][2] = cosLatitude;
+        // Up
+        frame.m_rotation[2][0] = cosLatitude * cosLongitude;
+        frame.m_rotation[2][1] = cosLatitude * sinLongitude;
+        frame.m_rotation[2][2] = sinLatitude;
+        return frame;
     }
 
-    WGS::Vector3d ENUToECEF(const WGS::WGS84Coordinate& referenceLatitudeLongitudeAltitude, const WGS::Vector3d& ENUPoint)
+    WGS::Vector3d ECEFToENU(const ENUReferenceFrame& referenceFrame, const WGS::Vector3d& ECEFPoint)
     {
-        const auto referenceECEF = WGS84ToECEF(referenceLatitudeLongitudeAltitude);
+        const auto& r = referenceFrame.m_rotation;
+        const double dx = ECEFPoint.m_x - referenceFrame.m_originECEF.m_x;
+        const double dy = ECEFPoint.m_y - referenceFrame.m_originECEF.m_y;
+        const double dz = ECEFPoint.m_z - referenceFrame.m_originECEF.m_z;
 
-        const double referenceLatitudeRad = DegToRad(referenceLatitudeLongitudeAltitude.m_latitude);
-        const double referenceLongitudeRad = DegToRad(referenceLatitudeLongitudeAltitude.m_longitude);
+        return { r[0][0] * dx + r[0][1] * dy + r[0][2] * dz,
+                 r[1][0] * dx + r[1][1] * dy + r[1][2] * dz,
+                 r[2][0] * dx + r[2][1] * dy + r[2][2] * dz };
+    }
+
+    WGS::Vector3d ENUToECEF(const ENUReferenceFrame& referenceFrame, const WGS::Vector3d& ENUPoint)
+    {
+        const auto& r = referenceFrame.m_rotation;
         const double& e = ENUPoint.m_x;
         const double& n = ENUPoint.m_y;
         const double& u = ENUPoint.m_z;
 
-        return { -std::sin(referenceLongitudeRad) * e - std::cos(referenceLongitudeRad) * std::sin(referenceLatitudeRad) * n +
-                     std::cos(referenceLongitudeRad) * std::cos(referenceLatitudeRad) * u + referenceECEF.m_x,
-                 std::cos(referenceLongitudeRad) * e - std::sin(referenceLongitudeRad) * std::sin(referenceLatitudeRad) * n +
-                     std::cos(referenceLatitudeRad) * std::sin(referenceLongitudeRad) * u + referenceECEF.m_y,
-                 std::cos(referenceLatitudeRad) * n + std::sin(referenceLatitudeRad) * u + referenceECEF.m_z };
+        return { r[0][0] * e + r[1][0] * n + r[2][0] * u + referenceFrame.m_originECEF.m_x,
+                 r[0][1] * e + r[1][1] * n + r[2][1] * u + referenceFrame.m_originECEF.m_y,
+                 r[0][2] * e + r[1][2] * n + r[2][2] * u + referenceFrame.m_originECEF.m_z };
+    }
+
+    WGS::Vector3d ECEFToENU(const WGS::WGS84Coordinate& referenceLatitudeLongitudeAltitude, const WGS::Vector3d& ECEFPoint)
+    {
+        return ECEFToENU(ComputeENUReferenceFrame(referenceLatitudeLongitudeAltitude), ECEFPoint);
+    }
+
+    WGS::Vector3d ENUToECEF(const WGS::WGS84Coordinate& referenceLatitudeLongitudeAltitude, const WGS::Vector3d& ENUPoint)
+    {
+        return ENUToECEF(ComputeENUReferenceFrame(referenceLatitudeLongitudeAltitude), ENUPoint);
     }
 
     WGS::WGS84Coordinate ECEFToWGS84(const WGS::Vector3d& ECFEPoint)
     {
-        const double& x = ECFEPoint.m_x;
-        const double& y = ECFEPoint.m_y;
-        const double& z = ECFEPoint.m_z;
+        double latitude = 0.0;
+        double altitude = 0.0;
+        ECEFToLatitudeAltitude(ECFEPoint.m_x, ECFEPoint.m_y, ECFEPoint.m_z, latitude, altitude);
+        const double longitude = std::atan2(ECFEPoint.m_y, ECFEPoint.m_x);
+        return { RadToDeg(latitude), RadToDeg(longitude), altitude };
+    }
 
-        const double radiusSquared = x * x + y * y;
-        const double radius = std::sqrt(radiusSquared);
+    // The batch conversions process points in blocks stored as structures of arrays. Loops over a whole block have a fixed
+    // trip count and no dependencies between points, so the compiler vectorizes them. Double precision is kept, as single
+    // precision SIMD cannot represent ECEF coordinates (millions of meters) with millimeter resolution.
+    constexpr size_t BatchBlockSize = 8;
 
-        const double E2 = earthSemimajorAxis * earthSemimajorAxis - earthSemiminorAxis * earthSemiminorAxis;
-        const double F = 54.0 * earthSemiminorAxis * earthSemiminorAxis * z * z;
-        const double G = radiusSquared + (1.0 - firstEccentricitySquared) * z * z - firstEccentricitySquared * E2;
-        const double c = (firstEccentricitySquared * firstEccentricitySquared * F * radiusSquared) / (G * G * G);
-        const double s = std::pow(1. + c + std::sqrt(c * c + 2. * c), 1. / 3);
-        const double P = F / (3.0 * (s + 1.0 / s + 1.0) * (s + 1.0 / s + 1.0) * G * G);
-        const double Q = std::sqrt(1.0 + 2.0 * firstEccentricitySquared * firstEccentricitySquared * P);
+    void WGS84ToECEF(AZStd::span<const WGS::WGS84Coordinate> latitudeLongitudeAltitude, AZStd::span<WGS::Vector3d> ECEFPoints)
+    {
+        AZ_Assert(latitudeLongitudeAltitude.size() == ECEFPoints.size(), "Input and output sizes differ");
+        for (size_t begin = 0; begin < latitudeLongitudeAltitude.size(); begin += BatchBlockSize)
+        {
+            const size_t count = AZStd::min(BatchBlockSize, latitudeLongitudeAltitude.size() - begin);
+            double sinLatitude[BatchBlockSize] = {};
+            double cosLatitude[BatchBlockSize] = {};
+            double sinLongitude[BatchBlockSize] = {};
+            double cosLongitude[BatchBlockSize] = {};
+            double altitude[BatchBlockSize] = {};
+            for (size_t i = 0; i < count; ++i)
+            {
+                const auto& point = latitudeLongitudeAltitude[begin + i];
+                const double latitudeRad = DegToRad(point.m_latitude);
+                const double longitudeRad = DegToRad(point.m_longitude);
+                sinLatitude[i] = std::sin(latitudeRad);
+                cosLatitude[i] = std::cos(latitudeRad);
+                sinLongitude[i] = std::sin(longitudeRad);
+                cosLongitude[i] = std::cos(longitudeRad);
+                altitude[i] = point.m_altitude;
+            }
 
-        const double ro = -(firstEccentricitySquared * P * radius) / (1.0 + Q) +
-            std::sqrt(
-                (earthSemimajorAxis * earthSemimajorAxis / 2.0) * (1.0 + 1.0 / Q) -
-                ((1.0 - firstEccentricitySquared) * P * z * z) / (Q * (1.0 + Q)) - P * radiusSquared / 2.0);
-        const double tmp = (radius - firstEccentricitySquared * ro) * (radius - firstEccentricitySquared * ro);
-        const double U = std::sqrt(tmp + z * z);
-        const double V = std::sqrt(tmp + (1.0 - firstEccentricitySquared) * z * z);
-        const double zo = (earthSemiminorAxis * earthSemiminorAxis * z) / (earthSemimajorAxis * V);
+            double x[BatchBlockSize];
+            double y[BatchBlockSize];
+            double z[BatchBlockSize];
+            for (size_t i = 0; i < BatchBlockSize; ++i)
+            {
+                GeodeticToECEF(sinLatitude[i], cosLatitude[i], sinLongitude[i], cosLongitude[i], altitude[i], x[i], y[i], z[i]);
+            }
 
-        const double latitude = std::atan((z + secondEccentrictySquared * zo) / radius);
-        const double longitude = std::atan2(y, x);
-        const double altitude = U * (1.0 - earthSemiminorAxis * earthSemiminorAxis / (earthSemimajorAxis * V));
+            for (size_t i = 0; i < count; ++i)
+            {
+                ECEFPoints[begin + i] = { x[i], y[i], z[i] };
+            }
+        }
+    }
 
-        return { RadToDeg(latitude), RadToDeg(longitude), altitude };
+    void ECEFToWGS84(AZStd::span<const WGS::Vector3d> ECEFPoints, AZStd::span<WGS::WGS84Coordinate> latitudeLongitudeAltitude)
+    {
+        AZ_Assert(latitudeLongitudeAltitude.size() == ECEFPoints.size(), "Input and output sizes differ");
+        for (size_t begin = 0; begin < ECEFPoints.size(); begin += BatchBlockSize)
+        {
+            const size_t count = AZStd::min(BatchBlockSize, ECEFPoints.size() - begin);
+            // Padding points lie on the equator, away from the singularity of the conversion at the center of the Earth.
+            double x[BatchBlockSize];
+            double y[BatchBlockSize];
+            double z[BatchBlockSize];
+            for (size_t i = 0; i < BatchBlockSize; ++i)
+            {
+                const bool isPoint = i < count;
+                x[i] = isPoint ? ECEFPoints[begin + i].m_x : earthSemimajorAxis;
+                y[i] = isPoint ? ECEFPoints[begin + i].m_y : 0.0;
+                z[i] = isPoint ? ECEFPoints[begin + i].m_z : 0.0;
+            }
+
+            double latitude[BatchBlockSize];
+            double altitude[BatchBlockSize];
+            for (size_t i = 0; i < BatchBlockSize; ++i)
+            {
+                ECEFToLatitudeAltitude(x[i], y[i], z[i], latitude[i], altitude[i]);
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                latitudeLongitudeAltitude[begin + i] = { RadToDeg(latitude[i]), RadToDeg(std::atan2(y[i], x[i])), altitude[i] };
+            }
+        }
+    }
+
+    void ECEFToENU(const ENUReferenceFrame& referenceFrame, AZStd::span<const WGS::Vector3d> ECEFPoints, AZStd::span<WGS::Vector3d> ENUPoints)
+    {
+        AZ_Assert(ECEFPoints.size() == ENUPoints.size(), "Input and output sizes differ");
+        const auto& r = referenceFrame.m_rotation;
+        for (size_t begin = 0; begin < ECEFPoints.size(); begin += BatchBlockSize)
+        {
+            const size_t count = AZStd::min(BatchBlockSize, ECEFPoints.size() - begin);
+            double dx[BatchBlockSize] = {};
+            double dy[BatchBlockSize] = {};
+            double dz[BatchBlockSize] = {};
+            for (size_t i = 0; i < count; ++i)
+            {
+                dx[i] = ECEFPoints[begin + i].m_x - referenceFrame.m_originECEF.m_x;
+                dy[i] = ECEFPoints[begin + i].m_y - referenceFrame.m_originECEF.m_y;
+                dz[i] = ECEFPoints[begin + i].m_z - referenceFrame.m_originECEF.m_z;
+            }
+
+            double east[BatchBlockSize];
+            double north[BatchBlockSize];
+            double up[BatchBlockSize];
+            for (size_t i = 0; i < BatchBlockSize; ++i)
+            {
+                east[i] = r[0][0] * dx[i] + r[0][1] * dy[i] + r[0][2] * dz[i];
+                north[i] = r[1][0] * dx[i] + r[1][1] * dy[i] + r[1][2] * dz[i];
+                up[i] = r[2][0] * dx[i] + r[2][1] * dy[i] + r[2][2] * dz[i];
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                ENUPoints[begin + i] = { east[i], north[i], up[i] };
+            }
+        }
+    }
+
+    void ENUToECEF(const ENUReferenceFrame& referenceFrame, AZStd::span<const WGS::Vector3d> ENUPoints, AZStd::span<WGS::Vector3d> ECEFPoints)
+    {
+        AZ_Assert(ECEFPoints.size() == ENUPoints.size(), "Input and output sizes differ");
+        const auto& r = referenceFrame.m_rotation;
+        const auto& origin = referenceFrame.m_originECEF;
+        for (size_t begin = 0; begin < ENUPoints.size(); begin += BatchBlockSize)
+        {
+            const size_t count = AZStd::min(BatchBlockSize, ENUPoints.size() - begin);
+            double east[BatchBlockSize] = {};
+            double north[BatchBlockSize] = {};
+            double up[BatchBlockSize] = {};
+            for (size_t i = 0; i < count; ++i)
+            {
+                east[i] = ENUPoints[begin + i].m_x;
+                north[i] = ENUPoints[begin + i].m_y;
+                up[i] = ENUPoints[begin + i].m_z;
+            }
+
+            double x[BatchBlockSize];
+            double y[BatchBlockSize];
+            double z[BatchBlockSize];
+            for (size_t i = 0; i < BatchBlockSize; ++i)
+            {
+                x[i] = r[0][0] * east[i] + r[1][0] * north[i] + r[2][0] * up[i] + origin.m_x;
+                y[i] = r[0][1] * east[i] + r[1][1] * north[i] + r[2][1] * up[i] + origin.m_y;
+                z[i] = r[0][2] * east[i] + r[1][2] * north[i] + r[2][2] * up[i] + origin.m_z;
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                ECEFPoints[begin + i] = { x[i], y[i], z[i] };
+            }
+        }
     }
 
 } // namespace ROS2::GNSS
@@ -8,10 +8,23 @@
 
 #pragma once
 #include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/std/containers/span.h>
 #include <ROS2/Georeference/GeoreferenceStructures.h>
 
 namespace ROS2::Utils::GeodeticConversions
 {
+    //! Local east, north, up (ENU) frame attached to a reference point, precomputed once per reference point.
+    //! Allows converting between ECEF and ENU without recomputing trigonometric functions of the reference point.
+    struct ENUReferenceFrame
+    {
+        WGS::Vector3d m_originECEF; //!< Reference point in ECEF coordinates.
+        double m_rotation[3][3] = {}; //!< Rows are east, north and up unit vectors expressed in ECEF.
+    };
+
+    //! Computes the local east, north, up (ENU) frame for a reference point.
+    //! @param referenceLatitudeLongitudeAltitude - reference point's latitude, longitude and altitude as WGS::WGS84Coordinate.
+    //! @return frame which can be used with ECEFToENU and ENUToECEF.
+    ENUReferenceFrame ComputeENUReferenceFrame(const WGS::WGS84Coordinate& referenceLatitudeLongitudeAltitude);
 
     //! Converts point in 1984 World Geodetic System (GS84) to Earth Centred Earth Fixed (ECEF)
     //! @param latitudeLongitudeAltitude - point's latitude, longitude and altitude as WGS::WGS84Coordinate.
@@ -40,4 +53,23 @@ namespace ROS2::Utils::GeodeticConversions
     //!     latitude and longitude are in decimal degrees
     //!     altitude is in meters
     WGS::WGS84Coordinate ECEFToWGS84(const WGS::Vector3d& ECFEPoint);
+
+    //! Converts Earth Centred Earth Fixed (ECEF) coordinates to local east, north, up (ENU) using a precomputed reference frame.
+    //! @param referenceFrame - frame computed with ComputeENUReferenceFrame.
+    //! @param ECEFPoint - ECEF point to be converted.
+    //! @return 3d vector of local east, north, up (ENU) coordinates.
+    WGS::Vector3d ECEFToENU(const ENUReferenceFrame& referenceFrame, const WGS::Vector3d& ECEFPoint);
+
+    //! Converts local east, north, up (ENU) coordinates to Earth Centred Earth Fixed (ECEF) using a precomputed reference frame.
+    //! @param referenceFrame - frame computed with ComputeENUReferenceFrame.
+    //! @param ENUPoint - ENU point to be converted.
+    //! @return 3d vector of ECEF coordinates.
+    WGS::Vector3d ENUToECEF(const ENUReferenceFrame& referenceFrame, const WGS::Vector3d& ENUPoint);
+
+    //! Batch versions of the conversions above. Input and output spans must have the same size.
+    //! The output span may be the same memory as the input span only for conversions between the same types.
+    void WGS84ToECEF(AZStd::span<const WGS::WGS84Coordinate> latitudeLongitudeAltitude, AZStd::span<WGS::Vector3d> ECEFPoints);
+    void ECEFToWGS84(AZStd::span<const WGS::Vector3d> ECEFPoints, AZStd::span<WGS::WGS84Coordinate> latitudeLongitudeAltitude);
+    void ECEFToENU(const ENUReferenceFrame& referenceFrame, AZStd::span<const WGS::Vector3d> ECEFPoints, AZStd::span<WGS::Vector3d> ENUPoints);
+    void ENUToECEF(const ENUReferenceFrame& referenceFrame, AZStd::span<const WGS::Vector3d> ENUPoints, AZStd::span<WGS::Vector3d> ECEFPoints);
 } // namespace ROS2::Utils::GeodeticConversions
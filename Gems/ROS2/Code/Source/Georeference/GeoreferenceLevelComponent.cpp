@@ -12,10 +12,14 @@
 #include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <ROS2/Georeference/GeoreferenceStructures.h>
 
 namespace ROS2
 {
+    //! Number of points converted per stack allocated block by the batch conversions.
+    static constexpr size_t ConversionBlockSize = 64;
+
     void GeoReferenceLevelConfig::Reflect(AZ::ReflectContext* context)
     {
         WGS::WGS84Coordinate::Reflect(context);
@@ -74,6 +78,9 @@ namespace ROS2
 
     void GeoReferenceLevelController::Activate(AZ::EntityId entityId)
     {
+        m_enuReferenceFrame = Utils::GeodeticConversions::ComputeENUReferenceFrame(m_config.m_originLocation);
+        m_enuOriginTransform = AZ::Transform::CreateIdentity();
+        m_enuOriginTransformInverse = AZ::Transform::CreateIdentity();
         AZ::EntityBus::Handler::BusConnect(m_config.m_enuOriginLocationEntityId);
         GeoreferenceRequestsBus::Handler::BusConnect();
     }
@@ -88,6 +95,7 @@ namespace ROS2
     {
         m_enuOriginTransform = AZ::Transform::CreateIdentity();
         AZ::TransformBus::EventResult(m_enuOriginTransform, m_config.m_enuOriginLocationEntityId, &AZ::TransformBus::Events::GetWorldTM);
+        m_enuOriginTransformInverse = m_enuOriginTransform;
         m_enuOriginTransform.Invert();
         AZ::EntityBus::Handler::BusDisconnect();
     }
@@ -96,7 +104,7 @@ namespace ROS2
     {
         using namespace ROS2::Utils::GeodeticConversions;
         const auto enu = WGS::Vector3d(m_enuOriginTransform.TransformPoint(xyz));
-        const auto ecef = ENUToECEF(m_config.m_originLocation, enu);
+        const auto ecef = ENUToECEF(m_enuReferenceFrame, enu);
         return ECEFToWGS84(ecef);
     }
 
@@ -104,10 +112,51 @@ namespace ROS2
     {
         using namespace ROS2::Utils::GeodeticConversions;
         const auto ecef = WGS84ToECEF(latLon);
-        const auto enu = ECEFToENU(m_config.m_originLocation, ecef);
-        return m_enuOriginTransform.GetInverse().TransformPoint(enu.ToVector3f());
+        const auto enu = ECEFToENU(m_enuReferenceFrame, ecef);
+        return m_enuOriginTransformInverse.TransformPoint(enu.ToVector3f());
     };
 
+    void GeoReferenceLevelController::ConvertPointsFromLevelToWSG84(
+        AZStd::span<const AZ::Vector3> xyz, AZStd::span<WGS::WGS84Coordinate> latLon)
+    {
+        using namespace ROS2::Utils::GeodeticConversions;
+        AZ_Assert(xyz.size() == latLon.size(), "Input and output sizes differ");
+
+        // Points are converted in blocks on the stack, so each stage runs over a whole block in the batch kernels without allocating
+        WGS::Vector3d points[ConversionBlockSize];
+        for (size_t begin = 0; begin < xyz.size(); begin += ConversionBlockSize)
+        {
+            const size_t count = AZStd::min(ConversionBlockSize, xyz.size() - begin);
+            for (size_t i = 0; i < count; ++i)
+            {
+                points[i] = WGS::Vector3d(m_enuOriginTransform.TransformPoint(xyz[begin + i]));
+            }
+            const AZStd::span<WGS::Vector3d> block(points, count);
+            ENUToECEF(m_enuReferenceFrame, block, block);
+            ECEFToWGS84(block, latLon.subspan(begin, count));
+        }
+    }
+
+    void GeoReferenceLevelController::ConvertPointsFromWSG84ToLevel(
+        AZStd::span<const WGS::WGS84Coordinate> latLon, AZStd::span<AZ::Vector3> xyz)
+    {
+        using namespace ROS2::Utils::GeodeticConversions;
+        AZ_Assert(xyz.size() == latLon.size(), "Input and output sizes differ");
+
+        WGS::Vector3d points[ConversionBlockSize];
+        for (size_t begin = 0; begin < latLon.size(); begin += ConversionBlockSize)
+        {
+            const size_t count = AZStd::min(ConversionBlockSize, latLon.size() - begin);
+            const AZStd::span<WGS::Vector3d> block(points, count);
+            WGS84ToECEF(latLon.subspan(begin, count), block);
+            ECEFToENU(m_enuReferenceFrame, block, block);
+            for (size_t i = 0; i < count; ++i)
+            {
+                xyz[begin + i] = m_enuOriginTransformInverse.TransformPoint(points[i].ToVector3f());
+            }
+        }
+    }
+
     AZ::Quaternion GeoReferenceLevelController::GetRotationFromLevelToENU()
     {
         return m_enuOriginTransform.GetRotation();
@@ -13,6 +13,8 @@
 #include <AzFramework/Components/ComponentAdapter.h>
 #include <ROS2/Georeference/GeoreferenceBus.h>
 
+#include "GNSSFormatConversions.h"
+
 namespace ROS2
 {
     struct GeoReferenceLevelConfig : public AZ::ComponentConfig
@@ -52,9 +54,14 @@ namespace ROS2
         WGS::WGS84Coordinate ConvertFromLevelToWSG84(const AZ::Vector3& xyz) override;
         AZ::Vector3 ConvertFromWSG84ToLevel(const WGS::WGS84Coordinate& latLon) override;
         AZ::Quaternion GetRotationFromLevelToENU() override;
+        void ConvertPointsFromLevelToWSG84(AZStd::span<const AZ::Vector3> xyz, AZStd::span<WGS::WGS84Coordinate> latLon) override;
+        void ConvertPointsFromWSG84ToLevel(AZStd::span<const WGS::WGS84Coordinate> latLon, AZStd::span<AZ::Vector3> xyz) override;
 
         GeoReferenceLevelConfig m_config;
         AZ::Transform m_enuOriginTransform; //!< Transform of the entity that lays in the origin of the ENU coordinate system
+        AZ::Transform m_enuOriginTransformInverse; //!< Inverse of m_enuOriginTransform, cached for conversions to Level's coordinates
+        //! ENU frame of m_config.m_originLocation, computed on activation to avoid recomputing it for every converted point
+        Utils::GeodeticConversions::ENUReferenceFrame m_enuReferenceFrame;
     };
 
     using GeoReferenceLevelComponentBase = AzFramework::Components::ComponentAdapter<GeoReferenceLevelController, GeoReferenceLevelConfig>;
@@ -50,17 +50,26 @@ namespace ROS2
         m_grippedObjectInEffector = AZ::EntityId(AZ::EntityId::InvalidEntityId);
         m_tryingToGrip = false;
         m_cancelGripperCommand = false;
-        AZ::TickBus::Handler::BusConnect();
+        m_effectorSetupDone = false;
+
+        m_onSceneSimulationFinishHandler = AzPhysics::SceneEvents::OnSceneSimulationFinishHandler(
+            [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float deltaTime)
+            {
+                OnPhysicsStep();
+            });
+        // The effector needs to be set up once the physics bodies exist, which is the case on the first physics step.
+        ConnectToPhysicsStep();
+
         ImGui::ImGuiUpdateListenerBus::Handler::BusConnect();
         GripperRequestBus::Handler::BusConnect(GetEntityId());
     }
 
     void VacuumGripperComponent::Deactivate()
     {
+        m_onSceneSimulationFinishHandler.Disconnect();
         m_onTriggerEnterHandler.Disconnect();
         m_onTriggerExitHandler.Disconnect();
         GripperRequestBus::Handler::BusDisconnect();
-        AZ::TickBus::Handler::BusDisconnect();
         ImGui::ImGuiUpdateListenerBus::Handler::BusDisconnect();
     }
 
@@ -104,7 +113,43 @@ namespace ROS2
         }
     }
 
-    void VacuumGripperComponent::OnTick(float delta, AZ::ScriptTimePoint timePoint)
+    void VacuumGripperComponent::ConnectToPhysicsStep()
+    {
+        if (m_onSceneSimulationFinishHandler.IsConnected())
+        {
+            return;
+        }
+
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AZ_Assert(sceneInterface, "No scene intreface.");
+
+        AzPhysics::SceneHandle defaultSceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+        AZ_Assert(defaultSceneHandle != AzPhysics::InvalidSceneHandle, "Invalid default physics scene handle.");
+
+        sceneInterface->RegisterSceneSimulationFinishHandler(defaultSceneHandle, m_onSceneSimulationFinishHandler);
+    }
+
+    void VacuumGripperComponent::OnPhysicsStep()
+    {
+        if (!m_effectorSetupDone)
+        {
+            m_effectorSetupDone = SetupEffector();
+        }
+
+        if (m_tryingToGrip)
+        {
+            TryToGripObject();
+        }
+
+        // Nothing left to do until the next grip command.
+        const bool isGripPending = m_tryingToGrip && m_vacuumJoint == AzPhysics::InvalidJointHandle;
+        if (m_effectorSetupDone && !isGripPending)
+        {
+            m_onSceneSimulationFinishHandler.Disconnect();
+        }
+    }
+
+    bool VacuumGripperComponent::SetupEffector()
     {
         AZ_Assert(AZ::Interface<AzPhysics::SystemInterface>::Get(), "No physics system.");
 
@@ -131,7 +176,10 @@ namespace ROS2
                     AzPhysics::SimulatedBodyEvents::RegisterOnTriggerExitHandler(foundBody.first, foundBody.second, m_onTriggerExitHandler);
                 }
             }
+        }
 
+        if (m_gripperEffectorBodyHandle == AzPhysics::InvalidSimulatedBodyHandle)
+        {
             AZ::EntityId rootArticulationEntity = Utils::GetRootOfArticulation(m_gripperEffectorArticulationLink);
             AZ::Entity* rootEntity = nullptr;
             AZ::ComponentApplicationBus::BroadcastResult(rootEntity, &AZ::ComponentApplicationRequests::FindEntity, rootArticulationEntity);
@@ -152,10 +200,15 @@ namespace ROS2
                 }
             }
         }
-        if (m_tryingToGrip)
-        {
-            TryToGripObject();
-        }
+
+        return m_onTriggerEnterHandler.IsConnected() && m_onTriggerExitHandler.IsConnected() &&
+            m_gripperEffectorBodyHandle != AzPhysics::InvalidSimulatedBodyHandle;
+    }
+
+    void VacuumGripperComponent::StartGripping()
+    {
+        m_tryingToGrip = true;
+        ConnectToPhysicsStep();
     }
 
     bool VacuumGripperComponent::isObjectGrippable(const AZ::EntityId entityId)
@@ -266,11 +319,14 @@ namespace ROS2
         ImGui::Text("Grippable object : %s", grippedObjectInEffectorName.c_str());
         ImGui::Text("Vacuum joint created : %d ", m_vacuumJoint != AzPhysics::InvalidJointHandle);
 
-        ImGui::Checkbox("Gripping", &m_tryingToGrip);
+        if (ImGui::Checkbox("Gripping", &m_tryingToGrip) && m_tryingToGrip)
+        {
+            StartGripping();
+        }
 
         if (ImGui::Button("Grip Command "))
         {
-            m_tryingToGrip = true;
+            StartGripping();
         }
 
         if (ImGui::Button("Release Command"))
@@ -286,7 +342,7 @@ namespace ROS2
         m_cancelGripperCommand = false;
         if (position == 0.0f)
         {
-            m_tryingToGrip = true;
+            StartGripping();
         }
         else
         {
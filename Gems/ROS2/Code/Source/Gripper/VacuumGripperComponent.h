@@ -9,7 +9,6 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
-#include <AzCore/Component/TickBus.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBodyEvents.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
@@ -26,11 +25,11 @@ namespace ROS2
     //!  - Attach component to root of robot articulation.
     //!  - Assign to m_gripperEffectorCollider EntityId of the collider that will be used as the gripper effector.
     //!  - Add tag "Grippable" to objects that can be gripped.
+    //! Grip detection runs on the physics step, only while a grip command is pending; an idle gripper does no per-frame work.
     class VacuumGripperComponent
         : public AZ::Component
         , public GripperRequestBus::Handler
         , public ImGui::ImGuiUpdateListenerBus::Handler
-        , public AZ::TickBus::Handler
     {
     public:
         static constexpr AZ::Crc32 GrippableTag = AZ_CRC_CE("Grippable");
@@ -55,8 +54,19 @@ namespace ROS2
         bool IsGripperNotMoving() const override;
         bool HasGripperReachedGoal() const override;
         bool HasGripperCommandBeenCancelled() const override;
-        // AZ::TickBus::Handler overrides...
-        void OnTick(float delta, AZ::ScriptTimePoint timePoint) override;
+
+        //! Called after each physics step while the handler is connected (until setup is done and while a grip command is pending).
+        void OnPhysicsStep();
+
+        //! Connects the physics step handler, if not connected already.
+        void ConnectToPhysicsStep();
+
+        //! Finds the effector body and registers trigger handlers on the effector collider.
+        //! @return true if the effector body and the collider were found.
+        bool SetupEffector();
+
+        //! Starts a grip command: the grip is attempted on the following physics steps until an object is attached.
+        void StartGripping();
 
         // ImGui::ImGuiUpdateListenerBus::Handler overrides...
         void OnImGuiUpdate() override;
@@ -81,6 +91,10 @@ namespace ROS2
 
         bool m_cancelGripperCommand{ false };
 
+        //! Set when the effector body and trigger handlers were found, which can happen only after the physics bodies are created.
+        bool m_effectorSetupDone{ false };
+
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_onSceneSimulationFinishHandler;
         AzPhysics::SimulatedBodyEvents::OnTriggerEnter::Handler m_onTriggerEnterHandler;
         AzPhysics::SimulatedBodyEvents::OnTriggerExit::Handler m_onTriggerExitHandler;
 
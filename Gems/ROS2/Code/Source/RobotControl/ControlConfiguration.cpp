@@ -15,7 +15,11 @@ namespace ROS2
     {
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
-            serializeContext->Class<ControlConfiguration>()->Version(1)->Field("Steering", &ControlConfiguration::m_steering);
+            serializeContext->Class<ControlConfiguration>()
+                ->Version(2)
+                ->Field("Steering", &ControlConfiguration::m_steering)
+                ->Field("UseLatestValueMailbox", &ControlConfiguration::m_useLatestValueMailbox)
+                ->Field("CommandTimeout", &ControlConfiguration::m_commandTimeout);
 
             if (AZ::EditContext* ec = serializeContext->GetEditContext())
             {
@@ -27,7 +31,19 @@ namespace ROS2
                         "Determines how the robot is controlled.")
                     ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
                     ->EnumAttribute(ControlConfiguration::Steering::Twist, "Twist")
-                    ->EnumAttribute(ControlConfiguration::Steering::Ackermann, "Ackermann");
+                    ->EnumAttribute(ControlConfiguration::Steering::Ackermann, "Ackermann")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &ControlConfiguration::m_useLatestValueMailbox,
+                        "Coalesce messages",
+                        "Keep only the latest control message and apply it once per physics step")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &ControlConfiguration::m_commandTimeout,
+                        "Command timeout",
+                        "Time in seconds without control messages after which a zero command is applied. 0 disables the timeout")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->Attribute(AZ::Edit::Attributes::Suffix, " s");
             }
         }
     }
@@ -35,12 +35,14 @@ namespace ROS2
 
         if (m_subscriptionHandler)
         {
-            m_subscriptionHandler->Activate(GetEntity(), m_subscriberConfiguration);
+            m_subscriptionHandler->Activate(GetEntity(), m_subscriberConfiguration, m_controlConfiguration);
         }
+        RobotControlRequestBus::Handler::BusConnect(GetEntityId());
     }
 
     void ROS2RobotControlComponent::Deactivate()
     {
+        RobotControlRequestBus::Handler::BusDisconnect();
         if (m_subscriptionHandler)
         {
             m_subscriptionHandler->Deactivate();
@@ -91,6 +93,11 @@ namespace ROS2
         return m_controlConfiguration;
     }
 
+    ControlSubscriptionStatistics ROS2RobotControlComponent::GetSubscriptionStatistics() const
+    {
+        return m_subscriptionHandler ? m_subscriptionHandler->GetStatistics() : ControlSubscriptionStatistics{};
+    }
+
     const TopicConfiguration& ROS2RobotControlComponent::GetSubscriberConfiguration() const
     {
         return m_subscriberConfiguration;
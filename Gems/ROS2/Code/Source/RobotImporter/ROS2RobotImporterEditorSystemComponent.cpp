@@ -7,6 +7,7 @@
  */
 
 #include "ROS2RobotImporterEditorSystemComponent.h"
+#include "RobotBatchImporter.h"
 #include "RobotImporterWidget.h"
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/StringFunc/StringFunc.h>
@@ -32,6 +33,8 @@ namespace ROS2
 {
     void ROS2RobotImporterEditorSystemComponent::Reflect(AZ::ReflectContext* context)
     {
+        RobotBatchImporter::Reflect(context);
+
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             const auto& importerHookCamera = ROS2::SDFormat::ROS2SensorHooks::ROS2CameraSensor();
@@ -52,7 +55,8 @@ namespace ROS2
                 ->Attribute(AZ::Script::Attributes::Category, "Robotics")
                 ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Automation)
                 ->Attribute(AZ::Script::Attributes::Module, "ROS2")
-                ->Event("ImportURDF", &RobotImporterRequestBus::Events::GeneratePrefabFromFile);
+                ->Event("ImportURDF", &RobotImporterRequestBus::Events::GeneratePrefabFromFile)
+                ->Event("ImportRobotsFromManifest", &RobotImporterRequestBus::Events::GeneratePrefabsFromManifest);
         }
     }
 
@@ -74,6 +78,12 @@ namespace ROS2
         AzToolsFramework::EditorEvents::Bus::Handler::BusConnect();
         RobotImporterRequestBus::Handler::BusConnect();
 
+        m_sourceAssetsCrcIndex = AZStd::make_unique<Utils::SourceAssetsCrcIndex>(Utils::SourceAssetsCrcIndex::GetDefaultIndexFilePath());
+        m_sourceAssetsCrcIndex->Activate(true);
+
+        m_xacroExpansionCache = AZStd::make_unique<Utils::xacro::XacroExpansionCache>();
+        m_xacroExpansionCache->Activate();
+
         auto serializeContext = AZ::Interface<AZ::ComponentApplicationRequests>::Get()->GetSerializeContext();
         serializeContext->EnumerateAll(
             [&](const AZ::SerializeContext::ClassData* classData, const AZ::Uuid& typeId) -> bool
@@ -97,6 +107,8 @@ namespace ROS2
 
     void ROS2RobotImporterEditorSystemComponent::Deactivate()
     {
+        m_xacroExpansionCache.reset();
+        m_sourceAssetsCrcIndex.reset();
         RobotImporterRequestBus::Handler::BusDisconnect();
         AzToolsFramework::EditorEvents::Bus::Handler::BusDisconnect();
         ROS2RobotImporterSystemComponent::Deactivate();
@@ -153,7 +165,11 @@ namespace ROS2
         if (importAssetWithUrdf)
         {
             urdfAssetsMapping = AZStd::make_shared<Utils::UrdfAssetMap>(
-                Utils::CopyReferencedAssetsAndCreateAssetMap(assetNames, filePath, sdfBuilderSettings));
+                Utils::CopyReferencedAssetsAndCreateAssetMap(
+                    assetNames,
+                    filePath,
+                    sdfBuilderSettings,
+                    Utils::GetColliderMeshExportMethods(parsedSdfRoot, sdfBuilderSettings.m_colliderMeshSettings)));
         }
         bool allAssetProcessed = false;
         bool assetProcessorFailed = false;
@@ -254,6 +270,34 @@ namespace ROS2
         return true;
     }
 
+    bool ROS2RobotImporterEditorSystemComponent::GeneratePrefabsFromManifest(
+        const AZStd::string_view manifestPath, const AZStd::string_view reportPath)
+    {
+        if (manifestPath.empty())
+        {
+            AZ_Warning("ROS2RobotImporterEditorSystemComponent", false, "Path provided for robot import manifest is empty");
+            return false;
+        }
+
+        auto manifestOutcome = RobotBatchImporter::LoadManifest(AZ::IO::Path(manifestPath));
+        if (!manifestOutcome.IsSuccess())
+        {
+            AZ_Warning("ROS2RobotImporterEditorSystemComponent", false, "%s", manifestOutcome.GetError().c_str());
+            return false;
+        }
+
+        // Relative robot description paths in the manifest are relative to the manifest itself
+        const AZ::IO::Path baseDirectory = AZ::IO::PathView(manifestPath).ParentPath();
+        const RobotImportReport report = RobotBatchImporter().Import(manifestOutcome.GetValue(), baseDirectory);
+
+        if (!reportPath.empty())
+        {
+            RobotBatchImporter::SaveReport(report, AZ::IO::Path(reportPath));
+        }
+
+        return report.m_failedCount == 0;
+    }
+
     const SDFormat::SensorImporterHooksStorage& ROS2RobotImporterEditorSystemComponent::GetSensorHooks() const
     {
         return m_sensorHooks;
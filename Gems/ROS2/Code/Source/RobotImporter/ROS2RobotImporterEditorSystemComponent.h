@@ -13,7 +13,9 @@
 #include <AzToolsFramework/Entity/EditorEntityContextBus.h>
 #include <ROS2/RobotImporter/RobotImporterBus.h>
 #include <ROS2/RobotImporter/SDFormatSensorImporterHook.h>
+#include <RobotImporter/Utils/SourceAssetsCrcIndex.h>
 #include <RobotImporter/Utils/SourceAssetsStorage.h>
+#include <RobotImporter/xacro/XacroExpander.h>
 namespace ROS2
 {
 
@@ -43,6 +45,7 @@ namespace ROS2
 
         // RobotImporterRequestsBus::Handler overrides ..
         bool GeneratePrefabFromFile(const AZStd::string_view filePath, bool importAssetWithUrdf, bool useArticulation) override;
+        bool GeneratePrefabsFromManifest(const AZStd::string_view manifestPath, const AZStd::string_view reportPath) override;
         const SDFormat::SensorImporterHooksStorage& GetSensorHooks() const override;
 
         // Timeout for loop waiting for assets to be built
@@ -50,5 +53,11 @@ namespace ROS2
 
         // Cache for storing sensor importer hooks (read only once)
         SDFormat::SensorImporterHooksStorage m_sensorHooks;
+
+        // Checksums of source assets, used to match meshes referenced by imported robots with existing assets
+        AZStd::unique_ptr<Utils::SourceAssetsCrcIndex> m_sourceAssetsCrcIndex;
+
+        // Results of in-process xacro expansions, reused when the same robot description is imported again
+        AZStd::unique_ptr<Utils::xacro::XacroExpansionCache> m_xacroExpansionCache;
     };
 } // namespace ROS2
@@ -0,0 +1,420 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RobotBatchImporter.h"
+#include <AzCore/Asset/AssetCatalogBus.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzFramework/Asset/AssetSystemBus.h>
+#include <AzToolsFramework/API/EditorAssetSystemAPI.h>
+#include <RobotImporter/URDF/URDFPrefabMaker.h>
+#include <RobotImporter/URDF/UrdfParser.h>
+#include <RobotImporter/Utils/ErrorUtils.h>
+#include <RobotImporter/Utils/FilePath.h>
+#include <RobotImporter/Utils/RobotImporterUtils.h>
+#include <RobotImporter/Utils/SourceAssetsStorage.h>
+#include <RobotImporter/xacro/XacroUtils.h>
+#include <SdfAssetBuilder/SdfAssetBuilderSettings.h>
+
+namespace ROS2
+{
+    namespace
+    {
+        constexpr const char* RobotBatchImporterName = "RobotBatchImporter";
+
+        using Clock = AZStd::chrono::steady_clock;
+
+        //! Interval at which the calling thread processes system events while it waits.
+        constexpr AZStd::chrono::milliseconds EventProcessingInterval{ 10 };
+
+        //! Time the calling thread waits for the asset catalog to list the products of the built assets.
+        constexpr AZStd::chrono::seconds CatalogWaitTimeout{ 30 };
+
+        double SecondsSince(Clock::time_point start)
+        {
+            return AZStd::chrono::duration<double>(Clock::now() - start).count();
+        }
+
+        //! Results of the concurrent stages of a robot import, consumed by the serial prefab creation.
+        struct PreparedRobot
+        {
+            AZ::IO::Path m_filePath;
+            AZStd::string m_prefabName;
+            UrdfParser::RootObjectOutcome m_parseOutcome;
+            AZStd::shared_ptr<Utils::UrdfAssetMap> m_assetsMapping = AZStd::make_shared<Utils::UrdfAssetMap>();
+            //! Products of the built assets, which must be in the asset catalog before the prefab is created.
+            AZStd::vector<AZ::Data::AssetId> m_productAssetIds;
+        };
+
+        //! Processes the events the main thread would otherwise handle on its next tick, including the Asset Processor
+        //! notifications which update the asset catalog, so that the Editor keeps running while the import waits.
+        void ProcessSystemEvents()
+        {
+            AZ::SystemTickBus::ExecuteQueuedEvents();
+            AZ::SystemTickBus::Broadcast(&AZ::SystemTickBus::Events::OnSystemTick);
+            AZ::TickBus::ExecuteQueuedEvents();
+        }
+
+        //! Returns true if the asset catalog lists the products of the built assets of every robot.
+        bool AreProductsInCatalog(const AZStd::vector<PreparedRobot>& preparedRobots)
+        {
+            for (const PreparedRobot& preparedRobot : preparedRobots)
+            {
+                for (const AZ::Data::AssetId& productAssetId : preparedRobot.m_productAssetIds)
+                {
+                    AZ::Data::AssetInfo assetInfo;
+                    AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                        assetInfo, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetInfoById, productAssetId);
+                    if (!assetInfo.m_assetId.IsValid())
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        //! Parses a robot description, copies its assets and waits until the Asset Processor builds them.
+        //! Runs on a job thread, so it only touches its own robot and thread safe buses.
+        void PrepareRobot(
+            const RobotImportManifestEntry& manifestEntry,
+            const AZ::IO::Path& baseDirectory,
+            const SdfAssetBuilderSettings& sdfBuilderSettings,
+            PreparedRobot& preparedRobot,
+            RobotImportReportEntry& reportEntry)
+        {
+            preparedRobot.m_filePath = AZ::IO::Path(manifestEntry.m_filePath);
+            if (preparedRobot.m_filePath.IsRelative())
+            {
+                preparedRobot.m_filePath = baseDirectory / preparedRobot.m_filePath;
+            }
+            preparedRobot.m_filePath = preparedRobot.m_filePath.LexicallyNormal();
+            reportEntry.m_filePath = preparedRobot.m_filePath.Native();
+
+            preparedRobot.m_prefabName = manifestEntry.m_prefabName;
+            if (preparedRobot.m_prefabName.empty())
+            {
+                preparedRobot.m_prefabName = AZStd::string(preparedRobot.m_filePath.Stem().Native());
+            }
+
+            const auto parseStart = Clock::now();
+            const sdf::ParserConfig parserConfig =
+                Utils::SDFormat::CreateSdfParserConfigFromSettings(sdfBuilderSettings, preparedRobot.m_filePath);
+            const bool isXacro = Utils::IsFileXacro(preparedRobot.m_filePath);
+            if (isXacro)
+            {
+                Utils::xacro::ExecutionOutcome outcome = Utils::xacro::ParseXacro(
+                    preparedRobot.m_filePath.String(), manifestEntry.m_xacroArguments, parserConfig, sdfBuilderSettings);
+                if (!outcome.m_succeed)
+                {
+                    reportEntry.m_failedStage = "Parse";
+                    reportEntry.m_error = AZStd::string::format("xacro failed: %s", outcome.m_logErrorOutput.c_str());
+                    reportEntry.m_parseSeconds = SecondsSince(parseStart);
+                    return;
+                }
+                preparedRobot.m_parseOutcome = AZStd::move(outcome.m_urdfHandle);
+            }
+            else
+            {
+                preparedRobot.m_parseOutcome = UrdfParser::ParseFromFile(preparedRobot.m_filePath, parserConfig, sdfBuilderSettings);
+            }
+            reportEntry.m_parseSeconds = SecondsSince(parseStart);
+
+            if (!preparedRobot.m_parseOutcome)
+            {
+                reportEntry.m_failedStage = "Parse";
+                reportEntry.m_error = Utils::JoinSdfErrorsToString(preparedRobot.m_parseOutcome.GetSdfErrors());
+                return;
+            }
+
+            if (!manifestEntry.m_importAssets)
+            {
+                return;
+            }
+
+            const auto assetsStart = Clock::now();
+            const auto assetNames = Utils::GetReferencedAssetFilenames(preparedRobot.m_parseOutcome.GetRoot());
+            // Variants of the same xacro file get separate asset directories, as their meshes may differ.
+            const AZStd::string_view outputDirSuffix = isXacro ? AZStd::string_view(preparedRobot.m_prefabName) : AZStd::string_view{};
+            *preparedRobot.m_assetsMapping = Utils::CopyReferencedAssetsAndCreateAssetMap(
+                assetNames,
+                preparedRobot.m_filePath.String(),
+                sdfBuilderSettings,
+                Utils::GetColliderMeshExportMethods(preparedRobot.m_parseOutcome.GetRoot(), sdfBuilderSettings.m_colliderMeshSettings),
+                outputDirSuffix);
+
+            // Compiling synchronously returns as soon as the Asset Processor reports the result of the source asset,
+            // so the job waits on the notification of the Asset Processor instead of polling the job status of every asset.
+            AZStd::unordered_set<AZ::IO::Path> sourceAssetPaths;
+            for (const auto& [unresolvedPath, urdfAsset] : *preparedRobot.m_assetsMapping)
+            {
+                const AZ::IO::Path& sourceAssetPath = urdfAsset.m_availableAssetInfo.m_sourceAssetGlobalPath;
+                if (sourceAssetPath.empty())
+                {
+                    reportEntry.m_failedAssets.emplace_back(unresolvedPath.Native());
+                    continue;
+                }
+                if (!sourceAssetPaths.emplace(sourceAssetPath).second)
+                {
+                    continue;
+                }
+
+                AzFramework::AssetSystem::AssetStatus assetStatus = AzFramework::AssetSystem::AssetStatus_Unknown;
+                AzFramework::AssetSystemRequestBus::BroadcastResult(
+                    assetStatus, &AzFramework::AssetSystem::AssetSystemRequests::CompileAssetSync, sourceAssetPath.Native());
+                if (assetStatus != AzFramework::AssetSystem::AssetStatus_Compiled)
+                {
+                    AZ_Warning(RobotBatchImporterName, false, "Asset %s was not built, status %d", sourceAssetPath.c_str(), static_cast<int>(assetStatus));
+                    reportEntry.m_failedAssets.emplace_back(sourceAssetPath.Native());
+                    continue;
+                }
+
+                // The products are queried once here, the calling thread then only polls its local asset catalog for them.
+                bool productsFound = false;
+                AZStd::vector<AZ::Data::AssetInfo> productsAssetInfo;
+                AzToolsFramework::AssetSystemRequestBus::BroadcastResult(
+                    productsFound,
+                    &AzToolsFramework::AssetSystemRequestBus::Events::GetAssetsProducedBySourceUUID,
+                    urdfAsset.m_availableAssetInfo.m_sourceGuid,
+                    productsAssetInfo);
+                for (const AZ::Data::AssetInfo& productAssetInfo : productsAssetInfo)
+                {
+                    preparedRobot.m_productAssetIds.emplace_back(productAssetInfo.m_assetId);
+                }
+            }
+            reportEntry.m_assetCount = aznumeric_cast<AZ::u32>(preparedRobot.m_assetsMapping->size());
+            reportEntry.m_assetsSeconds = SecondsSince(assetsStart);
+        }
+    } // namespace
+
+    void RobotImportManifestEntry::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<RobotImportManifestEntry>()
+                ->Version(0)
+                ->Field("FilePath", &RobotImportManifestEntry::m_filePath)
+                ->Field("PrefabName", &RobotImportManifestEntry::m_prefabName)
+                ->Field("ImportAssets", &RobotImportManifestEntry::m_importAssets)
+                ->Field("UseArticulations", &RobotImportManifestEntry::m_useArticulations)
+                ->Field("XacroArguments", &RobotImportManifestEntry::m_xacroArguments);
+        }
+    }
+
+    void RobotImportManifest::Reflect(AZ::ReflectContext* context)
+    {
+        RobotImportManifestEntry::Reflect(context);
+
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<RobotImportManifest>()->Version(0)->Field("Robots", &RobotImportManifest::m_robots);
+        }
+    }
+
+    void RobotImportReportEntry::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<RobotImportReportEntry>()
+                ->Version(0)
+                ->Field("FilePath", &RobotImportReportEntry::m_filePath)
+                ->Field("PrefabPath", &RobotImportReportEntry::m_prefabPath)
+                ->Field("Succeeded", &RobotImportReportEntry::m_succeeded)
+                ->Field("FailedStage", &RobotImportReportEntry::m_failedStage)
+                ->Field("Error", &RobotImportReportEntry::m_error)
+                ->Field("AssetCount", &RobotImportReportEntry::m_assetCount)
+                ->Field("FailedAssets", &RobotImportReportEntry::m_failedAssets)
+                ->Field("ParseSeconds", &RobotImportReportEntry::m_parseSeconds)
+                ->Field("AssetsSeconds", &RobotImportReportEntry::m_assetsSeconds)
+                ->Field("PrefabSeconds", &RobotImportReportEntry::m_prefabSeconds);
+        }
+    }
+
+    void RobotImportReport::Reflect(AZ::ReflectContext* context)
+    {
+        RobotImportReportEntry::Reflect(context);
+
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<RobotImportReport>()
+                ->Version(0)
+                ->Field("SucceededCount", &RobotImportReport::m_succeededCount)
+                ->Field("FailedCount", &RobotImportReport::m_failedCount)
+                ->Field("TotalSeconds", &RobotImportReport::m_totalSeconds)
+                ->Field("Robots", &RobotImportReport::m_robots);
+        }
+    }
+
+    void RobotBatchImporter::Reflect(AZ::ReflectContext* context)
+    {
+        RobotImportManifest::Reflect(context);
+        RobotImportReport::Reflect(context);
+    }
+
+    AZ::Outcome<RobotImportManifest, AZStd::string> RobotBatchImporter::LoadManifest(const AZ::IO::Path& manifestPath)
+    {
+        RobotImportManifest manifest;
+        if (auto loadResult = AZ::JsonSerializationUtils::LoadObjectFromFile(manifest, manifestPath.Native()); !loadResult.IsSuccess())
+        {
+            return AZ::Failure(
+                AZStd::string::format("Cannot read robot import manifest '%s': %s", manifestPath.c_str(), loadResult.GetError().c_str()));
+        }
+        return AZ::Success(AZStd::move(manifest));
+    }
+
+    bool RobotBatchImporter::SaveReport(const RobotImportReport& report, const AZ::IO::Path& reportPath)
+    {
+        auto saveResult = AZ::JsonSerializationUtils::SaveObjectToFile(&report, reportPath.Native());
+        AZ_Warning(
+            RobotBatchImporterName,
+            saveResult.IsSuccess(),
+            "Cannot write robot import report '%s': %s",
+            reportPath.c_str(),
+            saveResult.IsSuccess() ? "" : saveResult.GetError().c_str());
+        return saveResult.IsSuccess();
+    }
+
+    RobotImportReport RobotBatchImporter::Import(const RobotImportManifest& manifest, const AZ::IO::Path& baseDirectory) const
+    {
+        const auto importStart = Clock::now();
+
+        // Read the SDF Settings from the Settings Registry once, they are shared by every robot
+        SdfAssetBuilderSettings sdfBuilderSettings;
+        sdfBuilderSettings.LoadSettings();
+
+        const size_t robotCount = manifest.m_robots.size();
+        AZStd::vector<PreparedRobot> preparedRobots(robotCount);
+        RobotImportReport report;
+        report.m_robots.resize(robotCount);
+
+        if (robotCount > 0)
+        {
+            // Preparing a robot blocks its worker on xacro, file copies and the Asset Processor, so the robots are prepared on
+            // a job manager of their own instead of occupying the global job workers the Editor relies on.
+            const size_t workerCount = AZStd::min<size_t>(robotCount, AZStd::max<size_t>(AZStd::thread::hardware_concurrency(), 1));
+            AZ::JobManagerDesc jobManagerDesc;
+            jobManagerDesc.m_jobManagerName = "Robot Batch Importer";
+            for (size_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            AZ::JobManager jobManager(jobManagerDesc);
+            AZ::JobContext jobContext(jobManager);
+
+            AZStd::atomic<size_t> preparedCount{ 0 };
+            AZ::JobCompletion completion(&jobContext);
+            for (size_t robotIndex = 0; robotIndex < robotCount; ++robotIndex)
+            {
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [&, robotIndex]()
+                    {
+                        PrepareRobot(
+                            manifest.m_robots[robotIndex],
+                            baseDirectory,
+                            sdfBuilderSettings,
+                            preparedRobots[robotIndex],
+                            report.m_robots[robotIndex]);
+                        ++preparedCount;
+                    },
+                    true,
+                    &jobContext);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+
+            // The calling thread is the main thread of the Editor, so it keeps processing events instead of blocking on the jobs.
+            while (preparedCount < robotCount)
+            {
+                ProcessSystemEvents();
+                AZStd::this_thread::sleep_for(EventProcessingInterval);
+            }
+            completion.StartAndWaitForCompletion();
+        }
+
+        // Compiled assets are only referenced by the prefabs once the asset catalog, which is updated on system ticks, lists their products.
+        const auto catalogWaitStart = Clock::now();
+        while (!AreProductsInCatalog(preparedRobots))
+        {
+            if (Clock::now() - catalogWaitStart > CatalogWaitTimeout)
+            {
+                AZ_Warning(RobotBatchImporterName, false, "Timed out waiting for the asset catalog, prefabs may miss some built assets");
+                break;
+            }
+            ProcessSystemEvents();
+            AZStd::this_thread::sleep_for(EventProcessingInterval);
+        }
+
+        // Entities and prefab templates are created on the calling thread, one robot after another.
+        for (size_t robotIndex = 0; robotIndex < robotCount; ++robotIndex)
+        {
+            PreparedRobot& preparedRobot = preparedRobots[robotIndex];
+            RobotImportReportEntry& reportEntry = report.m_robots[robotIndex];
+            if (!reportEntry.m_failedStage.empty())
+            {
+                AZ_Warning(
+                    RobotBatchImporterName,
+                    false,
+                    "Import of %s failed at stage %s: %s",
+                    reportEntry.m_filePath.c_str(),
+                    reportEntry.m_failedStage.c_str(),
+                    reportEntry.m_error.c_str());
+                ++report.m_failedCount;
+                continue;
+            }
+
+            const auto prefabStart = Clock::now();
+            const AZ::IO::Path prefabPath(
+                AZ::IO::Path(AZ::Utils::GetProjectPath()) / "Assets" / "Importer" /
+                AZStd::string::format("%s.prefab", preparedRobot.m_prefabName.c_str()));
+            reportEntry.m_prefabPath = prefabPath.Native();
+
+            URDFPrefabMaker prefabMaker(
+                preparedRobot.m_filePath.String(),
+                &preparedRobot.m_parseOutcome.GetRoot(),
+                prefabPath.String(),
+                preparedRobot.m_assetsMapping,
+                manifest.m_robots[robotIndex].m_useArticulations);
+            auto prefabOutcome = prefabMaker.CreatePrefabFromUrdfOrSdf();
+            reportEntry.m_prefabSeconds = SecondsSince(prefabStart);
+
+            if (!prefabOutcome.IsSuccess())
+            {
+                reportEntry.m_failedStage = "Prefab";
+                reportEntry.m_error = prefabOutcome.GetError();
+                AZ_Warning(
+                    RobotBatchImporterName, false, "Unable to create prefab from %s: %s", reportEntry.m_filePath.c_str(), reportEntry.m_error.c_str());
+                ++report.m_failedCount;
+                continue;
+            }
+
+            reportEntry.m_succeeded = true;
+            ++report.m_succeededCount;
+        }
+
+        report.m_totalSeconds = SecondsSince(importStart);
+        AZ_Info(
+            RobotBatchImporterName,
+            "Imported %u of %zu robots in %.1f s\n",
+            report.m_succeededCount,
+            robotCount,
+            report.m_totalSeconds);
+        return report;
+    }
+} // namespace ROS2
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace ROS2
+{
+    //! A robot description to import, as listed in a batch import manifest.
+    struct RobotImportManifestEntry
+    {
+        AZ_TYPE_INFO(RobotImportManifestEntry, "{5E0B8C43-2D7A-4F19-A6E1-93C4B7D2F608}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! URDF, SDF or xacro file, a relative path is resolved against the directory of the manifest.
+        AZStd::string m_filePath;
+        //! Name of the created prefab without extension, the stem of the robot description file is used if empty.
+        AZStd::string m_prefabName;
+        //! Copy the meshes and textures referenced by the robot description into the project.
+        bool m_importAssets = true;
+        //! Create the prefab with articulations instead of rigid bodies and joints.
+        bool m_useArticulations = true;
+        //! Arguments of xacro, used only for xacro files.
+        AZStd::unordered_map<AZStd::string, AZStd::string> m_xacroArguments;
+    };
+
+    //! List of robot descriptions imported by RobotImporterRequest::GeneratePrefabsFromManifest.
+    struct RobotImportManifest
+    {
+        AZ_TYPE_INFO(RobotImportManifest, "{A3F1D926-7B4E-4C05-8E2D-1F6B9A7C3E51}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        AZStd::vector<RobotImportManifestEntry> m_robots;
+    };
+
+    //! Result of the import of a single robot.
+    struct RobotImportReportEntry
+    {
+        AZ_TYPE_INFO(RobotImportReportEntry, "{C8E25B71-0A4D-4F6E-B3C9-5D17E2A8F493}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        AZStd::string m_filePath;
+        AZStd::string m_prefabPath;
+        bool m_succeeded = false;
+        //! Import stage which failed ("Parse" or "Prefab"), empty if the import succeeded.
+        AZStd::string m_failedStage;
+        AZStd::string m_error;
+        AZ::u32 m_assetCount = 0;
+        //! Referenced assets which were not found or failed to build, the prefab is still created without their products.
+        AZStd::vector<AZStd::string> m_failedAssets;
+        double m_parseSeconds = 0.0;
+        double m_assetsSeconds = 0.0;
+        double m_prefabSeconds = 0.0;
+    };
+
+    //! Machine readable report of a batch import.
+    struct RobotImportReport
+    {
+        AZ_TYPE_INFO(RobotImportReport, "{17B6A4E2-95C3-4D8F-A0E7-6C2B1F9D5A38}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        AZ::u32 m_succeededCount = 0;
+        AZ::u32 m_failedCount = 0;
+        double m_totalSeconds = 0.0;
+        AZStd::vector<RobotImportReportEntry> m_robots;
+    };
+
+    //! Imports the robots listed in a manifest without any user interaction.
+    //! Robot descriptions are parsed, their assets are copied and built concurrently on a job manager owned by the import,
+    //! each job waiting on the Asset Processor replies for its own assets. The global job workers are left to the Editor.
+    //! The calling thread keeps processing system tick events while it waits, first for the jobs and then for the asset
+    //! catalog to list the built products. Prefabs are then created one after another on the calling thread,
+    //! since entities and prefab templates can only be created there.
+    class RobotBatchImporter
+    {
+    public:
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Reads a manifest from a JSON file.
+        //! @returns the manifest, or an error message if the file cannot be read
+        static AZ::Outcome<RobotImportManifest, AZStd::string> LoadManifest(const AZ::IO::Path& manifestPath);
+
+        //! Writes a report to a JSON file.
+        //! @returns true if succeed
+        static bool SaveReport(const RobotImportReport& report, const AZ::IO::Path& reportPath);
+
+        //! Imports every robot of the manifest, a failure of one robot does not stop the import of the others.
+        //! @param manifest robots to import
+        //! @param baseDirectory directory against which relative robot description paths are resolved
+        //! @returns report with one entry per robot, in the order of the manifest
+        RobotImportReport Import(const RobotImportManifest& manifest, const AZ::IO::Path& baseDirectory) const;
+    };
+} // namespace ROS2
@@ -318,11 +318,13 @@ namespace ROS2
 
             // Read the SDF Settings from PrefabMakerPage
             const SdfAssetBuilderSettings& sdfBuilderSettings = m_fileSelectPage->GetSdfAssetBuilderSettings();
+            const Utils::ColliderMeshExportMethods colliderMeshExportMethods =
+                Utils::GetColliderMeshExportMethods(m_parsedSdf, sdfBuilderSettings.m_colliderMeshSettings);
 
             if (m_importAssetWithUrdf)
             {
-                m_urdfAssetsMapping =
-                    AZStd::make_shared<Utils::UrdfAssetMap>(Utils::CreateAssetMap(m_assetNames, m_urdfPath.String(), sdfBuilderSettings));
+                m_urdfAssetsMapping = AZStd::make_shared<Utils::UrdfAssetMap>(
+                    Utils::CreateAssetMap(m_assetNames, m_urdfPath.String(), sdfBuilderSettings, colliderMeshExportMethods));
             }
             else
             {
@@ -337,7 +339,15 @@ namespace ROS2
                         bool collider = (assetReferenceType & Utils::ReferencedAssetType::ColliderMesh) == Utils::ReferencedAssetType::ColliderMesh;
                         if (visual || collider)
                         {
-                            Utils::CreateSceneManifest(asset.m_availableAssetInfo.m_sourceAssetGlobalPath, collider, visual);
+                            const auto exportMethodIt = colliderMeshExportMethods.find(assetPath);
+                            const ColliderMeshExportMethod exportMethod = exportMethodIt != colliderMeshExportMethods.end()
+                                ? exportMethodIt->second
+                                : sdfBuilderSettings.m_colliderMeshSettings.m_exportMethod;
+                            Utils::CreateSceneManifest(
+                                asset.m_availableAssetInfo.m_sourceAssetGlobalPath,
+                                collider,
+                                visual,
+                                sdfBuilderSettings.m_colliderMeshSettings.GetExport(exportMethod));
                         }
                     }
                 }
@@ -110,7 +110,7 @@ namespace ROS2
         return articulationLinkConfiguration;
     }
 
-    void ArticulationsMaker::AddArticulationLink(const sdf::Model& model, const sdf::Link* link, AZ::EntityId entityId) const
+    void ArticulationsMaker::AddArticulationLink(const Utils::SdfIndex& sdfIndex, const sdf::Link* link, AZ::EntityId entityId) const
     {
         AZ::Entity* entity = AzToolsFramework::GetEntityById(entityId);
         AZ_Assert(entity, "No entity for id %s", entityId.ToString().c_str());
@@ -120,9 +120,7 @@ namespace ROS2
 
         articulationLinkConfiguration = AddToArticulationConfig(articulationLinkConfiguration, link->Inertial());
 
-        constexpr bool getNestedModelJoints = true;
-        AZStd::string linkName(link->Name().c_str(), link->Name().size());
-        for (const sdf::Joint* joint : Utils::GetJointsForChildLink(model, linkName, getNestedModelJoints))
+        for (const sdf::Joint* joint : sdfIndex.GetJointsForChildLink(*link))
         {
             articulationLinkConfiguration = AddToArticulationConfig(articulationLinkConfiguration, joint);
         }
@@ -12,6 +12,7 @@
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <PhysX/ArticulationTypes.h>
+#include <RobotImporter/Utils/RobotImporterUtils.h>
 
 namespace ROS2
 {
@@ -20,10 +21,10 @@ namespace ROS2
     {
     public:
         //! Add zero or one inertial and joints elements to a given entity (depending on link content).
-        //! @param model SDF model object which can be queried to locate the joints needed to determine if the supplied
-        //!              link is a child link within a joint
+        //! @param sdfIndex index of the SDF document which is queried to locate the joints in which the supplied
+        //!                 link is a child link
         //! @param link A pointer to a parsed SDF link.
         //! @param entityId A non-active entity which will be populated according to inertial content.
-        void AddArticulationLink(const sdf::Model& model, const sdf::Link* link, AZ::EntityId entityId) const;
+        void AddArticulationLink(const Utils::SdfIndex& sdfIndex, const sdf::Link* link, AZ::EntityId entityId) const;
     };
 } // namespace ROS2
@@ -64,10 +64,10 @@ namespace ROS2
         }
     }
 
-    void CollidersMaker::AddColliders(const sdf::Model& model, const sdf::Link* link, AZ::EntityId entityId)
+    void CollidersMaker::AddColliders(const Utils::SdfIndex& sdfIndex, const sdf::Link* link, AZ::EntityId entityId)
     {
         AZStd::string typeString = "collider";
-        const bool isWheelEntity = Utils::IsWheelURDFHeuristics(model, link);
+        const bool isWheelEntity = Utils::IsWheelURDFHeuristics(sdfIndex, link);
         if (isWheelEntity)
         {
             AZ_Printf(Internal::CollidersMakerLoggingTag, "Due to its name, %s is considered a wheel entity\n", link->Name().c_str());
@@ -87,6 +87,11 @@ namespace ROS2
         }
     }
 
+    void CollidersMaker::SetProductAssetIds(const AZStd::shared_ptr<const Utils::ProductAssetIdMap>& productAssetIds)
+    {
+        m_productAssetIds = productAssetIds;
+    }
+
     void CollidersMaker::AddCollider(
         const sdf::Collision* collision,
         AZ::EntityId entityId,
@@ -134,7 +139,9 @@ namespace ROS2
                 return;
             }
 
-            AZ::Data::AssetId assetId = Utils::GetPhysXMeshProductAssetId(asset->m_sourceGuid);
+            const auto* productAssetIds = PrefabMakerUtils::FindProductAssetIds(m_productAssetIds.get(), asset->m_sourceGuid);
+            AZ::Data::AssetId assetId =
+                productAssetIds ? productAssetIds->m_physXMeshAssetId : Utils::GetPhysXMeshProductAssetId(asset->m_sourceGuid);
             if (!assetId.IsValid())
             {
                 AZ_Error(
@@ -20,6 +20,7 @@
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Physics/Material/PhysicsMaterialId.h>
 #include <AzFramework/Physics/Material/PhysicsMaterialManager.h>
+#include <RobotImporter/Utils/RobotImporterUtils.h>
 #include <RobotImporter/Utils/SourceAssetsStorage.h>
 
 namespace ROS2
@@ -38,10 +39,13 @@ namespace ROS2
         CollidersMaker(const CollidersMaker& other) = delete;
 
         //! Add zero, one or many collider elements (depending on link content).
-        //! @param model An SDF model object provided by libsdformat from a parsed URDF/SDF
+        //! @param sdfIndex index of the SDF document containing the link, used to query its joints
         //! @param link A parsed SDF tree link node which could hold information about colliders.
         //! @param entityId A non-active entity which will be affected.
-        void AddColliders(const sdf::Model& model, const sdf::Link* link, AZ::EntityId entityId);
+        void AddColliders(const Utils::SdfIndex& sdfIndex, const sdf::Link* link, AZ::EntityId entityId);
+        //! Set product asset IDs resolved ahead of entity creation, source assets missing from the map are looked up one by one.
+        //! @param productAssetIds Product asset IDs of the source assets used by the robot description.
+        void SetProductAssetIds(const AZStd::shared_ptr<const Utils::ProductAssetIdMap>& productAssetIds);
         //! Sends meshes required for colliders to asset processor.
         //! @param buildReadyCb Function to call when the processing finishes.
         void ProcessMeshes(BuildReadyCallback notifyBuildReadyCb);
@@ -58,5 +62,6 @@ namespace ROS2
 
         AZ::Data::Asset<Physics::MaterialAsset> m_wheelMaterial;
         AZStd::shared_ptr<Utils::UrdfAssetMap> m_urdfAssetsMapping;
+        AZStd::shared_ptr<const Utils::ProductAssetIdMap> m_productAssetIds;
     };
 } // namespace ROS2
@@ -10,8 +10,11 @@
 #include "RobotImporter/Utils/TypeConversions.h"
 #include <AzCore/Math/Quaternion.h>
 #include <AzCore/Utils/Utils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzToolsFramework/API/EditorAssetSystemAPI.h>
+#include <AzToolsFramework/API/EntityCompositionRequestBus.h>
 #include <AzToolsFramework/Entity/EditorEntityHelpers.h>
 #include <AzToolsFramework/Entity/EntityUtilityComponent.h>
 #include <AzToolsFramework/Prefab/PrefabFocusPublicInterface.h>
@@ -130,6 +133,90 @@ namespace ROS2::PrefabMakerUtils
         return SetEntityParentInternal(entityId, parentEntityId, useLocalTransform);
     }
 
+    static bool HasComponentOfType(const AZ::Entity& entity, const AZ::Uuid& componentType)
+    {
+        // Game components are wrapped by the editor, so the type of the wrapped component is compared.
+        return AZStd::any_of(
+            entity.GetComponents().begin(),
+            entity.GetComponents().end(),
+            [&componentType](const AZ::Component* component)
+            {
+                return AzToolsFramework::GetUnderlyingComponentType(*component) == componentType;
+            });
+    }
+
+    DeferredComponentBatch::~DeferredComponentBatch()
+    {
+        CreateComponents();
+    }
+
+    void DeferredComponentBatch::AddComponent(AZ::EntityId entityId, const AZ::Uuid& componentType, ComponentCreatedCallback onCreated)
+    {
+        m_deferredComponents.push_back({ entityId, componentType, AZStd::move(onCreated) });
+    }
+
+    void DeferredComponentBatch::CreateComponents()
+    {
+        if (m_deferredComponents.empty())
+        {
+            return;
+        }
+
+        // Group the entities by component type, in the order the types were first requested.
+        AZStd::vector<AZ::Uuid> componentTypes;
+        AZStd::unordered_map<AZ::Uuid, AZStd::vector<AZ::EntityId>> entitiesByComponentType;
+        for (const auto& deferredComponent : m_deferredComponents)
+        {
+            const AZ::Entity* entity = AzToolsFramework::GetEntityById(deferredComponent.m_entityId);
+            if (entity == nullptr || HasComponentOfType(*entity, deferredComponent.m_componentType))
+            {
+                continue;
+            }
+
+            auto [entitiesIt, inserted] = entitiesByComponentType.try_emplace(deferredComponent.m_componentType);
+            if (inserted)
+            {
+                componentTypes.push_back(deferredComponent.m_componentType);
+            }
+            if (AZStd::find(entitiesIt->second.begin(), entitiesIt->second.end(), deferredComponent.m_entityId) == entitiesIt->second.end())
+            {
+                entitiesIt->second.push_back(deferredComponent.m_entityId);
+            }
+        }
+
+        for (const AZ::Uuid& componentType : componentTypes)
+        {
+            const AZ::ComponentTypeList componentsToAdd{ componentType };
+            const AZStd::vector<AZ::EntityId>& entityIds = entitiesByComponentType[componentType];
+            AzToolsFramework::EntityCompositionRequests::AddComponentsOutcome addComponentsOutcome = AZ::Failure(AZStd::string());
+            AzToolsFramework::EntityCompositionRequestBus::BroadcastResult(
+                addComponentsOutcome, &AzToolsFramework::EntityCompositionRequests::AddComponentsToEntities, entityIds, componentsToAdd);
+            AZ_Warning(
+                "PrefabMakerUtils",
+                addComponentsOutcome.IsSuccess(),
+                "Failed to create component %s for %zu entities : %s",
+                componentType.ToString<AZStd::string>().c_str(),
+                entityIds.size(),
+                addComponentsOutcome.IsSuccess() ? "" : addComponentsOutcome.GetError().c_str());
+        }
+
+        // Components which could not be added, for example because of missing dependencies, are not configured.
+        auto deferredComponents = AZStd::move(m_deferredComponents);
+        m_deferredComponents.clear();
+        for (auto& deferredComponent : deferredComponents)
+        {
+            AZ::Entity* entity = AzToolsFramework::GetEntityById(deferredComponent.m_entityId);
+            if (entity == nullptr || !HasComponentOfType(*entity, deferredComponent.m_componentType))
+            {
+                continue;
+            }
+            if (deferredComponent.m_onCreated)
+            {
+                deferredComponent.m_onCreated(*entity);
+            }
+        }
+    }
+
     void AddRequiredComponentsToEntity(AZ::EntityId entityId)
     {
         AZ::Entity* entity = AzToolsFramework::GetEntityById(entityId);
@@ -160,4 +247,15 @@ namespace ROS2::PrefabMakerUtils
         return GetAssetFromPath(urdfAssetsMapping, AZStd::string(urdfMeshPath.c_str(), urdfMeshPath.size()));
     }
 
+    const Utils::ProductAssetIds* FindProductAssetIds(const Utils::ProductAssetIdMap* productAssetIds, const AZ::Uuid& sourceGuid)
+    {
+        if (productAssetIds == nullptr)
+        {
+            return nullptr;
+        }
+
+        const auto productIt = productAssetIds->find(sourceGuid);
+        return productIt != productAssetIds->end() ? &productIt->second : nullptr;
+    }
+
 } // namespace ROS2::PrefabMakerUtils
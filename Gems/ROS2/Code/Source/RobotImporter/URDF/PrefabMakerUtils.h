@@ -9,7 +9,10 @@
 #pragma once
 
 #include "UrdfParser.h"
+#include <AzCore/Component/ComponentBus.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_template.h>
 #include <AzCore/std/optional.h>
 #include <AzCore/std/string/string.h>
 #include <RobotImporter/Utils/SourceAssetsStorage.h>
@@ -19,6 +22,43 @@
 //! Common utils for Prefab Maker classes
 namespace ROS2::PrefabMakerUtils
 {
+    //! Defers the creation of components which are added through the editor entity composition requests.
+    //! Every request to add or remove components through the editor records an undo step, refreshes the property
+    //! editor and resolves the dependencies of the entity. Components deferred with AddComponent are instead
+    //! created with a single request per component type for all entities, when CreateComponents is called
+    //! or the batch goes out of scope.
+    class DeferredComponentBatch
+    {
+    public:
+        //! Callback invoked with the entity once it has the requested component.
+        using ComponentCreatedCallback = AZStd::function<void(AZ::Entity& entity)>;
+
+        DeferredComponentBatch() = default;
+        ~DeferredComponentBatch();
+        AZ_DISABLE_COPY_MOVE(DeferredComponentBatch);
+
+        //! Defer adding a component to an entity.
+        //! The component is not added if the entity already has a component of the type when the components are created,
+        //! the callback is then invoked with the existing component.
+        //! @param entityId entity that will own the component.
+        //! @param componentType Uuid of the component to create.
+        //! @param onCreated optional callback used to configure the component once it exists.
+        void AddComponent(AZ::EntityId entityId, const AZ::Uuid& componentType, ComponentCreatedCallback onCreated = {});
+
+        //! Create all deferred components.
+        void CreateComponents();
+
+    private:
+        struct DeferredComponent
+        {
+            AZ::EntityId m_entityId;
+            AZ::Uuid m_componentType;
+            ComponentCreatedCallback m_onCreated;
+        };
+
+        AZStd::vector<DeferredComponent> m_deferredComponents;
+    };
+
     //! Add required components to the entity.
     //! Calling this will ensure all the required (default) components are added.
     //! @param entityId entity to modify.
@@ -72,4 +112,10 @@ namespace ROS2::PrefabMakerUtils
     //! Get Asset from path. Version for std::string.
     //! @see GetAssetFromPath.
     AZStd::optional<Utils::AvailableAsset> GetAssetFromPath(const Utils::UrdfAssetMap& sdfAssetsMapping, const std::string& sdfMeshPath);
+
+    //! Find the product asset IDs of a source asset, resolved ahead by Utils::GetProductAssetIds.
+    //! @param productAssetIds resolved product asset IDs, may be nullptr.
+    //! @param sourceGuid GUID of the source asset.
+    //! @return product asset IDs, nullptr if the source asset was not resolved ahead.
+    const Utils::ProductAssetIds* FindProductAssetIds(const Utils::ProductAssetIdMap* productAssetIds, const AZ::Uuid& sourceGuid);
 } // namespace ROS2::PrefabMakerUtils
@@ -64,118 +64,9 @@ namespace ROS2
             return AZ::Failure(AZStd::string("URDF/SDF doesn't contain any models."));
         }
 
-        // Visit any nested models in the SDF as well
-        constexpr bool visitNestedModels = true;
-
-        // Maintains references to all joints and a mapping from the joints to their parent and child links
-        struct JointsMapper
-        {
-            struct JointToAttachedModel
-            {
-                AZStd::string m_fullyQualifiedName;
-                const sdf::Joint* m_joint{};
-                const sdf::Model* m_attachedModel{};
-            };
-            // this is a unique ordered vector
-            AZStd::vector<JointToAttachedModel> m_joints;
-            AZStd::unordered_map<const sdf::Joint*, const sdf::Link*> m_jointToParentLinks;
-            AZStd::unordered_map<const sdf::Joint*, const sdf::Link*> m_jointToChildLinks;
-        };
-        JointsMapper jointsMapper;
-        auto GetAllJointsFromModel = [&jointsMapper](const sdf::Model& model, const Utils::ModelStack&) -> Utils::VisitModelResponse
-        {
-            // As the VisitModels function visits nested models by default, gatherNestedModelJoints is set to false
-            constexpr bool gatherNestedModelJoints = false;
-            auto jointsForModel = Utils::GetAllJoints(model, gatherNestedModelJoints);
-            for (const auto& [fullyQualifiedName, joint] : jointsForModel)
-            {
-                JointsMapper::JointToAttachedModel jointToAttachedModel{
-                    AZStd::string(fullyQualifiedName.c_str(), fullyQualifiedName.size()), joint, &model
-                };
-                jointsMapper.m_joints.push_back(AZStd::move(jointToAttachedModel));
-
-                // add mapping from joint to child link
-                std::string childName = joint->ChildName();
-                if (const sdf::Link* link = model.LinkByName(childName); link != nullptr)
-                {
-                    // Add a mapping of joint to child link
-                    jointsMapper.m_jointToChildLinks[joint] = link;
-                }
-
-                // add mapping from joint to parent link
-                std::string parentName = joint->ParentName();
-                if (const sdf::Link* link = model.LinkByName(parentName); link != nullptr)
-                {
-                    jointsMapper.m_jointToParentLinks[joint] = link;
-                }
-            }
-
-            return Utils::VisitModelResponse::VisitNestedAndSiblings;
-        };
-        // Gather all Joints in SDF including in nested models
-        Utils::VisitModels(*m_root, GetAllJointsFromModel, visitNestedModels);
-
-        // Maintains references to all Links in the SDF and a mapping of links to the model it is attached to
-        struct LinksMapper
-        {
-            struct LinkToAttachedModel
-            {
-                AZStd::string m_fullyQualifiedName;
-                const sdf::Link* m_link{};
-                const sdf::Model* m_attachedModel{};
-            };
-            // this is a unique ordered vector
-            AZStd::vector<LinkToAttachedModel> m_links;
-        };
-        LinksMapper linksMapper;
-
-        struct ModelMapper
-        {
-            struct NestedModelToAttachedModel
-            {
-                AZStd::string m_fullyQualifiedName;
-                const sdf::Model* m_nestedModel{};
-                const sdf::Model* m_attachedModel{};
-            };
-            // this is a unique ordered vector
-            AZStd::vector<NestedModelToAttachedModel> m_models;
-        };
-        ModelMapper modelMapper;
-
-        auto GetAllLinksAndSetModelHierarchy = [&linksMapper, &modelMapper](const sdf::Model& model, const Utils::ModelStack& modelStack) -> Utils::VisitModelResponse
-        {
-            // As the VisitModels function visits nested models by default, gatherNestedModelLinks is set to false
-            constexpr bool gatherNestedModelLinks = false;
-            auto linksForModel = Utils::GetAllLinks(model, gatherNestedModelLinks);
-            for (const auto& [fullyQualifiedName, link] : linksForModel)
-            {
-                // Push back the mapping of link to attached model into the ordered vector
-                AZStd::string fullLinkName(fullyQualifiedName.c_str(), fullyQualifiedName.size());
-                LinksMapper::LinkToAttachedModel linkToAttachedModel{ AZStd::move(fullLinkName), link, &model };
-                linksMapper.m_links.push_back(AZStd::move(linkToAttachedModel));
-            }
-
-            // Use the model stack to create a mapping from the current model
-            // to the parent model it is attached to.
-            // If the current model has no parent model the attached model is set to nullptr
-            std::string stdFullModelName;
-            for (const sdf::Model& ancestorModel : modelStack)
-            {
-                stdFullModelName = sdf::JoinName(stdFullModelName, ancestorModel.Name());
-            }
-            stdFullModelName = sdf::JoinName(stdFullModelName, model.Name());
-            AZStd::string fullModelName(stdFullModelName.c_str(), stdFullModelName.size());
-            ModelMapper::NestedModelToAttachedModel nestedModelToAttachedModel;
-            nestedModelToAttachedModel.m_fullyQualifiedName = AZStd::move(fullModelName);
-            nestedModelToAttachedModel.m_nestedModel = &model;
-            nestedModelToAttachedModel.m_attachedModel = !modelStack.empty() ? &modelStack.back().get() : nullptr;
-            modelMapper.m_models.push_back(AZStd::move(nestedModelToAttachedModel));
-
-            return Utils::VisitModelResponse::VisitNestedAndSiblings;
-        };
-
-        // Gather all links and add a mapping of nested model -> parent model for each model in the SDF
-        Utils::VisitModels(*m_root, GetAllLinksAndSetModelHierarchy, visitNestedModels);
+        // Index all models, links and joints in the SDF including nested models once,
+        // so that the lookups done per link and per joint below do not traverse the SDF again
+        const Utils::SdfIndex sdfIndex(*m_root);
 
         // Build up a list of all entities created as a part of processing the file.
         AZStd::vector<AZ::EntityId> createdEntities;
@@ -185,7 +76,7 @@ namespace ROS2
         AZStd::unordered_map<AZStd::string, const sdf::Link*> links;
 
         // Create an entity for each model
-        for ([[maybe_unused]] const auto& [fullModelName, modelPtr, _] : modelMapper.m_models)
+        for ([[maybe_unused]] const auto& [fullModelName, modelPtr, _] : sdfIndex.GetModels())
         {
             // Create entities for each model in the SDF
             if (AzToolsFramework::Prefab::PrefabEntityResult createModelEntityResult = CreateEntityForModel(*modelPtr);
@@ -204,7 +95,7 @@ namespace ROS2
         }
 
         //! Setup the parent hierarchy for the nested models
-        for ([[maybe_unused]] const auto& [_, modelPtr, parentModelPtr] : modelMapper.m_models)
+        for ([[maybe_unused]] const auto& [_, modelPtr, parentModelPtr] : sdfIndex.GetModels())
         {
             // If there is no parent model, then the model would be at the top level of the hiearachy
             if (parentModelPtr == nullptr || modelPtr == nullptr)
@@ -234,8 +125,20 @@ namespace ROS2
             }
         }
 
-        // Create an entity for each link and set the parent to be the model entity where the link is attached
-        for ([[maybe_unused]] const auto& [_, linkPtr, attachedModel] : linksMapper.m_links)
+        // Asset lookups and component configurations of all links are prepared up front in parallel,
+        // so that only the creation of entities and components below runs serially.
+        AZStd::vector<const sdf::Link*> allLinks;
+        allLinks.reserve(sdfIndex.GetLinks().size());
+        for ([[maybe_unused]] const auto& [_, linkPtr, attachedModel] : sdfIndex.GetLinks())
+        {
+            allLinks.push_back(linkPtr);
+        }
+        PrepareLinks(allLinks);
+
+        // Create an entity for each link and set the parent to be the model entity where the link is attached.
+        // Components added through the editor requests are created together once all link entities exist.
+        PrefabMakerUtils::DeferredComponentBatch linkComponentBatch;
+        for ([[maybe_unused]] const auto& [_, linkPtr, attachedModel] : sdfIndex.GetLinks())
         {
             AZ::EntityId modelEntityId;
             if (attachedModel != nullptr)
@@ -249,7 +152,19 @@ namespace ROS2
                 }
             }
             // Add all link as children of their attached model entity by default
-            createdLinks[linkPtr] = AddEntitiesForLink(*linkPtr, attachedModel, modelEntityId, createdEntities);
+            createdLinks[linkPtr] =
+                AddEntitiesForLink(sdfIndex, *linkPtr, modelEntityId, createdEntities, linkComponentBatch);
+        }
+        linkComponentBatch.CreateComponents();
+
+        // Sensor components require the ROS2 frame of their link entity, so sensors are added once the deferred frames exist.
+        for ([[maybe_unused]] const auto& [_, linkPtr, attachedModel] : sdfIndex.GetLinks())
+        {
+            if (const auto linkIt = createdLinks.find(linkPtr);
+                attachedModel != nullptr && linkIt != createdLinks.end() && linkIt->second.IsSuccess())
+            {
+                m_sensorsMaker.AddSensors(*attachedModel, linkPtr, linkIt->second.GetValue());
+            }
         }
 
         for (const auto& [linkPtr, result] : createdLinks)
@@ -273,7 +188,7 @@ namespace ROS2
         }
 
         // Set the transforms of links
-        for ([[maybe_unused]] const auto& [fullLinkName, linkPtr, _] : linksMapper.m_links)
+        for ([[maybe_unused]] const auto& [fullLinkName, linkPtr, _] : sdfIndex.GetLinks())
         {
             if (const auto createLinkEntityResult = createdLinks.at(linkPtr); createLinkEntityResult.IsSuccess())
             {
@@ -313,10 +228,9 @@ namespace ROS2
 
         // Set the hierarchy
         AZStd::vector<AZ::EntityId> linkEntityIdsWithoutParent;
-        for (const auto& [fullLinkName, linkPtr, attachedModel] : linksMapper.m_links)
+        for ([[maybe_unused]] const auto& [fullLinkName, linkPtr, attachedModel] : sdfIndex.GetLinks())
         {
             std::string linkName = linkPtr->Name();
-            AZStd::string azLinkName(linkName.c_str(), linkName.size());
             const auto linkPrefabResult = createdLinks.at(linkPtr);
             if (!linkPrefabResult.IsSuccess())
             {
@@ -324,9 +238,7 @@ namespace ROS2
                 continue;
             }
 
-            AZStd::vector<const sdf::Joint*> jointsWhereLinkIsChild;
-            bool gatherNestedModelJoints = true;
-            jointsWhereLinkIsChild = Utils::GetJointsForChildLink(*attachedModel, azLinkName, gatherNestedModelJoints);
+            const AZStd::vector<const sdf::Joint*>& jointsWhereLinkIsChild = sdfIndex.GetJointsForChildLink(*linkPtr);
 
             if (jointsWhereLinkIsChild.empty())
             {
@@ -359,11 +271,10 @@ namespace ROS2
             std::string parentLinkName = joint->ParentName();
             AZStd::string parentName(parentLinkName.c_str(), parentLinkName.size());
 
-            // Lookup the entity created from the parent link using the JointMapper to locate the parent SDF link.
+            // Lookup the entity created from the parent link using the SDF index to locate the parent SDF link.
             // followed by using SDF link address to lookup the O3DE created entity ID
-            auto parentLinkIter = jointsMapper.m_jointToParentLinks.find(joint);
-            auto parentEntityIter =
-                parentLinkIter != jointsMapper.m_jointToParentLinks.end() ? createdLinks.find(parentLinkIter->second) : createdLinks.end();
+            const sdf::Link* parentLink = sdfIndex.GetParentLink(*joint);
+            auto parentEntityIter = parentLink != nullptr ? createdLinks.find(parentLink) : createdLinks.end();
             if (parentEntityIter == createdLinks.end())
             {
                 AZ_Trace("CreatePrefabFromUrdfOrSdf", "Link %s has invalid parent name %s\n", linkName.c_str(), parentName.c_str());
@@ -391,7 +302,7 @@ namespace ROS2
         }
 
         // Iterate over all the joints and locate the entity associated with the link
-        for ([[maybe_unused]] const auto& [fullJointName, jointPtr, _] : jointsMapper.m_joints)
+        for ([[maybe_unused]] const auto& [fullJointName, jointPtr, attachedModel, parentLink, childLink] : sdfIndex.GetJoints())
         {
             std::string jointName = jointPtr->Name();
             AZStd::string azJointName(jointName.c_str(), jointName.size());
@@ -400,9 +311,7 @@ namespace ROS2
 
             // Look up the O3DE created entity by first locating the parent SDF link associated with the current joint
             // and then using that SDF link to lookup the created entity
-            auto parentLinkIter = jointsMapper.m_jointToParentLinks.find(jointPtr);
-            auto parentEntityIter =
-                parentLinkIter != jointsMapper.m_jointToParentLinks.end() ? createdLinks.find(parentLinkIter->second) : createdLinks.end();
+            auto parentEntityIter = parentLink != nullptr ? createdLinks.find(parentLink) : createdLinks.end();
             if (parentEntityIter == createdLinks.end())
             {
                 AZ_Warning(
@@ -416,9 +325,7 @@ namespace ROS2
             auto leadEntity = parentEntityIter->second;
 
             // Use the joint to lookup the child SDF link which is used to look up the O3DE entity
-            auto childLinkIter = jointsMapper.m_jointToChildLinks.find(jointPtr);
-            auto childEntityIter =
-                childLinkIter != jointsMapper.m_jointToChildLinks.end() ? createdLinks.find(childLinkIter->second) : createdLinks.end();
+            auto childEntityIter = childLink != nullptr ? createdLinks.find(childLink) : createdLinks.end();
             if (childEntityIter == createdLinks.end())
             {
                 AZ_Warning(
@@ -590,7 +497,11 @@ namespace ROS2
     }
 
     AzToolsFramework::Prefab::PrefabEntityResult URDFPrefabMaker::AddEntitiesForLink(
-        const sdf::Link& link, const sdf::Model* attachedModel, AZ::EntityId parentEntityId, AZStd::vector<AZ::EntityId>& createdEntities)
+        const Utils::SdfIndex& sdfIndex,
+        const sdf::Link& link,
+        AZ::EntityId parentEntityId,
+        AZStd::vector<AZ::EntityId>& createdEntities,
+        PrefabMakerUtils::DeferredComponentBatch& componentBatch)
     {
         auto createEntityResult = PrefabMakerUtils::CreateEntity(parentEntityId, link.Name().c_str());
         if (!createEntityResult.IsSuccess())
@@ -598,17 +509,18 @@ namespace ROS2
             return createEntityResult;
         }
         AZ::EntityId entityId = createEntityResult.GetValue();
-        AZ::Entity* entity = AzToolsFramework::GetEntityById(entityId);
 
         createdEntities.emplace_back(entityId);
 
-        const auto frameComponentId = Utils::CreateComponent(entityId, ROS2FrameComponent::TYPEINFO_Uuid());
-        if (frameComponentId)
-        {
-            auto* component = Utils::GetGameOrEditorComponent<ROS2FrameComponent>(entity);
-            AZ_Assert(component, "ROS2 Frame Component does not exist for %s", entityId.ToString().c_str());
-            component->SetFrameID(AZStd::string(link.Name().c_str(), link.Name().size()));
-        }
+        componentBatch.AddComponent(
+            entityId,
+            ROS2FrameComponent::TYPEINFO_Uuid(),
+            [frameId = AZStd::string(link.Name().c_str(), link.Name().size())](AZ::Entity& entity)
+            {
+                auto* component = Utils::GetGameOrEditorComponent<ROS2FrameComponent>(&entity);
+                AZ_Assert(component, "ROS2 Frame Component does not exist for %s", entity.GetId().ToString().c_str());
+                component->SetFrameID(frameId);
+            });
         auto createdVisualEntities = m_visualsMaker.AddVisuals(&link, entityId);
         createdEntities.insert(createdEntities.end(), createdVisualEntities.begin(), createdVisualEntities.end());
 
@@ -618,18 +530,33 @@ namespace ROS2
         }
         else
         {
-            if (attachedModel != nullptr)
-            {
-                m_articulationsMaker.AddArticulationLink(*attachedModel, &link, entityId);
-            }
+            m_articulationsMaker.AddArticulationLink(sdfIndex, &link, entityId);
         }
 
-        if (attachedModel != nullptr)
+        m_collidersMaker.AddColliders(sdfIndex, &link, entityId);
+        return AZ::Success(entityId);
+    }
+
+    void URDFPrefabMaker::PrepareLinks(const AZStd::vector<const sdf::Link*>& links)
+    {
+        // Every source asset referenced by the robot description is resolved in a single batch ahead of the visuals and colliders.
+        AZStd::unordered_set<AZ::Uuid> sourceGuids;
+        if (m_urdfAssetsMapping)
         {
-            m_collidersMaker.AddColliders(*attachedModel, &link, entityId);
-            m_sensorsMaker.AddSensors(*attachedModel, &link, entityId);
+            for ([[maybe_unused]] const auto& [_, urdfAsset] : *m_urdfAssetsMapping)
+            {
+                if (!urdfAsset.m_availableAssetInfo.m_sourceGuid.IsNull())
+                {
+                    sourceGuids.insert(urdfAsset.m_availableAssetInfo.m_sourceGuid);
+                }
+            }
         }
-        return AZ::Success(entityId);
+        AZStd::shared_ptr<const Utils::ProductAssetIdMap> productAssetIds =
+            AZStd::make_shared<Utils::ProductAssetIdMap>(Utils::GetProductAssetIds(sourceGuids));
+        m_visualsMaker.SetProductAssetIds(productAssetIds);
+        m_collidersMaker.SetProductAssetIds(productAssetIds);
+
+        m_visualsMaker.PrepareVisuals(links);
     }
 
     void URDFPrefabMaker::AddRobotControl(AZ::EntityId rootEntityId)
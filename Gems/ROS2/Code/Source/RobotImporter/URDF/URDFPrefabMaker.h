@@ -12,6 +12,7 @@
 #include "CollidersMaker.h"
 #include "InertialsMaker.h"
 #include "JointsMaker.h"
+#include "PrefabMakerUtils.h"
 #include "SensorsMaker.h"
 #include "UrdfParser.h"
 #include "VisualsMaker.h"
@@ -71,7 +72,14 @@ namespace ROS2
 
     private:
         AzToolsFramework::Prefab::PrefabEntityResult CreateEntityForModel(const sdf::Model& model);
-        AzToolsFramework::Prefab::PrefabEntityResult AddEntitiesForLink(const sdf::Link& link, const sdf::Model* attachedModel, AZ::EntityId parentEntityId, AZStd::vector<AZ::EntityId>& createdEntities);
+        AzToolsFramework::Prefab::PrefabEntityResult AddEntitiesForLink(
+            const Utils::SdfIndex& sdfIndex,
+            const sdf::Link& link,
+            AZ::EntityId parentEntityId,
+            AZStd::vector<AZ::EntityId>& createdEntities,
+            PrefabMakerUtils::DeferredComponentBatch& componentBatch);
+        //! Resolves product assets and prepares component configurations of all links in parallel before any entity is created.
+        void PrepareLinks(const AZStd::vector<const sdf::Link*>& links);
         void AddRobotControl(AZ::EntityId rootEntityId);
         static void MoveEntityToDefaultSpawnPoint(const AZ::EntityId& rootEntityId, AZStd::optional<AZ::Transform> spawnPosition);
 
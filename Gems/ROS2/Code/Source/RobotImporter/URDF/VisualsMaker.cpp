@@ -18,6 +18,9 @@
 #include <AtomLyIntegration/CommonFeatures/Mesh/MeshComponentConstants.h>
 #include <AzCore/Component/NonUniformScaleBus.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzToolsFramework/Entity/EditorEntityHelpers.h>
 #include <AzToolsFramework/ToolsComponents/EditorNonUniformScaleComponent.h>
 
@@ -99,13 +102,32 @@ namespace ROS2
 
     AZ::Data::AssetId VisualsMaker::AddVisualToEntity(const sdf::Visual* visual, AZ::EntityId entityId) const
     {
-        // Asset ID for the asset added to the visual entity, if any.
-        AZ::Data::AssetId assetId;
-
         // Apply transform as per origin
         PrefabMakerUtils::SetEntityTransformLocal(visual->RawPose(), entityId);
 
-        auto geometry = visual->Geom();
+        AZStd::optional<VisualAsset> visualAsset;
+        if (auto preparedIt = m_preparedVisualAssets.find(visual); preparedIt != m_preparedVisualAssets.end())
+        {
+            visualAsset = preparedIt->second;
+        }
+        else
+        {
+            visualAsset = FindVisualAsset(visual->Geom());
+        }
+
+        if (!visualAsset.has_value())
+        {
+            return {};
+        }
+
+        AddVisualAssetToEntity(entityId, visualAsset->m_assetId, visualAsset->m_scale);
+        // Asset ID for the asset added to the visual entity, if any.
+        return visualAsset->m_assetId;
+    }
+
+    AZStd::optional<VisualsMaker::VisualAsset> VisualsMaker::FindVisualAsset(const sdf::Geometry* geometry) const
+    {
+        VisualAsset visualAsset;
         switch (geometry->Type())
         {
         case sdf::GeometryType::SPHERE:
@@ -113,19 +135,17 @@ namespace ROS2
                 auto sphereGeometry = geometry->SphereShape();
                 AZ_Assert(sphereGeometry, "geometry is not Sphere");
                 // Convert radius to diameter: the `_sphere_1x1.fbx.azmodel` model has a diameter of 1
-                const AZ::Vector3 sphereDimensions(sphereGeometry->Radius() * 2.0f);
+                visualAsset.m_scale = AZ::Vector3(sphereGeometry->Radius() * 2.0f);
 
                 // The `_sphere_1x1.fbx.azmodel` is created by Asset Processor based on O3DE `PrimitiveAssets` Gem source.
                 const char* sphereAssetRelPath = "objects/_primitives/_sphere_1x1.fbx.azmodel"; // relative path to cache folder.
                 AZ::Data::AssetCatalogRequestBus::BroadcastResult(
-                    assetId,
+                    visualAsset.m_assetId,
                     &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath,
                     sphereAssetRelPath,
                     AZ::Data::s_invalidAssetType,
                     false);
-                AZ_Warning("AddVisual", assetId.IsValid(), "There is no product asset for %s.", sphereAssetRelPath);
-
-                AddVisualAssetToEntity(entityId, assetId, sphereDimensions);
+                AZ_Warning("AddVisual", visualAsset.m_assetId.IsValid(), "There is no product asset for %s.", sphereAssetRelPath);
             }
             break;
         case sdf::GeometryType::CYLINDER:
@@ -133,65 +153,70 @@ namespace ROS2
                 auto cylinderGeometry = geometry->CylinderShape();
                 AZ_Assert(cylinderGeometry, "geometry is not Cylinder");
                 // Convert radius to diameter: the `_cylinder_1x1.fbx.azmodel` model has a diameter of 1
-                const AZ::Vector3 cylinderDimensions(
+                visualAsset.m_scale = AZ::Vector3(
                     cylinderGeometry->Radius() * 2.0f, cylinderGeometry->Radius() * 2.0f, cylinderGeometry->Length());
 
                 // The `_cylinder_1x1.fbx.azmodel` is created by Asset Processor based on O3DE `PrimitiveAssets` Gem source.
                 const char* cylinderAssetRelPath = "objects/_primitives/_cylinder_1x1.fbx.azmodel"; // relative path to cache folder.
                 AZ::Data::AssetCatalogRequestBus::BroadcastResult(
-                    assetId,
+                    visualAsset.m_assetId,
                     &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath,
                     cylinderAssetRelPath,
                     AZ::Data::s_invalidAssetType,
                     false);
-                AZ_Warning("AddVisual", assetId.IsValid(), "There is no product asset for %s.", cylinderAssetRelPath);
-
-                AddVisualAssetToEntity(entityId, assetId, cylinderDimensions);
+                AZ_Warning("AddVisual", visualAsset.m_assetId.IsValid(), "There is no product asset for %s.", cylinderAssetRelPath);
             }
             break;
         case sdf::GeometryType::BOX:
             {
                 auto boxGeometry = geometry->BoxShape();
                 AZ_Assert(boxGeometry, "geometry is not Box");
-                const AZ::Vector3 boxDimensions = URDF::TypeConversions::ConvertVector3(boxGeometry->Size());
+                visualAsset.m_scale = URDF::TypeConversions::ConvertVector3(boxGeometry->Size());
 
                 // The `_box_1x1.fbx.azmodel` is created by Asset Processor based on O3DE `PrimitiveAssets` Gem source.
                 const char* boxAssetRelPath = "objects/_primitives/_box_1x1.fbx.azmodel"; // relative path to cache folder.
                 AZ::Data::AssetCatalogRequestBus::BroadcastResult(
-                    assetId,
+                    visualAsset.m_assetId,
                     &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath,
                     boxAssetRelPath,
                     AZ::Data::s_invalidAssetType,
                     false);
-                AZ_Warning("AddVisual", assetId.IsValid(), "There is no product asset for %s.", boxAssetRelPath);
-
-                AddVisualAssetToEntity(entityId, assetId, boxDimensions);
+                AZ_Warning("AddVisual", visualAsset.m_assetId.IsValid(), "There is no product asset for %s.", boxAssetRelPath);
             }
             break;
         case sdf::GeometryType::MESH:
             {
                 auto meshGeometry = geometry->MeshShape();
                 AZ_Assert(meshGeometry, "geometry is not Mesh");
-                const AZ::Vector3 scaleVector = URDF::TypeConversions::ConvertVector3(meshGeometry->Scale());
+                visualAsset.m_scale = URDF::TypeConversions::ConvertVector3(meshGeometry->Scale());
 
                 const auto asset = PrefabMakerUtils::GetAssetFromPath(*m_urdfAssetsMapping, AZStd::string(meshGeometry->Uri().c_str()));
                 AZ_Warning("AddVisual", asset, "There is no source asset for %s.", meshGeometry->Uri().c_str());
 
                 if (asset)
                 {
-                    assetId = Utils::GetModelProductAssetId(asset->m_sourceGuid);
-                    AZ_Warning("AddVisual", assetId.IsValid(), "There is no product asset for %s.", asset->m_sourceAssetRelativePath.c_str());
+                    if (const auto* productAssetIds = PrefabMakerUtils::FindProductAssetIds(m_productAssetIds.get(), asset->m_sourceGuid))
+                    {
+                        visualAsset.m_assetId = productAssetIds->m_modelAssetId;
+                    }
+                    else
+                    {
+                        visualAsset.m_assetId = Utils::GetModelProductAssetId(asset->m_sourceGuid);
+                    }
+                    AZ_Warning(
+                        "AddVisual",
+                        visualAsset.m_assetId.IsValid(),
+                        "There is no product asset for %s.",
+                        asset->m_sourceAssetRelativePath.c_str());
                 }
-
-                AddVisualAssetToEntity(entityId, assetId, scaleVector);
             }
             break;
         default:
             AZ_Warning("AddVisual", false, "Unsupported visual geometry type, %d", (int)geometry->Type());
-            break;
+            return AZStd::nullopt;
         }
 
-        return assetId;
+        return visualAsset;
     }
 
     void VisualsMaker::AddVisualAssetToEntity(AZ::EntityId entityId, const AZ::Data::AssetId& assetId, const AZ::Vector3& scale) const
@@ -277,7 +302,11 @@ namespace ROS2
         AZ_Info("AddMaterial", "Added product material %s\n", materialProductPath.c_str());
     }
 
-    static void OverrideMaterialPbrSettings(const sdf::Material* material, const AZStd::shared_ptr<Utils::UrdfAssetMap>& assetMapping, AZ::Render::MaterialAssignmentMap& overrides)
+    static void OverrideMaterialPbrSettings(
+        const sdf::Material* material,
+        const AZStd::shared_ptr<Utils::UrdfAssetMap>& assetMapping,
+        const Utils::ProductAssetIdMap* productAssetIds,
+        AZ::Render::MaterialAssignmentMap& overrides)
     {
         if (auto pbr = material->PbrMaterial(); pbr)
         {
@@ -299,7 +328,7 @@ namespace ROS2
 
             for (auto& [id, materialAssignment] : overrides)
             {
-                auto GetImageAssetIdFromPath = [&assetMapping](const std::string& uri) -> AZ::Data::AssetId
+                auto GetImageAssetIdFromPath = [&assetMapping, productAssetIds](const std::string& uri) -> AZ::Data::AssetId
                 {
                     AZ::Data::AssetId assetId;
                     const auto asset = PrefabMakerUtils::GetAssetFromPath(*assetMapping, uri);
@@ -307,7 +336,9 @@ namespace ROS2
 
                     if (asset)
                     {
-                        assetId = Utils::GetImageProductAssetId(asset->m_sourceGuid);
+                        const auto* resolvedProductAssetIds = PrefabMakerUtils::FindProductAssetIds(productAssetIds, asset->m_sourceGuid);
+                        assetId = resolvedProductAssetIds ? resolvedProductAssetIds->m_imageAssetId
+                                                          : Utils::GetImageProductAssetId(asset->m_sourceGuid);
                         AZ_Warning("AddVisual", assetId.IsValid(), "There is no product image asset for %s.", asset->m_sourceAssetRelativePath.c_str());
                     }
                     return assetId;
@@ -496,6 +527,29 @@ namespace ROS2
         }
     }
 
+    AZ::Render::MaterialComponentConfig VisualsMaker::MakeMaterialConfig(
+        const sdf::Visual* visual, const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset) const
+    {
+        auto material = visual->Material();
+        AZ_Assert(material, "MakeMaterialConfig called for a visual without material");
+
+        AZ_Error("AddMaterial", modelAsset.IsReady(), "Trying to create materials for a model that couldn't load. The generated material overrides may not work correctly.");
+
+        // Initialize the material component configuration to contain all of the material mappings from the model.
+        AZ::Render::MaterialComponentConfig config;
+        config.m_materials = AZ::Render::GetDefaultMaterialMapFromModelAsset(modelAsset);
+
+        // Try to override all of the various material settings based on what's contained in the <material> and <visual> elements in the source file.
+        OverrideScriptMaterial(material, config.m_materials);
+        OverrideMaterialPbrSettings(material, m_urdfAssetsMapping, m_productAssetIds.get(), config.m_materials);
+        OverrideMaterialBaseColor(material, config.m_materials);
+        OverrideMaterialTransparency(visual, config.m_materials);
+        OverrideMaterialEmissiveSettings(material, config.m_materials);
+        OverrideMaterialRoughness(material, config.m_materials);
+        OverrideMaterialDoubleSided(material, config.m_materials);
+        return config;
+    }
+
     void VisualsMaker::AddMaterialForVisual(const sdf::Visual* visual, AZ::EntityId entityId, const AZ::Data::AssetId& assetId) const
     {
         auto material = visual->Material();
@@ -515,25 +569,20 @@ namespace ROS2
         // Also, URDF/SDF files don't have a concept of overriding specific materials, so every material override generated
         // below will get applied to *all* materials for a mesh file.
 
-        // First, force the model asset to get loaded into memory before adding the material component.
-        // This is required so that we can get the default material map that will be used to override properties for each material.
-        auto modelAsset = AZ::Data::AssetManager::Instance().GetAsset<AZ::RPI::ModelAsset>(assetId, AZ::Data::AssetLoadBehavior::Default);
-        modelAsset.BlockUntilLoadComplete();
-
-        AZ_Error("AddMaterial", modelAsset.IsReady(), "Trying to create materials for a model that couldn't load. The generated material overrides may not work correctly.");
-
-        // Initialize the material component configuration to contain all of the material mappings from the model.
         AZ::Render::MaterialComponentConfig config;
-        config.m_materials = AZ::Render::GetDefaultMaterialMapFromModelAsset(modelAsset);
-
-        // Try to override all of the various material settings based on what's contained in the <material> and <visual> elements in the source file.
-        OverrideScriptMaterial(material, config.m_materials);
-        OverrideMaterialPbrSettings(material, m_urdfAssetsMapping, config.m_materials);
-        OverrideMaterialBaseColor(material, config.m_materials);
-        OverrideMaterialTransparency(visual, config.m_materials);
-        OverrideMaterialEmissiveSettings(material, config.m_materials);
-        OverrideMaterialRoughness(material, config.m_materials);
-        OverrideMaterialDoubleSided(material, config.m_materials);
+        if (auto preparedIt = m_preparedMaterials.find(visual); preparedIt != m_preparedMaterials.end())
+        {
+            config = preparedIt->second;
+        }
+        else
+        {
+            // First, force the model asset to get loaded into memory before adding the material component.
+            // This is required so that we can get the default material map that will be used to override properties for each material.
+            auto modelAsset =
+                AZ::Data::AssetManager::Instance().GetAsset<AZ::RPI::ModelAsset>(assetId, AZ::Data::AssetLoadBehavior::Default);
+            modelAsset.BlockUntilLoadComplete();
+            config = MakeMaterialConfig(visual, modelAsset);
+        }
 
         // All the material overrides are in place, so get the entity, add the material component, and set its configuration to use the material overrides.
         AZ::Entity* entity = AzToolsFramework::GetEntityById(entityId);
@@ -541,4 +590,88 @@ namespace ROS2
         auto component = entity->CreateComponent(AZ::Render::EditorMaterialComponentTypeId);
         component->SetConfiguration(config);
     }
+
+    void VisualsMaker::SetProductAssetIds(const AZStd::shared_ptr<const Utils::ProductAssetIdMap>& productAssetIds)
+    {
+        m_productAssetIds = productAssetIds;
+    }
+
+    void VisualsMaker::PrepareVisuals(const AZStd::vector<const sdf::Link*>& links)
+    {
+        m_preparedVisualAssets.clear();
+        m_preparedMaterials.clear();
+
+        // Model assets of visuals with materials are requested all at once, so that the asset manager loads them concurrently
+        // instead of blocking on every model in turn during entity creation.
+        struct MaterialToPrepare
+        {
+            const sdf::Visual* m_visual{};
+            AZ::Data::Asset<AZ::RPI::ModelAsset> m_modelAsset;
+            AZ::Render::MaterialComponentConfig m_config;
+        };
+        AZStd::vector<MaterialToPrepare> materialsToPrepare;
+
+        for (const sdf::Link* link : links)
+        {
+            for (uint64_t index = 0; index < link->VisualCount(); index++)
+            {
+                const sdf::Visual* visual = link->VisualByIndex(index);
+                if (visual == nullptr || visual->Geom() == nullptr)
+                {
+                    continue;
+                }
+
+                const auto visualAsset = FindVisualAsset(visual->Geom());
+                if (!visualAsset.has_value())
+                {
+                    continue;
+                }
+                m_preparedVisualAssets.emplace(visual, *visualAsset);
+
+                if (visual->Material() != nullptr)
+                {
+                    MaterialToPrepare& materialToPrepare = materialsToPrepare.emplace_back();
+                    materialToPrepare.m_visual = visual;
+                    materialToPrepare.m_modelAsset = AZ::Data::AssetManager::Instance().GetAsset<AZ::RPI::ModelAsset>(
+                        visualAsset->m_assetId, AZ::Data::AssetLoadBehavior::Default);
+                }
+            }
+        }
+
+        for (auto& materialToPrepare : materialsToPrepare)
+        {
+            materialToPrepare.m_modelAsset.BlockUntilLoadComplete();
+        }
+
+        // Material configurations only read the loaded models and the SDF, so they are built in parallel jobs.
+        if (materialsToPrepare.size() > 1 && AZ::JobContext::GetGlobalContext() != nullptr)
+        {
+            AZ::JobCompletion completion;
+            for (auto& materialToPrepare : materialsToPrepare)
+            {
+                auto* entry = &materialToPrepare;
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [this, entry]()
+                    {
+                        entry->m_config = MakeMaterialConfig(entry->m_visual, entry->m_modelAsset);
+                    },
+                    true);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (auto& materialToPrepare : materialsToPrepare)
+            {
+                materialToPrepare.m_config = MakeMaterialConfig(materialToPrepare.m_visual, materialToPrepare.m_modelAsset);
+            }
+        }
+
+        for (auto& materialToPrepare : materialsToPrepare)
+        {
+            m_preparedMaterials.emplace(materialToPrepare.m_visual, AZStd::move(materialToPrepare.m_config));
+        }
+    }
 } // namespace ROS2
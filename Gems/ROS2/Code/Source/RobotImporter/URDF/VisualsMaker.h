@@ -9,10 +9,13 @@
 #pragma once
 
 #include "UrdfParser.h"
+#include <Atom/RPI.Reflect/Model/ModelAsset.h>
+#include <AtomLyIntegration/CommonFeatures/Material/MaterialComponentConfig.h>
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/optional.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <RobotImporter/Utils/SourceAssetsStorage.h>
 
@@ -32,12 +35,38 @@ namespace ROS2
         //! @return List containing any entities created.
         AZStd::vector<AZ::EntityId> AddVisuals(const sdf::Link* link, AZ::EntityId entityId) const;
 
+        //! Set product asset IDs resolved ahead of entity creation, source assets missing from the map are looked up one by one.
+        //! @param productAssetIds Product asset IDs of the source assets used by the robot description.
+        void SetProductAssetIds(const AZStd::shared_ptr<const Utils::ProductAssetIdMap>& productAssetIds);
+
+        //! Prepare model assets and material configurations of all visuals of the given links, so that AddVisuals only creates
+        //! entities and components. Model assets are loaded together and material configurations are built in parallel jobs.
+        //! @param links Parsed SDF links which will be passed to AddVisuals later.
+        void PrepareVisuals(const AZStd::vector<const sdf::Link*>& links);
+
     private:
+        //! Model asset and scale representing a visual geometry.
+        struct VisualAsset
+        {
+            AZ::Data::AssetId m_assetId;
+            AZ::Vector3 m_scale = AZ::Vector3::CreateOne();
+        };
+
         AZ::EntityId AddVisual(const sdf::Visual* visual, AZ::EntityId entityId, const AZStd::string& generatedName) const;
         AZ::Data::AssetId AddVisualToEntity(const sdf::Visual* visual, AZ::EntityId entityId) const;
         void AddVisualAssetToEntity(AZ::EntityId entityId, const AZ::Data::AssetId& assetId, const AZ::Vector3& scale) const;
         void AddMaterialForVisual(const sdf::Visual* visual, AZ::EntityId entityId, const AZ::Data::AssetId& assetId) const;
 
+        //! Find the model asset of a visual geometry.
+        //! @returns model asset and scale, nothing if the geometry type is not supported
+        AZStd::optional<VisualAsset> FindVisualAsset(const sdf::Geometry* geometry) const;
+        //! Build the material component configuration of a visual from its loaded model asset.
+        AZ::Render::MaterialComponentConfig MakeMaterialConfig(
+            const sdf::Visual* visual, const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset) const;
+
         AZStd::shared_ptr<Utils::UrdfAssetMap> m_urdfAssetsMapping;
+        AZStd::shared_ptr<const Utils::ProductAssetIdMap> m_productAssetIds;
+        AZStd::unordered_map<const sdf::Visual*, VisualAsset> m_preparedVisualAssets;
+        AZStd::unordered_map<const sdf::Visual*, AZ::Render::MaterialComponentConfig> m_preparedMaterials;
     };
 } // namespace ROS2
@@ -29,55 +29,79 @@ namespace ROS2::Utils
         };
     } // namespace Internal
 
-    bool IsWheelURDFHeuristics(const sdf::Model& model, const sdf::Link* link)
+    namespace
     {
-        auto wheelMatcher = [](AZStd::string_view name)
+        // Checks the name and the elements of a link, the joint is checked separately as it is queried in different ways
+        bool IsWheelLinkCandidate(const sdf::Link* link)
         {
-            // StringFunc matches are case-insensitive by default
-            return AZ::StringFunc::StartsWith(name, "wheel_") || AZ::StringFunc::EndsWith(name, "_wheel");
-        };
+            auto wheelMatcher = [](AZStd::string_view name)
+            {
+                // StringFunc matches are case-insensitive by default
+                return AZ::StringFunc::StartsWith(name, "wheel_") || AZ::StringFunc::EndsWith(name, "_wheel");
+            };
 
-        const AZStd::string linkName(link->Name().c_str(), link->Name().size());
-        // Check if link name is catchy for wheel
-        if (!wheelMatcher(linkName))
+            const AZStd::string_view linkName(link->Name().c_str(), link->Name().size());
+            // Check if link name is catchy for wheel
+            if (!wheelMatcher(linkName))
+            {
+                return false;
+            }
+
+            // Wheels need to have collision and visuals
+            return (link->CollisionCount() != 0) && (link->VisualCount() != 0);
+        }
+
+        bool IsWheelJoint(const AZStd::vector<const sdf::Joint*>& jointsWhereLinkIsChild)
         {
-            return false;
+            // URDFs only have a single parent
+            // This is explained in the Pose frame semantics tutorial for sdformat
+            // http://sdformat.org/tutorials?tut=pose_frame_semantics&ver=1.5#parent-frames-in-urdf
+
+            // The SDF URDF parser converts continuous joints to revolute joints with a limit
+            // of -infinity to +infinity
+            // https://github.com/gazebosim/sdformat/blob/sdf13/src/parser_urdf.cc#L3009-L3039
+            bool isWheel{};
+            if (!jointsWhereLinkIsChild.empty())
+            {
+                const sdf::Joint* potentialWheelJoint = jointsWhereLinkIsChild.front();
+                if (const sdf::JointAxis* jointAxis = potentialWheelJoint->Axis(); jointAxis != nullptr)
+                {
+                    using LimitType = decltype(jointAxis->Lower());
+                    // There should only be 1 element for URDF, however that will not be verified
+                    // in case this function is called on link from an SDF file
+                    isWheel = potentialWheelJoint->Type() == sdf::JointType::CONTINUOUS;
+                    isWheel = isWheel ||
+                        (potentialWheelJoint->Type() == sdf::JointType::REVOLUTE &&
+                         jointAxis->Lower() == -AZStd::numeric_limits<LimitType>::infinity() &&
+                         jointAxis->Upper() == AZStd::numeric_limits<LimitType>::infinity());
+                }
+            }
+
+            return isWheel;
         }
+    } // namespace
 
-        // Wheels need to have collision and visuals
-        if ((link->CollisionCount() == 0) || (link->VisualCount() == 0))
+    bool IsWheelURDFHeuristics(const sdf::Model& model, const sdf::Link* link)
+    {
+        if (!IsWheelLinkCandidate(link))
         {
             return false;
         }
 
         // When this link is a child, the parent link joint needs to be CONTINUOUS
-        AZStd::vector<const sdf::Joint*> joints = GetJointsForChildLink(model, linkName, true);
-
-        // URDFs only have a single parent
-        // This is explained in the Pose frame semantics tutorial for sdformat
-        // http://sdformat.org/tutorials?tut=pose_frame_semantics&ver=1.5#parent-frames-in-urdf
+        const AZStd::string linkName(link->Name().c_str(), link->Name().size());
+        return IsWheelJoint(GetJointsForChildLink(model, linkName, true));
+    }
 
-        // The SDF URDF parser converts continuous joints to revolute joints with a limit
-        // of -infinity to +infinity
-        // https://github.com/gazebosim/sdformat/blob/sdf13/src/parser_urdf.cc#L3009-L3039
-        bool isWheel{};
-        if (!joints.empty())
+    bool IsWheelURDFHeuristics(const SdfIndex& sdfIndex, const sdf::Link* link)
+    {
+        if (!IsWheelLinkCandidate(link))
         {
-            const sdf::Joint* potentialWheelJoint = joints.front();
-            if (const sdf::JointAxis* jointAxis = potentialWheelJoint->Axis(); jointAxis != nullptr)
-            {
-                using LimitType = decltype(jointAxis->Lower());
-                // There should only be 1 element for URDF, however that will not be verified
-                // in case this function is called on link from an SDF file
-                isWheel = potentialWheelJoint->Type() == sdf::JointType::CONTINUOUS;
-                isWheel = isWheel ||
-                    (potentialWheelJoint->Type() == sdf::JointType::REVOLUTE &&
-                     jointAxis->Lower() == -AZStd::numeric_limits<LimitType>::infinity() &&
-                     jointAxis->Upper() == AZStd::numeric_limits<LimitType>::infinity());
-            }
+            return false;
         }
 
-        return isWheel;
+        // When this link is a child, the parent link joint needs to be CONTINUOUS
+        return IsWheelJoint(sdfIndex.GetJointsForChildLink(*link));
     }
 
     AZ::Transform GetLocalTransformURDF(const sdf::Link* link, AZ::Transform t)
@@ -535,7 +559,7 @@ namespace ROS2::Utils
         const sdf::Model* resultModel{};
         auto IsLinkInModel = [&link, &resultModel](const sdf::Model& model, const ModelStack&) -> VisitModelResponse
         {
-            if (const sdf::Link* searchLink = model.LinkByName(link.Name()); searchLink != &link)
+            if (const sdf::Link* searchLink = model.LinkByName(link.Name()); searchLink == &link)
             {
                 resultModel = &model;
                 return VisitModelResponse::Stop;
@@ -572,7 +596,7 @@ namespace ROS2::Utils
         const sdf::Model* resultModel{};
         auto IsJointInModel = [&joint, &resultModel](const sdf::Model& model, const ModelStack&) -> VisitModelResponse
         {
-            if (const sdf::Joint* searchJoint = model.JointByName(joint.Name()); searchJoint != &joint)
+            if (const sdf::Joint* searchJoint = model.JointByName(joint.Name()); searchJoint == &joint)
             {
                 resultModel = &model;
                 return VisitModelResponse::Stop;
@@ -591,7 +615,7 @@ namespace ROS2::Utils
         auto IsModelInModel = [&model, &resultModel](const sdf::Model& outerModel, const ModelStack&) -> VisitModelResponse
         {
             // Validate the memory address of the model matches the outer model found searching the visited model "child models"
-            if (const sdf::Model* searchModel = outerModel.ModelByName(model.Name()); searchModel != &model)
+            if (const sdf::Model* searchModel = outerModel.ModelByName(model.Name()); searchModel == &model)
             {
                 resultModel = &outerModel;
                 return VisitModelResponse::Stop;
@@ -604,6 +628,172 @@ namespace ROS2::Utils
         return resultModel;
     }
 
+    SdfIndex::SdfIndex(const sdf::Root& root)
+    {
+        auto IndexModel = [this](const sdf::Model& model, const ModelStack& modelStack) -> VisitModelResponse
+        {
+            // Prepend the Model names using the Name Scoping support in libsdformat
+            // http://sdformat.org/tutorials?tut=composition_proposal#1-3-name-scoping-and-cross-referencing
+            std::string fullyQualifiedModelName;
+            for (const sdf::Model& ancestorModel : modelStack)
+            {
+                fullyQualifiedModelName = sdf::JoinName(fullyQualifiedModelName, ancestorModel.Name());
+            }
+            fullyQualifiedModelName = sdf::JoinName(fullyQualifiedModelName, model.Name());
+
+            ModelEntry& modelEntry = m_models.emplace_back();
+            modelEntry.m_fullyQualifiedName = AZStd::string(fullyQualifiedModelName.c_str(), fullyQualifiedModelName.size());
+            modelEntry.m_model = &model;
+            modelEntry.m_parentModel = !modelStack.empty() ? &modelStack.back().get() : nullptr;
+
+            for (uint64_t linkIndex{}; linkIndex < model.LinkCount(); ++linkIndex)
+            {
+                if (const sdf::Link* link = model.LinkByIndex(linkIndex); link != nullptr)
+                {
+                    const std::string fullyQualifiedLinkName = sdf::JoinName(fullyQualifiedModelName, link->Name());
+                    LinkEntry& linkEntry = m_links.emplace_back();
+                    linkEntry.m_fullyQualifiedName = AZStd::string(fullyQualifiedLinkName.c_str(), fullyQualifiedLinkName.size());
+                    linkEntry.m_link = link;
+                    linkEntry.m_model = &model;
+                }
+            }
+
+            for (uint64_t jointIndex{}; jointIndex < model.JointCount(); ++jointIndex)
+            {
+                if (const sdf::Joint* joint = model.JointByIndex(jointIndex); joint != nullptr)
+                {
+                    const std::string fullyQualifiedJointName = sdf::JoinName(fullyQualifiedModelName, joint->Name());
+                    JointEntry& jointEntry = m_joints.emplace_back();
+                    jointEntry.m_fullyQualifiedName = AZStd::string(fullyQualifiedJointName.c_str(), fullyQualifiedJointName.size());
+                    jointEntry.m_joint = joint;
+                    jointEntry.m_model = &model;
+                    // The parent and child names are relative to the model of the joint and can be scoped into its nested models
+                    jointEntry.m_parentLink = model.LinkByName(joint->ParentName());
+                    jointEntry.m_childLink = model.LinkByName(joint->ChildName());
+                }
+            }
+
+            return VisitModelResponse::VisitNestedAndSiblings;
+        };
+        VisitModels(root, IndexModel);
+
+        for (size_t index = 0; index < m_models.size(); ++index)
+        {
+            m_modelsByName.emplace(m_models[index].m_fullyQualifiedName, index);
+            m_modelIndices.emplace(m_models[index].m_model, index);
+        }
+
+        for (size_t index = 0; index < m_links.size(); ++index)
+        {
+            m_linksByName.emplace(m_links[index].m_fullyQualifiedName, index);
+            m_linkIndices.emplace(m_links[index].m_link, index);
+        }
+
+        for (size_t index = 0; index < m_joints.size(); ++index)
+        {
+            const JointEntry& jointEntry = m_joints[index];
+            m_jointsByName.emplace(jointEntry.m_fullyQualifiedName, index);
+            m_jointIndices.emplace(jointEntry.m_joint, index);
+            if (jointEntry.m_childLink != nullptr)
+            {
+                m_jointsForChildLink[jointEntry.m_childLink].push_back(jointEntry.m_joint);
+            }
+            if (jointEntry.m_parentLink != nullptr)
+            {
+                m_jointsForParentLink[jointEntry.m_parentLink].push_back(jointEntry.m_joint);
+            }
+        }
+    }
+
+    const AZStd::vector<SdfIndex::ModelEntry>& SdfIndex::GetModels() const
+    {
+        return m_models;
+    }
+
+    const AZStd::vector<SdfIndex::LinkEntry>& SdfIndex::GetLinks() const
+    {
+        return m_links;
+    }
+
+    const AZStd::vector<SdfIndex::JointEntry>& SdfIndex::GetJoints() const
+    {
+        return m_joints;
+    }
+
+    const sdf::Model* SdfIndex::FindModel(AZStd::string_view fullyQualifiedName) const
+    {
+        const auto modelIt = m_modelsByName.find(AZStd::string(fullyQualifiedName));
+        return modelIt != m_modelsByName.end() ? m_models[modelIt->second].m_model : nullptr;
+    }
+
+    const sdf::Link* SdfIndex::FindLink(AZStd::string_view fullyQualifiedName) const
+    {
+        const auto linkIt = m_linksByName.find(AZStd::string(fullyQualifiedName));
+        return linkIt != m_linksByName.end() ? m_links[linkIt->second].m_link : nullptr;
+    }
+
+    const sdf::Joint* SdfIndex::FindJoint(AZStd::string_view fullyQualifiedName) const
+    {
+        const auto jointIt = m_jointsByName.find(AZStd::string(fullyQualifiedName));
+        return jointIt != m_jointsByName.end() ? m_joints[jointIt->second].m_joint : nullptr;
+    }
+
+    const sdf::Model* SdfIndex::GetModelContainingLink(AZStd::string_view fullyQualifiedLinkName) const
+    {
+        const auto linkIt = m_linksByName.find(AZStd::string(fullyQualifiedLinkName));
+        return linkIt != m_linksByName.end() ? m_links[linkIt->second].m_model : nullptr;
+    }
+
+    const sdf::Model* SdfIndex::GetModelContainingLink(const sdf::Link& link) const
+    {
+        const auto linkIt = m_linkIndices.find(&link);
+        return linkIt != m_linkIndices.end() ? m_links[linkIt->second].m_model : nullptr;
+    }
+
+    const sdf::Model* SdfIndex::GetModelContainingJoint(AZStd::string_view fullyQualifiedJointName) const
+    {
+        const auto jointIt = m_jointsByName.find(AZStd::string(fullyQualifiedJointName));
+        return jointIt != m_jointsByName.end() ? m_joints[jointIt->second].m_model : nullptr;
+    }
+
+    const sdf::Model* SdfIndex::GetModelContainingJoint(const sdf::Joint& joint) const
+    {
+        const auto jointIt = m_jointIndices.find(&joint);
+        return jointIt != m_jointIndices.end() ? m_joints[jointIt->second].m_model : nullptr;
+    }
+
+    const sdf::Model* SdfIndex::GetModelContainingModel(const sdf::Model& model) const
+    {
+        const auto modelIt = m_modelIndices.find(&model);
+        return modelIt != m_modelIndices.end() ? m_models[modelIt->second].m_parentModel : nullptr;
+    }
+
+    const sdf::Link* SdfIndex::GetParentLink(const sdf::Joint& joint) const
+    {
+        const auto jointIt = m_jointIndices.find(&joint);
+        return jointIt != m_jointIndices.end() ? m_joints[jointIt->second].m_parentLink : nullptr;
+    }
+
+    const sdf::Link* SdfIndex::GetChildLink(const sdf::Joint& joint) const
+    {
+        const auto jointIt = m_jointIndices.find(&joint);
+        return jointIt != m_jointIndices.end() ? m_joints[jointIt->second].m_childLink : nullptr;
+    }
+
+    const AZStd::vector<const sdf::Joint*>& SdfIndex::GetJointsForChildLink(const sdf::Link& link) const
+    {
+        static const AZStd::vector<const sdf::Joint*> noJoints;
+        const auto jointsIt = m_jointsForChildLink.find(&link);
+        return jointsIt != m_jointsForChildLink.end() ? jointsIt->second : noJoints;
+    }
+
+    const AZStd::vector<const sdf::Joint*>& SdfIndex::GetJointsForParentLink(const sdf::Link& link) const
+    {
+        static const AZStd::vector<const sdf::Joint*> noJoints;
+        const auto jointsIt = m_jointsForParentLink.find(&link);
+        return jointsIt != m_jointsForParentLink.end() ? jointsIt->second : noJoints;
+    }
+
     AssetFilenameReferences GetReferencedAssetFilenames(const sdf::Root& root)
     {
         AssetFilenameReferences filenames;
@@ -710,6 +900,38 @@ namespace ROS2::Utils
         return filenames;
     }
 
+    ColliderMeshExportMethods GetColliderMeshExportMethods(const sdf::Root& root, const SdfColliderMeshSettings& colliderMeshSettings)
+    {
+        ColliderMeshExportMethods exportMethods;
+
+        // Links are looked up by their fully qualified name, since links of different models can share a name
+        const SdfIndex sdfIndex(root);
+        for (const SdfIndex::LinkEntry& linkEntry : sdfIndex.GetLinks())
+        {
+            const sdf::Link* link = linkEntry.m_link;
+            const ColliderMeshExportMethod linkExportMethod = colliderMeshSettings.GetExportMethod(linkEntry.m_fullyQualifiedName);
+            for (uint64_t collisionIndex = 0; collisionIndex < link->CollisionCount(); collisionIndex++)
+            {
+                const sdf::Geometry* geometry = link->CollisionByIndex(collisionIndex)->Geom();
+                if (geometry->Type() != sdf::GeometryType::MESH || geometry->MeshShape() == nullptr)
+                {
+                    continue;
+                }
+
+                // The methods are ordered from the most detailed one, so that a mesh shared by several links
+                // is not simplified more than any of them requires
+                const std::string& uri = geometry->MeshShape()->Uri();
+                if (auto [exportMethodIt, inserted] = exportMethods.emplace(AZStd::string(uri.c_str(), uri.size()), linkExportMethod);
+                    !inserted && linkExportMethod < exportMethodIt->second)
+                {
+                    exportMethodIt->second = linkExportMethod;
+                }
+            }
+        }
+
+        return exportMethods;
+    }
+
     AZ::IO::Path ResolveAmentPrefixPath(
         AZ::IO::Path unresolvedPath,
         AZStd::string_view amentPrefixPath,
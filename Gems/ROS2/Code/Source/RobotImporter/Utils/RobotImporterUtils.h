@@ -182,12 +182,131 @@ namespace ROS2::Utils
     //! @return pointer to parent model containing this model if the model is nested, otherwise nullptr
     const sdf::Model* GetModelContainingModel(const sdf::Root& root, const sdf::Model& model);
 
+    //! Lookup tables of all models, links and joints in a parsed SDF document, built with a single visitation of its models.
+    //! Unlike GetModelContainingLink, GetJointsForChildLink and similar functions, which visit the document on every call,
+    //! queries of the index run in constant time, so it should be used when the models, links or joints are queried repeatedly.
+    //! A fully qualified name joins the names of all models on the way from the root or world to the element,
+    //! following the SDF 1.8 name scoping proposal, for example "modelname1::nested_modelname1::linkname".
+    //! The index holds pointers to the SDF objects and must not outlive the root it was built from.
+    class SdfIndex
+    {
+    public:
+        struct ModelEntry
+        {
+            AZStd::string m_fullyQualifiedName;
+            const sdf::Model* m_model{};
+            //! Model containing the model, nullptr if the model is at the root of the document or in a world
+            const sdf::Model* m_parentModel{};
+        };
+
+        struct LinkEntry
+        {
+            AZStd::string m_fullyQualifiedName;
+            const sdf::Link* m_link{};
+            //! Model the link is attached to
+            const sdf::Model* m_model{};
+        };
+
+        struct JointEntry
+        {
+            AZStd::string m_fullyQualifiedName;
+            const sdf::Joint* m_joint{};
+            //! Model the joint is attached to
+            const sdf::Model* m_model{};
+            //! Parent link resolved within the model of the joint, nullptr if the parent is not a link (e.g. "world")
+            const sdf::Link* m_parentLink{};
+            //! Child link resolved within the model of the joint, nullptr if the child is not a link
+            const sdf::Link* m_childLink{};
+        };
+
+        //! Builds the index of all models (including nested models), links and joints of the SDF document.
+        //! @param root reference to SDF Root object representing the root of the parsed SDF xml document
+        explicit SdfIndex(const sdf::Root& root);
+
+        //! @returns all models, in the order of VisitModels
+        const AZStd::vector<ModelEntry>& GetModels() const;
+        //! @returns all links, grouped by model in the order of VisitModels
+        const AZStd::vector<LinkEntry>& GetLinks() const;
+        //! @returns all joints, grouped by model in the order of VisitModels
+        const AZStd::vector<JointEntry>& GetJoints() const;
+
+        //! @param fullyQualifiedName fully qualified name of the model
+        //! @returns the model, or nullptr if there is no such model
+        const sdf::Model* FindModel(AZStd::string_view fullyQualifiedName) const;
+        //! @param fullyQualifiedName fully qualified name of the link
+        //! @returns the link, or nullptr if there is no such link
+        const sdf::Link* FindLink(AZStd::string_view fullyQualifiedName) const;
+        //! @param fullyQualifiedName fully qualified name of the joint
+        //! @returns the joint, or nullptr if there is no such joint
+        const sdf::Joint* FindJoint(AZStd::string_view fullyQualifiedName) const;
+
+        //! @param fullyQualifiedLinkName fully qualified name of the link
+        //! @returns the model the link is attached to, or nullptr if there is no such link
+        const sdf::Model* GetModelContainingLink(AZStd::string_view fullyQualifiedLinkName) const;
+        //! @param link SDF link reference to lookup in the SDF document
+        //! @returns the model the link is attached to, or nullptr if the link is not part of the document
+        const sdf::Model* GetModelContainingLink(const sdf::Link& link) const;
+        //! @param fullyQualifiedJointName fully qualified name of the joint
+        //! @returns the model the joint is attached to, or nullptr if there is no such joint
+        const sdf::Model* GetModelContainingJoint(AZStd::string_view fullyQualifiedJointName) const;
+        //! @param joint SDF joint reference to lookup in the SDF document
+        //! @returns the model the joint is attached to, or nullptr if the joint is not part of the document
+        const sdf::Model* GetModelContainingJoint(const sdf::Joint& joint) const;
+        //! @param model SDF model reference to lookup in the SDF document
+        //! @return pointer to parent model containing this model if the model is nested, otherwise nullptr
+        const sdf::Model* GetModelContainingModel(const sdf::Model& model) const;
+
+        //! @returns the parent link of the joint, or nullptr if the parent is not a link of the document
+        const sdf::Link* GetParentLink(const sdf::Joint& joint) const;
+        //! @returns the child link of the joint, or nullptr if the child is not a link of the document
+        const sdf::Link* GetChildLink(const sdf::Joint& joint) const;
+
+        //! Retrieve all joints in which the specified link is a child, in any model of the document.
+        //! @param link SDF link reference to lookup in the SDF document
+        //! @returns vector of joints where link is a child
+        const AZStd::vector<const sdf::Joint*>& GetJointsForChildLink(const sdf::Link& link) const;
+        //! Retrieve all joints in which the specified link is a parent, in any model of the document.
+        //! @param link SDF link reference to lookup in the SDF document
+        //! @returns vector of joints where link is a parent
+        const AZStd::vector<const sdf::Joint*>& GetJointsForParentLink(const sdf::Link& link) const;
+
+    private:
+        AZStd::vector<ModelEntry> m_models;
+        AZStd::vector<LinkEntry> m_links;
+        AZStd::vector<JointEntry> m_joints;
+
+        // Indices into the entry vectors
+        AZStd::unordered_map<AZStd::string, size_t> m_modelsByName;
+        AZStd::unordered_map<AZStd::string, size_t> m_linksByName;
+        AZStd::unordered_map<AZStd::string, size_t> m_jointsByName;
+        AZStd::unordered_map<const sdf::Model*, size_t> m_modelIndices;
+        AZStd::unordered_map<const sdf::Link*, size_t> m_linkIndices;
+        AZStd::unordered_map<const sdf::Joint*, size_t> m_jointIndices;
+
+        AZStd::unordered_map<const sdf::Link*, AZStd::vector<const sdf::Joint*>> m_jointsForChildLink;
+        AZStd::unordered_map<const sdf::Link*, AZStd::vector<const sdf::Joint*>> m_jointsForParentLink;
+    };
+
+    //! Determine whether a given link is likely a wheel link, see IsWheelURDFHeuristics.
+    //! @param sdfIndex index of the SDF document containing the link, used to query the joints in which the link is a child
+    //! @param link the link that will be subjected to the heuristic.
+    //! @return true if the link is likely a wheel link.
+    bool IsWheelURDFHeuristics(const SdfIndex& sdfIndex, const sdf::Link* link);
+
     //! Retrieve all assets referenced in SDF/URDF as unresolved URIs.
     //! The URIs will still need to get resolved via ResolveAssetPath() to point to a valid file location.
     //! @param root reference to SDF Root object representing the root of the parsed SDF xml document
     //! @returns set of meshes' filenames.
     AssetFilenameReferences GetReferencedAssetFilenames(const sdf::Root& root);
 
+    //! Determine the export method of the collision geometry of every collider mesh referenced in SDF/URDF.
+    //! A mesh used by colliders of links with different export methods is exported with the most detailed of them.
+    //! @param root reference to SDF Root object representing the root of the parsed SDF xml document
+    //! @param colliderMeshSettings settings containing the default export method and the export methods of specific links,
+    //! keyed by fully qualified link name
+    //! @returns mapping from unresolved URIs of collider meshes to their export method
+    ColliderMeshExportMethods GetColliderMeshExportMethods(const sdf::Root& root, const SdfColliderMeshSettings& colliderMeshSettings);
+
     //! Callback used to check for file exist of a path referenced within a URDF/SDF file
     //! @param path Candidate local filesystem path to check for existence
     //! @return true should be returned if the file exist otherwise false
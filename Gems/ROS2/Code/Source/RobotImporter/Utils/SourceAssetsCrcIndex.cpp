@@ -0,0 +1,687 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "SourceAssetsCrcIndex.h"
+#include <AssetDatabase/AssetDatabaseConnection.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/algorithm.h>
+#include <cstdlib>
+
+namespace ROS2::Utils
+{
+    namespace
+    {
+        constexpr const char* IndexFileHeader = "ROS2SourceAssetsCrcIndex";
+    } // namespace
+
+    SourceAssetsCrcIndex::SourceAssetsCrcIndex(AZ::IO::Path indexFilePath)
+        : m_indexFilePath(AZStd::move(indexFilePath))
+    {
+    }
+
+    SourceAssetsCrcIndex::~SourceAssetsCrcIndex()
+    {
+        Deactivate();
+    }
+
+    AZ::IO::Path SourceAssetsCrcIndex::GetDefaultIndexFilePath()
+    {
+        AZ::IO::Path userPath;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            settingsRegistry->Get(userPath.Native(), AZ::SettingsRegistryMergeUtils::FilePathKey_ProjectUserPath);
+        }
+        if (userPath.empty())
+        {
+            return {};
+        }
+        return userPath / "ROS2" / "SourceAssetsCrcIndex.txt";
+    }
+
+    void SourceAssetsCrcIndex::Activate(bool listenForChanges)
+    {
+        Load();
+
+        if (AZ::Interface<SourceAssetsCrcIndex>::Get() == nullptr)
+        {
+            AZ::Interface<SourceAssetsCrcIndex>::Register(this);
+        }
+
+        m_listenForChanges = listenForChanges;
+        if (m_listenForChanges)
+        {
+            AzToolsFramework::AssetSystemBus::Handler::BusConnect();
+        }
+    }
+
+    void SourceAssetsCrcIndex::BeginBuilderJob()
+    {
+        AZStd::lock_guard lock(m_mutex);
+        m_rescanOnMissAllowed = true;
+    }
+
+    void SourceAssetsCrcIndex::Deactivate()
+    {
+        AzToolsFramework::AssetSystemBus::Handler::BusDisconnect();
+        m_listenForChanges = false;
+
+        if (AZ::Interface<SourceAssetsCrcIndex>::Get() == this)
+        {
+            AZ::Interface<SourceAssetsCrcIndex>::Unregister(this);
+        }
+
+        if (m_dirty)
+        {
+            Save();
+        }
+    }
+
+    AZ::Crc32 SourceAssetsCrcIndex::GetFileCRC(const AZ::IO::Path& filename)
+    {
+        AZStd::lock_guard lock(m_mutex);
+        return UpdateFileEntry(filename);
+    }
+
+    AZ::u64 SourceAssetsCrcIndex::GetFileContentHash(const AZ::IO::Path& filename)
+    {
+        return GetFileContentHashes({ filename }).front();
+    }
+
+    AZStd::vector<AZ::u64> SourceAssetsCrcIndex::GetFileContentHashes(const AZStd::vector<AZ::IO::Path>& filenames)
+    {
+        AZStd::lock_guard lock(m_mutex);
+
+        AZStd::vector<AZ::u64> hashes(filenames.size(), 0);
+        AZStd::vector<AZ::IO::Path> paths;
+        paths.reserve(filenames.size());
+
+        // A file requested several times is hashed once, a changed file has its content hash reset by UpdateFileEntry.
+        AZStd::unordered_map<AZ::IO::Path, AZ::u64> outdatedHashes;
+        for (size_t fileIndex = 0; fileIndex < filenames.size(); ++fileIndex)
+        {
+            const AZ::IO::Path& path = paths.emplace_back(filenames[fileIndex].LexicallyNormal());
+            UpdateFileEntry(path);
+            if (auto fileIt = m_files.find(path); fileIt != m_files.end() && fileIt->second.m_size > 0)
+            {
+                if (fileIt->second.m_contentHash != 0)
+                {
+                    hashes[fileIndex] = fileIt->second.m_contentHash;
+                }
+                else
+                {
+                    outdatedHashes.emplace(path, 0);
+                }
+            }
+        }
+
+        if (outdatedHashes.empty())
+        {
+            return hashes;
+        }
+
+        if (outdatedHashes.size() > 1 && AZ::JobContext::GetGlobalContext() != nullptr)
+        {
+            AZ::JobCompletion completion;
+            for (auto& outdatedHash : outdatedHashes)
+            {
+                auto* hashEntry = &outdatedHash;
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [hashEntry]()
+                    {
+                        hashEntry->second = ComputeFileContentHash(hashEntry->first);
+                    },
+                    true);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (auto& [path, hash] : outdatedHashes)
+            {
+                hash = ComputeFileContentHash(path);
+            }
+        }
+
+        for (const auto& [path, hash] : outdatedHashes)
+        {
+            if (auto fileIt = m_files.find(path); fileIt != m_files.end() && hash != 0)
+            {
+                fileIt->second.m_contentHash = hash;
+                m_dirty = true;
+            }
+        }
+        for (size_t fileIndex = 0; fileIndex < filenames.size(); ++fileIndex)
+        {
+            if (auto hashIt = outdatedHashes.find(paths[fileIndex]); hashIt != outdatedHashes.end())
+            {
+                hashes[fileIndex] = hashIt->second;
+            }
+        }
+        return hashes;
+    }
+
+    AZStd::unordered_map<AZ::IO::Path, AvailableAsset> SourceAssetsCrcIndex::FindSourceAssetsByContent(
+        const AZStd::vector<AZ::IO::Path>& filenames)
+    {
+        AZStd::lock_guard lock(m_mutex);
+        RefreshSourceAssets();
+
+        AZStd::unordered_map<AZ::IO::Path, AvailableAsset> foundAssets;
+        auto findAll = [this, &filenames, &foundAssets]()
+        {
+            // Files are laid out as each searched file followed by its candidates, so that all of them are hashed in one batch.
+            AZStd::vector<AZ::IO::Path> hashedFiles;
+            AZStd::vector<AZStd::pair<const AZ::IO::Path*, size_t>> searchedFiles;
+            for (const AZ::IO::Path& filename : filenames)
+            {
+                if (foundAssets.contains(filename))
+                {
+                    continue;
+                }
+                const AZ::Crc32 crc = UpdateFileEntry(filename);
+                AZStd::vector<AZ::IO::Path> candidates = crc != AZ::Crc32(0) ? FindValidSourceAssetPaths(crc) : AZStd::vector<AZ::IO::Path>{};
+                if (candidates.empty())
+                {
+                    continue;
+                }
+                searchedFiles.emplace_back(&filename, candidates.size());
+                hashedFiles.push_back(filename);
+                hashedFiles.insert(hashedFiles.end(), candidates.begin(), candidates.end());
+            }
+
+            const AZStd::vector<AZ::u64> hashes = GetFileContentHashes(hashedFiles);
+            size_t hashIndex = 0;
+            for (const auto& [filename, candidateCount] : searchedFiles)
+            {
+                const AZ::u64 fileHash = hashes[hashIndex];
+                for (size_t candidate = 1; candidate <= candidateCount; ++candidate)
+                {
+                    if (fileHash != 0 && hashes[hashIndex + candidate] == fileHash && !foundAssets.contains(*filename))
+                    {
+                        if (auto sourceAssetIt = m_sourceAssets.find(hashedFiles[hashIndex + candidate]); sourceAssetIt != m_sourceAssets.end())
+                        {
+                            foundAssets.emplace(*filename, sourceAssetIt->second.m_asset);
+                        }
+                    }
+                }
+                hashIndex += candidateCount + 1;
+            }
+
+            return AZStd::all_of(
+                filenames.begin(),
+                filenames.end(),
+                [&foundAssets](const AZ::IO::Path& filename)
+                {
+                    return foundAssets.contains(filename);
+                });
+        };
+
+        // Without notifications a missing file may match a source asset that was added since the last scan.
+        // A rescan costs a query of every source asset, so misses rescan at most once per builder job.
+        if (!findAll() && !m_listenForChanges && m_rescanOnMissAllowed)
+        {
+            RescanSourceAssets();
+            findAll();
+        }
+
+        return foundAssets;
+    }
+
+    AZStd::unordered_map<AZ::Crc32, AvailableAsset> SourceAssetsCrcIndex::FindSourceAssets(const AZStd::unordered_set<AZ::Crc32>& crcs)
+    {
+        AZStd::lock_guard lock(m_mutex);
+        RefreshSourceAssets();
+
+        AZStd::unordered_map<AZ::Crc32, AvailableAsset> foundAssets;
+        auto findAll = [this, &crcs, &foundAssets]()
+        {
+            bool allFound = true;
+            for (const AZ::Crc32& crc : crcs)
+            {
+                if (foundAssets.contains(crc))
+                {
+                    continue;
+                }
+
+                const AZStd::vector<AZ::IO::Path> paths = FindValidSourceAssetPaths(crc);
+                if (auto sourceAssetIt = paths.empty() ? m_sourceAssets.end() : m_sourceAssets.find(paths.front());
+                    sourceAssetIt != m_sourceAssets.end())
+                {
+                    foundAssets.emplace(crc, sourceAssetIt->second.m_asset);
+                }
+                else
+                {
+                    allFound = false;
+                }
+            }
+            return allFound;
+        };
+
+        // Without notifications a missing checksum may belong to a source asset that was added since the last scan.
+        // A rescan costs a query of every source asset, so misses rescan at most once per builder job.
+        if (!findAll() && !m_listenForChanges && m_rescanOnMissAllowed)
+        {
+            RescanSourceAssets();
+            findAll();
+        }
+
+        return foundAssets;
+    }
+
+    AZStd::unordered_map<AZ::Crc32, AvailableAsset> SourceAssetsCrcIndex::GetSourceAssets()
+    {
+        AZStd::lock_guard lock(m_mutex);
+
+        if (m_rescanRequired || !m_listenForChanges)
+        {
+            RescanSourceAssets();
+        }
+        else
+        {
+            ApplyPendingChanges();
+        }
+
+        AZStd::unordered_map<AZ::Crc32, AvailableAsset> availableAssets;
+        for (const auto& [crc, paths] : m_sourceAssetsByCrc)
+        {
+            if (const AvailableAsset* asset = FindSourceAsset(crc))
+            {
+                availableAssets.emplace(crc, *asset);
+            }
+        }
+        return availableAssets;
+    }
+
+    bool SourceAssetsCrcIndex::Load()
+    {
+        if (m_indexFilePath.empty() || !AZ::IO::SystemFile::Exists(m_indexFilePath.c_str()))
+        {
+            return false;
+        }
+
+        const auto fileSize = AZ::IO::SystemFile::Length(m_indexFilePath.c_str());
+        AZStd::string contents;
+        contents.resize_no_construct(fileSize);
+        if (fileSize == 0 || !AZ::IO::SystemFile::Read(m_indexFilePath.c_str(), contents.data(), fileSize))
+        {
+            AZ_Warning("SourceAssetsCrcIndex", false, "Cannot read source asset CRC index %s", m_indexFilePath.c_str());
+            return false;
+        }
+
+        const AZStd::string expectedHeader = AZStd::string::format("%s %u\n", IndexFileHeader, FileVersion);
+        if (!contents.starts_with(expectedHeader))
+        {
+            AZ_Trace("SourceAssetsCrcIndex", "Ignoring source asset CRC index %s with a different version", m_indexFilePath.c_str());
+            return false;
+        }
+
+        AZStd::lock_guard lock(m_mutex);
+
+        // Every line holds the checksum, size, modification time and content hash of a file followed by its absolute path, separated by tabs.
+        const char* const end = contents.data() + contents.size();
+        const char* line = contents.data() + expectedHeader.size();
+        while (line < end)
+        {
+            const char* lineEnd = AZStd::find(line, end, '\n');
+            char* field = const_cast<char*>(line);
+            FileEntry entry;
+            entry.m_crc = AZ::Crc32(static_cast<AZ::u32>(strtoul(field, &field, 10)));
+            const bool hasSize = field < lineEnd && *field++ == '\t';
+            entry.m_size = strtoull(field, &field, 10);
+            const bool hasModificationTime = field < lineEnd && *field++ == '\t';
+            entry.m_modificationTime = strtoull(field, &field, 10);
+            const bool hasContentHash = field < lineEnd && *field++ == '\t';
+            entry.m_contentHash = strtoull(field, &field, 10);
+            const bool hasPath = field < lineEnd && *field++ == '\t';
+            if (hasSize && hasModificationTime && hasContentHash && hasPath && field < lineEnd)
+            {
+                // Entries already validated in this process are newer than the persisted ones.
+                m_files.emplace(AZ::IO::Path(AZStd::string_view(field, lineEnd - field)), entry);
+            }
+            line = lineEnd + 1;
+        }
+
+        AZ_Trace("SourceAssetsCrcIndex", "Loaded %zu source asset checksums from %s", m_files.size(), m_indexFilePath.c_str());
+        return true;
+    }
+
+    bool SourceAssetsCrcIndex::Save()
+    {
+        if (m_indexFilePath.empty())
+        {
+            return false;
+        }
+
+        AZStd::string contents = AZStd::string::format("%s %u\n", IndexFileHeader, FileVersion);
+        {
+            AZStd::lock_guard lock(m_mutex);
+            for (const auto& [path, entry] : m_files)
+            {
+                contents += AZStd::string::format(
+                    "%u\t%llu\t%llu\t%llu\t%s\n",
+                    static_cast<AZ::u32>(entry.m_crc),
+                    static_cast<unsigned long long>(entry.m_size),
+                    static_cast<unsigned long long>(entry.m_modificationTime),
+                    static_cast<unsigned long long>(entry.m_contentHash),
+                    path.c_str());
+            }
+            m_dirty = false;
+        }
+
+        // Builder processes save their index independently, so the file is written aside and renamed over the previous one.
+        const AZ::IO::Path temporaryPath = AZStd::string::format(
+            "%s.%s.tmp", m_indexFilePath.c_str(), AZ::Uuid::CreateRandom().ToFixedString(false, false).c_str());
+        AZ::IO::SystemFile file;
+        if (!file.Open(
+                temporaryPath.c_str(),
+                AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("SourceAssetsCrcIndex", false, "Cannot write source asset CRC index %s", temporaryPath.c_str());
+            return false;
+        }
+        const bool written = file.Write(contents.data(), contents.size()) == contents.size();
+        file.Close();
+
+        if (!written || !AZ::IO::SystemFile::Rename(temporaryPath.c_str(), m_indexFilePath.c_str(), true))
+        {
+            AZ_Warning("SourceAssetsCrcIndex", false, "Cannot write source asset CRC index %s", m_indexFilePath.c_str());
+            AZ::IO::SystemFile::Delete(temporaryPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    void SourceAssetsCrcIndex::SourceFileChanged(AZStd::string relativePath, AZStd::string scanFolder, AZ::Uuid sourceUUID)
+    {
+        AZStd::lock_guard lock(m_mutex);
+        if (m_rescanRequired || !IsSupportedSourceFile(relativePath))
+        {
+            return;
+        }
+
+        AvailableAsset asset;
+        asset.m_sourceAssetRelativePath = relativePath;
+        asset.m_sourceAssetGlobalPath = (AZ::IO::Path(scanFolder) / relativePath).LexicallyNormal();
+        asset.m_sourceGuid = sourceUUID;
+        m_pendingChanges[asset.m_sourceAssetGlobalPath] = AZStd::move(asset);
+    }
+
+    void SourceAssetsCrcIndex::SourceFileRemoved(AZStd::string relativePath, AZStd::string scanFolder, [[maybe_unused]] AZ::Uuid sourceUUID)
+    {
+        AZStd::lock_guard lock(m_mutex);
+        if (m_rescanRequired || !IsSupportedSourceFile(relativePath))
+        {
+            return;
+        }
+
+        const AZ::IO::Path globalPath = (AZ::IO::Path(scanFolder) / relativePath).LexicallyNormal();
+        m_pendingChanges[globalPath] = AvailableAsset{};
+    }
+
+    AZ::Crc32 SourceAssetsCrcIndex::UpdateFileEntry(const AZ::IO::Path& filename)
+    {
+        const AZ::IO::Path path = filename.LexicallyNormal();
+        const AZ::u64 size = AZ::IO::SystemFile::Length(path.c_str());
+        const AZ::u64 modificationTime = AZ::IO::SystemFile::ModificationTime(path.c_str());
+
+        auto fileIt = m_files.find(path);
+        if (fileIt != m_files.end() && fileIt->second.m_size == size && fileIt->second.m_modificationTime == modificationTime)
+        {
+            return fileIt->second.m_crc;
+        }
+
+        FileEntry entry;
+        entry.m_size = size;
+        entry.m_modificationTime = modificationTime;
+        entry.m_crc = ComputeFileCRC(path);
+        if (fileIt != m_files.end())
+        {
+            fileIt->second = entry;
+        }
+        else
+        {
+            m_files.emplace(path, entry);
+        }
+        m_dirty = true;
+        return entry.m_crc;
+    }
+
+    void SourceAssetsCrcIndex::RefreshSourceAssets()
+    {
+        if (m_rescanRequired)
+        {
+            RescanSourceAssets();
+        }
+        else
+        {
+            ApplyPendingChanges();
+        }
+    }
+
+    void SourceAssetsCrcIndex::RescanSourceAssets()
+    {
+        // A failed scan counts as well, so that an unavailable database is not queried again on every miss.
+        m_rescanOnMissAllowed = false;
+
+        AzToolsFramework::AssetDatabase::AssetDatabaseConnection assetDatabaseConnection;
+        if (!assetDatabaseConnection.OpenDatabase())
+        {
+            AZ_Warning("SourceAssetsCrcIndex", false, "Cannot open database");
+            return;
+        }
+
+        m_supportedExtensions = GetSupportedExtensions();
+        m_sourceAssets.clear();
+        m_sourceAssetsByCrc.clear();
+        m_pendingChanges.clear();
+
+        // Scan folders are resolved once, rather than querying the Asset Processor for the source info of every entry.
+        AZStd::unordered_map<AZ::s64, AZ::IO::Path> scanFolders;
+        assetDatabaseConnection.QueryScanFoldersTable(
+            [&scanFolders](AzToolsFramework::AssetDatabase::ScanFolderDatabaseEntry& entry)
+            {
+                scanFolders.emplace(entry.m_scanFolderID, AZ::IO::Path(entry.m_scanFolder));
+                return true;
+            });
+
+        AZStd::vector<AvailableAsset> sourceAssets;
+        auto callback = [&scanFolders, &sourceAssets](AzToolsFramework::AssetDatabase::SourceDatabaseEntry& entry)
+        {
+            auto scanFolderIt = scanFolders.find(entry.m_scanFolderPK);
+            if (scanFolderIt == scanFolders.end())
+            {
+                AZ_Warning("SourceAssetsCrcIndex", false, "Cannot find scan folder for %s", entry.ToString().c_str());
+                return true;
+            }
+
+            AvailableAsset foundAsset;
+            foundAsset.m_sourceGuid = entry.m_sourceGuid;
+            foundAsset.m_sourceAssetRelativePath = entry.m_sourceName;
+            foundAsset.m_sourceAssetGlobalPath = (scanFolderIt->second / entry.m_sourceName).LexicallyNormal();
+            sourceAssets.push_back(AZStd::move(foundAsset));
+            return true;
+        };
+
+        for (const auto& extension : m_supportedExtensions)
+        {
+            assetDatabaseConnection.QuerySourceLikeSourceName(
+                extension.c_str(), AzToolsFramework::AssetDatabase::AssetDatabaseConnection::LikeType::EndsWith, callback);
+        }
+
+        // Only files whose size or modification time differ from the index are read.
+        AZStd::unordered_set<AZ::IO::Path> sourcePaths;
+        for (auto& asset : sourceAssets)
+        {
+            sourcePaths.insert(asset.m_sourceAssetGlobalPath);
+            AddSourceAsset(AZStd::move(asset));
+        }
+
+        // Drop checksums of files which are neither source assets nor present on disk anymore.
+        for (auto fileIt = m_files.begin(); fileIt != m_files.end();)
+        {
+            if (!sourcePaths.contains(fileIt->first) && !AZ::IO::SystemFile::Exists(fileIt->first.c_str()))
+            {
+                fileIt = m_files.erase(fileIt);
+                m_dirty = true;
+            }
+            else
+            {
+                ++fileIt;
+            }
+        }
+
+        m_rescanRequired = false;
+        AZ_Trace("SourceAssetsCrcIndex", "Indexed %zu source assets", m_sourceAssets.size());
+
+        if (m_dirty)
+        {
+            Save();
+        }
+    }
+
+    void SourceAssetsCrcIndex::ApplyPendingChanges()
+    {
+        for (auto& [globalPath, asset] : m_pendingChanges)
+        {
+            RemoveSourceAsset(globalPath);
+
+            // Timestamps have a coarse resolution on some platforms, so a reported change always reads the file again.
+            if (m_files.erase(globalPath) > 0)
+            {
+                m_dirty = true;
+            }
+            if (!asset.m_sourceGuid.IsNull())
+            {
+                AddSourceAsset(AZStd::move(asset));
+            }
+        }
+        m_pendingChanges.clear();
+    }
+
+    void SourceAssetsCrcIndex::AddSourceAsset(AvailableAsset asset)
+    {
+        const AZ::Crc32 crc = UpdateFileEntry(asset.m_sourceAssetGlobalPath);
+        if (crc == AZ::Crc32(0))
+        {
+            AZ_Warning("SourceAssetsCrcIndex", false, "Zero CRC for source asset %s", asset.m_sourceAssetGlobalPath.c_str());
+            return;
+        }
+
+        auto& paths = m_sourceAssetsByCrc[crc];
+        if (!paths.empty())
+        {
+            AZ_Warning(
+                "SourceAssetsCrcIndex",
+                false,
+                "Asset %s has the same CRC as %s",
+                asset.m_sourceAssetGlobalPath.c_str(),
+                paths.begin()->c_str());
+        }
+        paths.insert(asset.m_sourceAssetGlobalPath);
+
+        SourceAssetEntry entry;
+        entry.m_crc = crc;
+        entry.m_asset = AZStd::move(asset);
+        AZ::IO::Path globalPath = entry.m_asset.m_sourceAssetGlobalPath;
+        m_sourceAssets.insert_or_assign(AZStd::move(globalPath), AZStd::move(entry));
+    }
+
+    void SourceAssetsCrcIndex::RemoveSourceAsset(const AZ::IO::Path& globalPath)
+    {
+        auto sourceAssetIt = m_sourceAssets.find(globalPath);
+        if (sourceAssetIt == m_sourceAssets.end())
+        {
+            return;
+        }
+
+        if (auto pathsIt = m_sourceAssetsByCrc.find(sourceAssetIt->second.m_crc); pathsIt != m_sourceAssetsByCrc.end())
+        {
+            pathsIt->second.erase(globalPath);
+            if (pathsIt->second.empty())
+            {
+                m_sourceAssetsByCrc.erase(pathsIt);
+            }
+        }
+        m_sourceAssets.erase(sourceAssetIt);
+    }
+
+    bool SourceAssetsCrcIndex::IsSupportedSourceFile(AZStd::string_view filename) const
+    {
+        return AZStd::any_of(
+            m_supportedExtensions.begin(),
+            m_supportedExtensions.end(),
+            [filename](const AZStd::string& extension)
+            {
+                return AZ::StringFunc::EndsWith(filename, extension, false);
+            });
+    }
+
+    AZStd::vector<AZ::IO::Path> SourceAssetsCrcIndex::FindValidSourceAssetPaths(AZ::Crc32 crc)
+    {
+        auto pathsIt = m_sourceAssetsByCrc.find(crc);
+        if (pathsIt == m_sourceAssetsByCrc.end())
+        {
+            return {};
+        }
+
+        // Validate the indexed assets against the files on disk, an outdated asset is indexed again under its current checksum.
+        const AZStd::vector<AZ::IO::Path> paths(pathsIt->second.begin(), pathsIt->second.end());
+        AZStd::vector<AZ::IO::Path> validPaths;
+        for (const AZ::IO::Path& path : paths)
+        {
+            if (UpdateFileEntry(path) == crc)
+            {
+                validPaths.push_back(path);
+            }
+            else if (auto sourceAssetIt = m_sourceAssets.find(path); sourceAssetIt != m_sourceAssets.end())
+            {
+                AvailableAsset outdatedAsset = sourceAssetIt->second.m_asset;
+                RemoveSourceAsset(path);
+                AddSourceAsset(AZStd::move(outdatedAsset));
+            }
+        }
+
+        AZStd::sort(
+            validPaths.begin(),
+            validPaths.end(),
+            [](const AZ::IO::Path& lhs, const AZ::IO::Path& rhs)
+            {
+                return lhs.Native() < rhs.Native();
+            });
+        return validPaths;
+    }
+
+    const AvailableAsset* SourceAssetsCrcIndex::FindSourceAsset(AZ::Crc32 crc) const
+    {
+        auto pathsIt = m_sourceAssetsByCrc.find(crc);
+        if (pathsIt == m_sourceAssetsByCrc.end() || pathsIt->second.empty())
+        {
+            return nullptr;
+        }
+
+        // Pick a deterministic asset when several share a checksum, regardless of the order in which they were indexed.
+        const AZ::IO::Path* firstPath = &*pathsIt->second.begin();
+        for (const AZ::IO::Path& path : pathsIt->second)
+        {
+            if (path.Native() < firstPath->Native())
+            {
+                firstPath = &path;
+            }
+        }
+
+        auto sourceAssetIt = m_sourceAssets.find(*firstPath);
+        return sourceAssetIt != m_sourceAssets.end() ? &sourceAssetIt->second.m_asset : nullptr;
+    }
+} // namespace ROS2::Utils
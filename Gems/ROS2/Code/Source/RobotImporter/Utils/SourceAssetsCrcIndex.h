@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzToolsFramework/API/EditorAssetSystemAPI.h>
+#include <RobotImporter/Utils/SourceAssetsStorage.h>
+
+namespace ROS2::Utils
+{
+    //! Persistent index of source asset checksums, used to match files referenced by SDF/URDF with O3DE source assets.
+    //! Every checksum, and the content hash of files which were compared by content, is stored together with the size and
+    //! modification time of its file, and a file is only read again when one of them changes. The index is saved to the project user folder, so it survives between Editor sessions and
+    //! is shared by every SdfAssetBuilder job, instead of reading every source asset in the project for each import.
+    //! While the index is listening for Asset Processor notifications, changed and removed source files are applied
+    //! incrementally and the asset database is enumerated only once.
+    class SourceAssetsCrcIndex : private AzToolsFramework::AssetSystemBus::Handler
+    {
+    public:
+        AZ_RTTI(SourceAssetsCrcIndex, "{6D8C43F2-5A0B-4E8B-9C1D-2B7F4E6A9D31}");
+        AZ_DISABLE_COPY_MOVE(SourceAssetsCrcIndex);
+
+        //! Version of the index file, incremented whenever its layout changes.
+        static constexpr AZ::u32 FileVersion = 2;
+
+        //! @param indexFilePath - file the index is loaded from and saved to, the index is not persisted if the path is empty
+        explicit SourceAssetsCrcIndex(AZ::IO::Path indexFilePath = {});
+        ~SourceAssetsCrcIndex() override;
+
+        //! Returns the location of the index file in the project user folder, or an empty path if the project is unknown.
+        static AZ::IO::Path GetDefaultIndexFilePath();
+
+        //! Loads the index, registers it as the instance used by the functions in SourceAssetsStorage.h and,
+        //! optionally, starts applying source file notifications from the Asset Processor.
+        //! @param listenForChanges - if false the asset database is scanned again when a checksum is not found, at most once per builder job
+        void Activate(bool listenForChanges);
+
+        //! Marks the start of a builder job. An index which is not listening for changes scans the asset database again on the
+        //! first lookup miss after this call, further misses of the same job are not found until the next job begins.
+        void BeginBuilderJob();
+
+        //! Unregisters the index and saves it if it changed.
+        void Deactivate();
+
+        //! Computes CRC32 on the first kilobyte of a file, the file is only read if it changed since it was last indexed.
+        AZ::Crc32 GetFileCRC(const AZ::IO::Path& filename);
+
+        //! Hashes the whole content of a file, the file is only read if it changed since it was last hashed.
+        //! @returns content hash of the file, zero if the file is empty or cannot be read
+        AZ::u64 GetFileContentHash(const AZ::IO::Path& filename);
+
+        //! Hashes the whole content of several files, files which changed since they were last hashed are read in parallel on the job system.
+        //! @returns content hashes in the order of the files, zero for files which are empty or cannot be read
+        AZStd::vector<AZ::u64> GetFileContentHashes(const AZStd::vector<AZ::IO::Path>& filenames);
+
+        //! Finds source assets with the same content as the given files.
+        //! Candidates are preselected by the checksum of the first kilobyte and only they are hashed, so a file is matched exactly
+        //! even when it shares its header with unrelated source assets.
+        //! @returns map where key is the given file and value is AvailableAsset, files without a match are omitted
+        AZStd::unordered_map<AZ::IO::Path, AvailableAsset> FindSourceAssetsByContent(const AZStd::vector<AZ::IO::Path>& filenames);
+
+        //! Finds source assets with the given checksums.
+        //! Only the matching assets are validated, unless a checksum is missing and the index is not listening for changes,
+        //! in which case the asset database is scanned again if it was not already scanned during the current builder job.
+        //! @returns map where key is crc of source file and value is AvailableAsset, checksums that were not found are omitted
+        AZStd::unordered_map<AZ::Crc32, AvailableAsset> FindSourceAssets(const AZStd::unordered_set<AZ::Crc32>& crcs);
+
+        //! Returns every indexed source asset, bringing the whole index up to date first.
+        //! @returns map where key is crc of source file and value is AvailableAsset
+        AZStd::unordered_map<AZ::Crc32, AvailableAsset> GetSourceAssets();
+
+        //! Reads file checksums from the index file, entries which are already indexed are kept.
+        //! @returns true if the file exists and has the current version
+        bool Load();
+
+        //! Writes file checksums to the index file. The file is replaced atomically, so concurrent builders never read a partial index.
+        //! @returns true if succeed
+        bool Save();
+
+    private:
+        struct FileEntry
+        {
+            AZ::u64 m_size = 0;
+            AZ::u64 m_modificationTime = 0;
+            AZ::Crc32 m_crc;
+            AZ::u64 m_contentHash = 0; //!< Zero until the content of the file is hashed.
+        };
+
+        struct SourceAssetEntry
+        {
+            AvailableAsset m_asset;
+            AZ::Crc32 m_crc;
+        };
+
+        // AzToolsFramework::AssetSystemBus::Handler overrides ...
+        void SourceFileChanged(AZStd::string relativePath, AZStd::string scanFolder, AZ::Uuid sourceUUID) override;
+        void SourceFileRemoved(AZStd::string relativePath, AZStd::string scanFolder, AZ::Uuid sourceUUID) override;
+
+        //! Returns the checksum of a file, reading it only when its size or modification time changed. The mutex must be held.
+        AZ::Crc32 UpdateFileEntry(const AZ::IO::Path& filename);
+
+        //! Brings the indexed source assets up to date before a lookup.
+        void RefreshSourceAssets();
+
+        //! Enumerates source assets of supported extensions in the asset database, replacing the indexed source assets.
+        void RescanSourceAssets();
+
+        //! Applies source file notifications received since the last lookup.
+        void ApplyPendingChanges();
+
+        void AddSourceAsset(AvailableAsset asset);
+        void RemoveSourceAsset(const AZ::IO::Path& globalPath);
+        bool IsSupportedSourceFile(AZStd::string_view filename) const;
+
+        //! Returns sorted paths of the source assets with the given checksum, source assets whose files changed are indexed again.
+        AZStd::vector<AZ::IO::Path> FindValidSourceAssetPaths(AZ::Crc32 crc);
+
+        //! Returns the source asset with the given checksum, preferring the lexicographically first path when several match.
+        const AvailableAsset* FindSourceAsset(AZ::Crc32 crc) const;
+
+        AZ::IO::Path m_indexFilePath;
+        AZStd::recursive_mutex m_mutex;
+
+        //! Checksums of every file seen by the index, keyed by absolute path.
+        AZStd::unordered_map<AZ::IO::Path, FileEntry> m_files;
+        //! Source assets known to the asset database, keyed by absolute path.
+        AZStd::unordered_map<AZ::IO::Path, SourceAssetEntry> m_sourceAssets;
+        //! Absolute paths of the source assets with a given checksum.
+        AZStd::unordered_map<AZ::Crc32, AZStd::unordered_set<AZ::IO::Path>> m_sourceAssetsByCrc;
+        //! Source files reported by the Asset Processor since the last lookup, a null source GUID marks a removal.
+        AZStd::unordered_map<AZ::IO::Path, AvailableAsset> m_pendingChanges;
+        AZStd::vector<AZStd::string> m_supportedExtensions;
+
+        bool m_listenForChanges = false;
+        bool m_rescanRequired = true;
+        //! Set by BeginBuilderJob and cleared by any scan, so that lookup misses scan the asset database at most once per job.
+        bool m_rescanOnMissAllowed = false;
+        bool m_dirty = false;
+    };
+} // namespace ROS2::Utils
@@ -9,12 +9,18 @@
 #include "SourceAssetsStorage.h"
 #include "AzCore/Outcome/Outcome.h"
 #include "RobotImporterUtils.h"
+#include "SourceAssetsCrcIndex.h"
 #include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
 #include <Atom/RPI.Reflect/Model/ModelAsset.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Serialization/Json/JsonImporter.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Utils/TypeHash.h>
 #include <AzCore/Utils/Utils.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Asset/AssetSystemBus.h>
@@ -48,6 +54,37 @@ namespace ROS2::Utils
         {
             m_exportMethod = method;
         }
+        void SetConvexDecompositionLimits(AZ::u32 maxConvexHulls, AZ::u32 maxVerticesPerConvexHull)
+        {
+            m_convexDecompositionParams.m_maxConvexHulls = maxConvexHulls;
+            m_convexDecompositionParams.m_maxNumVerticesPerConvexHull = maxVerticesPerConvexHull;
+        }
+        void SetConvexVertexLimit(AZ::u32 maxVertices)
+        {
+            m_convexAssetParams.m_vertexLimit = maxVertices;
+        }
+        void SetColliderMeshExport(const ColliderMeshExport& colliderMeshExport)
+        {
+            switch (colliderMeshExport.m_exportMethod)
+            {
+            case ColliderMeshExportMethod::ConvexDecomposition:
+                SetMeshExportMethod(PhysX::Pipeline::MeshExportMethod::Convex);
+                SetIsDecomposeMeshes(true);
+                SetConvexDecompositionLimits(colliderMeshExport.m_maxConvexHulls, colliderMeshExport.m_maxVerticesPerConvexHull);
+                SetConvexVertexLimit(colliderMeshExport.m_maxVerticesPerConvexHull);
+                break;
+            case ColliderMeshExportMethod::ConvexHull:
+                SetMeshExportMethod(PhysX::Pipeline::MeshExportMethod::Convex);
+                SetIsDecomposeMeshes(false);
+                SetConvexVertexLimit(colliderMeshExport.m_maxVerticesPerConvexHull);
+                break;
+            case ColliderMeshExportMethod::Primitive:
+                // The primitive shape which fits the mesh best is chosen by the PhysX scene pipeline
+                SetMeshExportMethod(PhysX::Pipeline::MeshExportMethod::Primitive);
+                SetIsDecomposeMeshes(false);
+                break;
+            }
+        }
     };
 
     //! Returns supported filenames by Asset Processor
@@ -80,7 +117,7 @@ namespace ROS2::Utils
     }
 
     /// Function computes CRC32 on first kilobyte of file.
-    AZ::Crc32 GetFileCRC(const AZ::IO::Path& filename)
+    AZ::Crc32 ComputeFileCRC(const AZ::IO::Path& filename)
     {
         auto fileSize = AZ::IO::SystemFile::Length(filename.c_str());
         fileSize = AZStd::min(fileSize, 1024ull); // limit crc computation to first kilobyte
@@ -100,6 +137,46 @@ namespace ROS2::Utils
         return r;
     }
 
+    AZ::u64 ComputeFileContentHash(const AZ::IO::Path& filename)
+    {
+        AZ::IO::SystemFile file;
+        if (!file.Open(filename.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+        {
+            return 0;
+        }
+
+        // Meshes are read in large chunks, each chunk seeds the hash of the next one.
+        constexpr AZ::IO::SizeType ChunkSize = 1024 * 1024;
+        AZStd::vector<AZ::u8> buffer;
+        buffer.resize_no_construct(ChunkSize);
+        AZ::HashValue64 hash{ 0 };
+        AZ::IO::SizeType totalSize = 0;
+        for (AZ::IO::SizeType readSize = file.Read(ChunkSize, buffer.data()); readSize > 0; readSize = file.Read(ChunkSize, buffer.data()))
+        {
+            hash = AZ::TypeHash64(buffer.data(), readSize, hash);
+            totalSize += readSize;
+        }
+        return totalSize > 0 ? static_cast<AZ::u64>(hash) : 0;
+    }
+
+    AZ::Crc32 GetFileCRC(const AZ::IO::Path& filename)
+    {
+        if (auto* crcIndex = AZ::Interface<SourceAssetsCrcIndex>::Get())
+        {
+            return crcIndex->GetFileCRC(filename);
+        }
+        return ComputeFileCRC(filename);
+    }
+
+    AZ::u64 GetFileContentHash(const AZ::IO::Path& filename)
+    {
+        if (auto* crcIndex = AZ::Interface<SourceAssetsCrcIndex>::Get())
+        {
+            return crcIndex->GetFileContentHash(filename);
+        }
+        return ComputeFileContentHash(filename);
+    }
+
     AZStd::vector<AZStd::string> GetProductAssets(const AZ::Uuid& sourceAssetUUID)
     {
         AZStd::vector<AZStd::string> productPaths;
@@ -172,6 +249,49 @@ namespace ROS2::Utils
         return GetProductAssetId(sourceAssetUUID, azrtti_typeid<PhysX::Pipeline::MeshAsset>());
     }
 
+    ProductAssetIdMap GetProductAssetIds(const AZStd::unordered_set<AZ::Uuid>& sourceAssetUUIDs)
+    {
+        // A single query returns every product of a source asset, so all product types are picked from it at once.
+        auto resolveProductAssetIds = [](const AZ::Uuid& sourceAssetUUID, ProductAssetIds& productAssetIds)
+        {
+            AZStd::vector<AZ::Data::AssetInfo> productsAssetInfo;
+            using AssetSysReqBus = AzToolsFramework::AssetSystemRequestBus;
+            bool ok{ false };
+            AssetSysReqBus::BroadcastResult(ok, &AssetSysReqBus::Events::GetAssetsProducedBySourceUUID, sourceAssetUUID, productsAssetInfo);
+            if (!ok)
+            {
+                return;
+            }
+            for (const auto& product : productsAssetInfo)
+            {
+                if (product.m_assetType == azrtti_typeid<AZ::RPI::ModelAsset>() && !productAssetIds.m_modelAssetId.IsValid())
+                {
+                    productAssetIds.m_modelAssetId = product.m_assetId;
+                }
+                else if (product.m_assetType == azrtti_typeid<PhysX::Pipeline::MeshAsset>() && !productAssetIds.m_physXMeshAssetId.IsValid())
+                {
+                    productAssetIds.m_physXMeshAssetId = product.m_assetId;
+                }
+                else if (
+                    product.m_assetType == azrtti_typeid<AZ::RPI::StreamingImageAsset>() && !productAssetIds.m_imageAssetId.IsValid())
+                {
+                    productAssetIds.m_imageAssetId = product.m_assetId;
+                }
+            }
+        };
+
+        // The queries are issued serially, the Asset Processor connection handles one request at a time,
+        // so broadcasting from several jobs would only contend on the bus lock.
+        ProductAssetIdMap productAssetIdMap;
+        productAssetIdMap.reserve(sourceAssetUUIDs.size());
+        for (const auto& sourceAssetUUID : sourceAssetUUIDs)
+        {
+            resolveProductAssetIds(sourceAssetUUID, productAssetIdMap[sourceAssetUUID]);
+        }
+
+        return productAssetIdMap;
+    }
+
     AvailableAsset GetAvailableAssetInfo(const AZStd::string& globalSourceAssetPath)
     {
         using AssetSysReqBus = AzToolsFramework::AssetSystemRequestBus;
@@ -212,90 +332,197 @@ namespace ROS2::Utils
 
     AZStd::unordered_map<AZ::Crc32, AvailableAsset> GetInterestingSourceAssetsCRC()
     {
-        // connect to database API
-        const AZStd::vector<AZStd::string> InterestingExtensions = GetSupportedExtensions();
-        AZStd::unordered_map<AZ::Crc32, AvailableAsset> availableAssets;
+        if (auto* crcIndex = AZ::Interface<SourceAssetsCrcIndex>::Get())
+        {
+            return crcIndex->GetSourceAssets();
+        }
+
+        // Without an active index the checksums are computed for this call only.
+        SourceAssetsCrcIndex crcIndex;
+        return crcIndex.GetSourceAssets();
+    }
 
-        AzToolsFramework::AssetDatabase::AssetDatabaseConnection assetDatabaseConnection;
-        if (!assetDatabaseConnection.OpenDatabase())
+    namespace
+    {
+        //! Copies of referenced assets are bound by the disk rather than the CPU, so only a few of them run at once.
+        constexpr size_t MaxConcurrentAssetCopies = 8;
+
+        //! Calls the function with every index below count, using at most MaxConcurrentAssetCopies jobs.
+        template<typename IndexFunction>
+        void ForEachIndexConcurrently(size_t count, const IndexFunction& function)
         {
-            AZ_Warning("GetInterestingSourceAssetsCRC", false, "Cannot open database");
-            return {};
+            const size_t jobCount = AZStd::min(count, MaxConcurrentAssetCopies);
+            if (jobCount > 1 && AZ::JobContext::GetGlobalContext() != nullptr)
+            {
+                AZStd::atomic<size_t> nextIndex{ 0 };
+                AZ::JobCompletion completion;
+                for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction(
+                        [&nextIndex, &function, count]()
+                        {
+                            for (size_t index = nextIndex++; index < count; index = nextIndex++)
+                            {
+                                function(index);
+                            }
+                        },
+                        true);
+                    job->SetDependent(&completion);
+                    job->Start();
+                }
+                completion.StartAndWaitForCompletion();
+            }
+            else
+            {
+                for (size_t index = 0; index < count; ++index)
+                {
+                    function(index);
+                }
+            }
         }
-        auto callback = [&availableAssets](AzToolsFramework::AssetDatabase::SourceDatabaseEntry& entry)
+
+        //! State of a referenced asset while it is copied into the project.
+        struct ReferencedAssetCopy
         {
-            using AssetSysReqBus = AzToolsFramework::AssetSystemRequestBus;
-            AvailableAsset foundAsset;
-            foundAsset.m_sourceGuid = entry.m_sourceGuid;
+            UrdfAsset* m_urdfAsset = nullptr;
+            AZ::IO::Path m_targetPathAssetTmp;
+            AZ::IO::Path m_targetPathAssetDst;
+            //! True when the asset is in the temporary directory and can be moved to its destination.
+            bool m_staged = false;
+            //! Source and destination paths of the textures referenced by a mesh.
+            AZStd::vector<AZStd::pair<AZ::IO::Path, AZ::IO::Path>> m_textureCopies;
+            //! True when any of the textures could not be copied, the asset is still moved but its copy has failed.
+            bool m_textureCopyFailed = false;
+        };
 
-            using AssetSysReqBus = AzToolsFramework::AssetSystemRequestBus;
+        ReferencedAssetCopy MakeReferencedAssetCopy(
+            const ImportedAssetsDest& importedAssetsDest, UrdfAsset& urdfAsset, unsigned int duplicationCounter)
+        {
+            AZStd::string filename = urdfAsset.m_resolvedUrdfPath.Filename().String();
+            if (duplicationCounter > 0)
+            {
+                AZStd::string stem = urdfAsset.m_resolvedUrdfPath.Stem().String();
+                AZStd::string extension = urdfAsset.m_resolvedUrdfPath.Extension().String();
+                filename = AZStd::string::format("%s_dup_%u%s", stem.c_str(), duplicationCounter, extension.c_str());
+            }
 
-            // get source asset info
-            bool sourceAssetFound{ false };
-            AZ::Data::AssetInfo assetInfo;
-            AZStd::string watchFolder;
-            AssetSysReqBus::BroadcastResult(
-                sourceAssetFound, &AssetSysReqBus::Events::GetSourceInfoBySourceUUID, entry.m_sourceGuid, assetInfo, watchFolder);
-            if (!sourceAssetFound)
+            ReferencedAssetCopy assetCopy;
+            assetCopy.m_urdfAsset = &urdfAsset;
+            assetCopy.m_targetPathAssetDst = importedAssetsDest.importDirectoryDst / filename;
+            assetCopy.m_targetPathAssetTmp = importedAssetsDest.importDirectoryTmp / filename;
+            return assetCopy;
+        }
+
+        //! Copies the asset to the temporary location ignored by the Asset Processor, creates the scene manifest of a mesh
+        //! at the destination location and lists the textures of the mesh to copy.
+        void StageReferencedAsset(
+            ReferencedAssetCopy& assetCopy, const ImportedAssetsDest& importedAssetsDest, AZ::IO::FileIOBase* fileIO)
+        {
+            UrdfAsset& urdfAsset = *assetCopy.m_urdfAsset;
+            if (fileIO->Exists(assetCopy.m_targetPathAssetDst.c_str()))
             {
-                AZ_Warning("GetInterestingSourceAssetsCRC", false, "Cannot find source asset info for %s", entry.ToString().c_str());
-                return true;
+                AZ_Printf("CopyAssetForURDF", "File %s already exists, omitting import", assetCopy.m_targetPathAssetDst.c_str());
+                urdfAsset.m_copyStatus = CopyStatus::Exists;
+                return;
             }
 
-            const auto fullSourcePath = AZ::IO::Path(watchFolder) / AZ::IO::Path(assetInfo.m_relativePath);
+            urdfAsset.m_copyStatus = CopyStatus::Copying;
+
+            // copy mesh file to temporary location ignored by AP
+            const auto outcomeCopyTmp = fileIO->Copy(urdfAsset.m_resolvedUrdfPath.c_str(), assetCopy.m_targetPathAssetTmp.c_str());
+            AZ_Printf(
+                "CopyAssetForURDF",
+                "Copy %s to %s, result: %d",
+                urdfAsset.m_resolvedUrdfPath.c_str(),
+                assetCopy.m_targetPathAssetTmp.c_str(),
+                outcomeCopyTmp.GetResultCode());
+            if (!outcomeCopyTmp)
+            {
+                urdfAsset.m_copyStatus = CopyStatus::Failed;
+                return;
+            }
 
-            foundAsset.m_sourceAssetRelativePath = assetInfo.m_relativePath;
-            foundAsset.m_sourceAssetGlobalPath = fullSourcePath.String();
+            const bool needsVisual = (urdfAsset.m_assetReferenceType & ReferencedAssetType::VisualMesh) == ReferencedAssetType::VisualMesh;
+            const bool needsCollider =
+                (urdfAsset.m_assetReferenceType & ReferencedAssetType::ColliderMesh) == ReferencedAssetType::ColliderMesh;
+            if (!needsVisual && !needsCollider)
+            {
+                assetCopy.m_staged = true;
+                return;
+            }
 
-            AZ::Crc32 crc = Utils::GetFileCRC(foundAsset.m_sourceAssetGlobalPath);
-            if (crc == AZ::Crc32(0))
+            // if the asset is a mesh, create asset info at destination location using the temporary mesh file
+            const AZ::IO::Path targetPathAssetInfo(assetCopy.m_targetPathAssetDst.Native() + ".assetinfo");
+            if (!CreateSceneManifest(
+                    assetCopy.m_targetPathAssetTmp, targetPathAssetInfo, needsCollider, needsVisual, urdfAsset.m_colliderMeshExport))
             {
-                AZ_Warning(
-                    "GetInterestingSourceAssetsCRC", false, "Zero CRC for source asset %s", foundAsset.m_sourceAssetGlobalPath.c_str());
-                return true;
+                return;
             }
-            AZ_Printf("GetInterestingSourceAssetsCRC", "Found asset:");
-            AZ_Printf("GetInterestingSourceAssetsCRC", "\tm_sourceAssetRelativePath  : %s", foundAsset.m_sourceAssetRelativePath.c_str());
-            AZ_Printf("GetInterestingSourceAssetsCRC", "\tm_sourceAssetGlobalPath    : %s", foundAsset.m_sourceAssetGlobalPath.c_str());
-            AZ_Printf("GetInterestingSourceAssetsCRC", "\tm_productAssetRelativePath : %s", foundAsset.m_productAssetRelativePath.c_str());
-            AZ_Printf(
-                "GetInterestingSourceAssetsCRC",
-                "\tm_sourceGuid               : %s",
-                foundAsset.m_sourceGuid.ToString<AZStd::string>().c_str());
-            AZ_Printf("GetInterestingSourceAssetsCRC", "\tcrc                        : %d", crc);
+            assetCopy.m_staged = true;
 
-            auto availableAssetIt = availableAssets.find(crc);
-            if (availableAssetIt != availableAssets.end())
+            // additional assets such as textures are copied directly to destination location
+            const auto& meshTextureAssets = Utils::GetMeshTextureAssets(assetCopy.m_targetPathAssetTmp);
+            for (const auto& unresolvedAssetPath : meshTextureAssets)
             {
-                AZ_Warning(
-                    "GetInterestingSourceAssetsCRC", false, "Asset already in database : %s ", foundAsset.m_sourceAssetGlobalPath.c_str());
-                AZ_Warning(
-                    "GetInterestingSourceAssetsCRC", false, "Found asset : %s ", availableAssetIt->second.m_sourceAssetGlobalPath.c_str());
+                // Manifest returns local path in Project's directory temp folder
+                const AZ::IO::Path assetLocalPath(AZ::IO::Path(AZ::IO::Path(AZ::Utils::GetProjectPath()) / unresolvedAssetPath)
+                                                      .LexicallyRelative(importedAssetsDest.importDirectoryTmp));
+
+                assetCopy.m_textureCopies.emplace_back(
+                    AZ::IO::Path(urdfAsset.m_resolvedUrdfPath.ParentPath()) / assetLocalPath,
+                    importedAssetsDest.importDirectoryDst / assetLocalPath);
             }
-            else
+        }
+
+        bool CopyTextureAsset(const AZ::IO::Path& assetFullPathSrc, const AZ::IO::Path& assetFullPathDst, AZ::IO::FileIOBase* fileIO)
+        {
+            const auto outcomeMkdir = fileIO->CreatePath(AZ::IO::Path(assetFullPathDst.ParentPath()).c_str());
+            const bool copied = outcomeMkdir && fileIO->Copy(assetFullPathSrc.c_str(), assetFullPathDst.c_str());
+            AZ_Warning("CopyAssetForURDF", copied, "Cannot copy texture %s to %s", assetFullPathSrc.c_str(), assetFullPathDst.c_str());
+            return copied;
+        }
+
+        //! Moves a staged asset from the temporary location to the destination location.
+        void MoveStagedReferencedAsset(ReferencedAssetCopy& assetCopy, AZ::IO::FileIOBase* fileIO)
+        {
+            if (!assetCopy.m_staged)
             {
-                availableAssets.insert({ crc, foundAsset });
+                return;
             }
-            return true;
-        };
 
-        for (auto& extension : InterestingExtensions)
+            const auto outcomeMoveDst = fileIO->Rename(assetCopy.m_targetPathAssetTmp.c_str(), assetCopy.m_targetPathAssetDst.c_str());
+            AZ_Printf(
+                "CopyAssetForURDF",
+                "Rename file %s to %s, result: %d",
+                assetCopy.m_targetPathAssetTmp.c_str(),
+                assetCopy.m_targetPathAssetDst.c_str(),
+                outcomeMoveDst.GetResultCode());
+
+            assetCopy.m_urdfAsset->m_copyStatus = (outcomeMoveDst && !assetCopy.m_textureCopyFailed) ? CopyStatus::Copied : CopyStatus::Failed;
+        }
+
+        //! Fills the information about the source asset once the Asset Processor is aware of it.
+        void FinishReferencedAssetCopy(ReferencedAssetCopy& assetCopy)
         {
-            assetDatabaseConnection.QuerySourceLikeSourceName(
-                extension.c_str(), AzToolsFramework::AssetDatabase::AssetDatabaseConnection::LikeType::EndsWith, callback);
+            UrdfAsset& urdfAsset = *assetCopy.m_urdfAsset;
+            if (urdfAsset.m_copyStatus == CopyStatus::Exists || urdfAsset.m_copyStatus == CopyStatus::Copied)
+            {
+                urdfAsset.m_availableAssetInfo = Utils::GetAvailableAssetInfo(assetCopy.m_targetPathAssetDst.String());
+            }
+            urdfAsset.m_urdfPath = "";
+            urdfAsset.m_urdfFileCRC = AZ::Crc32();
         }
-        return availableAssets;
-    }
+    } // namespace
 
     UrdfAssetMap CopyReferencedAssetsAndCreateAssetMap(
         const AssetFilenameReferences& assetFilenames,
         const AZStd::string& urdfFilename,
         const SdfAssetBuilderSettings& sdfBuilderSettings,
+        const ColliderMeshExportMethods& colliderMeshExportMethods,
         AZStd::string_view outputDirSuffix,
         AZ::IO::FileIOBase* fileIO)
     {
-        auto urdfAssetMap = CreateAssetMap(assetFilenames, urdfFilename, sdfBuilderSettings);
-        AZStd::mutex urdfAssetMapMutex;
+        auto urdfAssetMap = CreateAssetMap(assetFilenames, urdfFilename, sdfBuilderSettings, colliderMeshExportMethods);
         if (urdfAssetMap.empty())
         {
             return urdfAssetMap;
@@ -306,10 +533,20 @@ namespace ROS2::Utils
         {
             return urdfAssetMap;
         }
+        const ImportedAssetsDest& importedAssetsDest = destDirectory.GetValue();
 
+        AZStd::vector<ReferencedAssetCopy> assetCopies;
+        assetCopies.reserve(urdfAssetMap.size());
         AZStd::unordered_map<AZ::IO::Path, unsigned int> duplicatedFilenames;
         for (auto& [unresolvedFileName, urdfAsset] : urdfAssetMap)
         {
+            if (urdfAsset.m_resolvedUrdfPath.empty())
+            {
+                AZ_Warning("CopyAssetForURDF", false, "There is no resolved path for %s", unresolvedFileName.c_str());
+                urdfAsset.m_copyStatus = CopyStatus::Unresolvable;
+                continue;
+            }
+
             if (duplicatedFilenames.contains(unresolvedFileName))
             {
                 duplicatedFilenames[unresolvedFileName]++;
@@ -318,9 +555,105 @@ namespace ROS2::Utils
             {
                 duplicatedFilenames[unresolvedFileName] = 0;
             }
-            CopyReferencedAsset(unresolvedFileName, destDirectory.GetValue(), urdfAsset, duplicatedFilenames[unresolvedFileName]);
+            assetCopies.emplace_back(MakeReferencedAssetCopy(importedAssetsDest, urdfAsset, duplicatedFilenames[unresolvedFileName]));
         }
-        Utils::RemoveTmpDir(destDirectory.GetValue().importDirectoryTmp);
+
+        // Assets sharing a destination are copied once, the others find the copied file once it is moved to the destination.
+        AZStd::vector<ReferencedAssetCopy*> concurrentCopies;
+        AZStd::vector<ReferencedAssetCopy*> sequentialCopies;
+        AZStd::unordered_set<AZ::IO::Path> destinations;
+        for (auto& assetCopy : assetCopies)
+        {
+            if (destinations.emplace(assetCopy.m_targetPathAssetDst).second)
+            {
+                concurrentCopies.push_back(&assetCopy);
+            }
+            else
+            {
+                sequentialCopies.push_back(&assetCopy);
+            }
+        }
+
+        ForEachIndexConcurrently(
+            concurrentCopies.size(),
+            [&concurrentCopies, &importedAssetsDest, fileIO](size_t index)
+            {
+                StageReferencedAsset(*concurrentCopies[index], importedAssetsDest, fileIO);
+            });
+
+        // Meshes may share textures, every texture is copied once before any mesh is moved to the destination location.
+        AZStd::unordered_map<AZ::IO::Path, AZ::IO::Path> textureCopies;
+        for (const ReferencedAssetCopy* assetCopy : concurrentCopies)
+        {
+            for (const auto& [assetFullPathSrc, assetFullPathDst] : assetCopy->m_textureCopies)
+            {
+                textureCopies.emplace(assetFullPathDst, assetFullPathSrc);
+            }
+        }
+        const AZStd::vector<AZStd::pair<AZ::IO::Path, AZ::IO::Path>> textureCopyList(textureCopies.begin(), textureCopies.end());
+        // Bytes rather than bools, so that concurrent writes to different elements do not touch the same memory
+        AZStd::vector<AZ::u8> textureCopied(textureCopyList.size(), 0);
+        ForEachIndexConcurrently(
+            textureCopyList.size(),
+            [&textureCopyList, &textureCopied, fileIO](size_t index)
+            {
+                const auto& [assetFullPathDst, assetFullPathSrc] = textureCopyList[index];
+                textureCopied[index] = CopyTextureAsset(assetFullPathSrc, assetFullPathDst, fileIO) ? 1 : 0;
+            });
+
+        // The copy of every mesh referencing a texture which could not be copied fails
+        AZStd::unordered_set<AZ::IO::Path> failedTextures;
+        for (size_t index = 0; index < textureCopyList.size(); ++index)
+        {
+            if (textureCopied[index] == 0)
+            {
+                failedTextures.insert(textureCopyList[index].first);
+            }
+        }
+        for (ReferencedAssetCopy* assetCopy : concurrentCopies)
+        {
+            for (const auto& textureCopy : assetCopy->m_textureCopies)
+            {
+                assetCopy->m_textureCopyFailed = assetCopy->m_textureCopyFailed || failedTextures.contains(textureCopy.second);
+            }
+        }
+
+        for (ReferencedAssetCopy* assetCopy : concurrentCopies)
+        {
+            MoveStagedReferencedAsset(*assetCopy, fileIO);
+        }
+
+        for (ReferencedAssetCopy* assetCopy : sequentialCopies)
+        {
+            StageReferencedAsset(*assetCopy, importedAssetsDest, fileIO);
+            for (const auto& [assetFullPathSrc, assetFullPathDst] : assetCopy->m_textureCopies)
+            {
+                if (!CopyTextureAsset(assetFullPathSrc, assetFullPathDst, fileIO))
+                {
+                    assetCopy->m_textureCopyFailed = true;
+                }
+            }
+            MoveStagedReferencedAsset(*assetCopy, fileIO);
+        }
+        Utils::RemoveTmpDir(importedAssetsDest.importDirectoryTmp);
+
+        // The Asset Processor is made aware of every copied file at once, instead of once per file
+        AZStd::vector<AZ::IO::Path> copiedAssetPaths;
+        for (const auto& assetCopy : assetCopies)
+        {
+            if (assetCopy.m_urdfAsset->m_copyStatus == CopyStatus::Copied)
+            {
+                copiedAssetPaths.push_back(assetCopy.m_targetPathAssetDst);
+            }
+        }
+        FlushIOOfAssets(copiedAssetPaths);
+
+        ForEachIndexConcurrently(
+            assetCopies.size(),
+            [&assetCopies](size_t index)
+            {
+                FinishReferencedAssetCopy(assetCopies[index]);
+            });
 
         return urdfAssetMap;
     }
@@ -343,9 +676,51 @@ namespace ROS2::Utils
             urdfToAsset.emplace(assetPath, AZStd::move(asset));
         }
 
-        if (!urdfToAsset.empty())
+        if (!urdfToAsset.empty() && sdfBuilderSettings.m_matchAssetsByContentHash)
         {
-            AZStd::unordered_map<AZ::Crc32, AvailableAsset> availableAssets = Utils::GetInterestingSourceAssetsCRC();
+            AZStd::vector<AZ::IO::Path> resolvedPaths;
+            for (const auto& [assetPath, asset] : urdfToAsset)
+            {
+                resolvedPaths.push_back(asset.m_resolvedUrdfPath);
+            }
+
+            AZStd::unordered_map<AZ::IO::Path, AvailableAsset> availableAssets;
+            if (auto* crcIndex = AZ::Interface<SourceAssetsCrcIndex>::Get())
+            {
+                availableAssets = crcIndex->FindSourceAssetsByContent(resolvedPaths);
+            }
+            else
+            {
+                SourceAssetsCrcIndex localCrcIndex;
+                availableAssets = localCrcIndex.FindSourceAssetsByContent(resolvedPaths);
+            }
+
+            for (auto& [assetPath, asset] : urdfToAsset)
+            {
+                if (auto foundSourceAsset = availableAssets.find(asset.m_resolvedUrdfPath); foundSourceAsset != availableAssets.end())
+                {
+                    asset.m_availableAssetInfo = foundSourceAsset->second;
+                }
+            }
+        }
+        else if (!urdfToAsset.empty())
+        {
+            AZStd::unordered_set<AZ::Crc32> referencedCrcs;
+            for (const auto& [assetPath, asset] : urdfToAsset)
+            {
+                referencedCrcs.insert(asset.m_urdfFileCRC);
+            }
+
+            AZStd::unordered_map<AZ::Crc32, AvailableAsset> availableAssets;
+            if (auto* crcIndex = AZ::Interface<SourceAssetsCrcIndex>::Get())
+            {
+                availableAssets = crcIndex->FindSourceAssets(referencedCrcs);
+            }
+            else
+            {
+                SourceAssetsCrcIndex localCrcIndex;
+                availableAssets = localCrcIndex.FindSourceAssets(referencedCrcs);
+            }
 
             // Search for suitable mappings by comparing checksum
             for (auto it = urdfToAsset.begin(); it != urdfToAsset.end(); it++)
@@ -362,7 +737,12 @@ namespace ROS2::Utils
         return urdfToAsset;
     }
 
-    bool CreateSceneManifest(const AZ::IO::Path& sourceAssetPath, const AZ::IO::Path& assetInfoFile, const bool collider, const bool visual)
+    bool CreateSceneManifest(
+        const AZ::IO::Path& sourceAssetPath,
+        const AZ::IO::Path& assetInfoFile,
+        const bool collider,
+        const bool visual,
+        const ColliderMeshExport& colliderMeshExport)
     {
         // Start with a default set of import settings.
         AZ::SceneAPI::SceneImportSettings importSettings;
@@ -441,8 +821,7 @@ namespace ROS2::Utils
         if (collider)
         {
             AZStd::shared_ptr<UrdfPhysxMeshGroupHelper> physxDataMeshGroup = AZStd::make_shared<UrdfPhysxMeshGroupHelper>();
-            physxDataMeshGroup->SetIsDecomposeMeshes(true);
-            physxDataMeshGroup->SetMeshExportMethod(PhysX::Pipeline::MeshExportMethod::Convex);
+            physxDataMeshGroup->SetColliderMeshExport(colliderMeshExport);
 
             // select all nodes to this mesh group
             AZ::SceneAPI::Utilities::SceneGraphSelector::SelectAll(scene->GetGraph(), physxDataMeshGroup->GetSceneNodeSelectionList());
@@ -471,13 +850,17 @@ namespace ROS2::Utils
         return true;
     }
 
-    bool CreateSceneManifest(const AZ::IO::Path& sourceAssetPath, const bool collider, const bool visual)
+    bool CreateSceneManifest(
+        const AZ::IO::Path& sourceAssetPath, const bool collider, const bool visual, const ColliderMeshExport& colliderMeshExport)
     {
-        return CreateSceneManifest(sourceAssetPath, sourceAssetPath.Native() + ".assetinfo", collider, visual);
+        return CreateSceneManifest(sourceAssetPath, sourceAssetPath.Native() + ".assetinfo", collider, visual, colliderMeshExport);
     }
 
     UrdfAssetMap CreateAssetMap(
-        const AssetFilenameReferences& assetFilenames, const AZStd::string& urdfFilename, const SdfAssetBuilderSettings& sdfBuilderSettings)
+        const AssetFilenameReferences& assetFilenames,
+        const AZStd::string& urdfFilename,
+        const SdfAssetBuilderSettings& sdfBuilderSettings,
+        const ColliderMeshExportMethods& colliderMeshExportMethods)
     {
         UrdfAssetMap urdfAssetMap;
         if (assetFilenames.empty())
@@ -495,6 +878,10 @@ namespace ROS2::Utils
             asset.m_urdfFileCRC = AZ::Crc32();
             asset.m_assetReferenceType = assetReferenceType;
             asset.m_unresolvedFileName = unresolvedFileName;
+            const auto exportMethodIt = colliderMeshExportMethods.find(unresolvedFileName);
+            asset.m_colliderMeshExport = sdfBuilderSettings.m_colliderMeshSettings.GetExport(
+                exportMethodIt != colliderMeshExportMethods.end() ? exportMethodIt->second
+                                                                  : sdfBuilderSettings.m_colliderMeshSettings.m_exportMethod);
             urdfAssetMap.emplace(unresolvedFileName, AZStd::move(asset));
         }
 
@@ -567,109 +954,23 @@ namespace ROS2::Utils
             return CopyStatus::Unresolvable;
         }
 
-        AZStd::string filename = urdfAsset.m_resolvedUrdfPath.Filename().String();
-        if (duplicationCounter > 0)
-        {
-            AZStd::string stem = urdfAsset.m_resolvedUrdfPath.Stem().String();
-            AZStd::string extension = urdfAsset.m_resolvedUrdfPath.Extension().String();
-            filename = AZStd::string::format("%s_dup_%u%s", stem.c_str(), duplicationCounter, extension.c_str());
-        }
-
-        AZ::IO::Path targetPathAssetDst(importedAssetsDest.importDirectoryDst / filename);
-        AZ::IO::Path targetPathAssetTmp(importedAssetsDest.importDirectoryTmp / filename);
-
-        AZ::IO::Path targetPathAssetInfo(targetPathAssetDst.Native() + ".assetinfo");
-
-        bool targetAssetExists = fileIO->Exists(targetPathAssetDst.c_str());
-        if (!targetAssetExists)
+        ReferencedAssetCopy assetCopy = MakeReferencedAssetCopy(importedAssetsDest, urdfAsset, duplicationCounter);
+        StageReferencedAsset(assetCopy, importedAssetsDest, fileIO);
+        for (const auto& [assetFullPathSrc, assetFullPathDst] : assetCopy.m_textureCopies)
         {
-            urdfAsset.m_copyStatus = CopyStatus::Copying;
-
-            // copy mesh file to temporary location ignored by AP
-            const auto outcomeCopyTmp = fileIO->Copy(urdfAsset.m_resolvedUrdfPath.c_str(), targetPathAssetTmp.c_str());
-            AZ_Printf(
-                "CopyAssetForURDF",
-                "Copy %s to %s, result: %d",
-                urdfAsset.m_resolvedUrdfPath.c_str(),
-                targetPathAssetTmp.c_str(),
-                outcomeCopyTmp.GetResultCode());
-
-            if (outcomeCopyTmp)
+            if (!CopyTextureAsset(assetFullPathSrc, assetFullPathDst, fileIO))
             {
-                // call FlushIOOfAsset to ensure the asset processor is aware of the new file
-                FlushIOOfAsset(targetPathAssetTmp);
-
-                const bool needsVisual =
-                    (urdfAsset.m_assetReferenceType & ReferencedAssetType::VisualMesh) == ReferencedAssetType::VisualMesh;
-                const bool needsCollider =
-                    (urdfAsset.m_assetReferenceType & ReferencedAssetType::ColliderMesh) == ReferencedAssetType::ColliderMesh;
-                const bool isMeshFile = (needsVisual || needsCollider);
-
-                // if the asset is a mesh, create asset info at destination location using the temporary mesh file
-                const bool assetInfoOk =
-                    isMeshFile ? CreateSceneManifest(targetPathAssetTmp, targetPathAssetInfo, needsCollider, needsVisual) : true;
-
-                if (assetInfoOk)
-                {
-                    // copy additional assets such as textures directly to destination location
-                    if (isMeshFile)
-                    {
-                        const auto& meshTextureAssets = Utils::GetMeshTextureAssets(targetPathAssetTmp);
-                        for (const auto& unresolvedAssetPath : meshTextureAssets)
-                        {
-                            // Manifest returns local path in Project's directory temp folder
-                            const AZ::IO::Path assetLocalPath(AZ::IO::Path(AZ::IO::Path(AZ::Utils::GetProjectPath()) / unresolvedAssetPath)
-                                                                  .LexicallyRelative(importedAssetsDest.importDirectoryTmp));
-
-                            const AZ::IO::Path assetFullPathSrc(AZ::IO::Path(urdfAsset.m_resolvedUrdfPath.ParentPath()) / assetLocalPath);
-                            const AZ::IO::Path assetFullPathDst(importedAssetsDest.importDirectoryDst / assetLocalPath);
-
-                            const auto outcomeMkdir = fileIO->CreatePath(AZ::IO::Path(assetFullPathDst.ParentPath()).c_str());
-                            if (!outcomeMkdir)
-                            {
-                                break;
-                            }
-
-                            const auto outcomeCopy = fileIO->Copy(assetFullPathSrc.c_str(), assetFullPathDst.c_str());
-                            if (!outcomeCopy)
-                            {
-                                urdfAsset.m_copyStatus = CopyStatus::Failed;
-                            }
-                        }
-                    }
-
-                    // move asset file from temporary location to destination location
-                    const auto outcomeMoveDst = fileIO->Rename(targetPathAssetTmp.c_str(), targetPathAssetDst.c_str());
-                    AZ_Printf(
-                        "CopyAssetForURDF",
-                        "Rename file %s to %s, result: %d",
-                        targetPathAssetTmp.c_str(),
-                        targetPathAssetDst.c_str(),
-                        outcomeMoveDst.GetResultCode());
-
-                    // call FlushIOOfAsset to ensure the asset processor is aware of the new file
-                    FlushIOOfAsset(targetPathAssetDst);
-
-                    urdfAsset.m_copyStatus = outcomeMoveDst ? CopyStatus::Copied : CopyStatus::Failed;
-                }
-            }
-            else
-            {
-                urdfAsset.m_copyStatus = CopyStatus::Failed;
+                assetCopy.m_textureCopyFailed = true;
             }
         }
-        else
-        {
-            AZ_Printf("CopyAssetForURDF", "File %s already exists, omitting import", targetPathAssetDst.c_str());
-            urdfAsset.m_copyStatus = CopyStatus::Exists;
-        }
+        MoveStagedReferencedAsset(assetCopy, fileIO);
 
-        if (urdfAsset.m_copyStatus == CopyStatus::Exists || urdfAsset.m_copyStatus == CopyStatus::Copied)
+        if (urdfAsset.m_copyStatus == CopyStatus::Copied)
         {
-            urdfAsset.m_availableAssetInfo = Utils::GetAvailableAssetInfo(targetPathAssetDst.String());
+            // call FlushIOOfAsset to ensure the asset processor is aware of the new file
+            FlushIOOfAsset(assetCopy.m_targetPathAssetDst);
         }
-        urdfAsset.m_urdfPath = "";
-        urdfAsset.m_urdfFileCRC = AZ::Crc32();
+        FinishReferencedAssetCopy(assetCopy);
 
         return urdfAsset.m_copyStatus;
     }
@@ -727,4 +1028,14 @@ namespace ROS2::Utils
 
         return assetStatus;
     }
+
+    AzFramework::AssetSystem::AssetStatus FlushIOOfAssets(const AZStd::vector<AZ::IO::Path>& paths)
+    {
+        // The flush is not specific to the requested file, so one request covers every file written before it.
+        if (paths.empty())
+        {
+            return AzFramework::AssetSystem::AssetStatus::AssetStatus_Unknown;
+        }
+        return FlushIOOfAsset(paths.front());
+    }
 } // namespace ROS2::Utils
@@ -17,13 +17,10 @@
 #include <AzCore/Math/Crc.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzFramework/Asset/AssetSystemBus.h>
 #include <AzToolsFramework/API/EditorAssetSystemAPI.h>
-
-namespace ROS2
-{
-    struct SdfAssetBuilderSettings;
-} // namespace ROS2
+#include <SdfAssetBuilder/SdfAssetBuilderSettings.h>
 
 namespace ROS2::Utils
 {
@@ -88,6 +85,9 @@ namespace ROS2::Utils
 
         //! Found O3DE asset.
         AvailableAsset m_availableAssetInfo;
+
+        //! Collision geometry generated from the mesh, if it is referenced by a collider.
+        ColliderMeshExport m_colliderMeshExport;
     };
 
     //! Structure contains paths to the temporary and destination directories for imported assets.
@@ -103,13 +103,33 @@ namespace ROS2::Utils
     //! Maps unresolved URI asset references to the type of reference(s) - mesh, texture, etc.
     using AssetFilenameReferences = AZStd::unordered_map<AZStd::string, ReferencedAssetType>;
 
+    //! Maps unresolved URI collider mesh references to the method used to generate their collision geometry.
+    using ColliderMeshExportMethods = AZStd::unordered_map<AZStd::string, ColliderMeshExportMethod>;
+
     /// Type that hold result of mapping from URDF path to asset info
     using UrdfAssetMap = AZStd::unordered_map<AZ::IO::Path, Utils::UrdfAsset>;
 
+    //! Returns extensions of the scene files supported by the Asset Processor.
+    AZStd::vector<AZStd::string> GetSupportedExtensions();
+
+    //! Function computes CRC32 on first kilobyte of file, always reading the file.
+    AZ::Crc32 ComputeFileCRC(const AZ::IO::Path& filename);
+
+    //! Function computes a 64-bit hash of the whole content of file, reading it in large chunks.
+    //! @returns content hash, zero if the file is empty or cannot be read
+    AZ::u64 ComputeFileContentHash(const AZ::IO::Path& filename);
+
     //! Function computes CRC32 on first kilobyte of file.
+    //! If a SourceAssetsCrcIndex is active, the checksum is taken from the index unless the file changed.
     AZ::Crc32 GetFileCRC(const AZ::IO::Path& filename);
 
+    //! Function computes a 64-bit hash of the whole content of file.
+    //! If a SourceAssetsCrcIndex is active, the hash is taken from the index unless the file changed.
+    //! @returns content hash, zero if the file is empty or cannot be read
+    AZ::u64 GetFileContentHash(const AZ::IO::Path& filename);
+
     //! Compute CRC for every source mesh from the assets catalog.
+    //! If a SourceAssetsCrcIndex is active, only source assets which changed since the last call are read.
     //! @returns map where key is crc of source file and value is AvailableAsset.
     AZStd::unordered_map<AZ::Crc32, AvailableAsset> GetInterestingSourceAssetsCRC();
 
@@ -118,7 +138,9 @@ namespace ROS2::Utils
     //! Steps:
     //! - Functions resolves URDF filenames with `ResolveAssetPath`.
     //! - Files pointed by resolved URDF patches have their checksum computed `GetFileCRC`.
-    //! - Function scans all available O3DE assets by calling `GetInterestingSourceAssetsCRC`.
+    //! - Function looks up the checksums in the SourceAssetsCrcIndex, which only reads source assets that changed since they were indexed.
+    //! - If `m_matchAssetsByContentHash` is set in the builder settings, source assets with a matching checksum are compared
+    //!   by a hash of their whole content, so files sharing the same header are not mistaken for each other.
     //! - Suitable mapping to the O3DE asset is found by comparing the checksum of the file pointed by the URDF path and source asset.
     //! @param assetFilenames - list of the unresolved paths from the SDF/URDF file
     //! @param urdfFilename - filename of URDF file, used for resolvement
@@ -155,22 +177,45 @@ namespace ROS2::Utils
     //! @returns product asset id (invalid id if not found)
     AZ::Data::AssetId GetPhysXMeshProductAssetId(const AZ::Uuid& sourceAssetUUID);
 
+    //! Product asset IDs of a single source asset, as used by the prefab makers.
+    struct ProductAssetIds
+    {
+        AZ::Data::AssetId m_modelAssetId; //!< AZ::RPI::ModelAsset product, invalid if not found.
+        AZ::Data::AssetId m_physXMeshAssetId; //!< PhysX::Pipeline::MeshAsset product, invalid if not found.
+        AZ::Data::AssetId m_imageAssetId; //!< AZ::RPI::StreamingImageAsset product, invalid if not found.
+    };
+
+    //! Product asset IDs keyed by source asset GUID.
+    using ProductAssetIdMap = AZStd::unordered_map<AZ::Uuid, ProductAssetIds>;
+
+    //! Resolves product asset IDs of several source assets at once, with a single Asset Processor query per source asset.
+    //! @param sourceAssetUUIDs GUIDs of source assets
+    //! @returns map where key is source asset GUID and value contains its product asset IDs
+    ProductAssetIdMap GetProductAssetIds(const AZStd::unordered_set<AZ::Uuid>& sourceAssetUUIDs);
+
     //! Creates side-car file (.assetinfo) that configures the imported scene (e.g. DAE file).
     //! The .assetinfo will be create next to scene's file.
     //! @param sourceAssetPath - global path to source asset
     //! @param collider - create assetinfo section for collider product asset
     //! @param visual - create assetinfo section for visual mesh
+    //! @param colliderMeshExport - collision geometry generated for the collider product asset
     //! @returns true if succeed
-    bool CreateSceneManifest(const AZ::IO::Path& sourceAssetPath, const bool collider, const bool visual);
+    bool CreateSceneManifest(
+        const AZ::IO::Path& sourceAssetPath, const bool collider, const bool visual, const ColliderMeshExport& colliderMeshExport = {});
 
     //! Creates side-car file (.assetinfo) that configures the imported scene (e.g. DAE file).
     //! @param sourceAssetPath - global path to source asset
     //! @param assetInfoFile - global path to assetInfo file to create
     //! @param collider - create assetinfo section for collider product asset
     //! @param visual - create assetinfo section for visual mesh
+    //! @param colliderMeshExport - collision geometry generated for the collider product asset
     //! @returns true if succeed
     bool CreateSceneManifest(
-        const AZ::IO::Path& sourceAssetPath, const AZ::IO::Path& assetInfoFile, const bool collider, const bool visual);
+        const AZ::IO::Path& sourceAssetPath,
+        const AZ::IO::Path& assetInfoFile,
+        const bool collider,
+        const bool visual,
+        const ColliderMeshExport& colliderMeshExport = {});
 
     //! Copies and prepares assets that are referenced in SDF/URDF.
     //! It resolves every asset, creates a directory in Project's Asset directory, copies files, and prepares assets info.
@@ -178,6 +223,8 @@ namespace ROS2::Utils
     //! @param assetFilenames - files to copy (as unresolved urdf paths)
     //! @param urdfFilename - path to URDF file (as a global path)
     //! @param sdfBuilderSettings - the builder settings to use to convert the SDF/URDF files
+    //! @param colliderMeshExportMethods - export methods of collider meshes, see GetColliderMeshExportMethods.
+    //!        Collider meshes without an entry use the export method of the builder settings.
     //! @param outputDirSuffix - suffix to make output directory unique, if xacro file was used
     //! @param fileIO - instance to fileIO class
     //! @returns mapping from unresolved urdf paths to source asset info
@@ -185,6 +232,7 @@ namespace ROS2::Utils
         const AssetFilenameReferences& assetFilenames,
         const AZStd::string& urdfFilename,
         const SdfAssetBuilderSettings& sdfBuilderSettings,
+        const ColliderMeshExportMethods& colliderMeshExportMethods = {},
         AZStd::string_view outputDirSuffix = "",
         AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance());
 
@@ -192,11 +240,14 @@ namespace ROS2::Utils
     //! @param assetFilenames - files to copy (as unresolved urdf paths)
     //! @param urdfFilename - path to URDF file (as a global path)
     //! @param sdfBuilderSettings - the builder settings to use to convert the SDF/URDF files
+    //! @param colliderMeshExportMethods - export methods of collider meshes, see GetColliderMeshExportMethods.
+    //!        Collider meshes without an entry use the export method of the builder settings.
     //! @returns mapping from unresolved urdf paths to source asset info
     UrdfAssetMap CreateAssetMap(
         const AssetFilenameReferences& assetFilenames,
         const AZStd::string& urdfFilename,
-        const SdfAssetBuilderSettings& sdfBuilderSettings);
+        const SdfAssetBuilderSettings& sdfBuilderSettings,
+        const ColliderMeshExportMethods& colliderMeshExportMethods = {});
 
     //! Copies and prepares asset that is referenced in SDF/URDF.
     //! Modifies urdfAsset in place.
@@ -239,4 +290,10 @@ namespace ROS2::Utils
     //! @returns status of the asset after flushing
     AzFramework::AssetSystem::AssetStatus FlushIOOfAsset(const AZ::IO::Path& path);
 
+    //! Flushes the IO of several assets to disk with a single status request, which makes the asset processor aware of
+    //! every file written before it. The status of the other assets is not queried.
+    //! @param paths - paths to assets to flush
+    //! @returns status of the first asset after flushing, AssetStatus_Unknown if there are no assets
+    AzFramework::AssetSystem::AssetStatus FlushIOOfAssets(const AZStd::vector<AZ::IO::Path>& paths);
+
 } // namespace ROS2::Utils
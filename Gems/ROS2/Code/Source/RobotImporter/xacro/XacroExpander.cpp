@@ -0,0 +1,1667 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "XacroExpander.h"
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/TypeHash.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/XML/rapidxml.h>
+#include <AzCore/XML/rapidxml_print.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <RobotImporter/Utils/RobotImporterUtils.h>
+#include <RobotImporter/Utils/SourceAssetsStorage.h>
+#include <SdfAssetBuilder/SdfAssetBuilderSettings.h>
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <string>
+
+namespace ROS2::Utils::xacro
+{
+    namespace
+    {
+        using XmlDocument = AZ::rapidxml::xml_document<>;
+        using XmlNode = AZ::rapidxml::xml_node<>;
+        using XmlAttribute = AZ::rapidxml::xml_attribute<>;
+
+        //! Text is kept in data nodes only, so that substituting it does not have to update the element value as well.
+        constexpr int XmlParseFlags = AZ::rapidxml::parse_no_element_values | AZ::rapidxml::parse_trim_whitespace;
+
+        //! Deeper nesting of macro calls and includes is treated as an endless recursion.
+        constexpr int MaxNestingDepth = 100;
+
+        constexpr double Pi = 3.14159265358979323846;
+
+        bool IsDigit(char character)
+        {
+            return character >= '0' && character <= '9';
+        }
+
+        //! Prints a number the way Python does, so that the output matches the one of the xacro executable.
+        AZStd::string FormatNumber(double number, bool integer)
+        {
+            if (!std::isfinite(number))
+            {
+                return std::isnan(number) ? "nan" : (number > 0.0 ? "inf" : "-inf");
+            }
+            if (integer && std::fabs(number) < 1e15)
+            {
+                return AZStd::string::format("%lld", static_cast<long long>(number));
+            }
+
+            // Python prints the shortest representation which reads back as the same number.
+            int precision = 1;
+            AZStd::string text;
+            for (; precision <= 17; ++precision)
+            {
+                text = AZStd::string::format("%.*g", precision, number);
+                if (std::strtod(text.c_str(), nullptr) == number)
+                {
+                    break;
+                }
+            }
+
+            // Unlike printf, Python only uses the exponent notation for very small and very large numbers.
+            const double magnitude = std::fabs(number);
+            if (text.find('e') != AZStd::string::npos && magnitude >= 1e-4 && magnitude < 1e16)
+            {
+                const int exponent = static_cast<int>(std::floor(std::log10(magnitude)));
+                text = AZStd::string::format("%.*f", AZStd::max(precision - 1 - exponent, 0), number);
+            }
+            if (text.find_first_of(".e") == AZStd::string::npos)
+            {
+                text += ".0";
+            }
+            return text;
+        }
+
+        //! Value of a xacro expression, following the Python types the xacro executable evaluates expressions with.
+        struct Value
+        {
+            enum class Type
+            {
+                Number,
+                Boolean,
+                Text
+            };
+
+            static Value MakeNumber(double number, bool integer)
+            {
+                Value value;
+                value.m_type = Type::Number;
+                value.m_number = number;
+                value.m_integer = integer;
+                return value;
+            }
+
+            static Value MakeBoolean(bool boolean)
+            {
+                Value value;
+                value.m_type = Type::Boolean;
+                value.m_number = boolean ? 1.0 : 0.0;
+                value.m_integer = true;
+                return value;
+            }
+
+            static Value MakeText(AZStd::string text)
+            {
+                Value value;
+                value.m_type = Type::Text;
+                value.m_text = AZStd::move(text);
+                return value;
+            }
+
+            //! Properties are stored as text, a property holding a number is evaluated as a number like xacro does.
+            static Value FromText(const AZStd::string& text)
+            {
+                if (!text.empty() && (IsDigit(text.front()) || text.front() == '-' || text.front() == '+' || text.front() == '.'))
+                {
+                    char* end = nullptr;
+                    const double number = std::strtod(text.c_str(), &end);
+                    if (end == text.c_str() + text.size())
+                    {
+                        return MakeNumber(number, text.find_first_of(".eEnN") == AZStd::string::npos);
+                    }
+                }
+                return MakeText(text);
+            }
+
+            //! Python booleans are numbers as well.
+            bool IsNumeric() const
+            {
+                return m_type != Type::Text;
+            }
+
+            bool IsTrue() const
+            {
+                return m_type == Type::Text ? !m_text.empty() : m_number != 0.0;
+            }
+
+            AZStd::string ToString() const
+            {
+                switch (m_type)
+                {
+                case Type::Number:
+                    return FormatNumber(m_number, m_integer);
+                case Type::Boolean:
+                    return m_number != 0.0 ? "True" : "False";
+                default:
+                    return m_text;
+                }
+            }
+
+            Type m_type = Type::Text;
+            double m_number = 0.0;
+            bool m_integer = false;
+            AZStd::string m_text;
+        };
+
+        using ValueOutcome = AZ::Outcome<Value, AZStd::string>;
+        using PropertyLookup = AZStd::function<const AZStd::string*(const AZStd::string&)>;
+
+        //! Evaluates the Python expressions of `${...}`, limited to literals, properties, arithmetic, comparisons,
+        //! boolean operators and math functions. Lists, dictionaries, conditional expressions and the rest of Python fail.
+        class ExpressionEvaluator
+        {
+        public:
+            ExpressionEvaluator(AZStd::string_view expression, const PropertyLookup& lookup)
+                : m_expression(expression)
+                , m_lookup(lookup)
+            {
+            }
+
+            ValueOutcome Evaluate()
+            {
+                Value value;
+                if (!ParseOr(value))
+                {
+                    return AZ::Failure(m_error);
+                }
+                SkipSpaces();
+                if (m_position != m_expression.size())
+                {
+                    return AZ::Failure(AZStd::string::format("unsupported expression '%.*s'", AZ_STRING_ARG(m_expression)));
+                }
+                return AZ::Success(AZStd::move(value));
+            }
+
+        private:
+            bool Fail(const AZStd::string& message)
+            {
+                if (m_error.empty())
+                {
+                    m_error = AZStd::string::format("%s in expression '%.*s'", message.c_str(), AZ_STRING_ARG(m_expression));
+                }
+                return false;
+            }
+
+            void SkipSpaces()
+            {
+                while (m_position < m_expression.size() && std::isspace(static_cast<unsigned char>(m_expression[m_position])))
+                {
+                    ++m_position;
+                }
+            }
+
+            static bool IsIdentifierCharacter(char character)
+            {
+                return std::isalnum(static_cast<unsigned char>(character)) || character == '_' || character == '.';
+            }
+
+            bool MatchSymbol(AZStd::string_view symbol)
+            {
+                SkipSpaces();
+                if (m_expression.substr(m_position).starts_with(symbol))
+                {
+                    m_position += symbol.size();
+                    return true;
+                }
+                return false;
+            }
+
+            bool MatchKeyword(AZStd::string_view keyword)
+            {
+                SkipSpaces();
+                const size_t end = m_position + keyword.size();
+                if (m_expression.substr(m_position).starts_with(keyword) &&
+                    (end == m_expression.size() || !IsIdentifierCharacter(m_expression[end])))
+                {
+                    m_position = end;
+                    return true;
+                }
+                return false;
+            }
+
+            bool ParseOr(Value& value)
+            {
+                if (!ParseAnd(value))
+                {
+                    return false;
+                }
+                while (MatchKeyword("or"))
+                {
+                    Value rhs;
+                    if (!ParseAnd(rhs))
+                    {
+                        return false;
+                    }
+                    value = Value::MakeBoolean(value.IsTrue() || rhs.IsTrue());
+                }
+                return true;
+            }
+
+            bool ParseAnd(Value& value)
+            {
+                if (!ParseNot(value))
+                {
+                    return false;
+                }
+                while (MatchKeyword("and"))
+                {
+                    Value rhs;
+                    if (!ParseNot(rhs))
+                    {
+                        return false;
+                    }
+                    value = Value::MakeBoolean(value.IsTrue() && rhs.IsTrue());
+                }
+                return true;
+            }
+
+            bool ParseNot(Value& value)
+            {
+                if (MatchKeyword("not"))
+                {
+                    if (!ParseNot(value))
+                    {
+                        return false;
+                    }
+                    value = Value::MakeBoolean(!value.IsTrue());
+                    return true;
+                }
+                return ParseComparison(value);
+            }
+
+            bool ParseComparison(Value& value)
+            {
+                if (!ParseSum(value))
+                {
+                    return false;
+                }
+
+                // Longer operators first, so that "<=" is not taken for "<".
+                constexpr AZStd::string_view Operators[] = { "==", "!=", "<=", ">=", "<", ">" };
+                for (const AZStd::string_view& op : Operators)
+                {
+                    if (!MatchSymbol(op))
+                    {
+                        continue;
+                    }
+
+                    Value rhs;
+                    if (!ParseSum(rhs))
+                    {
+                        return false;
+                    }
+
+                    int order = 0;
+                    if (value.IsNumeric() && rhs.IsNumeric())
+                    {
+                        order = value.m_number < rhs.m_number ? -1 : (value.m_number > rhs.m_number ? 1 : 0);
+                    }
+                    else if (!value.IsNumeric() && !rhs.IsNumeric())
+                    {
+                        order = value.m_text.compare(rhs.m_text);
+                    }
+                    else if (op == "==" || op == "!=")
+                    {
+                        value = Value::MakeBoolean(op == "!=");
+                        return true;
+                    }
+                    else
+                    {
+                        return Fail("cannot compare a number with text");
+                    }
+
+                    bool result = false;
+                    if (op == "==")
+                    {
+                        result = order == 0;
+                    }
+                    else if (op == "!=")
+                    {
+                        result = order != 0;
+                    }
+                    else if (op == "<=")
+                    {
+                        result = order <= 0;
+                    }
+                    else if (op == ">=")
+                    {
+                        result = order >= 0;
+                    }
+                    else if (op == "<")
+                    {
+                        result = order < 0;
+                    }
+                    else
+                    {
+                        result = order > 0;
+                    }
+                    value = Value::MakeBoolean(result);
+                    return true;
+                }
+                return true;
+            }
+
+            bool ParseSum(Value& value)
+            {
+                if (!ParseProduct(value))
+                {
+                    return false;
+                }
+                while (true)
+                {
+                    const bool add = MatchSymbol("+");
+                    if (!add && !MatchSymbol("-"))
+                    {
+                        return true;
+                    }
+
+                    Value rhs;
+                    if (!ParseProduct(rhs))
+                    {
+                        return false;
+                    }
+                    if (value.IsNumeric() && rhs.IsNumeric())
+                    {
+                        const double result = add ? value.m_number + rhs.m_number : value.m_number - rhs.m_number;
+                        value = Value::MakeNumber(result, value.m_integer && rhs.m_integer);
+                    }
+                    else if (add && !value.IsNumeric() && !rhs.IsNumeric())
+                    {
+                        value.m_text += rhs.m_text;
+                    }
+                    else
+                    {
+                        return Fail("arithmetic on text");
+                    }
+                }
+            }
+
+            bool ParseProduct(Value& value)
+            {
+                if (!ParseUnary(value))
+                {
+                    return false;
+                }
+                while (true)
+                {
+                    // "//" has to be checked before "/", "**" is already taken by ParsePower.
+                    constexpr AZStd::string_view Operators[] = { "//", "/", "*", "%" };
+                    AZStd::string_view op;
+                    for (const AZStd::string_view& candidate : Operators)
+                    {
+                        if (MatchSymbol(candidate))
+                        {
+                            op = candidate;
+                            break;
+                        }
+                    }
+                    if (op.empty())
+                    {
+                        return true;
+                    }
+
+                    Value rhs;
+                    if (!ParseUnary(rhs))
+                    {
+                        return false;
+                    }
+                    if (!value.IsNumeric() || !rhs.IsNumeric())
+                    {
+                        return Fail("arithmetic on text");
+                    }
+
+                    const bool integer = value.m_integer && rhs.m_integer;
+                    if (op == "*")
+                    {
+                        value = Value::MakeNumber(value.m_number * rhs.m_number, integer);
+                        continue;
+                    }
+                    if (rhs.m_number == 0.0)
+                    {
+                        return Fail("division by zero");
+                    }
+                    if (op == "/")
+                    {
+                        value = Value::MakeNumber(value.m_number / rhs.m_number, false);
+                    }
+                    else if (op == "//")
+                    {
+                        value = Value::MakeNumber(std::floor(value.m_number / rhs.m_number), integer);
+                    }
+                    else
+                    {
+                        // Python takes the sign of the remainder from the divisor.
+                        double remainder = std::fmod(value.m_number, rhs.m_number);
+                        if (remainder != 0.0 && ((remainder < 0.0) != (rhs.m_number < 0.0)))
+                        {
+                            remainder += rhs.m_number;
+                        }
+                        value = Value::MakeNumber(remainder, integer);
+                    }
+                }
+            }
+
+            bool ParseUnary(Value& value)
+            {
+                if (MatchSymbol("-"))
+                {
+                    if (!ParseUnary(value))
+                    {
+                        return false;
+                    }
+                    if (!value.IsNumeric())
+                    {
+                        return Fail("negation of text");
+                    }
+                    value = Value::MakeNumber(-value.m_number, value.m_integer);
+                    return true;
+                }
+                if (MatchSymbol("+"))
+                {
+                    return ParseUnary(value);
+                }
+                return ParsePower(value);
+            }
+
+            bool ParsePower(Value& value)
+            {
+                if (!ParsePrimary(value))
+                {
+                    return false;
+                }
+                if (!MatchSymbol("**"))
+                {
+                    return true;
+                }
+
+                // The exponent binds to the right and may be negated, as in 2**-1.
+                Value exponent;
+                if (!ParseUnary(exponent))
+                {
+                    return false;
+                }
+                if (!value.IsNumeric() || !exponent.IsNumeric())
+                {
+                    return Fail("arithmetic on text");
+                }
+                const bool integer = value.m_integer && exponent.m_integer && exponent.m_number >= 0.0;
+                value = Value::MakeNumber(std::pow(value.m_number, exponent.m_number), integer);
+                return true;
+            }
+
+            bool ParsePrimary(Value& value)
+            {
+                SkipSpaces();
+                if (m_position == m_expression.size())
+                {
+                    return Fail("missing operand");
+                }
+
+                const char first = m_expression[m_position];
+                if (first == '(')
+                {
+                    ++m_position;
+                    if (!ParseOr(value))
+                    {
+                        return false;
+                    }
+                    return MatchSymbol(")") || Fail("missing ')'");
+                }
+
+                if (IsDigit(first) || (first == '.' && m_position + 1 < m_expression.size() && IsDigit(m_expression[m_position + 1])))
+                {
+                    const AZStd::string literal(m_expression.substr(m_position));
+                    char* end = nullptr;
+                    const double number = std::strtod(literal.c_str(), &end);
+                    const size_t length = static_cast<size_t>(end - literal.c_str());
+                    const bool integer = AZStd::string_view(literal).substr(0, length).find_first_of(".eE") == AZStd::string_view::npos;
+                    m_position += length;
+                    value = Value::MakeNumber(number, integer);
+                    return true;
+                }
+
+                if (first == '\'' || first == '"')
+                {
+                    const size_t end = m_expression.find(first, m_position + 1);
+                    if (end == AZStd::string_view::npos)
+                    {
+                        return Fail("unterminated string");
+                    }
+                    const AZStd::string_view text = m_expression.substr(m_position + 1, end - m_position - 1);
+                    if (text.find('\\') != AZStd::string_view::npos)
+                    {
+                        return Fail("unsupported escape sequence");
+                    }
+                    value = Value::MakeText(AZStd::string(text));
+                    m_position = end + 1;
+                    return true;
+                }
+
+                if (std::isalpha(static_cast<unsigned char>(first)) || first == '_')
+                {
+                    const size_t start = m_position;
+                    while (m_position < m_expression.size() && IsIdentifierCharacter(m_expression[m_position]))
+                    {
+                        ++m_position;
+                    }
+                    const AZStd::string name(m_expression.substr(start, m_position - start));
+                    if (MatchSymbol("("))
+                    {
+                        return ParseCall(name, value);
+                    }
+                    return LookupName(name, value);
+                }
+
+                return Fail(AZStd::string::format("unsupported character '%c'", first));
+            }
+
+            bool LookupName(const AZStd::string& name, Value& value)
+            {
+                if (name == "True" || name == "False")
+                {
+                    value = Value::MakeBoolean(name == "True");
+                    return true;
+                }
+                if (const AZStd::string* property = m_lookup(name); property != nullptr)
+                {
+                    value = Value::FromText(*property);
+                    return true;
+                }
+                if (name == "pi" || name == "math.pi")
+                {
+                    value = Value::MakeNumber(Pi, false);
+                    return true;
+                }
+                if (name == "e" || name == "math.e")
+                {
+                    value = Value::MakeNumber(std::exp(1.0), false);
+                    return true;
+                }
+                return Fail(AZStd::string::format("unknown property '%s'", name.c_str()));
+            }
+
+            bool ParseCall(const AZStd::string& calledName, Value& value)
+            {
+                AZStd::vector<Value> arguments;
+                if (!MatchSymbol(")"))
+                {
+                    do
+                    {
+                        if (!ParseOr(arguments.emplace_back()))
+                        {
+                            return false;
+                        }
+                    } while (MatchSymbol(","));
+                    if (!MatchSymbol(")"))
+                    {
+                        return Fail("missing ')'");
+                    }
+                }
+
+                const AZStd::string_view name = AZStd::string_view(calledName).starts_with("math.")
+                    ? AZStd::string_view(calledName).substr(5)
+                    : AZStd::string_view(calledName);
+
+                if (name == "str" && arguments.size() == 1)
+                {
+                    value = Value::MakeText(arguments[0].ToString());
+                    return true;
+                }
+                if ((name == "float" || name == "int") && arguments.size() == 1 && !arguments[0].IsNumeric())
+                {
+                    arguments[0] = Value::FromText(arguments[0].m_text);
+                }
+
+                for (const Value& argument : arguments)
+                {
+                    if (!argument.IsNumeric())
+                    {
+                        return Fail(AZStd::string::format("text passed to '%s'", calledName.c_str()));
+                    }
+                }
+
+                if (arguments.size() == 1)
+                {
+                    const double x = arguments[0].m_number;
+                    struct UnaryFunction
+                    {
+                        AZStd::string_view m_name;
+                        double (*m_function)(double);
+                    };
+                    static const UnaryFunction UnaryFunctions[] = {
+                        { "sin", [](double v) { return std::sin(v); } },     { "cos", [](double v) { return std::cos(v); } },
+                        { "tan", [](double v) { return std::tan(v); } },     { "asin", [](double v) { return std::asin(v); } },
+                        { "acos", [](double v) { return std::acos(v); } },   { "atan", [](double v) { return std::atan(v); } },
+                        { "sinh", [](double v) { return std::sinh(v); } },   { "cosh", [](double v) { return std::cosh(v); } },
+                        { "tanh", [](double v) { return std::tanh(v); } },   { "exp", [](double v) { return std::exp(v); } },
+                        { "log", [](double v) { return std::log(v); } },     { "log10", [](double v) { return std::log10(v); } },
+                        { "sqrt", [](double v) { return std::sqrt(v); } },   { "fabs", [](double v) { return std::fabs(v); } },
+                        { "float", [](double v) { return v; } },
+                        { "radians", [](double v) { return v * Pi / 180.0; } },
+                        { "degrees", [](double v) { return v * 180.0 / Pi; } },
+                    };
+                    for (const UnaryFunction& function : UnaryFunctions)
+                    {
+                        if (name == function.m_name)
+                        {
+                            value = Value::MakeNumber(function.m_function(x), false);
+                            return true;
+                        }
+                    }
+
+                    if (name == "abs")
+                    {
+                        value = Value::MakeNumber(std::fabs(x), arguments[0].m_integer);
+                        return true;
+                    }
+                    if (name == "int")
+                    {
+                        value = Value::MakeNumber(std::trunc(x), true);
+                        return true;
+                    }
+                    if (name == "floor" || name == "ceil" || name == "round")
+                    {
+                        // Python 3 returns integers, and rounds halves to the nearest even number like the default rounding mode.
+                        const double rounded = name == "floor" ? std::floor(x) : (name == "ceil" ? std::ceil(x) : std::nearbyint(x));
+                        value = Value::MakeNumber(rounded, true);
+                        return true;
+                    }
+                }
+
+                if (arguments.size() == 2 && (name == "atan2" || name == "pow" || name == "hypot" || name == "fmod"))
+                {
+                    const double x = arguments[0].m_number;
+                    const double y = arguments[1].m_number;
+                    const double result = name == "atan2" ? std::atan2(x, y)
+                        : name == "pow"                   ? std::pow(x, y)
+                        : name == "hypot"                 ? std::hypot(x, y)
+                                                          : std::fmod(x, y);
+                    value = Value::MakeNumber(result, false);
+                    return true;
+                }
+
+                if ((name == "min" || name == "max") && !arguments.empty())
+                {
+                    value = arguments[0];
+                    for (const Value& argument : arguments)
+                    {
+                        if (name == "min" ? argument.m_number < value.m_number : argument.m_number > value.m_number)
+                        {
+                            value = argument;
+                        }
+                    }
+                    return true;
+                }
+
+                return Fail(AZStd::string::format("unsupported function '%s'", calledName.c_str()));
+            }
+
+            AZStd::string_view m_expression;
+            size_t m_position = 0;
+            const PropertyLookup& m_lookup;
+            AZStd::string m_error;
+        };
+
+        //! Expands one xacro file and the files it includes, working directly on the parsed XML documents.
+        class XacroExpander
+        {
+        public:
+            XacroExpander(const Params& params, const SdfAssetBuilderSettings& settings)
+                : m_arguments(params)
+                , m_settings(settings)
+                , m_amentPrefixPath(GetAmentPrefixPath().c_str())
+            {
+            }
+
+            ExpansionOutcome Expand(AZStd::string data, const AZ::IO::Path& filename)
+            {
+                XmlNode* root = LoadDocument(AZStd::move(data));
+                if (root == nullptr)
+                {
+                    return AZ::Failure(AZStd::string::format("No root element in xacro file %s", filename.c_str()));
+                }
+
+                // The xacro namespace prefix is taken from its declaration, "xacro" is the prefix used by convention.
+                for (const XmlAttribute* attribute = root->first_attribute(); attribute != nullptr; attribute = attribute->next_attribute())
+                {
+                    const AZStd::string_view name(attribute->name(), attribute->name_size());
+                    const AZStd::string_view value(attribute->value(), attribute->value_size());
+                    if (name.starts_with("xmlns:") && value.find("xacro") != AZStd::string_view::npos)
+                    {
+                        m_prefix = AZStd::string(name.substr(6)) + ":";
+                        break;
+                    }
+                }
+
+                m_fileStack.push_back(filename);
+                if (!filename.empty())
+                {
+                    m_result.m_files.push_back(filename);
+                }
+
+                Scope globalScope;
+                if (!ProcessAttributes(root, globalScope) || !ProcessChildren(root, globalScope))
+                {
+                    return AZ::Failure(m_error);
+                }
+
+                std::string urdf;
+                AZ::rapidxml::print(std::back_inserter(urdf), *root, 0);
+                m_result.m_urdf.assign(urdf.c_str(), urdf.size());
+                return AZ::Success(AZStd::move(m_result));
+            }
+
+        private:
+            struct MacroParameter
+            {
+                enum class Kind
+                {
+                    Value,
+                    Block,
+                    Blocks
+                };
+
+                AZStd::string m_name;
+                Kind m_kind = Kind::Value;
+                bool m_hasDefault = false;
+                AZStd::string m_default;
+                //! The value is taken from a property of the calling scope if it is not passed ("name:=^").
+                bool m_inherit = false;
+            };
+
+            struct Macro
+            {
+                const XmlNode* m_definition = nullptr;
+                AZStd::vector<MacroParameter> m_parameters;
+            };
+
+            //! Properties, blocks and macros visible in the expanded element, a macro call opens a nested scope.
+            struct Scope
+            {
+                const AZStd::string* FindProperty(const AZStd::string& name) const
+                {
+                    for (const Scope* scope = this; scope != nullptr; scope = scope->m_parent)
+                    {
+                        if (auto it = scope->m_properties.find(name); it != scope->m_properties.end())
+                        {
+                            return &it->second;
+                        }
+                    }
+                    return nullptr;
+                }
+
+                const AZStd::vector<XmlNode*>* FindBlock(const AZStd::string& name) const
+                {
+                    for (const Scope* scope = this; scope != nullptr; scope = scope->m_parent)
+                    {
+                        if (auto it = scope->m_blocks.find(name); it != scope->m_blocks.end())
+                        {
+                            return &it->second;
+                        }
+                    }
+                    return nullptr;
+                }
+
+                const Macro* FindMacro(const AZStd::string& name) const
+                {
+                    for (const Scope* scope = this; scope != nullptr; scope = scope->m_parent)
+                    {
+                        if (auto it = scope->m_macros.find(name); it != scope->m_macros.end())
+                        {
+                            return &it->second;
+                        }
+                    }
+                    return nullptr;
+                }
+
+                Scope* m_parent = nullptr;
+                AZStd::unordered_map<AZStd::string, AZStd::string> m_properties;
+                AZStd::unordered_map<AZStd::string, AZStd::vector<XmlNode*>> m_blocks;
+                AZStd::unordered_map<AZStd::string, Macro> m_macros;
+            };
+
+            //! Parsed documents reference their buffers, both are kept until the expansion ends.
+            struct LoadedDocument
+            {
+                AZStd::vector<char> m_buffer;
+                XmlDocument m_document;
+            };
+
+            bool Fail(const AZStd::string& message)
+            {
+                if (m_error.empty())
+                {
+                    m_error = m_fileStack.empty() ? message
+                                                  : AZStd::string::format("%s (in %s)", message.c_str(), m_fileStack.back().c_str());
+                }
+                return false;
+            }
+
+            XmlNode* LoadDocument(AZStd::string data)
+            {
+                auto& loaded = m_documents.emplace_back(AZStd::make_unique<LoadedDocument>());
+                loaded->m_buffer.assign(data.begin(), data.end());
+                loaded->m_buffer.push_back('\0');
+                loaded->m_document.parse<XmlParseFlags>(loaded->m_buffer.data());
+                for (XmlNode* node = loaded->m_document.first_node(); node != nullptr; node = node->next_sibling())
+                {
+                    if (node->type() == AZ::rapidxml::node_element)
+                    {
+                        return node;
+                    }
+                }
+                return nullptr;
+            }
+
+            //! Copies text to the memory pool of the expanded document, so that the nodes can reference it.
+            const char* AllocateString(const AZStd::string& text)
+            {
+                char* allocated = m_documents.front()->m_document.allocate_string(nullptr, text.size() + 1);
+                AZStd::copy(text.begin(), text.end(), allocated);
+                allocated[text.size()] = '\0';
+                return allocated;
+            }
+
+            static const XmlAttribute* FindAttribute(const XmlNode* node, const char* name)
+            {
+                return node->first_attribute(name);
+            }
+
+            bool GetAttribute(const XmlNode* node, const char* name, const Scope& scope, AZStd::string& value)
+            {
+                const XmlAttribute* attribute = FindAttribute(node, name);
+                if (attribute == nullptr)
+                {
+                    return Fail(AZStd::string::format("Missing attribute '%s' of element '%s'", name, node->name()));
+                }
+                return Substitute(AZStd::string_view(attribute->value(), attribute->value_size()), scope, value);
+            }
+
+            bool ProcessChildren(XmlNode* parent, Scope& scope)
+            {
+                // Nodes created by a child are inserted before it and processed by it, so the iteration continues after it.
+                XmlNode* child = parent->first_node();
+                while (child != nullptr)
+                {
+                    XmlNode* next = child->next_sibling();
+                    if (!ProcessNode(parent, child, scope))
+                    {
+                        return false;
+                    }
+                    child = next;
+                }
+                return true;
+            }
+
+            bool ProcessNode(XmlNode* parent, XmlNode* node, Scope& scope)
+            {
+                switch (node->type())
+                {
+                case AZ::rapidxml::node_data:
+                case AZ::rapidxml::node_cdata:
+                    {
+                        const AZStd::string_view text(node->value(), node->value_size());
+                        if (text.find('$') != AZStd::string_view::npos)
+                        {
+                            AZStd::string substituted;
+                            if (!Substitute(text, scope, substituted))
+                            {
+                                return false;
+                            }
+                            node->value(AllocateString(substituted), substituted.size());
+                        }
+                        return true;
+                    }
+                case AZ::rapidxml::node_element:
+                    {
+                        const AZStd::string_view name(node->name(), node->name_size());
+                        if (name.starts_with(m_prefix))
+                        {
+                            return ProcessDirective(parent, node, AZStd::string(name.substr(m_prefix.size())), scope);
+                        }
+                        return ProcessAttributes(node, scope) && ProcessChildren(node, scope);
+                    }
+                default:
+                    return true;
+                }
+            }
+
+            bool ProcessAttributes(XmlNode* node, const Scope& scope)
+            {
+                for (XmlAttribute* attribute = node->first_attribute(); attribute != nullptr; attribute = attribute->next_attribute())
+                {
+                    const AZStd::string_view value(attribute->value(), attribute->value_size());
+                    if (value.find('$') != AZStd::string_view::npos)
+                    {
+                        AZStd::string substituted;
+                        if (!Substitute(value, scope, substituted))
+                        {
+                            return false;
+                        }
+                        attribute->value(AllocateString(substituted), substituted.size());
+                    }
+                }
+                return true;
+            }
+
+            bool ProcessDirective(XmlNode* parent, XmlNode* node, const AZStd::string& directive, Scope& scope)
+            {
+                bool processed = false;
+                if (directive == "property")
+                {
+                    processed = DefineProperty(node, scope);
+                }
+                else if (directive == "arg")
+                {
+                    processed = DefineArgument(node, scope);
+                }
+                else if (directive == "macro")
+                {
+                    processed = DefineMacro(node, scope);
+                }
+                else if (directive == "include")
+                {
+                    processed = Include(parent, node, scope);
+                }
+                else if (directive == "if" || directive == "unless")
+                {
+                    processed = Conditional(parent, node, directive == "unless", scope);
+                }
+                else if (directive == "insert_block")
+                {
+                    processed = InsertBlock(parent, node, scope);
+                }
+                else if (directive == "call")
+                {
+                    AZStd::string macroName;
+                    processed = GetAttribute(node, "macro", scope, macroName) && CallMacro(parent, node, macroName, scope);
+                }
+                else if (directive == "element" || directive == "attribute" || directive == "eval" || directive == "loop")
+                {
+                    return Fail(AZStd::string::format("Unsupported element '%s%s'", m_prefix.c_str(), directive.c_str()));
+                }
+                else
+                {
+                    processed = CallMacro(parent, node, directive, scope);
+                }
+
+                if (processed)
+                {
+                    parent->remove_node(node);
+                }
+                return processed;
+            }
+
+            //! Inserts nodes before the given node of the parent and expands them.
+            bool InsertNodes(XmlNode* parent, XmlNode* where, const AZStd::vector<XmlNode*>& nodes, bool clone, Scope& scope)
+            {
+                for (XmlNode* source : nodes)
+                {
+                    XmlNode* inserted = source;
+                    if (clone)
+                    {
+                        inserted = m_documents.front()->m_document.clone_node(source);
+                    }
+                    else if (source->parent() != nullptr)
+                    {
+                        source->parent()->remove_node(source);
+                    }
+                    parent->insert_node(where, inserted);
+                    if (!ProcessNode(parent, inserted, scope))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            static AZStd::vector<XmlNode*> GetChildren(const XmlNode* node, bool elementsOnly)
+            {
+                AZStd::vector<XmlNode*> children;
+                for (XmlNode* child = node->first_node(); child != nullptr; child = child->next_sibling())
+                {
+                    if (!elementsOnly || child->type() == AZ::rapidxml::node_element)
+                    {
+                        children.push_back(child);
+                    }
+                }
+                return children;
+            }
+
+            Scope* GetTargetScope(const XmlNode* node, Scope& scope)
+            {
+                Scope* target = &scope;
+                if (const XmlAttribute* scopeAttribute = FindAttribute(node, "scope"); scopeAttribute != nullptr)
+                {
+                    const AZStd::string_view scopeName(scopeAttribute->value(), scopeAttribute->value_size());
+                    if (scopeName == "parent" && scope.m_parent != nullptr)
+                    {
+                        target = scope.m_parent;
+                    }
+                    else if (scopeName == "global")
+                    {
+                        while (target->m_parent != nullptr)
+                        {
+                            target = target->m_parent;
+                        }
+                    }
+                }
+                return target;
+            }
+
+            bool DefineProperty(const XmlNode* node, Scope& scope)
+            {
+                AZStd::string name;
+                if (!GetAttribute(node, "name", scope, name))
+                {
+                    return false;
+                }
+
+                Scope* target = GetTargetScope(node, scope);
+                if (FindAttribute(node, "value") != nullptr)
+                {
+                    AZStd::string value;
+                    if (!GetAttribute(node, "value", scope, value))
+                    {
+                        return false;
+                    }
+                    target->m_properties[name] = AZStd::move(value);
+                }
+                else if (FindAttribute(node, "default") != nullptr)
+                {
+                    if (scope.FindProperty(name) == nullptr)
+                    {
+                        AZStd::string value;
+                        if (!GetAttribute(node, "default", scope, value))
+                        {
+                            return false;
+                        }
+                        target->m_properties[name] = AZStd::move(value);
+                    }
+                }
+                else
+                {
+                    // A property without value holds a block of elements, inserted later with insert_block.
+                    target->m_blocks[name] = GetChildren(node, true);
+                }
+                return true;
+            }
+
+            bool DefineArgument(const XmlNode* node, const Scope& scope)
+            {
+                AZStd::string name;
+                if (!GetAttribute(node, "name", scope, name))
+                {
+                    return false;
+                }
+                if (!m_arguments.contains(name) && FindAttribute(node, "default") != nullptr)
+                {
+                    AZStd::string value;
+                    if (!GetAttribute(node, "default", scope, value))
+                    {
+                        return false;
+                    }
+                    m_arguments.emplace(AZStd::move(name), AZStd::move(value));
+                }
+                return true;
+            }
+
+            bool DefineMacro(const XmlNode* node, Scope& scope)
+            {
+                AZStd::string name;
+                if (!GetAttribute(node, "name", scope, name))
+                {
+                    return false;
+                }
+
+                Macro macro;
+                macro.m_definition = node;
+                if (const XmlAttribute* params = FindAttribute(node, "params"); params != nullptr)
+                {
+                    AZStd::vector<AZStd::string> tokens;
+                    AZ::StringFunc::Tokenize(AZStd::string_view(params->value(), params->value_size()), tokens, " \t\r\n");
+                    for (AZStd::string_view token : tokens)
+                    {
+                        if (token.find_first_of("'\"") != AZStd::string_view::npos)
+                        {
+                            return Fail(AZStd::string::format("Unsupported quoted default in parameters of macro '%s'", name.c_str()));
+                        }
+
+                        MacroParameter& parameter = macro.m_parameters.emplace_back();
+                        if (token.starts_with("**"))
+                        {
+                            parameter.m_kind = MacroParameter::Kind::Blocks;
+                            parameter.m_name = AZStd::string(token.substr(2));
+                            continue;
+                        }
+                        if (token.starts_with("*"))
+                        {
+                            parameter.m_kind = MacroParameter::Kind::Block;
+                            parameter.m_name = AZStd::string(token.substr(1));
+                            continue;
+                        }
+
+                        const size_t separator = token.find(":=");
+                        parameter.m_name = AZStd::string(token.substr(0, separator));
+                        if (separator == AZStd::string_view::npos)
+                        {
+                            continue;
+                        }
+                        AZStd::string_view defaultValue = token.substr(separator + 2);
+                        if (defaultValue.starts_with("^"))
+                        {
+                            parameter.m_inherit = true;
+                            defaultValue.remove_prefix(1);
+                            if (!defaultValue.starts_with("|"))
+                            {
+                                continue;
+                            }
+                            defaultValue.remove_prefix(1);
+                        }
+                        parameter.m_hasDefault = true;
+                        parameter.m_default = AZStd::string(defaultValue);
+                    }
+                }
+                scope.m_macros[name] = AZStd::move(macro);
+                return true;
+            }
+
+            bool Include(XmlNode* parent, XmlNode* node, Scope& scope)
+            {
+                if (FindAttribute(node, "ns") != nullptr)
+                {
+                    return Fail("Unsupported namespaced include");
+                }
+
+                AZStd::string filename;
+                if (!GetAttribute(node, "filename", scope, filename))
+                {
+                    return false;
+                }
+                if (filename.find_first_of("*?[") != AZStd::string::npos)
+                {
+                    return Fail(AZStd::string::format("Unsupported glob pattern in include '%s'", filename.c_str()));
+                }
+
+                AZ::IO::Path includePath(filename);
+                if (includePath.IsRelative() && !m_fileStack.back().empty())
+                {
+                    includePath = m_fileStack.back().ParentPath() / includePath;
+                }
+                includePath = includePath.LexicallyNormal();
+
+                auto readResult = AZ::Utils::ReadFile<AZStd::string>(includePath.Native());
+                if (!readResult.IsSuccess())
+                {
+                    return Fail(AZStd::string::format("Cannot read included file %s", includePath.c_str()));
+                }
+                XmlNode* includedRoot = LoadDocument(readResult.TakeValue());
+                if (includedRoot == nullptr)
+                {
+                    return Fail(AZStd::string::format("No root element in included file %s", includePath.c_str()));
+                }
+                if (m_fileStack.size() > MaxNestingDepth)
+                {
+                    return Fail("Too deeply nested includes");
+                }
+
+                // The root element of the included file is dropped, its content replaces the include element.
+                m_result.m_files.push_back(includePath);
+                m_fileStack.push_back(includePath);
+                const bool included = InsertNodes(parent, node, GetChildren(includedRoot, false), false, scope);
+                m_fileStack.pop_back();
+                return included;
+            }
+
+            bool Conditional(XmlNode* parent, XmlNode* node, bool unless, Scope& scope)
+            {
+                AZStd::string condition;
+                if (!GetAttribute(node, "value", scope, condition))
+                {
+                    return false;
+                }
+
+                const Value value = Value::FromText(condition);
+                bool isTrue = false;
+                if (value.IsNumeric())
+                {
+                    isTrue = value.IsTrue();
+                }
+                else if (condition == "true" || condition == "True")
+                {
+                    isTrue = true;
+                }
+                else if (condition != "false" && condition != "False")
+                {
+                    return Fail(AZStd::string::format("Invalid condition '%s'", condition.c_str()));
+                }
+
+                if (isTrue == unless)
+                {
+                    return true;
+                }
+                return InsertNodes(parent, node, GetChildren(node, false), false, scope);
+            }
+
+            bool InsertBlock(XmlNode* parent, XmlNode* node, Scope& scope)
+            {
+                AZStd::string name;
+                if (!GetAttribute(node, "name", scope, name))
+                {
+                    return false;
+                }
+                const AZStd::vector<XmlNode*>* block = scope.FindBlock(name);
+                if (block == nullptr)
+                {
+                    return Fail(AZStd::string::format("Unknown block '%s'", name.c_str()));
+                }
+                return InsertNodes(parent, node, *block, true, scope);
+            }
+
+            bool CallMacro(XmlNode* parent, XmlNode* node, const AZStd::string& name, Scope& scope)
+            {
+                const Macro* macro = scope.FindMacro(name);
+                if (macro == nullptr)
+                {
+                    return Fail(AZStd::string::format("Unknown macro or unsupported element '%s%s'", m_prefix.c_str(), name.c_str()));
+                }
+                if (m_depth >= MaxNestingDepth)
+                {
+                    return Fail(AZStd::string::format("Too deeply nested calls of macro '%s'", name.c_str()));
+                }
+
+                // Macros see the properties of the calling scope, like with the xacro executable.
+                Scope macroScope;
+                macroScope.m_parent = &scope;
+
+                AZStd::unordered_map<AZStd::string, AZStd::string_view> passedValues;
+                for (const XmlAttribute* attribute = node->first_attribute(); attribute != nullptr; attribute = attribute->next_attribute())
+                {
+                    passedValues.emplace(
+                        AZStd::string(attribute->name(), attribute->name_size()),
+                        AZStd::string_view(attribute->value(), attribute->value_size()));
+                }
+
+                const AZStd::vector<XmlNode*> passedBlocks = GetChildren(node, true);
+                size_t nextBlock = 0;
+                for (const MacroParameter& parameter : macro->m_parameters)
+                {
+                    if (parameter.m_kind != MacroParameter::Kind::Value)
+                    {
+                        if (nextBlock >= passedBlocks.size())
+                        {
+                            return Fail(AZStd::string::format(
+                                "Missing block '%s' in call of macro '%s'", parameter.m_name.c_str(), name.c_str()));
+                        }
+                        XmlNode* block = passedBlocks[nextBlock++];
+                        macroScope.m_blocks[parameter.m_name] =
+                            parameter.m_kind == MacroParameter::Kind::Block ? AZStd::vector<XmlNode*>{ block } : GetChildren(block, false);
+                        continue;
+                    }
+
+                    AZStd::string value;
+                    if (auto passed = passedValues.find(parameter.m_name); passed != passedValues.end())
+                    {
+                        if (!Substitute(passed->second, scope, value))
+                        {
+                            return false;
+                        }
+                        passedValues.erase(passed);
+                    }
+                    else if (const AZStd::string* inherited = parameter.m_inherit ? scope.FindProperty(parameter.m_name) : nullptr;
+                             inherited != nullptr)
+                    {
+                        value = *inherited;
+                    }
+                    else if (parameter.m_hasDefault)
+                    {
+                        if (!Substitute(parameter.m_default, scope, value))
+                        {
+                            return false;
+                        }
+                    }
+                    else
+                    {
+                        return Fail(AZStd::string::format(
+                            "Missing parameter '%s' in call of macro '%s'", parameter.m_name.c_str(), name.c_str()));
+                    }
+                    macroScope.m_properties[parameter.m_name] = AZStd::move(value);
+                }
+
+                if (!passedValues.empty())
+                {
+                    return Fail(AZStd::string::format(
+                        "Unknown parameter '%s' in call of macro '%s'", passedValues.begin()->first.c_str(), name.c_str()));
+                }
+
+                ++m_depth;
+                const bool called = InsertNodes(parent, node, GetChildren(macro->m_definition, false), true, macroScope);
+                --m_depth;
+                return called;
+            }
+
+            //! Replaces `${expression}` and `$(argument)` in text, `$${` and `$$(` are kept as literal `${` and `$(`.
+            bool Substitute(AZStd::string_view text, const Scope& scope, AZStd::string& result)
+            {
+                result.clear();
+                size_t position = 0;
+                while (position < text.size())
+                {
+                    const size_t dollar = text.find('$', position);
+                    if (dollar == AZStd::string_view::npos)
+                    {
+                        result.append(text.substr(position));
+                        break;
+                    }
+                    result.append(text.substr(position, dollar - position));
+
+                    const AZStd::string_view rest = text.substr(dollar);
+                    if (rest.starts_with("$${") || rest.starts_with("$$("))
+                    {
+                        result.append(rest.substr(1, 2));
+                        position = dollar + 3;
+                    }
+                    else if (rest.starts_with("${"))
+                    {
+                        const size_t end = FindExpressionEnd(text, dollar + 2);
+                        if (end == AZStd::string_view::npos)
+                        {
+                            return Fail(AZStd::string::format("Unterminated expression in '%.*s'", AZ_STRING_ARG(text)));
+                        }
+                        const PropertyLookup lookup = [&scope](const AZStd::string& name)
+                        {
+                            return scope.FindProperty(name);
+                        };
+                        ValueOutcome value = ExpressionEvaluator(text.substr(dollar + 2, end - dollar - 2), lookup).Evaluate();
+                        if (!value.IsSuccess())
+                        {
+                            return Fail(value.GetError());
+                        }
+                        result.append(value.GetValue().ToString());
+                        position = end + 1;
+                    }
+                    else if (rest.starts_with("$("))
+                    {
+                        const size_t end = text.find(')', dollar + 2);
+                        if (end == AZStd::string_view::npos)
+                        {
+                            return Fail(AZStd::string::format("Unterminated substitution argument in '%.*s'", AZ_STRING_ARG(text)));
+                        }
+                        AZStd::string substituted;
+                        if (!EvaluateSubstitutionArgument(text.substr(dollar + 2, end - dollar - 2), substituted))
+                        {
+                            return false;
+                        }
+                        result.append(substituted);
+                        position = end + 1;
+                    }
+                    else
+                    {
+                        result.push_back('$');
+                        position = dollar + 1;
+                    }
+                }
+                return true;
+            }
+
+            //! Finds the brace closing an expression, braces inside string literals are skipped.
+            static size_t FindExpressionEnd(AZStd::string_view text, size_t start)
+            {
+                char quote = '\0';
+                for (size_t position = start; position < text.size(); ++position)
+                {
+                    const char character = text[position];
+                    if (quote != '\0')
+                    {
+                        quote = character == quote ? '\0' : quote;
+                    }
+                    else if (character == '\'' || character == '"')
+                    {
+                        quote = character;
+                    }
+                    else if (character == '}')
+                    {
+                        return position;
+                    }
+                }
+                return AZStd::string_view::npos;
+            }
+
+            bool EvaluateSubstitutionArgument(AZStd::string_view command, AZStd::string& result)
+            {
+                AZStd::vector<AZStd::string> words;
+                AZ::StringFunc::Tokenize(command, words, " \t");
+                if (words.empty())
+                {
+                    return Fail("Empty substitution argument");
+                }
+
+                const AZStd::string& type = words.front();
+                if (type == "find" && words.size() == 2)
+                {
+                    return FindPackage(words[1], result);
+                }
+                if (type == "arg" && words.size() == 2)
+                {
+                    auto argument = m_arguments.find(words[1]);
+                    if (argument == m_arguments.end())
+                    {
+                        return Fail(AZStd::string::format("Undefined argument '%s'", words[1].c_str()));
+                    }
+                    result = argument->second;
+                    return true;
+                }
+                if ((type == "env" && words.size() == 2) || (type == "optenv" && words.size() >= 2))
+                {
+                    const char* variable = std::getenv(words[1].c_str());
+                    m_result.m_environmentVariables[words[1]] =
+                        variable != nullptr ? AZStd::optional<AZStd::string>(variable) : AZStd::nullopt;
+                    if (variable != nullptr)
+                    {
+                        result = variable;
+                        return true;
+                    }
+                    if (type == "env")
+                    {
+                        return Fail(AZStd::string::format("Undefined environment variable '%s'", words[1].c_str()));
+                    }
+                    result.clear();
+                    for (size_t index = 2; index < words.size(); ++index)
+                    {
+                        result += (index > 2 ? " " : "") + words[index];
+                    }
+                    return true;
+                }
+                if (type == "dirname" && words.size() == 1)
+                {
+                    result = m_fileStack.back().ParentPath().Native();
+                    return true;
+                }
+                return Fail(AZStd::string::format("Unsupported substitution argument '$(%.*s)'", AZ_STRING_ARG(command)));
+            }
+
+            //! Resolves the share directory of a ROS package with the AMENT_PREFIX_PATH logic used for package:// URIs.
+            bool FindPackage(const AZStd::string& package, AZStd::string& result)
+            {
+                if (auto found = m_packages.find(package); found != m_packages.end())
+                {
+                    result = found->second;
+                    return true;
+                }
+
+                const AZ::IO::Path manifestUri(AZStd::string::format("package://%s/package.xml", package.c_str()));
+                const AZ::IO::Path manifestPath = ResolveAssetPath(manifestUri, m_fileStack.back(), m_amentPrefixPath, m_settings);
+                if (manifestPath.empty() || manifestPath == manifestUri || !AZ::IO::SystemFile::Exists(manifestPath.c_str()))
+                {
+                    return Fail(AZStd::string::format("Cannot find package '%s'", package.c_str()));
+                }
+                result = manifestPath.ParentPath().Native();
+                m_packages.emplace(package, result);
+                return true;
+            }
+
+            Params m_arguments;
+            const SdfAssetBuilderSettings& m_settings;
+            AZStd::string m_amentPrefixPath;
+            AZStd::string m_prefix = "xacro:";
+            AZStd::vector<AZStd::unique_ptr<LoadedDocument>> m_documents;
+            //! Files being expanded, the innermost include last.
+            AZStd::vector<AZ::IO::Path> m_fileStack;
+            AZStd::unordered_map<AZStd::string, AZStd::string> m_packages;
+            ExpansionResult m_result;
+            AZStd::string m_error;
+            int m_depth = 0;
+        };
+
+        AZ::u64 HashString(AZStd::string_view value, AZ::u64 seed)
+        {
+            return static_cast<AZ::u64>(
+                AZ::TypeHash64(reinterpret_cast<const uint8_t*>(value.data()), value.size(), AZ::HashValue64{ seed }));
+        }
+
+        AZStd::vector<AZ::u64> GetFileContentHashes(const AZStd::vector<AZ::IO::Path>& filenames)
+        {
+            AZStd::vector<AZ::u64> contentHashes;
+            contentHashes.reserve(filenames.size());
+            for (const AZ::IO::Path& filename : filenames)
+            {
+                contentHashes.push_back(GetFileContentHash(filename));
+            }
+            return contentHashes;
+        }
+
+        //! Checks that the environment variables read by an expansion still have the values they had during it.
+        bool IsEnvironmentUnchanged(const ExpansionResult& result)
+        {
+            for (const auto& [name, value] : result.m_environmentVariables)
+            {
+                const char* variable = std::getenv(name.c_str());
+                if (variable == nullptr ? value.has_value() : (!value.has_value() || *value != variable))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        //! The key changes with the parameters and with the packages available for `$(find ...)`.
+        AZ::u64 ComputeKey(const AZ::IO::Path& filename, const Params& params, const SdfAssetBuilderSettings& settings)
+        {
+            // Parameters are hashed in a fixed order, since the order of an unordered map is not.
+            const AZStd::map<AZStd::string, AZStd::string> sortedParams(params.begin(), params.end());
+            AZ::u64 key = HashString(filename.Native(), 0);
+            for (const auto& [name, value] : sortedParams)
+            {
+                key = HashString(value, HashString(name, key));
+            }
+            key = HashString(settings.m_resolverSettings.m_useAmentPrefixPath ? "ament" : "", key);
+            return HashString(GetAmentPrefixPath().c_str(), key);
+        }
+    } // namespace
+
+    ExpansionOutcome ExpandXacroFile(const AZ::IO::Path& filename, const Params& params, const SdfAssetBuilderSettings& settings)
+    {
+        auto readResult = AZ::Utils::ReadFile<AZStd::string>(filename.Native());
+        if (!readResult.IsSuccess())
+        {
+            return AZ::Failure(AZStd::string::format("Cannot read xacro file %s: %s", filename.c_str(), readResult.GetError().c_str()));
+        }
+        return XacroExpander(params, settings).Expand(readResult.TakeValue(), filename.LexicallyNormal());
+    }
+
+    ExpansionOutcome ExpandXacroData(
+        const AZStd::string& data, const AZ::IO::Path& filename, const Params& params, const SdfAssetBuilderSettings& settings)
+    {
+        return XacroExpander(params, settings).Expand(data, filename);
+    }
+
+    XacroExpansionCache::~XacroExpansionCache()
+    {
+        Deactivate();
+    }
+
+    void XacroExpansionCache::Activate()
+    {
+        if (AZ::Interface<XacroExpansionCache>::Get() == nullptr)
+        {
+            AZ::Interface<XacroExpansionCache>::Register(this);
+        }
+    }
+
+    void XacroExpansionCache::Deactivate()
+    {
+        if (AZ::Interface<XacroExpansionCache>::Get() == this)
+        {
+            AZ::Interface<XacroExpansionCache>::Unregister(this);
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_entries.clear();
+    }
+
+    ExpansionOutcome XacroExpansionCache::Expand(
+        const AZ::IO::Path& filename, const Params& params, const SdfAssetBuilderSettings& settings)
+    {
+        const AZ::IO::Path sourcePath = filename.LexicallyNormal();
+        const AZ::u64 key = ComputeKey(sourcePath, params, settings);
+
+        AZStd::optional<Entry> cached;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (auto it = m_entries.find(sourcePath); it != m_entries.end() && it->second.m_key == key)
+            {
+                cached = it->second;
+            }
+        }
+
+        // Included files and read environment variables are only known after an expansion, so a result is valid while
+        // none of them changed.
+        if (cached.has_value() && IsEnvironmentUnchanged(cached->m_result) &&
+            GetFileContentHashes(cached->m_result.m_files) == cached->m_contentHashes)
+        {
+            AZ_Trace("ParseXacro", "Reusing the expansion of %s\n", sourcePath.c_str());
+            return AZ::Success(AZStd::move(cached->m_result));
+        }
+
+        ExpansionOutcome outcome = ExpandXacroFile(sourcePath, params, settings);
+        if (!outcome.IsSuccess())
+        {
+            return outcome;
+        }
+
+        Entry entry;
+        entry.m_key = key;
+        entry.m_result = outcome.GetValue();
+        entry.m_contentHashes = GetFileContentHashes(entry.m_result.m_files);
+        if (AZStd::find(entry.m_contentHashes.begin(), entry.m_contentHashes.end(), 0) == entry.m_contentHashes.end())
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_entries[sourcePath] = AZStd::move(entry);
+        }
+        return outcome;
+    }
+} // namespace ROS2::Utils::xacro
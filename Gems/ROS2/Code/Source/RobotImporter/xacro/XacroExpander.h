@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <RobotImporter/xacro/XacroUtils.h>
+
+namespace ROS2::Utils::xacro
+{
+    //! Result of an in-process xacro expansion
+    struct ExpansionResult
+    {
+        //! Expanded URDF content
+        AZStd::string m_urdf;
+        //! Expanded file followed by every file it includes, directly or indirectly
+        AZStd::vector<AZ::IO::Path> m_files;
+        //! Environment variables read by `$(env)` and `$(optenv)` with the values they had, unset variables have no value
+        AZStd::unordered_map<AZStd::string, AZStd::optional<AZStd::string>> m_environmentVariables;
+    };
+
+    //! Expanded URDF, or a description of the construct which could not be expanded.
+    using ExpansionOutcome = AZ::Outcome<ExpansionResult, AZStd::string>;
+
+    //! Expands a xacro file in the calling process, without running the xacro executable.
+    //! Arguments, properties (including block properties), macros with default, inherited and block parameters, includes,
+    //! conditionals, arithmetic and boolean expressions, math functions and the `find`, `arg`, `env`, `optenv` and `dirname`
+    //! substitution arguments are supported. Any other construct fails the expansion, so the caller can fall back to the
+    //! xacro executable.
+    //! @param filename absolute path of the xacro file
+    //! @param params values of xacro arguments, overriding their defaults
+    //! @param settings settings used to resolve `$(find package)` with the AMENT_PREFIX_PATH
+    //! @returns expanded URDF and the files it was expanded from, or an error message
+    ExpansionOutcome ExpandXacroFile(const AZ::IO::Path& filename, const Params& params, const SdfAssetBuilderSettings& settings);
+
+    //! Expands xacro content in the calling process, see ExpandXacroFile.
+    //! @param data xacro content
+    //! @param filename path of the file the content comes from, used to resolve relative includes and `$(dirname)`
+    //! @param params values of xacro arguments, overriding their defaults
+    //! @param settings settings used to resolve `$(find package)` with the AMENT_PREFIX_PATH
+    //! @returns expanded URDF, or an error message
+    ExpansionOutcome ExpandXacroData(
+        const AZStd::string& data, const AZ::IO::Path& filename, const Params& params, const SdfAssetBuilderSettings& settings);
+
+    //! Keeps the results of in-process xacro expansions, so that importing the same robot description again does not
+    //! expand it again. A result is reused while the parameters, the AMENT_PREFIX_PATH, the environment variables read by
+    //! the expansion and the content hashes of the expanded file and of every file it includes are unchanged. Only the
+    //! latest result of every file is kept.
+    class XacroExpansionCache
+    {
+    public:
+        AZ_RTTI(XacroExpansionCache, "{0B5E7C21-8F3A-4D96-A2C4-7E1D9B6F3A58}");
+        AZ_DISABLE_COPY_MOVE(XacroExpansionCache);
+
+        XacroExpansionCache() = default;
+        virtual ~XacroExpansionCache();
+
+        //! Registers the cache as the instance used by ParseXacro.
+        void Activate();
+
+        //! Unregisters the cache and drops every result.
+        void Deactivate();
+
+        //! Expands a xacro file with ExpandXacroFile, unless a valid result of a previous expansion is available.
+        ExpansionOutcome Expand(const AZ::IO::Path& filename, const Params& params, const SdfAssetBuilderSettings& settings);
+
+    private:
+        struct Entry
+        {
+            AZ::u64 m_key = 0;
+            ExpansionResult m_result;
+            AZStd::vector<AZ::u64> m_contentHashes;
+        };
+
+        AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZ::IO::Path, Entry> m_entries;
+    };
+} // namespace ROS2::Utils::xacro
@@ -7,6 +7,7 @@
  */
 
 #include "XacroUtils.h"
+#include "XacroExpander.h"
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/XML/rapidxml.h>
@@ -18,13 +19,64 @@
 
 namespace ROS2::Utils::xacro
 {
+    namespace
+    {
+        void ParseExpandedUrdf(
+            ExecutionOutcome& outcome,
+            const AZStd::string& output,
+            const sdf::ParserConfig& parserConfig,
+            const SdfAssetBuilderSettings& settings)
+        {
+            if (settings.m_fixURDF)
+            {
+                // modify in memory URDF result
+                auto [modifiedXmlStr, modifiedElements] = (ROS2::Utils::ModifyURDFInMemory(output));
+                outcome.m_urdfHandle = UrdfParser::Parse(modifiedXmlStr, parserConfig);
+                outcome.m_urdfHandle.m_modifiedURDFContent = AZStd::move(modifiedXmlStr);
+                outcome.m_urdfHandle.m_urdfModifications = AZStd::move(modifiedElements);
+                outcome.m_succeed = true;
+            }
+            else
+            {
+                outcome.m_urdfHandle = UrdfParser::Parse(output, parserConfig);
+                outcome.m_succeed = true;
+            }
+        }
+    } // namespace
+
     ExecutionOutcome ParseXacro(
         const AZStd::string& filename, const Params& params, const sdf::ParserConfig& parserConfig, const SdfAssetBuilderSettings& settings)
     {
         ExecutionOutcome outcome;
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+
+        // Expanding in-process avoids starting Python twice for every file, the xacro executable is only needed for
+        // constructs the expander does not support.
+        bool expandInProcess = true;
+        if (settingsRegistry)
+        {
+            settingsRegistry->Get(expandInProcess, "/O3DE/ROS2/xacro_expand_in_process");
+        }
+        if (expandInProcess)
+        {
+            auto* expansionCache = AZ::Interface<XacroExpansionCache>::Get();
+            ExpansionOutcome expansion = expansionCache ? expansionCache->Expand(filename, params, settings)
+                                                        : ExpandXacroFile(filename, params, settings);
+            if (expansion.IsSuccess())
+            {
+                AZ_Printf("ParseXacro", "Expanded xacro file in-process : %s \n", filename.c_str());
+                outcome.m_called = AZStd::string::format("in-process xacro expansion of %s", filename.c_str());
+                ParseExpandedUrdf(outcome, expansion.GetValue().m_urdf, parserConfig, settings);
+                return outcome;
+            }
+            AZ_Printf(
+                "ParseXacro",
+                "Cannot expand xacro file in-process, using the xacro executable instead : %s \n",
+                expansion.GetError().c_str());
+        }
+
         // test if xacro exists
         AZ::IO::Path xacroPath = "xacro";
-        auto settingsRegistry = AZ::SettingsRegistry::Get();
         AZStd::string xacroExecutablePath;
         if (settingsRegistry && settingsRegistry->Get(xacroExecutablePath, "/O3DE/ROS2/xacro_executable_path"))
         {
@@ -90,22 +142,7 @@ namespace ROS2::Utils::xacro
         if (succeed && process_output.HasOutput() && !process_output.HasError())
         {
             AZ_Printf("ParseXacro", "xacro finished with success \n");
-            const auto& output = process_output.outputResult;
-
-            if (settings.m_fixURDF)
-            {
-                // modify in memory URDF result
-                auto [modifiedXmlStr, modifiedElements] = (ROS2::Utils::ModifyURDFInMemory(output));
-                outcome.m_urdfHandle = UrdfParser::Parse(modifiedXmlStr, parserConfig);
-                outcome.m_urdfHandle.m_modifiedURDFContent = AZStd::move(modifiedXmlStr);
-                outcome.m_urdfHandle.m_urdfModifications = AZStd::move(modifiedElements);
-                outcome.m_succeed = true;
-            }
-            else
-            {
-                outcome.m_urdfHandle = UrdfParser::Parse(output, parserConfig);
-                outcome.m_succeed = true;
-            }
+            ParseExpandedUrdf(outcome, process_output.outputResult, parserConfig, settings);
         }
         else
         {
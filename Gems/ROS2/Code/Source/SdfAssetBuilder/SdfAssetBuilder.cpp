@@ -26,6 +26,7 @@
 #include <RobotImporter/URDF/UrdfParser.h>
 #include <SdfAssetBuilder/SdfAssetBuilderSettings.h>
 #include <RobotImporter/Utils/ErrorUtils.h>
+#include <RobotImporter/Utils/SourceAssetsCrcIndex.h>
 #include <Utils/RobotImporterUtils.h>
 
 namespace ROS2
@@ -36,6 +37,7 @@ namespace ROS2
     }
 
     SdfAssetBuilder::SdfAssetBuilder()
+        : m_parseCache(SdfAssetBuilderParseCache::GetDefaultCacheDirectory())
     {
         // Read in all of the global settings from the settings registry.
         m_globalSettings.LoadSettings();
@@ -136,15 +138,30 @@ namespace ROS2
 
             // We should determine if this CRC check is actually necessary for resolving URI references.
             // Ideally, the additional overhead should be removed and the asset reference result should be trusted.
-            AZ::Crc32 crc = Utils::GetFileCRC(asset.m_availableAssetInfo.m_sourceAssetGlobalPath);
-            if (crc == asset.m_urdfFileCRC)
+            // A reference which resolved to the source asset itself trivially matches, so its content is never hashed.
+            bool contentMatches = false;
+            if (asset.m_resolvedUrdfPath.LexicallyNormal() == fullSourcePath.LexicallyNormal())
+            {
+                contentMatches = true;
+            }
+            else if (m_globalSettings.m_matchAssetsByContentHash)
+            {
+                const AZ::u64 sourceHash = Utils::GetFileContentHash(asset.m_availableAssetInfo.m_sourceAssetGlobalPath);
+                contentMatches = sourceHash != 0 && sourceHash == Utils::GetFileContentHash(asset.m_resolvedUrdfPath);
+            }
+            else
+            {
+                contentMatches = Utils::GetFileCRC(asset.m_availableAssetInfo.m_sourceAssetGlobalPath) == asset.m_urdfFileCRC;
+            }
+
+            if (contentMatches)
             {
                 AZ_Info(SdfAssetBuilderName, "Resolved uri '%s' to source asset '%s'.", uri.c_str(), assetInfo.m_relativePath.c_str());
                 assetMap.emplace(uri, AZStd::move(asset));
             }
             else
             {
-                AZ_Warning(SdfAssetBuilderName, false, "Resolved to source asset '%s' which has incorrect CRC, skipping.", assetInfo.m_relativePath.c_str());
+                AZ_Warning(SdfAssetBuilderName, false, "Resolved to source asset '%s' which has different content, skipping.", assetInfo.m_relativePath.c_str());
             }
         }
 
@@ -176,14 +193,20 @@ namespace ROS2
     {
         // To be able to successfully process the SDF job, we need job dependencies on every asset
         // referenced by the SDF file. Otherwise we won't be able to connect the references to the
-        // correct product assets. Unfortunately, this means that we need to redundantly parse the
-        // source file once here to set up the job dependencies, and then we'll parse it a second
-        // time when actually running ProcessJob().
+        // correct product assets. This means that we need to parse the source file here to set up the
+        // job dependencies. The parse result and the asset mappings are stored in the parse cache,
+        // so that ProcessJob() doesn't have to parse the source file a second time.
 
         // Eventually, we may need to extend the logic here even further to create more asset
         // generation jobs for exporting any embedded model / material / collider assets that only
         // exist inside the SDF file and not as an external reference.
 
+        // Source assets added since the last job may only be found by scanning the asset database again.
+        if (auto* crcIndex = AZ::Interface<Utils::SourceAssetsCrcIndex>::Get())
+        {
+            crcIndex->BeginBuilderJob();
+        }
+
         const auto fullSourcePath = AZ::IO::Path(request.m_watchFolder) / AZ::IO::Path(request.m_sourceFile);
 
         // Set the parser config settings for parsing URDF content through the libsdformat parser
@@ -204,6 +227,9 @@ namespace ROS2
         AZ_Info(SdfAssetBuilderName, "Finding asset IDs for all mesh and collider assets.");
         auto sourceAssetMap = AZStd::make_shared<Utils::UrdfAssetMap>(FindAssets(sdfRoot, fullSourcePath.String()));
 
+        // The cache is always refreshed here rather than read, so that CreateJobs picks up changes to included files.
+        m_parseCache.Store(fullSourcePath, m_fingerprint, sdfRoot, *sourceAssetMap);
+
         // Create an output job for each platform
         for (const AssetBuilderSDK::PlatformInfo& platformInfo : request.m_enabledPlatforms)
         {
@@ -241,6 +267,11 @@ namespace ROS2
         const AssetBuilderSDK::ProcessJobRequest& request,
         AssetBuilderSDK::ProcessJobResponse& response) const
     {
+        if (auto* crcIndex = AZ::Interface<Utils::SourceAssetsCrcIndex>::Get())
+        {
+            crcIndex->BeginBuilderJob();
+        }
+
         // Set whether or not the outputs should use PhysX articulation components for joints.
         const bool useArticulation = m_globalSettings.m_useArticulations;
 
@@ -250,23 +281,45 @@ namespace ROS2
         // Set the parser config settings for parsing URDF content through the libsdformat parser
         sdf::ParserConfig parserConfig = Utils::SDFormat::CreateSdfParserConfigFromSettings(m_globalSettings, AZ::IO::PathView(request.m_sourceFile));
 
-        // Read in and parse the source SDF file.
-        AZ_Info(SdfAssetBuilderName, "Parsing source file: %s", request.m_fullPath.c_str());
-        auto parsedSdfRootOutcome = UrdfParser::ParseFromFile(AZ::IO::PathView(request.m_fullPath), parserConfig, m_globalSettings);
-        if (!parsedSdfRootOutcome)
+        // Reuse the parse result of CreateJobs if the source file and the settings haven't changed since.
+        // The cached content is plain SDF, so it skips xacro expansion, URDF conversion and asset resolution.
+        UrdfParser::RootObjectOutcome parsedSdfRootOutcome;
+        AZStd::shared_ptr<Utils::UrdfAssetMap> assetMap;
+        if (auto cachedParseResult = m_parseCache.Load(AZ::IO::Path(request.m_fullPath), m_fingerprint); cachedParseResult.has_value())
         {
-            const AZStd::string sdfParseErrors = Utils::JoinSdfErrorsToString(parsedSdfRootOutcome.GetSdfErrors());
-            AZ_Error(SdfAssetBuilderName, false, R"(Failed to parse source file "%s". Errors: "%s")",
-                request.m_fullPath.c_str(), sdfParseErrors.c_str());
-            response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
-            return;
+            AZ_Info(SdfAssetBuilderName, "Using cached parse result for source file: %s", request.m_fullPath.c_str());
+            parsedSdfRootOutcome = UrdfParser::Parse(cachedParseResult->m_sdfContent, parserConfig);
+            if (parsedSdfRootOutcome)
+            {
+                assetMap = AZStd::make_shared<Utils::UrdfAssetMap>(AZStd::move(cachedParseResult->m_assetMap));
+            }
+            else
+            {
+                AZ_Warning(SdfAssetBuilderName, false, "Failed to parse cached content of '%s', parsing the source file.",
+                    request.m_fullPath.c_str());
+            }
         }
 
-        const sdf::Root& sdfRoot = parsedSdfRootOutcome.GetRoot();
+        if (!assetMap)
+        {
+            // Read in and parse the source SDF file.
+            AZ_Info(SdfAssetBuilderName, "Parsing source file: %s", request.m_fullPath.c_str());
+            parsedSdfRootOutcome = UrdfParser::ParseFromFile(AZ::IO::PathView(request.m_fullPath), parserConfig, m_globalSettings);
+            if (!parsedSdfRootOutcome)
+            {
+                const AZStd::string sdfParseErrors = Utils::JoinSdfErrorsToString(parsedSdfRootOutcome.GetSdfErrors());
+                AZ_Error(SdfAssetBuilderName, false, R"(Failed to parse source file "%s". Errors: "%s")",
+                    request.m_fullPath.c_str(), sdfParseErrors.c_str());
+                response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+                return;
+            }
 
-        // Resolve all the URI references into source asset GUIDs.
-        AZ_Info(SdfAssetBuilderName, "Finding asset IDs for all mesh and collider assets.");
-        auto assetMap = AZStd::make_shared<Utils::UrdfAssetMap>(FindAssets(sdfRoot, request.m_fullPath));
+            // Resolve all the URI references into source asset GUIDs.
+            AZ_Info(SdfAssetBuilderName, "Finding asset IDs for all mesh and collider assets.");
+            assetMap = AZStd::make_shared<Utils::UrdfAssetMap>(FindAssets(parsedSdfRootOutcome.GetRoot(), request.m_fullPath));
+        }
+
+        const sdf::Root& sdfRoot = parsedSdfRootOutcome.GetRoot();
 
         // Given the parsed source file and asset mappings, generate an in-memory prefab.
         AZ_Info(SdfAssetBuilderName, "Creating prefab from source file.");
@@ -11,6 +11,7 @@
 #include <AssetBuilderSDK/AssetBuilderBusses.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
 
+#include <SdfAssetBuilder/SdfAssetBuilderParseCache.h>
 #include <SdfAssetBuilder/SdfAssetBuilderSettings.h>
 #include <URDF/UrdfParser.h>
 #include <Utils/SourceAssetsStorage.h>
@@ -47,6 +48,9 @@ namespace ROS2
 
         SdfAssetBuilderSettings m_globalSettings;
         AZStd::string m_fingerprint;
+
+        //! Parse results of CreateJobs, reused by ProcessJob while the source file and settings are unchanged.
+        SdfAssetBuilderParseCache m_parseCache;
     };
 
 } // ROS2
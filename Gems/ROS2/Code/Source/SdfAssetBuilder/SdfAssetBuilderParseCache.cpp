@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <SdfAssetBuilder/SdfAssetBuilderParseCache.h>
+#include <SdfAssetBuilder/SdfAssetBuilder.h>
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Utils/TypeHash.h>
+
+namespace ROS2
+{
+    namespace
+    {
+        AZ::u64 HashString(AZStd::string_view value, AZ::u64 seed)
+        {
+            return static_cast<AZ::u64>(
+                AZ::TypeHash64(reinterpret_cast<const uint8_t*>(value.data()), value.size(), AZ::HashValue64{ seed }));
+        }
+
+        //! The key changes with the content of the source file, its location and the builder settings.
+        AZ::u64 ComputeKey(const AZ::IO::Path& fullSourcePath, AZStd::string_view fingerprint)
+        {
+            const AZ::u64 contentHash = Utils::GetFileContentHash(fullSourcePath);
+            if (contentHash == 0)
+            {
+                return 0;
+            }
+            return HashString(fullSourcePath.Native(), HashString(fingerprint, contentHash));
+        }
+
+        //! The resolved file and the source asset it was matched with must still hold the content that FindAssets compared.
+        bool IsCachedAssetUnchanged(const SdfAssetBuilderCachedAsset& cachedAsset)
+        {
+            const AZ::IO::Path resolvedPath(cachedAsset.m_resolvedPath);
+            if (!AZ::IO::SystemFile::Exists(resolvedPath.c_str()) ||
+                static_cast<AZ::u32>(Utils::GetFileCRC(resolvedPath)) != cachedAsset.m_crc ||
+                Utils::GetFileContentHash(resolvedPath) != cachedAsset.m_resolvedContentHash)
+            {
+                return false;
+            }
+
+            const AZ::IO::Path sourcePath(cachedAsset.m_sourceGlobalPath);
+            if (sourcePath.LexicallyNormal() == resolvedPath.LexicallyNormal())
+            {
+                return true;
+            }
+            return AZ::IO::SystemFile::Exists(sourcePath.c_str()) &&
+                Utils::GetFileContentHash(sourcePath) == cachedAsset.m_sourceContentHash;
+        }
+    } // namespace
+
+    void SdfAssetBuilderCachedAsset::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<SdfAssetBuilderCachedAsset>()
+                ->Version(1)
+                ->Field("Uri", &SdfAssetBuilderCachedAsset::m_uri)
+                ->Field("ResolvedPath", &SdfAssetBuilderCachedAsset::m_resolvedPath)
+                ->Field("Crc", &SdfAssetBuilderCachedAsset::m_crc)
+                ->Field("ReferenceType", &SdfAssetBuilderCachedAsset::m_referenceType)
+                ->Field("SourceRelativePath", &SdfAssetBuilderCachedAsset::m_sourceRelativePath)
+                ->Field("SourceGlobalPath", &SdfAssetBuilderCachedAsset::m_sourceGlobalPath)
+                ->Field("SourceGuid", &SdfAssetBuilderCachedAsset::m_sourceGuid)
+                ->Field("ResolvedContentHash", &SdfAssetBuilderCachedAsset::m_resolvedContentHash)
+                ->Field("SourceContentHash", &SdfAssetBuilderCachedAsset::m_sourceContentHash);
+        }
+    }
+
+    void SdfAssetBuilderCacheEntry::Reflect(AZ::ReflectContext* context)
+    {
+        SdfAssetBuilderCachedAsset::Reflect(context);
+
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<SdfAssetBuilderCacheEntry>()
+                ->Version(0)
+                ->Field("Version", &SdfAssetBuilderCacheEntry::m_version)
+                ->Field("SourcePath", &SdfAssetBuilderCacheEntry::m_sourcePath)
+                ->Field("Key", &SdfAssetBuilderCacheEntry::m_key)
+                ->Field("SdfContent", &SdfAssetBuilderCacheEntry::m_sdfContent)
+                ->Field("Assets", &SdfAssetBuilderCacheEntry::m_assets);
+        }
+    }
+
+    SdfAssetBuilderParseCache::SdfAssetBuilderParseCache(AZ::IO::Path cacheDirectory)
+        : m_cacheDirectory(AZStd::move(cacheDirectory))
+    {
+    }
+
+    void SdfAssetBuilderParseCache::Reflect(AZ::ReflectContext* context)
+    {
+        SdfAssetBuilderCacheEntry::Reflect(context);
+    }
+
+    AZ::IO::Path SdfAssetBuilderParseCache::GetDefaultCacheDirectory()
+    {
+        AZ::IO::Path userPath;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            settingsRegistry->Get(userPath.Native(), AZ::SettingsRegistryMergeUtils::FilePathKey_ProjectUserPath);
+        }
+        if (userPath.empty())
+        {
+            return {};
+        }
+
+        // CreateJobs has no job temp directory, so the cache lives next to them in the Asset Processor temp folder.
+        return userPath / "AssetProcessorTemp" / "SdfAssetBuilderCache";
+    }
+
+    bool SdfAssetBuilderParseCache::Store(
+        const AZ::IO::Path& fullSourcePath,
+        AZStd::string_view fingerprint,
+        const sdf::Root& root,
+        const Utils::UrdfAssetMap& assetMap) const
+    {
+        if (m_cacheDirectory.empty() || root.Element() == nullptr)
+        {
+            return false;
+        }
+
+        const AZ::IO::Path sourcePath = fullSourcePath.LexicallyNormal();
+        SdfAssetBuilderCacheEntry entry;
+        entry.m_version = CacheVersion;
+        entry.m_sourcePath = sourcePath.Native();
+        entry.m_key = ComputeKey(sourcePath, fingerprint);
+        if (entry.m_key == 0)
+        {
+            return false;
+        }
+
+        // The element tree holds the parsed content after xacro expansion, URDF conversion and resolution of included models.
+        const std::string sdfContent = root.Element()->ToString("");
+        entry.m_sdfContent.assign(sdfContent.c_str(), sdfContent.size());
+
+        entry.m_assets.reserve(assetMap.size());
+        for (const auto& [uri, asset] : assetMap)
+        {
+            SdfAssetBuilderCachedAsset& cachedAsset = entry.m_assets.emplace_back();
+            cachedAsset.m_uri = uri.Native();
+            cachedAsset.m_resolvedPath = asset.m_resolvedUrdfPath.Native();
+            cachedAsset.m_crc = static_cast<AZ::u32>(asset.m_urdfFileCRC);
+            cachedAsset.m_referenceType = static_cast<AZ::u32>(asset.m_assetReferenceType);
+            cachedAsset.m_sourceRelativePath = asset.m_availableAssetInfo.m_sourceAssetRelativePath.Native();
+            cachedAsset.m_sourceGlobalPath = asset.m_availableAssetInfo.m_sourceAssetGlobalPath.Native();
+            cachedAsset.m_sourceGuid = asset.m_availableAssetInfo.m_sourceGuid;
+            cachedAsset.m_resolvedContentHash = Utils::GetFileContentHash(asset.m_resolvedUrdfPath);
+            cachedAsset.m_sourceContentHash = Utils::GetFileContentHash(asset.m_availableAssetInfo.m_sourceAssetGlobalPath);
+        }
+
+        if (!AZ::IO::SystemFile::Exists(m_cacheDirectory.c_str()) && !AZ::IO::SystemFile::CreateDir(m_cacheDirectory.c_str()))
+        {
+            AZ_Warning(SdfAssetBuilderName, false, "Cannot create parse cache directory '%s'.", m_cacheDirectory.c_str());
+            return false;
+        }
+
+        // CreateJobs and ProcessJob of different builder processes may store and load the same file concurrently,
+        // so the cache file is written aside and renamed over the previous one.
+        const AZ::IO::Path cacheFilePath = GetCacheFilePath(sourcePath);
+        const AZ::IO::Path temporaryPath = AZStd::string::format(
+            "%s.%s.tmp", cacheFilePath.c_str(), AZ::Uuid::CreateRandom().ToFixedString(false, false).c_str());
+        auto saveResult = AZ::JsonSerializationUtils::SaveObjectToFile(&entry, temporaryPath.Native());
+        if (!saveResult.IsSuccess())
+        {
+            AZ_Warning(
+                SdfAssetBuilderName,
+                false,
+                "Cannot write parse cache file '%s': %s",
+                temporaryPath.c_str(),
+                saveResult.GetError().c_str());
+            AZ::IO::SystemFile::Delete(temporaryPath.c_str());
+            return false;
+        }
+        if (!AZ::IO::SystemFile::Rename(temporaryPath.c_str(), cacheFilePath.c_str(), true))
+        {
+            AZ_Warning(SdfAssetBuilderName, false, "Cannot replace parse cache file '%s'.", cacheFilePath.c_str());
+            AZ::IO::SystemFile::Delete(temporaryPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    AZStd::optional<SdfAssetBuilderParseCache::CachedParseResult> SdfAssetBuilderParseCache::Load(
+        const AZ::IO::Path& fullSourcePath, AZStd::string_view fingerprint) const
+    {
+        if (m_cacheDirectory.empty())
+        {
+            return AZStd::nullopt;
+        }
+
+        const AZ::IO::Path sourcePath = fullSourcePath.LexicallyNormal();
+        const AZ::IO::Path cacheFilePath = GetCacheFilePath(sourcePath);
+        if (!AZ::IO::SystemFile::Exists(cacheFilePath.c_str()))
+        {
+            return AZStd::nullopt;
+        }
+
+        SdfAssetBuilderCacheEntry entry;
+        if (auto loadResult = AZ::JsonSerializationUtils::LoadObjectFromFile(entry, cacheFilePath.Native()); !loadResult.IsSuccess())
+        {
+            AZ_Trace(SdfAssetBuilderName, "Ignoring unreadable parse cache file '%s': %s", cacheFilePath.c_str(), loadResult.GetError().c_str());
+            return AZStd::nullopt;
+        }
+
+        if (entry.m_version != CacheVersion || entry.m_sourcePath != sourcePath.Native() || entry.m_key == 0 ||
+            entry.m_key != ComputeKey(sourcePath, fingerprint))
+        {
+            return AZStd::nullopt;
+        }
+
+        CachedParseResult result;
+        result.m_sdfContent.assign(entry.m_sdfContent.c_str(), entry.m_sdfContent.size());
+        for (const SdfAssetBuilderCachedAsset& cachedAsset : entry.m_assets)
+        {
+            // A moved, deleted or modified asset invalidates the resolved references, so the source file is parsed again.
+            if (!IsCachedAssetUnchanged(cachedAsset))
+            {
+                return AZStd::nullopt;
+            }
+
+            Utils::UrdfAsset asset;
+            asset.m_urdfPath = cachedAsset.m_uri;
+            asset.m_resolvedUrdfPath = cachedAsset.m_resolvedPath;
+            asset.m_urdfFileCRC = AZ::Crc32(cachedAsset.m_crc);
+            asset.m_assetReferenceType = static_cast<Utils::ReferencedAssetType>(cachedAsset.m_referenceType);
+            asset.m_availableAssetInfo.m_sourceAssetRelativePath = cachedAsset.m_sourceRelativePath;
+            asset.m_availableAssetInfo.m_sourceAssetGlobalPath = cachedAsset.m_sourceGlobalPath;
+            asset.m_availableAssetInfo.m_sourceGuid = cachedAsset.m_sourceGuid;
+            result.m_assetMap.emplace(AZ::IO::Path(cachedAsset.m_uri), AZStd::move(asset));
+        }
+        return result;
+    }
+
+    AZ::IO::Path SdfAssetBuilderParseCache::GetCacheFilePath(const AZ::IO::Path& fullSourcePath) const
+    {
+        // One cache file per source file, so a changed source file replaces its previous result instead of accumulating files.
+        const AZ::u64 pathHash = HashString(fullSourcePath.Native(), 0);
+        return m_cacheDirectory / AZStd::string::format("%016llx.json", static_cast<unsigned long long>(pathHash));
+    }
+} // namespace ROS2
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/string/string.h>
+#include <RobotImporter/Utils/SourceAssetsStorage.h>
+
+#include <sdf/Root.hh>
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace ROS2
+{
+    //! A resolved asset reference of a cached parse result.
+    struct SdfAssetBuilderCachedAsset
+    {
+        AZ_TYPE_INFO(SdfAssetBuilderCachedAsset, "{3B2E5D6A-8C41-4F0E-9A7B-1D2C3E4F5A60}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        AZStd::string m_uri;
+        AZStd::string m_resolvedPath;
+        AZ::u32 m_crc = 0;
+        AZ::u32 m_referenceType = 0;
+        AZStd::string m_sourceRelativePath;
+        AZStd::string m_sourceGlobalPath;
+        AZ::Uuid m_sourceGuid = AZ::Uuid::CreateNull();
+        //! Content hashes of the resolved file and of the source asset it was matched with, when the result was stored.
+        AZ::u64 m_resolvedContentHash = 0;
+        AZ::u64 m_sourceContentHash = 0;
+    };
+
+    //! The cache file of a single source file.
+    struct SdfAssetBuilderCacheEntry
+    {
+        AZ_TYPE_INFO(SdfAssetBuilderCacheEntry, "{9F4C7A21-6E3B-4D58-B0C2-7A8E5F1D3B94}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        AZ::u32 m_version = 0;
+        AZStd::string m_sourcePath;
+        AZ::u64 m_key = 0;
+        AZStd::string m_sdfContent;
+        AZStd::vector<SdfAssetBuilderCachedAsset> m_assets;
+    };
+
+    //! Shares the parse results of the SdfAssetBuilder between CreateJobs and ProcessJob, so that a source file is parsed
+    //! (including any xacro expansion and URDF conversion) and has its asset references resolved once per change.
+    //! CreateJobs and ProcessJob may run in different builder processes, so every source file has a cache file on disk.
+    //! A cache file is only used if the content of the source file, the builder settings fingerprint and the content of every
+    //! referenced file are unchanged.
+    class SdfAssetBuilderParseCache
+    {
+    public:
+        //! Version of the cache files, incremented whenever their layout changes.
+        static constexpr AZ::u32 CacheVersion = 2;
+
+        //! A parse result read back from the cache.
+        struct CachedParseResult
+        {
+            //! SDF content of the parsed source file, with URDF converted and included models expanded.
+            std::string m_sdfContent;
+            //! Asset references found by SdfAssetBuilder::FindAssets.
+            Utils::UrdfAssetMap m_assetMap;
+        };
+
+        //! @param cacheDirectory - directory of the cache files, caching is disabled if it is empty
+        explicit SdfAssetBuilderParseCache(AZ::IO::Path cacheDirectory = {});
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Returns the cache directory within the Asset Processor temp folder of the project, or an empty path if the project is unknown.
+        static AZ::IO::Path GetDefaultCacheDirectory();
+
+        //! Stores the parse result of a source file, replacing any previous result for the same file.
+        //! The cache file is written aside and renamed over the previous one, so concurrent builders never read a partial file.
+        //! @returns true if succeed
+        bool Store(
+            const AZ::IO::Path& fullSourcePath,
+            AZStd::string_view fingerprint,
+            const sdf::Root& root,
+            const Utils::UrdfAssetMap& assetMap) const;
+
+        //! Reads the parse result of a source file.
+        //! @returns the cached result, or nothing if the source file, the fingerprint or any referenced source asset changed
+        AZStd::optional<CachedParseResult> Load(const AZ::IO::Path& fullSourcePath, AZStd::string_view fingerprint) const;
+
+    private:
+        //! Returns the path of the cache file of a source file.
+        AZ::IO::Path GetCacheFilePath(const AZ::IO::Path& fullSourcePath) const;
+
+        AZ::IO::Path m_cacheDirectory;
+    };
+} // namespace ROS2
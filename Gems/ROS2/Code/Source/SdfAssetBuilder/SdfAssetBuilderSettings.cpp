@@ -52,7 +52,9 @@ namespace ROS2
         constexpr auto SdfAssetBuilderURDFPreserveFixedJointRegistryKey = SDFSettingsRootKey("URDFPreserveFixedJoint");
         constexpr auto SdfAssetBuilderImportMeshesJointRegistryKey = SDFSettingsRootKey("ImportMeshes");
         constexpr auto SdfAssetBuilderFixURDFRegistryKey = SDFSettingsRootKey("FixURDF");
+        constexpr auto SdfAssetBuilderMatchAssetsByContentHashRegistryKey = SDFSettingsRootKey("MatchAssetsByContentHash");
         constexpr auto SdfAssetBuilderAssetResolverRegistryKey = SDFSettingsRootKey("AssetResolverSettings");
+        constexpr auto SdfAssetBuilderColliderMeshRegistryKey = SDFSettingsRootKey("ColliderMeshSettings");
     }
 
     void SdfAssetPathResolverSettings::Reflect(AZ::ReflectContext* context)
@@ -90,9 +92,84 @@ namespace ROS2
         }
     }
 
+    void SdfColliderMeshSettings::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Enum<ColliderMeshExportMethod>()
+                ->Value("ConvexDecomposition", ColliderMeshExportMethod::ConvexDecomposition)
+                ->Value("ConvexHull", ColliderMeshExportMethod::ConvexHull)
+                ->Value("Primitive", ColliderMeshExportMethod::Primitive);
+
+            serializeContext->Class<SdfColliderMeshSettings>()
+                ->Version(0)
+                ->Field("ExportMethod", &SdfColliderMeshSettings::m_exportMethod)
+                ->Field("MaxConvexHulls", &SdfColliderMeshSettings::m_maxConvexHulls)
+                ->Field("MaxVerticesPerConvexHull", &SdfColliderMeshSettings::m_maxVerticesPerConvexHull)
+                ->Field("LinkExportMethods", &SdfColliderMeshSettings::m_linkExportMethods)
+             ;
+
+            if (auto editContext = serializeContext->GetEditContext(); editContext != nullptr)
+            {
+                editContext->Enum<ColliderMeshExportMethod>("Collider mesh export method", "Collision geometry generated from a mesh")
+                    ->Value("Convex decomposition", ColliderMeshExportMethod::ConvexDecomposition)
+                    ->Value("Convex hull", ColliderMeshExportMethod::ConvexHull)
+                    ->Value("Primitive", ColliderMeshExportMethod::Primitive);
+
+                editContext
+                    ->Class<SdfColliderMeshSettings>(
+                        "Collider Meshes", "Exposes settings for generating collision geometry from the collider meshes")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::ComboBox,
+                        &SdfColliderMeshSettings::m_exportMethod,
+                        "Export method",
+                        "Collision geometry generated from collider meshes: a convex decomposition, a single convex hull"
+                        " or a fitted primitive shape, from the most to the least detailed.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &SdfColliderMeshSettings::m_maxConvexHulls,
+                        "Max convex hulls",
+                        "Upper bound of the number of convex hulls a mesh is decomposed into.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &SdfColliderMeshSettings::m_maxVerticesPerConvexHull,
+                        "Max vertices per convex hull",
+                        "Upper bound of the number of vertices of each convex hull, of a single hull or of a decomposed mesh.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 4)
+                        ->Attribute(AZ::Edit::Attributes::Max, 255)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &SdfColliderMeshSettings::m_linkExportMethods,
+                        "Per link export methods",
+                        "Map fully qualified link names, scoped by the names of the models containing them, to the export method"
+                        " of their collider meshes (ex: 'robot::base_link' -> 'Primitive')");
+            }
+        }
+    }
+
+    ColliderMeshExportMethod SdfColliderMeshSettings::GetExportMethod(AZStd::string_view fullyQualifiedLinkName) const
+    {
+        if (auto linkIt = m_linkExportMethods.find(AZStd::string(fullyQualifiedLinkName)); linkIt != m_linkExportMethods.end())
+        {
+            return linkIt->second;
+        }
+        return m_exportMethod;
+    }
+
+    ColliderMeshExport SdfColliderMeshSettings::GetExport(ColliderMeshExportMethod exportMethod) const
+    {
+        ColliderMeshExport colliderMeshExport;
+        colliderMeshExport.m_exportMethod = exportMethod;
+        colliderMeshExport.m_maxConvexHulls = m_maxConvexHulls;
+        colliderMeshExport.m_maxVerticesPerConvexHull = m_maxVerticesPerConvexHull;
+        return colliderMeshExport;
+    }
+
     void SdfAssetBuilderSettings::Reflect(AZ::ReflectContext* context)
     {
         SdfAssetPathResolverSettings::Reflect(context);
+        SdfColliderMeshSettings::Reflect(context);
 
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
@@ -102,7 +179,9 @@ namespace ROS2
                 ->Field("URDFPreserveFixedJoint", &SdfAssetBuilderSettings::m_urdfPreserveFixedJoints)
                 ->Field("ImportReferencedMeshFiles", &SdfAssetBuilderSettings::m_importReferencedMeshFiles)
                 ->Field("FixURDF", &SdfAssetBuilderSettings::m_fixURDF)
+                ->Field("MatchAssetsByContentHash", &SdfAssetBuilderSettings::m_matchAssetsByContentHash)
                 ->Field("AssetResolverSettings", &SdfAssetBuilderSettings::m_resolverSettings)
+                ->Field("ColliderMeshSettings", &SdfAssetBuilderSettings::m_colliderMeshSettings)
 
                 // m_builderPatterns aren't serialized because we only use the serialization
                 // to detect when global settings changes cause us to rebuild our assets.
@@ -139,11 +218,22 @@ namespace ROS2
                         &SdfAssetBuilderSettings::m_fixURDF,
                         "Fix URDF to be compatible with libsdformat",
                         "When set, fixes the URDF file before importing it. This is useful for fixing URDF files that have missing inertials or duplicate names within links and joints.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &SdfAssetBuilderSettings::m_matchAssetsByContentHash,
+                        "Match assets by content",
+                        "When set, referenced mesh files are matched with existing source assets by a hash of their whole content."
+                        " Otherwise only the first kilobyte is compared, which can confuse files exported with identical headers.")
                     ->DataElement(
                         AZ::Edit::UIHandlers::Default,
                         &SdfAssetBuilderSettings::m_resolverSettings,
                         "Path Resolvers",
                         "Determines how to resolve any partial asset paths.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &SdfAssetBuilderSettings::m_colliderMeshSettings,
+                        "Collider Meshes",
+                        "Determines the collision geometry generated from the collider meshes of imported robots.")
                         ;
             }
         }
@@ -170,6 +260,9 @@ namespace ROS2
         // Query the fix URDF option from the Settings Registry to determine if the URDF file should be fixed before importing
         settingsRegistry->Get(m_fixURDF, SdfAssetBuilderFixURDFRegistryKey);
 
+        // Query whether referenced files are matched with source assets by their whole content or by the CRC of their first kilobyte
+        settingsRegistry->Get(m_matchAssetsByContentHash, SdfAssetBuilderMatchAssetsByContentHashRegistryKey);
+
         // Visit each supported file type extension and create an asset builder wildcard pattern for it.
         auto VisitFileTypeExtensions = [&settingsRegistry, this]
             (const AZ::SettingsRegistryInterface::VisitArgs& visitArgs)
@@ -202,6 +295,9 @@ namespace ROS2
         // Get the Asset Resolver settings
         settingsRegistry->GetObject(m_resolverSettings, SdfAssetBuilderAssetResolverRegistryKey);
 
+        // Get the settings of the collision geometry generated from collider meshes
+        settingsRegistry->GetObject(m_colliderMeshSettings, SdfAssetBuilderColliderMeshRegistryKey);
+
         AZ_Warning(SdfAssetBuilderName, !m_builderPatterns.empty(), "SdfAssetBuilder disabled, no supported file type extensions found.");
     }
 } // ROS2
@@ -34,6 +34,56 @@ namespace ROS2
         UriPrefixMap m_uriPrefixMap;
     };
 
+    //! Collision geometry generated by the PhysX scene pipeline from the collider meshes of an imported robot.
+    //! The methods are ordered from the most to the least detailed geometry.
+    enum class ColliderMeshExportMethod : AZ::u8
+    {
+        //! Approximate convex decomposition (V-HACD) of each mesh into a limited number of convex hulls
+        ConvexDecomposition,
+        //! A single convex hull of each mesh
+        ConvexHull,
+        //! A primitive shape (sphere, box or capsule) fitted to each mesh
+        Primitive,
+    };
+
+    //! Configuration of the collision geometry generated from a collider mesh.
+    struct ColliderMeshExport
+    {
+        ColliderMeshExportMethod m_exportMethod = ColliderMeshExportMethod::ConvexDecomposition;
+        //! Upper bound of the number of convex hulls a mesh is decomposed into
+        AZ::u32 m_maxConvexHulls = 32;
+        //! Upper bound of the number of vertices of each convex hull, of a single hull or of a decomposed mesh
+        AZ::u32 m_maxVerticesPerConvexHull = 64;
+    };
+
+    struct SdfColliderMeshSettings
+    {
+    public:
+        AZ_RTTI(SdfColliderMeshSettings, "{3C8A5E21-7D94-4B6F-A1E0-5F2B9C7D4E63}");
+
+        SdfColliderMeshSettings() = default;
+        virtual ~SdfColliderMeshSettings() = default;
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Returns the export method of the collider meshes of a link.
+        //! @param fullyQualifiedLinkName name of the link scoped by the names of the models containing it, see Utils::SdfIndex
+        ColliderMeshExportMethod GetExportMethod(AZStd::string_view fullyQualifiedLinkName) const;
+
+        //! Returns the configuration of a collider mesh exported with the given method, within the limits of these settings.
+        ColliderMeshExport GetExport(ColliderMeshExportMethod exportMethod) const;
+
+        //! Export method of the collider meshes of links without an entry in m_linkExportMethods
+        ColliderMeshExportMethod m_exportMethod = ColliderMeshExportMethod::ConvexDecomposition;
+        //! Upper bound of the number of convex hulls a mesh is decomposed into
+        AZ::u32 m_maxConvexHulls = 32;
+        //! Upper bound of the number of vertices of each convex hull, of a single hull or of a decomposed mesh
+        AZ::u32 m_maxVerticesPerConvexHull = 64;
+        //! Export methods of the collider meshes of specific links, keyed by fully qualified link name (ex: "robot::base_link"),
+        //! so that links with the same name in different models can be told apart
+        AZStd::unordered_map<AZStd::string, ColliderMeshExportMethod> m_linkExportMethods;
+    };
+
     struct SdfAssetBuilderSettings
     {
     public:
@@ -59,7 +109,17 @@ namespace ROS2
         bool m_importReferencedMeshFiles = true;
         //! When true URDF will be fixed to be compatible with SDFormat.
         bool m_fixURDF = true;
+        //! When true, referenced files are matched with source assets by a hash of their whole content rather than
+        //! only by the CRC of their first kilobyte.
+        bool m_matchAssetsByContentHash = true;
 
         SdfAssetPathResolverSettings m_resolverSettings;
+        //! Collision geometry generated from the collider meshes copied into the project
+        SdfColliderMeshSettings m_colliderMeshSettings;
     };
 } // namespace ROS2
+
+namespace AZ
+{
+    AZ_TYPE_INFO_SPECIALIZE(ROS2::ColliderMeshExportMethod, "{B7E04F92-1C6D-4A38-9E5B-2D8F7A1C6B49}");
+} // namespace AZ
@@ -6,8 +6,10 @@
  *
  */
 #include <AzCore/Serialization/SerializeContext.h>
+#include <RobotImporter/Utils/SourceAssetsCrcIndex.h>
 #include <SdfAssetBuilder/SdfAssetBuilderSystemComponent.h>
 #include <SdfAssetBuilder/SdfAssetBuilder.h>
+#include <SdfAssetBuilder/SdfAssetBuilderParseCache.h>
 #include <SdfAssetBuilder/SdfAssetBuilderSettings.h>
 
 namespace ROS2
@@ -22,6 +24,7 @@ namespace ROS2
     void SdfAssetBuilderSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         SdfAssetBuilderSettings::Reflect(context);
+        SdfAssetBuilderParseCache::Reflect(context);
 
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
@@ -56,12 +59,16 @@ namespace ROS2
 
     void SdfAssetBuilderSystemComponent::Activate()
     {
+        // Builder processes do not receive source file notifications, so the index checks files against their size and modification time.
+        m_sourceAssetsCrcIndex = AZStd::make_unique<Utils::SourceAssetsCrcIndex>(Utils::SourceAssetsCrcIndex::GetDefaultIndexFilePath());
+        m_sourceAssetsCrcIndex->Activate(false);
         m_sdfAssetBuilder = AZStd::make_unique<SdfAssetBuilder>();
     }
 
     void SdfAssetBuilderSystemComponent::Deactivate()
     {
         m_sdfAssetBuilder.reset();
+        m_sourceAssetsCrcIndex.reset();
     }
 
 } // namespace ROS2
@@ -18,6 +18,11 @@ namespace ROS2
 {
     class SdfAssetBuilder;
 
+    namespace Utils
+    {
+        class SourceAssetsCrcIndex;
+    }
+
     /// System component for registering and managing the SdfAssetBuilder.
     class SdfAssetBuilderSystemComponent : public AZ::Component
     {
@@ -40,5 +45,8 @@ namespace ROS2
 
         // Asset builder for Sdf assets
         AZStd::unique_ptr<SdfAssetBuilder> m_sdfAssetBuilder;
+
+        // Checksums of source assets, shared by every job of this builder process and persisted between processes
+        AZStd::unique_ptr<Utils::SourceAssetsCrcIndex> m_sourceAssetsCrcIndex;
     };
 } // namespace ROS2
@@ -7,6 +7,7 @@
  */
 
 #include "ROS2SpawnerComponent.h"
+#include "SpawnBatchState.h"
 #include "Spawner/ROS2SpawnerComponentController.h"
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -21,7 +22,6 @@
 
 namespace ROS2
 {
-
     ROS2SpawnerComponent::ROS2SpawnerComponent(const ROS2SpawnerComponentConfig& properties)
         : ROS2SpawnerComponentBase(properties)
     {
@@ -31,6 +31,13 @@ namespace ROS2
     {
         ROS2SpawnerComponentBase::Activate();
 
+        // Queue loading of all registered spawnables up front, so that spawn requests do not have to wait for the assets.
+        m_spawnables = m_controller.GetSpawnables();
+        for (auto& [name, spawnable] : m_spawnables)
+        {
+            spawnable.QueueLoad();
+        }
+
         auto ros2Node = ROS2Interface::Get()->GetNode();
         AZ_Assert(ros2Node, "ROS 2 node is not initialized");
 
@@ -72,18 +79,37 @@ namespace ROS2
             {
                 GetSpawnPointsNames(request, response);
             });
+
+        SpawnerBatchRequestsBus::Handler::BusConnect(GetEntityId());
     }
 
     void ROS2SpawnerComponent::Deactivate()
     {
+        SpawnerBatchRequestsBus::Handler::BusDisconnect();
+        AZ::Data::AssetBus::MultiHandler::BusDisconnect();
         ROS2SpawnerComponentBase::Deactivate();
 
+        // Spawns waiting for their spawnable to load are rejected.
+        auto pendingSpawns = AZStd::move(m_pendingSpawns);
+        m_pendingSpawns.clear();
+        for (auto& [assetId, spawns] : pendingSpawns)
+        {
+            for (auto& pendingSpawn : spawns)
+            {
+                SpawnEntityResult result;
+                result.statusMessage = "Spawner was deactivated before spawnable " + pendingSpawn.m_entry.spawnableName + " was loaded.";
+                pendingSpawn.m_completionCallback(result);
+            }
+        }
+
         m_getSpawnablesNamesService.reset();
         m_spawnService.reset();
         m_deleteService.reset();
         m_getSpawnPointInfoService.reset();
         m_getSpawnPointsNamesService.reset();
         m_tickets.clear();
+        m_ticketPool.clear();
+        m_spawnables.clear();
     }
 
     void ROS2SpawnerComponent::Reflect(AZ::ReflectContext* context)
@@ -99,7 +125,7 @@ namespace ROS2
     void ROS2SpawnerComponent::GetAvailableSpawnableNames(
         const GetAvailableSpawnableNamesRequest request, GetAvailableSpawnableNamesResponse response)
     {
-        for (const auto& spawnable : m_controller.GetSpawnables())
+        for (const auto& spawnable : m_spawnables)
         {
             response->model_names.emplace_back(spawnable.first.c_str());
         }
@@ -108,98 +134,173 @@ namespace ROS2
     void ROS2SpawnerComponent::SpawnEntity(
         const SpawnEntityServiceHandle service_handle, const std::shared_ptr<rmw_request_id_t> header, const SpawnEntityRequest request)
     {
-        AZStd::string spawnableName(request->name.c_str());
-        AZStd::string spawnableNamespace(request->robot_namespace.c_str());
         AZStd::string spawnPointName(request->xml.c_str(), request->xml.size());
 
-        SpawnEntityResponse response;
+        SpawnEntityInfo entry;
+        entry.spawnableName = request->name.c_str();
+        entry.robotNamespace = request->robot_namespace.c_str();
 
-        auto namespaceValidation = ROS2Names::ValidateNamespace(spawnableNamespace);
-        if (!namespaceValidation.IsSuccess())
+        auto spawnPoints = GetSpawnPoints();
+        if (spawnPoints.contains(spawnPointName))
         {
-            response.success = false;
-            response.status_message = namespaceValidation.GetError().data();
-            service_handle->send_response(*header, response);
-            return;
+            entry.pose = spawnPoints.at(spawnPointName).pose;
+        }
+        else
+        {
+            entry.pose = { AZ::Vector3(request->initial_pose.position.x, request->initial_pose.position.y, request->initial_pose.position.z),
+                           AZ::Quaternion(
+                               request->initial_pose.orientation.x,
+                               request->initial_pose.orientation.y,
+                               request->initial_pose.orientation.z,
+                               request->initial_pose.orientation.w),
+                           1.0f };
         }
 
-        auto spawnPoints = GetSpawnPoints();
+        SpawnSingleEntity(
+            entry,
+            [service_handle, header](const SpawnEntityResult& result)
+            {
+                SpawnEntityResponse response;
+                response.success = result.success;
+                response.status_message = result.success ? result.ticketName.c_str() : result.statusMessage.c_str();
+                service_handle->send_response(*header, response);
+            });
+    }
 
-        if (!m_controller.GetSpawnables().contains(spawnableName))
+    void ROS2SpawnerComponent::SpawnEntities(const AZStd::vector<SpawnEntityInfo>& entries, SpawnBatchCompletionCallback completionCallback)
+    {
+        if (entries.empty())
         {
-            response.success = false;
-            response.status_message = "Could not find spawnable with given name: " + request->name;
-            service_handle->send_response(*header, response);
+            if (completionCallback)
+            {
+                completionCallback({});
+            }
             return;
         }
 
-        auto spawnable = m_controller.GetSpawnables().find(spawnableName);
+        auto batch = AZStd::make_shared<SpawnBatchState>(entries.size(), AZStd::move(completionCallback));
+        for (size_t index = 0; index < entries.size(); ++index)
+        {
+            SpawnSingleEntity(
+                entries[index],
+                [batch, index](const SpawnEntityResult& result)
+                {
+                    batch->SetResult(index, result);
+                });
+        }
+    }
+
+    void ROS2SpawnerComponent::SpawnSingleEntity(const SpawnEntityInfo& entry, SpawnCompletionCallback completionCallback)
+    {
+        SpawnEntityResult result;
 
-        if (spawnable->second->IsLoading())
+        auto namespaceValidation = ROS2Names::ValidateNamespace(entry.robotNamespace);
+        if (!namespaceValidation.IsSuccess())
         {
-            // This is an Editor only situation. All assets during game mode are fully loaded.
-            response.success = false;
-            response.status_message = "Asset for spawnable " + request->name + " has not yet loaded.";
-            service_handle->send_response(*header, response);
+            result.statusMessage = namespaceValidation.GetError();
+            completionCallback(result);
             return;
         }
 
-        if (spawnable->second->IsError())
+        auto spawnable = m_spawnables.find(entry.spawnableName);
+        if (spawnable == m_spawnables.end())
         {
-            response.success = false;
-            response.status_message = "Spawnable " + request->name + " loaded with an error.";
-            service_handle->send_response(*header, response);
+            result.statusMessage = "Could not find spawnable with given name: " + entry.spawnableName;
+            completionCallback(result);
             return;
         }
 
-        if (!m_tickets.contains(spawnableName))
+        if (spawnable->second.IsLoading())
         {
-            // if a ticket for this spawnable was not created but the spawnable name is correct, create the ticket and then use it to
-            // spawn an entity
-            auto spawnable = m_controller.GetSpawnables().find(spawnableName);
-            m_tickets.emplace(spawnable->first, AzFramework::EntitySpawnTicket(spawnable->second));
+            // This is an Editor only situation. All assets during game mode are fully loaded. The spawn is resumed once the
+            // asset is loaded, instead of blocking the thread which handles the request.
+            const AZ::Data::AssetId assetId = spawnable->second.GetId();
+            auto& pendingSpawns = m_pendingSpawns[assetId];
+            pendingSpawns.push_back({ entry, AZStd::move(completionCallback) });
+            if (pendingSpawns.size() == 1)
+            {
+                // Connecting to an asset which has finished loading in the meantime calls OnAssetReady right away.
+                AZ::Data::AssetBus::MultiHandler::BusConnect(assetId);
+            }
+            return;
+        }
+
+        if (!spawnable->second.IsReady())
+        {
+            result.statusMessage = "Spawnable " + entry.spawnableName + " loaded with an error.";
+            completionCallback(result);
+            return;
         }
 
-        auto spawnableTicket = AzFramework::EntitySpawnTicket(spawnable->second);
-        auto ticketId = spawnableTicket.GetId();
-        AZStd::string ticketName = spawnable->first + "_" + AZStd::to_string(ticketId);
-        m_tickets.emplace(ticketName, AZStd::move(spawnableTicket));
+        auto spawnableTicket = AcquireTicket(spawnable->first, spawnable->second);
+        const AZStd::string ticketName = MakeSpawnTicketName(spawnable->first, spawnableTicket.GetId(), m_spawnGeneration++);
+        auto [instance, inserted] = m_tickets.emplace(ticketName, SpawnedInstance{ spawnable->first, AZStd::move(spawnableTicket) });
+        if (!inserted)
+        {
+            result.statusMessage = "Instance with name " + ticketName + " already exists.";
+            completionCallback(result);
+            return;
+        }
 
         auto spawner = AZ::Interface<AzFramework::SpawnableEntitiesDefinition>::Get();
 
         AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
 
-        AZ::Transform transform;
+        optionalArgs.m_preInsertionCallback = [this, entry](auto id, auto view)
+        {
+            PreSpawn(id, view, entry.pose, entry.spawnableName, entry.instanceName, entry.robotNamespace);
+        };
 
-        if (spawnPoints.contains(spawnPointName))
+        optionalArgs.m_completionCallback = [completionCallback, ticketName](auto id, auto view)
         {
-            transform = spawnPoints.at(spawnPointName).pose;
-        }
-        else
+            SpawnEntityResult result;
+            result.success = true;
+            result.ticketName = ticketName;
+            completionCallback(result);
+        };
+
+        spawner->SpawnAllEntities(instance->second.m_ticket, optionalArgs);
+    }
+
+    void ROS2SpawnerComponent::OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset)
+    {
+        ResumePendingSpawns(asset.GetId());
+    }
+
+    void ROS2SpawnerComponent::OnAssetError(AZ::Data::Asset<AZ::Data::AssetData> asset)
+    {
+        ResumePendingSpawns(asset.GetId());
+    }
+
+    void ROS2SpawnerComponent::ResumePendingSpawns(const AZ::Data::AssetId& assetId)
+    {
+        AZ::Data::AssetBus::MultiHandler::BusDisconnect(assetId);
+
+        auto pendingSpawnsIt = m_pendingSpawns.find(assetId);
+        if (pendingSpawnsIt == m_pendingSpawns.end())
         {
-            transform = { AZ::Vector3(request->initial_pose.position.x, request->initial_pose.position.y, request->initial_pose.position.z),
-                          AZ::Quaternion(
-                              request->initial_pose.orientation.x,
-                              request->initial_pose.orientation.y,
-                              request->initial_pose.orientation.z,
-                              request->initial_pose.orientation.w),
-                          1.0f };
+            return;
         }
+        auto pendingSpawns = AZStd::move(pendingSpawnsIt->second);
+        m_pendingSpawns.erase(pendingSpawnsIt);
 
-        optionalArgs.m_preInsertionCallback = [this, transform, spawnableName, spawnableNamespace](auto id, auto view)
+        // The spawnable is no longer loading, so the spawns either proceed or report the load error.
+        for (auto& pendingSpawn : pendingSpawns)
         {
-            PreSpawn(id, view, transform, spawnableName, spawnableNamespace);
-        };
+            SpawnSingleEntity(pendingSpawn.m_entry, AZStd::move(pendingSpawn.m_completionCallback));
+        }
+    }
 
-        optionalArgs.m_completionCallback = [service_handle, header, ticketName](auto id, auto view)
+    AzFramework::EntitySpawnTicket ROS2SpawnerComponent::AcquireTicket(
+        const AZStd::string& spawnableName, const AZ::Data::Asset<AzFramework::Spawnable>& asset)
+    {
+        if (auto pool = m_ticketPool.find(spawnableName); pool != m_ticketPool.end() && !pool->second.empty())
         {
-            SpawnEntityResponse response;
-            response.success = true;
-            response.status_message = ticketName.c_str();
-            service_handle->send_response(*header, response);
-        };
-
-        spawner->SpawnAllEntities(m_tickets.at(ticketName), optionalArgs);
+            auto ticket = AZStd::move(pool->second.back());
+            pool->second.pop_back();
+            return ticket;
+        }
+        return AzFramework::EntitySpawnTicket(asset);
     }
 
     void ROS2SpawnerComponent::PreSpawn(
@@ -207,6 +308,7 @@ namespace ROS2
         AzFramework::SpawnableEntityContainerView view,
         const AZ::Transform& transform,
         const AZStd::string& spawnableName,
+        const AZStd::string& instanceName,
         const AZStd::string& spawnableNamespace)
     {
         if (view.empty())
@@ -218,13 +320,14 @@ namespace ROS2
         auto* transformInterface = root->FindComponent<AzFramework::TransformComponent>();
         transformInterface->SetWorldTM(transform);
 
-        AZStd::string instanceName = AZStd::string::format("%s_%d", spawnableName.c_str(), m_counter++);
+        const AZStd::string entityName =
+            instanceName.empty() ? AZStd::string::format("%s_%d", spawnableName.c_str(), m_counter++) : instanceName;
         for (AZ::Entity* entity : view)
         { // Update name for the first entity with ROS2Frame in hierarchy (left to right)
             auto* frameComponent = Utils::GetGameOrEditorComponent<ROS2FrameComponent>(entity);
             if (frameComponent)
             {
-                entity->SetName(instanceName);
+                entity->SetName(entityName);
                 if (!spawnableNamespace.empty())
                 {
                     frameComponent->UpdateNamespaceConfiguration(spawnableNamespace, NamespaceConfiguration::NamespaceStrategy::Custom);
@@ -237,28 +340,69 @@ namespace ROS2
     void ROS2SpawnerComponent::DeleteEntity(
         const DeleteEntityServiceHandle service_handle, const std::shared_ptr<rmw_request_id_t> header, DeleteEntityRequest request)
     {
-        auto deleteName = AZStd::string(request->name.c_str());
-        if (!m_tickets.contains(deleteName))
+        DespawnSingleEntity(
+            AZStd::string(request->name.c_str()),
+            [service_handle, header](const SpawnEntityResult& result)
+            {
+                DeleteEntityResponse response;
+                response.success = result.success;
+                response.status_message = result.statusMessage.c_str();
+                service_handle->send_response(*header, response);
+            });
+    }
+
+    void ROS2SpawnerComponent::DespawnEntities(const AZStd::vector<AZStd::string>& ticketNames, SpawnBatchCompletionCallback completionCallback)
+    {
+        if (ticketNames.empty())
         {
-            DeleteEntityResponse response;
-            response.success = false;
-            response.status_message = "Could not find entity with given name: " + request->name;
-            service_handle->send_response(*header, response);
+            if (completionCallback)
+            {
+                completionCallback({});
+            }
+            return;
+        }
+
+        auto batch = AZStd::make_shared<SpawnBatchState>(ticketNames.size(), AZStd::move(completionCallback));
+        for (size_t index = 0; index < ticketNames.size(); ++index)
+        {
+            DespawnSingleEntity(
+                ticketNames[index],
+                [batch, index](const SpawnEntityResult& result)
+                {
+                    batch->SetResult(index, result);
+                });
+        }
+    }
+
+    void ROS2SpawnerComponent::DespawnSingleEntity(const AZStd::string& ticketName, SpawnCompletionCallback completionCallback)
+    {
+        auto instance = m_tickets.find(ticketName);
+        if (instance == m_tickets.end())
+        {
+            SpawnEntityResult result;
+            result.ticketName = ticketName;
+            result.statusMessage = "Could not find entity with given name: " + ticketName;
+            completionCallback(result);
             return;
         }
         auto spawner = AZ::Interface<AzFramework::SpawnableEntitiesDefinition>::Get();
 
         AzFramework::DespawnAllEntitiesOptionalArgs optionalArgs;
 
-        optionalArgs.m_completionCallback = [service_handle, header](auto id)
+        optionalArgs.m_completionCallback = [completionCallback, ticketName](auto id)
         {
-            DeleteEntityResponse response;
-            response.success = true;
-            service_handle->send_response(*header, response);
+            SpawnEntityResult result;
+            result.success = true;
+            result.ticketName = ticketName;
+            completionCallback(result);
         };
 
-        spawner->DespawnAllEntities(m_tickets.at(deleteName), optionalArgs);
-        m_tickets.erase(deleteName);
+        spawner->DespawnAllEntities(instance->second.m_ticket, optionalArgs);
+
+        // Commands issued on a ticket are executed in order, so the ticket can be handed out again right away: the next spawn on it
+        // runs after the despawn above is complete.
+        m_ticketPool[instance->second.m_spawnableName].emplace_back(AZStd::move(instance->second.m_ticket));
+        m_tickets.erase(instance);
     }
 
     void ROS2SpawnerComponent::GetSpawnPointsNames(
@@ -13,9 +13,12 @@
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzFramework/Components/ComponentAdapter.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
+#include <ROS2/Spawner/SpawnerBus.h>
+#include <ROS2/Spawner/SpawnerInfo.h>
 #include <gazebo_msgs/srv/delete_entity.hpp>
 #include <gazebo_msgs/srv/get_model_state.hpp>
 #include <gazebo_msgs/srv/get_world_properties.hpp>
@@ -40,7 +43,11 @@ namespace ROS2
     using ROS2SpawnerComponentBase = AzFramework::Components::ComponentAdapter<ROS2SpawnerComponentController, ROS2SpawnerComponentConfig>;
     //! Manages robots spawning.
     //! Allows user to set spawnable prefabs in the Editor and spawn them using ROS2 service during the simulation.
-    class ROS2SpawnerComponent : public ROS2SpawnerComponentBase
+    //! Spawnables are preloaded on activation and spawn tickets of deleted instances are pooled and reused.
+    class ROS2SpawnerComponent
+        : public ROS2SpawnerComponentBase
+        , public SpawnerBatchRequestsBus::Handler
+        , public AZ::Data::AssetBus::MultiHandler
     {
     public:
         AZ_COMPONENT(ROS2SpawnerComponent, "{8ea91880-0067-11ee-be56-0242ac120002}", AZ::Component);
@@ -56,9 +63,52 @@ namespace ROS2
         //////////////////////////////////////////////////////////////////////////
         static void Reflect(AZ::ReflectContext* context);
 
+        //////////////////////////////////////////////////////////////////////////
+        // SpawnerBatchRequestsBus::Handler overrides
+        void SpawnEntities(const AZStd::vector<SpawnEntityInfo>& entries, SpawnBatchCompletionCallback completionCallback) override;
+        void DespawnEntities(const AZStd::vector<AZStd::string>& ticketNames, SpawnBatchCompletionCallback completionCallback) override;
+        //////////////////////////////////////////////////////////////////////////
+
     private:
+        //////////////////////////////////////////////////////////////////////////
+        // AZ::Data::AssetBus::MultiHandler overrides
+        void OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+        void OnAssetError(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+        //////////////////////////////////////////////////////////////////////////
+
+        //! Ticket of a spawned instance together with the name of the spawnable it was created for.
+        struct SpawnedInstance
+        {
+            AZStd::string m_spawnableName;
+            AzFramework::EntitySpawnTicket m_ticket;
+        };
+
+        using SpawnCompletionCallback = AZStd::function<void(const SpawnEntityResult&)>;
+
+        //! Spawn request waiting for its spawnable to finish loading.
+        struct PendingSpawn
+        {
+            SpawnEntityInfo m_entry;
+            SpawnCompletionCallback m_completionCallback;
+        };
+
+        //! Spawn a single instance and call the completionCallback once done. Rejected requests call it immediately.
+        void SpawnSingleEntity(const SpawnEntityInfo& entry, SpawnCompletionCallback completionCallback);
+        //! Despawn a single instance and return its ticket to the pool. Rejected requests call the completionCallback immediately.
+        void DespawnSingleEntity(const AZStd::string& ticketName, SpawnCompletionCallback completionCallback);
+        //! Take a released ticket for the spawnable from the pool or create a new one.
+        AzFramework::EntitySpawnTicket AcquireTicket(const AZStd::string& spawnableName, const AZ::Data::Asset<AzFramework::Spawnable>& asset);
+        //! Process the spawns which were waiting for the spawnable asset to finish loading.
+        void ResumePendingSpawns(const AZ::Data::AssetId& assetId);
+
         int m_counter = 1;
-        AZStd::unordered_map<AZStd::string, AzFramework::EntitySpawnTicket> m_tickets;
+        //! Incremented with every spawn, makes names of instances spawned on a reused ticket unique.
+        AZ::u64 m_spawnGeneration = 0;
+        AZStd::unordered_map<AZ::Data::AssetId, AZStd::vector<PendingSpawn>> m_pendingSpawns;
+        AZStd::unordered_map<AZStd::string, SpawnedInstance> m_tickets;
+        AZStd::unordered_map<AZStd::string, AZStd::vector<AzFramework::EntitySpawnTicket>> m_ticketPool;
+        //! Spawnables with loading queued on activation; holding them keeps the assets loaded while the component is active.
+        AZStd::unordered_map<AZStd::string, AZ::Data::Asset<AzFramework::Spawnable>> m_spawnables;
 
         rclcpp::Service<gazebo_msgs::srv::GetWorldProperties>::SharedPtr m_getSpawnablesNamesService;
         rclcpp::Service<gazebo_msgs::srv::GetWorldProperties>::SharedPtr m_getSpawnPointsNamesService;
@@ -77,6 +127,7 @@ namespace ROS2
             AzFramework::SpawnableEntityContainerView,
             const AZ::Transform&,
             const AZStd::string& spawnableName,
+            const AZStd::string& instanceName,
             const AZStd::string& spawnableNamespace);
 
         void DeleteEntity(
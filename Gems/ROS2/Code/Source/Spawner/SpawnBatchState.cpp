@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "SpawnBatchState.h"
+
+namespace ROS2
+{
+    SpawnBatchState::SpawnBatchState(size_t size, SpawnBatchCompletionCallback completionCallback)
+        : m_remaining(size)
+        , m_completionCallback(AZStd::move(completionCallback))
+    {
+        m_results.resize(size);
+    }
+
+    void SpawnBatchState::SetResult(size_t index, const SpawnEntityResult& result)
+    {
+        AZ_Assert(index < m_results.size(), "Result index %zu is out of the batch of %zu entries", index, m_results.size());
+        m_results[index] = result;
+        if (--m_remaining == 0 && m_completionCallback)
+        {
+            m_completionCallback(m_results);
+        }
+    }
+
+    AZStd::string MakeSpawnTicketName(const AZStd::string& spawnableName, AZ::u32 ticketId, AZ::u64 generation)
+    {
+        return AZStd::string::format("%s_%u_%llu", spawnableName.c_str(), ticketId, static_cast<unsigned long long>(generation));
+    }
+} // namespace ROS2
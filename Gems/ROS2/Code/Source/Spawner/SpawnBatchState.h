@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/string/string.h>
+#include <ROS2/Spawner/SpawnerInfo.h>
+
+namespace ROS2
+{
+    //! Collects results of a batch spawn or despawn request and reports them once, when the last entry completes.
+    class SpawnBatchState
+    {
+    public:
+        SpawnBatchState(size_t size, SpawnBatchCompletionCallback completionCallback);
+
+        //! Store the result of an entry of the batch.
+        //! The completion callback is called with all results once every entry has a result.
+        void SetResult(size_t index, const SpawnEntityResult& result);
+
+    private:
+        SpawnEntityResults m_results;
+        size_t m_remaining;
+        SpawnBatchCompletionCallback m_completionCallback;
+    };
+
+    //! Create the name which identifies a spawned instance.
+    //! Spawn tickets are pooled and their ids are reused, so the name includes the generation of the spawn as well.
+    //! A name of a deleted instance therefore never matches an instance spawned later on the same ticket.
+    //! @param spawnableName name of the spawnable as registered in the spawner.
+    //! @param ticketId id of the spawn ticket used for the instance.
+    //! @param generation number of the spawn, unique within a spawner.
+    //! @return name of the spawned instance.
+    AZStd::string MakeSpawnTicketName(const AZStd::string& spawnableName, AZ::u32 ticketId, AZ::u64 generation);
+} // namespace ROS2
@@ -10,6 +10,7 @@
 #include <AzTest/AzTest.h>
 
 #include <Georeference/GNSSFormatConversions.h>
+#include <Georeference/GeoreferenceLevelComponent.h>
 
 namespace UnitTest
 {
@@ -96,4 +97,116 @@ namespace UnitTest
             EXPECT_NEAR(result.m_altitude, goldResult.m_altitude, OneMillimiter);
         }
     }
+
+    // Batches longer than a processing block, with a partially filled last block, are converted with the reference coordinates
+    // used in the single point tests above.
+    constexpr size_t BatchTestSize = 19;
+
+    TEST_F(GNSSTest, BatchWGS84ToECEFAndBack)
+    {
+        using namespace ROS2::WGS;
+        using namespace ROS2::Utils::GeodeticConversions;
+        const AZStd::vector<AZStd::pair<WGS84Coordinate, Vector3d>> inputGoldSet = {
+            { { 10.0, 20.0, 300.0 }, { 5903307.167667380, 2148628.092761247, 1100300.642188661 } },
+            { { -70.0, 170.0, 500.0 }, { -2154856.524084172, 379959.3447517005, -5971509.853428957 } },
+            { { 50.0, -120.0, -100.0 }, { -2053899.906222906, -3557458.991239029, 4862712.433262121 } },
+        };
+        AZStd::vector<WGS84Coordinate> points;
+        for (size_t i = 0; i < BatchTestSize; ++i)
+        {
+            points.push_back(inputGoldSet[i % inputGoldSet.size()].first);
+        }
+
+        AZStd::vector<Vector3d> ecef(points.size());
+        AZStd::vector<WGS84Coordinate> wgs84(points.size());
+        WGS84ToECEF(points, ecef);
+        ECEFToWGS84(ecef, wgs84);
+
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            const auto& [goldWGS84, goldECEF] = inputGoldSet[i % inputGoldSet.size()];
+            EXPECT_NEAR(ecef[i].m_x, goldECEF.m_x, OneMillimiter);
+            EXPECT_NEAR(ecef[i].m_y, goldECEF.m_y, OneMillimiter);
+            EXPECT_NEAR(ecef[i].m_z, goldECEF.m_z, OneMillimiter);
+            EXPECT_NEAR(wgs84[i].m_latitude, goldWGS84.m_latitude, OneMillimeterInDegreesOnEquator);
+            EXPECT_NEAR(wgs84[i].m_longitude, goldWGS84.m_longitude, OneMillimeterInDegreesOnEquator);
+            EXPECT_NEAR(wgs84[i].m_altitude, goldWGS84.m_altitude, OneMillimiter);
+        }
+    }
+
+    TEST_F(GNSSTest, BatchECEFToENUAndBack)
+    {
+        using namespace ROS2::WGS;
+        using namespace ROS2::Utils::GeodeticConversions;
+        const AZStd::vector<AZStd::tuple<Vector3d, WGS84Coordinate, Vector3d>> inputGoldSet = {
+            { { -2053900.0, -3557459.0, 4862712.0 }, { 50.0, -120.0, -100.0 }, { -0.076833, -0.3202, -0.2969 } },
+            { { 5903307.167667380, 2148628.092761247, 1100300.642188661 },
+              { 11.0, 21.0, 400.0 },
+              { -109638.9539891188, -110428.2398398574, -2004.501240225796 } },
+            { { -2154856.524084172, 379959.3447517005, -5971509.853428957 },
+              { -72.0, 169.0, 1000.0 },
+              { 38187.58712786288, 222803.8182465429, -4497.428919329745 } },
+        };
+        for (const auto& [goldECEF, refWGS84, goldENU] : inputGoldSet)
+        {
+            const auto referenceFrame = ComputeENUReferenceFrame(refWGS84);
+            const AZStd::vector<Vector3d> ecefPoints(BatchTestSize, goldECEF);
+            AZStd::vector<Vector3d> enu(BatchTestSize);
+            AZStd::vector<Vector3d> ecef(BatchTestSize);
+            ECEFToENU(referenceFrame, ecefPoints, enu);
+            ENUToECEF(referenceFrame, enu, ecef);
+
+            for (size_t i = 0; i < BatchTestSize; ++i)
+            {
+                EXPECT_NEAR(enu[i].m_x, goldENU.m_x, OneMillimiter);
+                EXPECT_NEAR(enu[i].m_y, goldENU.m_y, OneMillimiter);
+                EXPECT_NEAR(enu[i].m_z, goldENU.m_z, OneMillimiter);
+                EXPECT_NEAR(ecef[i].m_x, goldECEF.m_x, OneMillimiter);
+                EXPECT_NEAR(ecef[i].m_y, goldECEF.m_y, OneMillimiter);
+                EXPECT_NEAR(ecef[i].m_z, goldECEF.m_z, OneMillimiter);
+            }
+        }
+    }
+
+    TEST_F(GNSSTest, LevelBatchConversionsMatchSinglePointConversions)
+    {
+        using namespace ROS2::WGS;
+        ROS2::GeoReferenceLevelConfig config;
+        config.m_originLocation = { 50.0, -120.0, -100.0 };
+        ROS2::GeoReferenceLevelController controller(config);
+        controller.Activate(AZ::EntityId());
+
+        // More points than a single conversion block, with a partially filled last block
+        constexpr size_t PointCount = 150;
+        AZStd::vector<AZ::Vector3> levelPoints;
+        for (size_t i = 0; i < PointCount; ++i)
+        {
+            const float offset = static_cast<float>(i);
+            levelPoints.emplace_back(offset * 13.0f - 900.0f, 700.0f - offset * 7.0f, offset * 0.5f);
+        }
+
+        AZStd::vector<WGS84Coordinate> batchWGS84(PointCount);
+        ROS2::GeoreferenceRequestsBus::Broadcast(
+            &ROS2::GeoreferenceRequests::ConvertPointsFromLevelToWSG84,
+            AZStd::span<const AZ::Vector3>(levelPoints),
+            AZStd::span<WGS84Coordinate>(batchWGS84));
+        AZStd::vector<AZ::Vector3> batchLevel(PointCount);
+        ROS2::GeoreferenceRequestsBus::Broadcast(
+            &ROS2::GeoreferenceRequests::ConvertPointsFromWSG84ToLevel,
+            AZStd::span<const WGS84Coordinate>(batchWGS84),
+            AZStd::span<AZ::Vector3>(batchLevel));
+
+        for (size_t i = 0; i < PointCount; ++i)
+        {
+            WGS84Coordinate singleWGS84;
+            ROS2::GeoreferenceRequestsBus::BroadcastResult(
+                singleWGS84, &ROS2::GeoreferenceRequests::ConvertFromLevelToWSG84, levelPoints[i]);
+            EXPECT_NEAR(batchWGS84[i].m_latitude, singleWGS84.m_latitude, OneMillimeterInDegreesOnEquator);
+            EXPECT_NEAR(batchWGS84[i].m_longitude, singleWGS84.m_longitude, OneMillimeterInDegreesOnEquator);
+            EXPECT_NEAR(batchWGS84[i].m_altitude, singleWGS84.m_altitude, OneMillimiter);
+            EXPECT_TRUE(batchLevel[i].IsClose(levelPoints[i], 0.01f));
+        }
+
+        controller.Deactivate();
+    }
 } // namespace UnitTest
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzTest/AzTest.h>
+
+#include <ROS2/RobotControl/LatestValueMailbox.h>
+
+namespace UnitTest
+{
+    class LatestValueMailboxTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(LatestValueMailboxTest, ReadWithoutWriteReturnsNothing)
+    {
+        ROS2::LatestValueMailbox<int> mailbox;
+        int value = -1;
+        EXPECT_FALSE(mailbox.Read(value));
+        EXPECT_EQ(-1, value);
+    }
+
+    TEST_F(LatestValueMailboxTest, ValueIsReadOnce)
+    {
+        ROS2::LatestValueMailbox<int> mailbox;
+        EXPECT_FALSE(mailbox.Write(7));
+
+        int value = 0;
+        EXPECT_TRUE(mailbox.Read(value));
+        EXPECT_EQ(7, value);
+        EXPECT_FALSE(mailbox.Read(value));
+    }
+
+    TEST_F(LatestValueMailboxTest, UnreadValuesAreCoalescedToLatest)
+    {
+        ROS2::LatestValueMailbox<int> mailbox;
+        EXPECT_FALSE(mailbox.Write(1));
+        EXPECT_TRUE(mailbox.Write(2));
+        EXPECT_TRUE(mailbox.Write(3));
+
+        int value = 0;
+        EXPECT_TRUE(mailbox.Read(value));
+        EXPECT_EQ(3, value);
+
+        // A value written after a read is not reported as coalesced.
+        EXPECT_FALSE(mailbox.Write(4));
+        EXPECT_TRUE(mailbox.Read(value));
+        EXPECT_EQ(4, value);
+    }
+
+    TEST_F(LatestValueMailboxTest, ConcurrentReaderSeesIncreasingValuesEndingWithLast)
+    {
+        constexpr int WriteCount = 100000;
+        ROS2::LatestValueMailbox<int> mailbox;
+
+        AZStd::thread writer(
+            [&mailbox]()
+            {
+                for (int i = 1; i <= WriteCount; ++i)
+                {
+                    mailbox.Write(i);
+                }
+            });
+
+        int lastRead = 0;
+        bool increasing = true;
+        while (lastRead != WriteCount)
+        {
+            int value = 0;
+            if (mailbox.Read(value))
+            {
+                increasing = increasing && value > lastRead;
+                lastRead = value;
+            }
+        }
+        writer.join();
+
+        EXPECT_TRUE(increasing);
+        EXPECT_EQ(WriteCount, lastRead);
+    }
+} // namespace UnitTest
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <ROS2/RobotImporter/RobotImporterBus.h>
+#include <RobotImporter/ROS2RobotImporterEditorSystemComponent.h>
+#include <RobotImporter/ROS2RobotImporterSystemComponent.h>
+#include <RobotImporter/RobotBatchImporter.h>
+
+namespace UnitTest
+{
+    class RobotBatchImporterTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            // Manifests and reports are read and written with the JSON serializer, which requires the importer reflection.
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadSettingsRegistry = false;
+            m_application = AZStd::make_unique<AZ::ComponentApplication>();
+            m_application->Create(AZ::ComponentApplication::Descriptor(), startupParameters);
+
+            m_importerDescriptor.reset(ROS2::ROS2RobotImporterSystemComponent::CreateDescriptor());
+            m_editorImporterDescriptor.reset(ROS2::ROS2RobotImporterEditorSystemComponent::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(m_importerDescriptor.get());
+            m_application->RegisterComponentDescriptor(m_editorImporterDescriptor.get());
+        }
+
+        void TearDown() override
+        {
+            m_application->UnregisterComponentDescriptor(m_editorImporterDescriptor.get());
+            m_application->UnregisterComponentDescriptor(m_importerDescriptor.get());
+            m_editorImporterDescriptor.reset();
+            m_importerDescriptor.reset();
+            m_application->Destroy();
+            m_application.reset();
+
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZ::IO::Path CreateFile(AZ::IO::PathView filename, AZStd::string_view contents)
+        {
+            auto path = AZ::Test::CreateTestFile(m_tempDirectory, filename, contents);
+            EXPECT_TRUE(path.has_value());
+            return path.has_value() ? AZ::IO::Path(path->Native()) : AZ::IO::Path();
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZStd::unique_ptr<AZ::ComponentApplication> m_application;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_importerDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_editorImporterDescriptor;
+    };
+
+    TEST_F(RobotBatchImporterTest, LoadManifest_ReadsEntriesAndDefaults)
+    {
+        const AZ::IO::Path manifestPath = CreateFile(
+            "manifest.json",
+            R"({
+                "Robots": [
+                    {
+                        "FilePath": "robots/arm.urdf.xacro",
+                        "PrefabName": "left_arm",
+                        "ImportAssets": false,
+                        "UseArticulations": false,
+                        "XacroArguments": { "side": "left", "gripper": "true" }
+                    },
+                    {
+                        "FilePath": "robots/rover.sdf"
+                    }
+                ]
+            })");
+
+        const auto manifestOutcome = ROS2::RobotBatchImporter::LoadManifest(manifestPath);
+        ASSERT_TRUE(manifestOutcome.IsSuccess()) << manifestOutcome.GetError().c_str();
+        const ROS2::RobotImportManifest& manifest = manifestOutcome.GetValue();
+        ASSERT_EQ(2, manifest.m_robots.size());
+
+        const ROS2::RobotImportManifestEntry& arm = manifest.m_robots[0];
+        EXPECT_EQ("robots/arm.urdf.xacro", arm.m_filePath);
+        EXPECT_EQ("left_arm", arm.m_prefabName);
+        EXPECT_FALSE(arm.m_importAssets);
+        EXPECT_FALSE(arm.m_useArticulations);
+        ASSERT_EQ(2, arm.m_xacroArguments.size());
+        EXPECT_EQ("left", arm.m_xacroArguments.at("side"));
+        EXPECT_EQ("true", arm.m_xacroArguments.at("gripper"));
+
+        // Omitted options keep the defaults of an interactive import.
+        const ROS2::RobotImportManifestEntry& rover = manifest.m_robots[1];
+        EXPECT_EQ("robots/rover.sdf", rover.m_filePath);
+        EXPECT_TRUE(rover.m_prefabName.empty());
+        EXPECT_TRUE(rover.m_importAssets);
+        EXPECT_TRUE(rover.m_useArticulations);
+        EXPECT_TRUE(rover.m_xacroArguments.empty());
+    }
+
+    TEST_F(RobotBatchImporterTest, LoadManifest_MissingOrMalformedFile_ReturnsError)
+    {
+        EXPECT_FALSE(ROS2::RobotBatchImporter::LoadManifest(AZ::IO::Path(m_tempDirectory.Resolve("missing.json").c_str())).IsSuccess());
+
+        const AZ::IO::Path manifestPath = CreateFile("manifest.json", R"({ "Robots": [ { "FilePath": )");
+        EXPECT_FALSE(ROS2::RobotBatchImporter::LoadManifest(manifestPath).IsSuccess());
+    }
+
+    TEST_F(RobotBatchImporterTest, GeneratePrefabsFromManifest_RobotsFailToParse_ReportsEveryRobot)
+    {
+        AZ::Entity systemEntity;
+        systemEntity.CreateComponent<ROS2::ROS2RobotImporterEditorSystemComponent>();
+        systemEntity.Init();
+        systemEntity.Activate();
+
+        CreateFile("robots/broken.urdf", R"(<?xml version="1.0"?><robot name="broken"><link name="base_link"></robot>)");
+        const AZ::IO::Path manifestPath = CreateFile(
+            "manifest.json",
+            R"({
+                "Robots": [
+                    { "FilePath": "robots/missing.urdf", "ImportAssets": false },
+                    { "FilePath": "robots/broken.urdf", "ImportAssets": false }
+                ]
+            })");
+        const AZ::IO::Path reportPath(m_tempDirectory.Resolve("report.json").c_str());
+
+        bool succeeded = true;
+        ROS2::RobotImporterRequestBus::BroadcastResult(
+            succeeded, &ROS2::RobotImporterRequestBus::Events::GeneratePrefabsFromManifest, manifestPath.Native(), reportPath.Native());
+        EXPECT_FALSE(succeeded);
+
+        // A failure of one robot does not stop the others, the report keeps the order of the manifest.
+        ROS2::RobotImportReport report;
+        ASSERT_TRUE(AZ::JsonSerializationUtils::LoadObjectFromFile(report, reportPath.Native()).IsSuccess());
+        EXPECT_EQ(0, report.m_succeededCount);
+        EXPECT_EQ(2, report.m_failedCount);
+        ASSERT_EQ(2, report.m_robots.size());
+        EXPECT_EQ(AZ::IO::Path(m_tempDirectory.Resolve("robots/missing.urdf").c_str()).LexicallyNormal().Native(), report.m_robots[0].m_filePath);
+        EXPECT_EQ(AZ::IO::Path(m_tempDirectory.Resolve("robots/broken.urdf").c_str()).LexicallyNormal().Native(), report.m_robots[1].m_filePath);
+        for (const ROS2::RobotImportReportEntry& reportEntry : report.m_robots)
+        {
+            EXPECT_FALSE(reportEntry.m_succeeded);
+            EXPECT_EQ("Parse", reportEntry.m_failedStage);
+            EXPECT_FALSE(reportEntry.m_error.empty());
+            EXPECT_TRUE(reportEntry.m_prefabPath.empty());
+        }
+
+        // Without a readable manifest nothing is imported and no report is written.
+        succeeded = true;
+        ROS2::RobotImporterRequestBus::BroadcastResult(
+            succeeded, &ROS2::RobotImporterRequestBus::Events::GeneratePrefabsFromManifest, AZStd::string_view{}, AZStd::string_view{});
+        EXPECT_FALSE(succeeded);
+
+        systemEntity.Deactivate();
+    }
+} // namespace UnitTest
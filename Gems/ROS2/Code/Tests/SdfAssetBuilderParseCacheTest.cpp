@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <RobotImporter/URDF/UrdfParser.h>
+#include <SdfAssetBuilder/SdfAssetBuilderParseCache.h>
+
+namespace UnitTest
+{
+    class SdfAssetBuilderParseCacheTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            // The cache files are written with the JSON serializer, which requires the reflected cache entry.
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadSettingsRegistry = false;
+            m_application = AZStd::make_unique<AZ::ComponentApplication>();
+            m_application->Create(AZ::ComponentApplication::Descriptor(), startupParameters);
+            ROS2::SdfAssetBuilderParseCache::Reflect(m_application->GetSerializeContext());
+
+            m_cacheDirectory = m_tempDirectory.Resolve("Cache").Native();
+            m_sourcePath = CreateFile("robot.sdf", GetSdf());
+            m_meshPath = CreateFile("meshes/base.dae", "<COLLADA>base</COLLADA>");
+            m_sourceAssetPath = CreateFile("Assets/meshes/base.dae", "<COLLADA>base</COLLADA>");
+        }
+
+        void TearDown() override
+        {
+            AZ::SerializeContext* serializeContext = m_application->GetSerializeContext();
+            serializeContext->EnableRemoveReflection();
+            ROS2::SdfAssetBuilderParseCache::Reflect(serializeContext);
+            serializeContext->DisableRemoveReflection();
+            m_application->Destroy();
+            m_application.reset();
+
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZ::IO::Path CreateFile(AZ::IO::PathView filename, AZStd::string_view contents)
+        {
+            auto path = AZ::Test::CreateTestFile(m_tempDirectory, filename, contents);
+            EXPECT_TRUE(path.has_value());
+            return path.has_value() ? AZ::IO::Path(path->Native()) : AZ::IO::Path();
+        }
+
+        static std::string GetSdf()
+        {
+            return R"(<?xml version="1.0"?>
+                      <sdf version="1.6">
+                        <model name="test_robot">
+                          <link name="base_link">
+                            <visual name="base_visual">
+                              <geometry>
+                                <mesh>
+                                  <uri>meshes/base.dae</uri>
+                                </mesh>
+                              </geometry>
+                            </visual>
+                          </link>
+                        </model>
+                      </sdf>)";
+        }
+
+        //! The asset map FindAssets would have produced for the mesh of the test model.
+        ROS2::Utils::UrdfAssetMap GetAssetMap() const
+        {
+            ROS2::Utils::UrdfAsset asset;
+            asset.m_urdfPath = "meshes/base.dae";
+            asset.m_resolvedUrdfPath = m_meshPath;
+            asset.m_urdfFileCRC = ROS2::Utils::GetFileCRC(m_meshPath);
+            asset.m_assetReferenceType = ROS2::Utils::ReferencedAssetType::VisualMesh;
+            asset.m_availableAssetInfo.m_sourceAssetRelativePath = "meshes/base.dae";
+            asset.m_availableAssetInfo.m_sourceAssetGlobalPath = m_sourceAssetPath;
+            asset.m_availableAssetInfo.m_sourceGuid = AZ::Uuid::CreateName("meshes/base.dae");
+
+            ROS2::Utils::UrdfAssetMap assetMap;
+            assetMap.emplace(asset.m_urdfPath, AZStd::move(asset));
+            return assetMap;
+        }
+
+        bool StoreParseResult(const ROS2::SdfAssetBuilderParseCache& cache, AZStd::string_view fingerprint)
+        {
+            const auto sdfRootOutcome = ROS2::UrdfParser::Parse(GetSdf(), {});
+            EXPECT_TRUE(sdfRootOutcome);
+            return sdfRootOutcome && cache.Store(m_sourcePath, fingerprint, sdfRootOutcome.GetRoot(), GetAssetMap());
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZStd::unique_ptr<AZ::ComponentApplication> m_application;
+        AZ::IO::Path m_cacheDirectory;
+        AZ::IO::Path m_sourcePath;
+        AZ::IO::Path m_meshPath;
+        AZ::IO::Path m_sourceAssetPath;
+    };
+
+    TEST_F(SdfAssetBuilderParseCacheTest, StoreAndLoad_ReturnsStoredResult)
+    {
+        const ROS2::SdfAssetBuilderParseCache cache(m_cacheDirectory);
+        ASSERT_TRUE(StoreParseResult(cache, "settings"));
+
+        const auto cachedResult = cache.Load(m_sourcePath, "settings");
+        ASSERT_TRUE(cachedResult.has_value());
+        EXPECT_NE(std::string::npos, cachedResult->m_sdfContent.find("test_robot"));
+
+        ASSERT_EQ(1, cachedResult->m_assetMap.size());
+        const auto assetIt = cachedResult->m_assetMap.find(AZ::IO::Path("meshes/base.dae"));
+        ASSERT_NE(cachedResult->m_assetMap.end(), assetIt);
+        EXPECT_EQ(m_meshPath, assetIt->second.m_resolvedUrdfPath);
+        EXPECT_EQ(ROS2::Utils::GetFileCRC(m_meshPath), assetIt->second.m_urdfFileCRC);
+        EXPECT_EQ(ROS2::Utils::ReferencedAssetType::VisualMesh, assetIt->second.m_assetReferenceType);
+        EXPECT_EQ(m_sourceAssetPath, assetIt->second.m_availableAssetInfo.m_sourceAssetGlobalPath);
+        EXPECT_EQ(AZ::Uuid::CreateName("meshes/base.dae"), assetIt->second.m_availableAssetInfo.m_sourceGuid);
+    }
+
+    TEST_F(SdfAssetBuilderParseCacheTest, Store_LeavesNoTemporaryFiles)
+    {
+        const ROS2::SdfAssetBuilderParseCache cache(m_cacheDirectory);
+        ASSERT_TRUE(StoreParseResult(cache, "settings"));
+        ASSERT_TRUE(StoreParseResult(cache, "settings"));
+
+        // The second store replaces the cache file of the first one through a rename.
+        int fileCount = 0;
+        AZ::IO::SystemFile::FindFiles(
+            (m_cacheDirectory / "*").c_str(),
+            [&fileCount](const char* fileName, bool isFile)
+            {
+                if (isFile)
+                {
+                    ++fileCount;
+                    EXPECT_TRUE(AZ::IO::PathView(fileName).Extension() == ".json") << fileName;
+                }
+                return true;
+            });
+        EXPECT_EQ(1, fileCount);
+    }
+
+    TEST_F(SdfAssetBuilderParseCacheTest, Load_SourceOrFingerprintChanged_ReturnsNothing)
+    {
+        const ROS2::SdfAssetBuilderParseCache cache(m_cacheDirectory);
+        ASSERT_TRUE(StoreParseResult(cache, "settings"));
+        EXPECT_FALSE(cache.Load(m_sourcePath, "other settings").has_value());
+
+        CreateFile("robot.sdf", GetSdf() + "\n<!-- edited -->");
+        EXPECT_FALSE(cache.Load(m_sourcePath, "settings").has_value());
+    }
+
+    TEST_F(SdfAssetBuilderParseCacheTest, Load_ReferencedFileChanged_ReturnsNothing)
+    {
+        const ROS2::SdfAssetBuilderParseCache cache(m_cacheDirectory);
+
+        // A changed resolved mesh no longer matches the source asset it was matched with.
+        ASSERT_TRUE(StoreParseResult(cache, "settings"));
+        CreateFile("meshes/base.dae", "<COLLADA>modified</COLLADA>");
+        EXPECT_FALSE(cache.Load(m_sourcePath, "settings").has_value());
+
+        // The same holds for a changed source asset, even though it still exists.
+        CreateFile("meshes/base.dae", "<COLLADA>base</COLLADA>");
+        ASSERT_TRUE(StoreParseResult(cache, "settings"));
+        ASSERT_TRUE(cache.Load(m_sourcePath, "settings").has_value());
+        CreateFile("Assets/meshes/base.dae", "<COLLADA>base with a different tail</COLLADA>");
+        EXPECT_FALSE(cache.Load(m_sourcePath, "settings").has_value());
+
+        // And for a deleted source asset.
+        CreateFile("Assets/meshes/base.dae", "<COLLADA>base</COLLADA>");
+        ASSERT_TRUE(StoreParseResult(cache, "settings"));
+        ASSERT_TRUE(AZ::IO::SystemFile::Delete(m_sourceAssetPath.c_str()));
+        EXPECT_FALSE(cache.Load(m_sourcePath, "settings").has_value());
+    }
+
+    TEST_F(SdfAssetBuilderParseCacheTest, EmptyCacheDirectory_CachingDisabled)
+    {
+        const ROS2::SdfAssetBuilderParseCache cache;
+        EXPECT_FALSE(StoreParseResult(cache, "settings"));
+        EXPECT_FALSE(cache.Load(m_sourcePath, "settings").has_value());
+    }
+} // namespace UnitTest
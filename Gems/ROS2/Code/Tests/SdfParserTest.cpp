@@ -6,11 +6,19 @@
  *
  */
 
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/Entity.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzTest/AzTest.h>
 #include <AzTest/Utils.h>
+#include <AzToolsFramework/ToolsComponents/GenericComponentWrapper.h>
+#include <GNSS/ROS2GNSSSensorComponent.h>
+#include <ROS2/Frame/ROS2FrameComponent.h>
+#include <ROS2/ROS2GemUtilities.h>
 #include <RobotImporter/SDFormat/ROS2SensorHooks.h>
+#include <RobotImporter/SDFormat/ROS2SensorHooksUtils.h>
 #include <RobotImporter/Utils/ErrorUtils.h>
 #include <RobotImporter/Utils/RobotImporterUtils.h>
 #include <RobotImporter/URDF/UrdfParser.h>
@@ -195,6 +203,55 @@ namespace UnitTest
           </sdf>)";
         }
 
+        static std::string GetSdfWorldWithNestedModelsAndJoints()
+        {
+            return R"(<?xml version="1.0"?>
+            <sdf version="1.10">
+            <world name="default">
+              <model name="robot">
+                <link name="base"/>
+                <model name="arm">
+                  <link name="upper"/>
+                  <link name="lower"/>
+                  <joint name="elbow" type="revolute">
+                    <parent>upper</parent>
+                    <child>lower</child>
+                    <axis>
+                      <xyz>0 0 1</xyz>
+                    </axis>
+                  </joint>
+                </model>
+                <joint name="shoulder" type="fixed">
+                  <parent>base</parent>
+                  <child>arm::upper</child>
+                </joint>
+              </model>
+              <model name="other">
+                <link name="base"/>
+              </model>
+            </world>
+          </sdf>)";
+        }
+
+        // Returns a model with a chain of links, each link after the first one being the child of a joint with the previous link
+        static std::string GetSdfModelWithLinkChain(size_t linkCount)
+        {
+            std::string xmlStr = R"(<?xml version="1.0"?>
+            <sdf version="1.10">
+            <model name="chain">
+              <link name="link_0"/>)";
+            for (size_t index = 1; index < linkCount; ++index)
+            {
+                const std::string linkName = "link_" + std::to_string(index);
+                const std::string parentLinkName = "link_" + std::to_string(index - 1);
+                xmlStr += "<link name=\"" + linkName + "\"/>";
+                xmlStr += "<joint name=\"joint_" + std::to_string(index) + "\" type=\"fixed\">";
+                xmlStr += "<parent>" + parentLinkName + "</parent><child>" + linkName + "</child></joint>";
+            }
+            xmlStr += "</model></sdf>";
+            return xmlStr;
+        }
+
         struct SdfXmlStack
         {
             AZStd::deque<std::string> m_stack;
@@ -357,6 +414,136 @@ namespace UnitTest
         EXPECT_TRUE(links.contains("your_model::same_link_name"));
     }
 
+    TEST_F(SdfParserTest, SdfIndex_LooksUpNestedModelsLinksAndJoints)
+    {
+        const auto xmlStr = GetSdfWorldWithNestedModelsAndJoints();
+        const auto sdfRootOutcome = ROS2::UrdfParser::Parse(xmlStr, {});
+        ASSERT_TRUE(sdfRootOutcome);
+        const auto& sdfRoot = sdfRootOutcome.GetRoot();
+        const ROS2::Utils::SdfIndex sdfIndex(sdfRoot);
+
+        ASSERT_EQ(3, sdfIndex.GetModels().size());
+        EXPECT_EQ("robot", sdfIndex.GetModels()[0].m_fullyQualifiedName);
+        EXPECT_EQ("robot::arm", sdfIndex.GetModels()[1].m_fullyQualifiedName);
+        EXPECT_EQ("other", sdfIndex.GetModels()[2].m_fullyQualifiedName);
+        EXPECT_EQ(4, sdfIndex.GetLinks().size());
+        EXPECT_EQ(2, sdfIndex.GetJoints().size());
+
+        const sdf::Model* robotModel = sdfIndex.FindModel("robot");
+        const sdf::Model* armModel = sdfIndex.FindModel("robot::arm");
+        const sdf::Model* otherModel = sdfIndex.FindModel("other");
+        ASSERT_NE(nullptr, robotModel);
+        ASSERT_NE(nullptr, armModel);
+        ASSERT_NE(nullptr, otherModel);
+        EXPECT_EQ(nullptr, sdfIndex.FindModel("arm"));
+        EXPECT_EQ(robotModel, sdfIndex.GetModelContainingModel(*armModel));
+        EXPECT_EQ(nullptr, sdfIndex.GetModelContainingModel(*robotModel));
+
+        // Links with the same name in different models are told apart
+        const sdf::Link* robotBase = sdfIndex.FindLink("robot::base");
+        const sdf::Link* otherBase = sdfIndex.FindLink("other::base");
+        const sdf::Link* upper = sdfIndex.FindLink("robot::arm::upper");
+        const sdf::Link* lower = sdfIndex.FindLink("robot::arm::lower");
+        ASSERT_NE(nullptr, robotBase);
+        ASSERT_NE(nullptr, otherBase);
+        ASSERT_NE(nullptr, upper);
+        ASSERT_NE(nullptr, lower);
+        EXPECT_NE(robotBase, otherBase);
+        EXPECT_EQ(robotModel, sdfIndex.GetModelContainingLink("robot::base"));
+        EXPECT_EQ(otherModel, sdfIndex.GetModelContainingLink(*otherBase));
+        EXPECT_EQ(armModel, sdfIndex.GetModelContainingLink(*lower));
+        EXPECT_EQ(nullptr, sdfIndex.GetModelContainingLink("base"));
+
+        const sdf::Joint* shoulder = sdfIndex.FindJoint("robot::shoulder");
+        const sdf::Joint* elbow = sdfIndex.FindJoint("robot::arm::elbow");
+        ASSERT_NE(nullptr, shoulder);
+        ASSERT_NE(nullptr, elbow);
+        EXPECT_EQ(robotModel, sdfIndex.GetModelContainingJoint("robot::shoulder"));
+        EXPECT_EQ(armModel, sdfIndex.GetModelContainingJoint(*elbow));
+
+        // A joint of the outer model can refer to a link of the nested model using a scoped name
+        EXPECT_EQ(robotBase, sdfIndex.GetParentLink(*shoulder));
+        EXPECT_EQ(upper, sdfIndex.GetChildLink(*shoulder));
+        EXPECT_EQ(upper, sdfIndex.GetParentLink(*elbow));
+        EXPECT_EQ(lower, sdfIndex.GetChildLink(*elbow));
+
+        ASSERT_EQ(1, sdfIndex.GetJointsForChildLink(*upper).size());
+        EXPECT_EQ(shoulder, sdfIndex.GetJointsForChildLink(*upper).front());
+        ASSERT_EQ(1, sdfIndex.GetJointsForParentLink(*upper).size());
+        EXPECT_EQ(elbow, sdfIndex.GetJointsForParentLink(*upper).front());
+        EXPECT_TRUE(sdfIndex.GetJointsForChildLink(*robotBase).empty());
+        EXPECT_TRUE(sdfIndex.GetJointsForParentLink(*otherBase).empty());
+        EXPECT_TRUE(sdfIndex.GetJointsForChildLink(*otherBase).empty());
+    }
+
+    TEST_F(SdfParserTest, SdfIndex_LargeModel_MatchesJointQueries)
+    {
+        constexpr size_t linkCount = 5000;
+        const auto xmlStr = GetSdfModelWithLinkChain(linkCount);
+        const auto sdfRootOutcome = ROS2::UrdfParser::Parse(xmlStr, {});
+        ASSERT_TRUE(sdfRootOutcome);
+        const auto& sdfRoot = sdfRootOutcome.GetRoot();
+        const sdf::Model* model = sdfRoot.Model();
+        ASSERT_NE(nullptr, model);
+
+        const ROS2::Utils::SdfIndex sdfIndex(sdfRoot);
+        ASSERT_EQ(1, sdfIndex.GetModels().size());
+        ASSERT_EQ(linkCount, sdfIndex.GetLinks().size());
+        ASSERT_EQ(linkCount - 1, sdfIndex.GetJoints().size());
+
+        for (const auto& [fullLinkName, link, attachedModel] : sdfIndex.GetLinks())
+        {
+            EXPECT_EQ(model, attachedModel);
+            EXPECT_EQ(link, sdfIndex.FindLink(fullLinkName));
+            const auto& jointsWhereLinkIsChild = sdfIndex.GetJointsForChildLink(*link);
+            const auto& jointsWhereLinkIsParent = sdfIndex.GetJointsForParentLink(*link);
+            EXPECT_EQ(link->Name() == "link_0" ? 0u : 1u, jointsWhereLinkIsChild.size());
+            EXPECT_EQ(link->Name() == "link_" + std::to_string(linkCount - 1) ? 0u : 1u, jointsWhereLinkIsParent.size());
+        }
+
+        // The index gives the same joints as a traversal of the model
+        for (const char* linkName : { "link_0", "link_1", "link_2500", "link_4999" })
+        {
+            const sdf::Link* link = model->LinkByName(linkName);
+            ASSERT_NE(nullptr, link);
+            EXPECT_EQ(ROS2::Utils::GetJointsForChildLink(*model, linkName), sdfIndex.GetJointsForChildLink(*link));
+            EXPECT_EQ(ROS2::Utils::GetJointsForParentLink(*model, linkName), sdfIndex.GetJointsForParentLink(*link));
+        }
+    }
+
+    TEST_F(SdfParserTest, ColliderMeshExportMethods_SameLinkNameInNestedModels_UseQualifiedLinkOverrides)
+    {
+        const std::string xmlStr = R"(<?xml version="1.0"?>
+            <sdf version="1.7">
+              <model name="rover">
+                <link name="wheel">
+                  <collision name="collision">
+                    <geometry><mesh><uri>model://rover/meshes/rover_wheel.dae</uri></mesh></geometry>
+                  </collision>
+                </link>
+                <model name="trailer">
+                  <link name="wheel">
+                    <collision name="collision">
+                      <geometry><mesh><uri>model://rover/meshes/trailer_wheel.dae</uri></mesh></geometry>
+                    </collision>
+                  </link>
+                </model>
+              </model>
+            </sdf>)";
+        const auto sdfRootOutcome = ROS2::UrdfParser::Parse(xmlStr, {});
+        ASSERT_TRUE(sdfRootOutcome);
+
+        ROS2::SdfColliderMeshSettings colliderMeshSettings;
+        colliderMeshSettings.m_exportMethod = ROS2::ColliderMeshExportMethod::ConvexDecomposition;
+        colliderMeshSettings.m_linkExportMethods.emplace("rover::trailer::wheel", ROS2::ColliderMeshExportMethod::Primitive);
+
+        // Only the link of the nested model is overridden, even though both links are named "wheel"
+        const auto exportMethods = ROS2::Utils::GetColliderMeshExportMethods(sdfRootOutcome.GetRoot(), colliderMeshSettings);
+        ASSERT_EQ(2, exportMethods.size());
+        EXPECT_EQ(ROS2::ColliderMeshExportMethod::ConvexDecomposition, exportMethods.at("model://rover/meshes/rover_wheel.dae"));
+        EXPECT_EQ(ROS2::ColliderMeshExportMethod::Primitive, exportMethods.at("model://rover/meshes/trailer_wheel.dae"));
+    }
+
     TEST_F(SdfParserTest, NestedModel_CanBeIncludedFromURI_Succeeds)
     {
         const SdfXmlStack sdfStack = GetSdfWorldWithNestedModelWithPose();
@@ -652,4 +839,84 @@ namespace UnitTest
         }
     }
 
+    //! Sensor components are created by the importer hooks on the entity of their link, as the prefab maker does.
+    class SdfSensorHookTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            // The dependencies between the components are taken from their registered descriptors.
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadSettingsRegistry = false;
+            m_application = AZStd::make_unique<AZ::ComponentApplication>();
+            m_application->Create(AZ::ComponentApplication::Descriptor(), startupParameters);
+
+            m_descriptors.emplace_back(AzToolsFramework::Components::GenericComponentWrapper::CreateDescriptor());
+            m_descriptors.emplace_back(ROS2::ROS2FrameComponent::CreateDescriptor());
+            m_descriptors.emplace_back(ROS2::ROS2GNSSSensorComponent::CreateDescriptor());
+            for (const auto& descriptor : m_descriptors)
+            {
+                m_application->RegisterComponentDescriptor(descriptor.get());
+            }
+        }
+
+        void TearDown() override
+        {
+            for (const auto& descriptor : m_descriptors)
+            {
+                m_application->UnregisterComponentDescriptor(descriptor.get());
+            }
+            m_descriptors.clear();
+            m_application->Destroy();
+            m_application.reset();
+
+            LeakDetectionFixture::TearDown();
+        }
+
+        static std::string GetSdfWithGNSSSensor()
+        {
+            return R"(<?xml version="1.0"?>
+                      <sdf version="1.6">
+                        <model name="gnss_robot">
+                          <link name="gnss_link">
+                            <sensor name="gnss" type="navsat">
+                              <update_rate>10</update_rate>
+                              <navsat/>
+                            </sensor>
+                          </link>
+                        </model>
+                      </sdf>)";
+        }
+
+        AZStd::unique_ptr<AZ::ComponentApplication> m_application;
+        AZStd::vector<AZStd::unique_ptr<AZ::ComponentDescriptor>> m_descriptors;
+    };
+
+    TEST_F(SdfSensorHookTest, GNSSSensorHook_LinkWithFrame_AddsSensor)
+    {
+        const auto sdfRootOutcome = ROS2::UrdfParser::Parse(GetSdfWithGNSSSensor(), {});
+        ASSERT_TRUE(sdfRootOutcome);
+        const sdf::Model* sdfModel = sdfRootOutcome.GetRoot().Model();
+        ASSERT_NE(nullptr, sdfModel);
+        const sdf::Link* sdfLink = sdfModel->LinkByName("gnss_link");
+        ASSERT_NE(nullptr, sdfLink);
+        ASSERT_EQ(1U, sdfLink->SensorCount());
+        const sdf::Sensor& sdfSensor = *sdfLink->SensorByIndex(0U);
+
+        const auto& importerHook = ROS2::SDFormat::ROS2SensorHooks::ROS2GNSSSensor();
+        ASSERT_TRUE(importerHook.m_sensorTypes.contains(sdfSensor.Type()));
+
+        // Unlike the camera, lidar and IMU hooks, the GNSS hook does not create the ROS2 frame the sensor requires,
+        // so the sensor can only be added once the frame of the link exists.
+        AZ::Entity linkEntity("gnss_link");
+        EXPECT_FALSE(importerHook.m_sdfSensorToComponentCallback(linkEntity, sdfSensor).IsSuccess());
+        EXPECT_EQ(nullptr, ROS2::Utils::GetGameOrEditorComponent<ROS2::ROS2GNSSSensorComponent>(&linkEntity));
+
+        ASSERT_NE(nullptr, ROS2::SDFormat::ROS2SensorHooks::Utils::CreateComponent<ROS2::ROS2FrameComponent>(linkEntity));
+        const auto outcome = importerHook.m_sdfSensorToComponentCallback(linkEntity, sdfSensor);
+        EXPECT_TRUE(outcome.IsSuccess()) << outcome.GetError().c_str();
+        EXPECT_NE(nullptr, ROS2::Utils::GetGameOrEditorComponent<ROS2::ROS2GNSSSensorComponent>(&linkEntity));
+    }
 } // namespace UnitTest
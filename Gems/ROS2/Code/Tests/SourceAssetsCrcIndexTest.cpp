@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/string/string.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <RobotImporter/Utils/SourceAssetsCrcIndex.h>
+
+namespace UnitTest
+{
+
+    class SourceAssetsCrcIndexTest : public LeakDetectionFixture
+    {
+    public:
+        AZ::IO::Path CreateFile(AZ::IO::PathView filename, AZStd::string_view contents)
+        {
+            auto path = AZ::Test::CreateTestFile(m_tempDirectory, filename, contents);
+            EXPECT_TRUE(path.has_value());
+            return path.has_value() ? AZ::IO::Path(path->Native()) : AZ::IO::Path();
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+    };
+
+    TEST_F(SourceAssetsCrcIndexTest, GetFileCRC_MatchesComputedChecksum)
+    {
+        const AZ::IO::Path meshPath = CreateFile("mesh.dae", "<COLLADA>first</COLLADA>");
+        ROS2::Utils::SourceAssetsCrcIndex crcIndex;
+
+        const AZ::Crc32 crc = crcIndex.GetFileCRC(meshPath);
+        EXPECT_NE(AZ::Crc32(0), crc);
+        EXPECT_EQ(ROS2::Utils::ComputeFileCRC(meshPath), crc);
+        EXPECT_EQ(crc, crcIndex.GetFileCRC(meshPath));
+    }
+
+    TEST_F(SourceAssetsCrcIndexTest, GetFileCRC_FileChangedSize_ChecksumUpdated)
+    {
+        const AZ::IO::Path meshPath = CreateFile("mesh.dae", "<COLLADA>first</COLLADA>");
+        ROS2::Utils::SourceAssetsCrcIndex crcIndex;
+        const AZ::Crc32 firstCrc = crcIndex.GetFileCRC(meshPath);
+
+        CreateFile("mesh.dae", "<COLLADA>second version</COLLADA>");
+        const AZ::Crc32 secondCrc = crcIndex.GetFileCRC(meshPath);
+        EXPECT_NE(firstCrc, secondCrc);
+        EXPECT_EQ(ROS2::Utils::ComputeFileCRC(meshPath), secondCrc);
+    }
+
+    TEST_F(SourceAssetsCrcIndexTest, GetFileContentHash_SameHeader_DifferentHashes)
+    {
+        // Both files share the first kilobyte, so only the content hash tells them apart.
+        const AZStd::string header(1024, 'h');
+        const AZ::IO::Path firstPath = CreateFile("first.dae", header + "first");
+        const AZ::IO::Path secondPath = CreateFile("second.dae", header + "other");
+        const AZ::IO::Path copyPath = CreateFile("copy.dae", header + "first");
+        ROS2::Utils::SourceAssetsCrcIndex crcIndex;
+
+        EXPECT_EQ(crcIndex.GetFileCRC(firstPath), crcIndex.GetFileCRC(secondPath));
+        const AZStd::vector<AZ::u64> hashes = crcIndex.GetFileContentHashes({ firstPath, secondPath, copyPath, firstPath });
+        ASSERT_EQ(4, hashes.size());
+        EXPECT_NE(0, hashes[0]);
+        EXPECT_NE(hashes[0], hashes[1]);
+        EXPECT_EQ(hashes[0], hashes[2]);
+        EXPECT_EQ(hashes[0], hashes[3]);
+        EXPECT_EQ(ROS2::Utils::ComputeFileContentHash(secondPath), hashes[1]);
+    }
+
+    TEST_F(SourceAssetsCrcIndexTest, SaveAndLoad_RoundTrip_ChecksumsPersisted)
+    {
+        const AZ::IO::Path meshPath = CreateFile("mesh.dae", "<COLLADA>first</COLLADA>");
+        const AZ::IO::Path indexPath = m_tempDirectory.Resolve("index/SourceAssetsCrcIndex.txt").Native();
+
+        AZ::Crc32 crc;
+        {
+            ROS2::Utils::SourceAssetsCrcIndex crcIndex(indexPath);
+            crc = crcIndex.GetFileCRC(meshPath);
+            ASSERT_TRUE(crcIndex.Save());
+        }
+
+        ROS2::Utils::SourceAssetsCrcIndex loadedCrcIndex(indexPath);
+        ASSERT_TRUE(loadedCrcIndex.Load());
+        EXPECT_EQ(crc, loadedCrcIndex.GetFileCRC(meshPath));
+    }
+
+    TEST_F(SourceAssetsCrcIndexTest, Load_UnchangedFile_IsNotReadAgain)
+    {
+        const AZ::IO::Path meshPath = CreateFile("mesh.dae", "<COLLADA>first</COLLADA>");
+        const AZ::u64 size = AZ::IO::SystemFile::Length(meshPath.c_str());
+        const AZ::u64 modificationTime = AZ::IO::SystemFile::ModificationTime(meshPath.c_str());
+
+        // The persisted checksum deliberately differs from the file contents, so it is only returned if the file is not read.
+        constexpr AZ::u32 PersistedCrc = 12345;
+        constexpr AZ::u64 PersistedContentHash = 67890;
+        const AZStd::string indexContents = AZStd::string::format(
+            "ROS2SourceAssetsCrcIndex %u\n%u\t%llu\t%llu\t%llu\t%s\n",
+            ROS2::Utils::SourceAssetsCrcIndex::FileVersion,
+            PersistedCrc,
+            static_cast<unsigned long long>(size),
+            static_cast<unsigned long long>(modificationTime),
+            static_cast<unsigned long long>(PersistedContentHash),
+            meshPath.LexicallyNormal().c_str());
+        const AZ::IO::Path indexPath = CreateFile("SourceAssetsCrcIndex.txt", indexContents);
+
+        ROS2::Utils::SourceAssetsCrcIndex crcIndex(indexPath);
+        ASSERT_TRUE(crcIndex.Load());
+        EXPECT_EQ(AZ::Crc32(PersistedCrc), crcIndex.GetFileCRC(meshPath));
+        EXPECT_EQ(PersistedContentHash, crcIndex.GetFileContentHash(meshPath));
+    }
+
+    TEST_F(SourceAssetsCrcIndexTest, Load_DifferentVersion_Ignored)
+    {
+        const AZ::IO::Path indexPath = CreateFile("SourceAssetsCrcIndex.txt", "ROS2SourceAssetsCrcIndex 0\n1\t2\t3\t/some/file.dae\n");
+
+        ROS2::Utils::SourceAssetsCrcIndex crcIndex(indexPath);
+        EXPECT_FALSE(crcIndex.Load());
+    }
+} // namespace UnitTest
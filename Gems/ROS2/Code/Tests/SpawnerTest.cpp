@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+
+#include <Spawner/SpawnBatchState.h>
+
+namespace UnitTest
+{
+    class SpawnerTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(SpawnerTest, SpawnInfoPosesDefaultToIdentity)
+    {
+        EXPECT_TRUE(ROS2::SpawnPointInfo{}.pose.IsClose(AZ::Transform::CreateIdentity()));
+        EXPECT_TRUE(ROS2::SpawnEntityInfo{}.pose.IsClose(AZ::Transform::CreateIdentity()));
+    }
+
+    TEST_F(SpawnerTest, TicketNamesOfReusedTicketsAreUnique)
+    {
+        const AZStd::string firstName = ROS2::MakeSpawnTicketName("robot", 7, 0);
+        const AZStd::string reusedName = ROS2::MakeSpawnTicketName("robot", 7, 1);
+        EXPECT_NE(firstName, reusedName);
+        EXPECT_NE(firstName, ROS2::MakeSpawnTicketName("other_robot", 7, 0));
+        EXPECT_EQ(firstName, ROS2::MakeSpawnTicketName("robot", 7, 0));
+    }
+
+    TEST_F(SpawnerTest, BatchReportsAllResultsOnceInRequestOrder)
+    {
+        int completionCount = 0;
+        ROS2::SpawnEntityResults reportedResults;
+        ROS2::SpawnBatchState batch(
+            3,
+            [&completionCount, &reportedResults](const ROS2::SpawnEntityResults& results)
+            {
+                ++completionCount;
+                reportedResults = results;
+            });
+
+        ROS2::SpawnEntityResult result;
+        result.success = true;
+        result.ticketName = "third";
+        batch.SetResult(2, result);
+        result.ticketName = "first";
+        batch.SetResult(0, result);
+        EXPECT_EQ(0, completionCount);
+
+        result.success = false;
+        result.ticketName = "second";
+        batch.SetResult(1, result);
+        EXPECT_EQ(1, completionCount);
+
+        ASSERT_EQ(3, reportedResults.size());
+        EXPECT_EQ("first", reportedResults[0].ticketName);
+        EXPECT_EQ("second", reportedResults[1].ticketName);
+        EXPECT_FALSE(reportedResults[1].success);
+        EXPECT_EQ("third", reportedResults[2].ticketName);
+    }
+} // namespace UnitTest
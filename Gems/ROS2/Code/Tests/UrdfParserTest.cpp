@@ -6,13 +6,17 @@
  *
  */
 
+#include <AzCore/Debug/TraceMessageBus.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
 #include <AzCore/std/string/string.h>
 #include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
 #include <RobotImporter/URDF/UrdfParser.h>
 #include <RobotImporter/Utils/ErrorUtils.h>
 #include <RobotImporter/Utils/RobotImporterUtils.h>
+#include <RobotImporter/xacro/XacroExpander.h>
 #include <RobotImporter/xacro/XacroUtils.h>
 #include <SdfAssetBuilder/SdfAssetBuilderSettings.h>
 
@@ -28,6 +32,46 @@ namespace UnitTest
                    "    <xacro:arg name=\"laser_enabled\" default=\"false\" />\n"
                    "</robot>";
         }
+        AZStd::string GetXacroWithMacros()
+        {
+            return R"(<robot name="test_xacro" xmlns:xacro="http://ros.org/wiki/xacro">
+                  <xacro:arg name="prefix" default="robot_"/>
+                  <xacro:property name="width" value="0.5"/>
+                  <xacro:property name="length" value="${width * 4}"/>
+                  <xacro:macro name="box_link" params="name size:=1 *origin">
+                    <link name="$(arg prefix)${name}">
+                      <inertial>
+                        <mass value="${size * 2}"/>
+                        <inertia ixx="1.0" iyy="1.0" izz="1.0" ixy="0" ixz="0" iyz="0"/>
+                      </inertial>
+                      <visual>
+                        <xacro:insert_block name="origin"/>
+                        <geometry>
+                          <box size="${size} ${width} ${length}"/>
+                        </geometry>
+                      </visual>
+                    </link>
+                  </xacro:macro>
+                  <xacro:box_link name="base_link" size="${width / 2}">
+                    <origin xyz="0 0 ${-width}"/>
+                  </xacro:box_link>
+                  <xacro:if value="${length > 1 and width < 1}">
+                    <xacro:box_link name="long_link">
+                      <origin xyz="0 0 0"/>
+                    </xacro:box_link>
+                  </xacro:if>
+                  <xacro:unless value="true">
+                    <xacro:box_link name="skipped_link">
+                      <origin xyz="0 0 0"/>
+                    </xacro:box_link>
+                  </xacro:unless>
+                  <joint name="joint" type="continuous">
+                    <parent link="$(arg prefix)base_link"/>
+                    <child link="$(arg prefix)long_link"/>
+                  </joint>
+                </robot>)";
+        }
+
         AZStd::string GetUrdfWithOneLink()
         {
             return "<robot name=\"test_one_link\">"
@@ -302,6 +346,42 @@ namespace UnitTest
             // clang-format on
         }
 
+        AZStd::string GetURDFWithSharedColliderMeshes()
+        {
+            auto GetLink = [](const AZStd::string& linkName, const AZStd::string& meshUri)
+            {
+                return AZStd::string::format(
+                    R"(<link name="%s">
+                        <inertial>
+                          <mass value="1."/>
+                          <inertia ixx="1." ixy="0." ixz="0." iyy="1." iyz="0." izz="1."/>
+                        </inertial>
+                        <collision>
+                          <geometry>
+                            <mesh filename="%s"/>
+                          </geometry>
+                        </collision>
+                      </link>)",
+                    linkName.c_str(),
+                    meshUri.c_str());
+            };
+            auto GetJoint = [](const AZStd::string& jointName, const AZStd::string& childName)
+            {
+                return AZStd::string::format(
+                    R"(<joint name="%s" type="fixed">
+                        <parent link="base_link"/>
+                        <child link="%s"/>
+                      </joint>)",
+                    jointName.c_str(),
+                    childName.c_str());
+            };
+
+            return R"(<robot name="collider_meshes_test">)" + GetLink("base_link", "package://test/meshes/base.dae") +
+                GetLink("wheel_left", "package://test/meshes/wheel.dae") + GetLink("wheel_right", "package://test/meshes/wheel.dae") +
+                GetLink("gripper", "package://test/meshes/gripper.dae") + GetJoint("wheel_left_joint", "wheel_left") +
+                GetJoint("wheel_right_joint", "wheel_right") + GetJoint("gripper_joint", "gripper") + "</robot>";
+        }
+
         ROS2::SdfAssetBuilderSettings GetTestSettings()
         {
             ROS2::SdfAssetBuilderSettings settings;
@@ -857,6 +937,33 @@ namespace UnitTest
         ASSERT_TRUE(AZStd::ranges::contains(joints, "joint1", jointToNameProjection));
     }
 
+    TEST_F(UrdfParserTest, ColliderMeshExportMethods_UseLinkOverridesAndMostDetailedMethodOfSharedMeshes)
+    {
+        const auto xmlStr = GetURDFWithSharedColliderMeshes();
+        sdf::ParserConfig parserConfig;
+        parserConfig.URDFSetPreserveFixedJoint(true);
+        const auto sdfRootOutcome = ROS2::UrdfParser::Parse(xmlStr, parserConfig);
+        ASSERT_TRUE(sdfRootOutcome);
+        const sdf::Root& sdfRoot = sdfRootOutcome.GetRoot();
+
+        ROS2::SdfColliderMeshSettings colliderMeshSettings;
+        colliderMeshSettings.m_exportMethod = ROS2::ColliderMeshExportMethod::ConvexHull;
+        colliderMeshSettings.m_linkExportMethods.emplace("collider_meshes_test::wheel_left", ROS2::ColliderMeshExportMethod::Primitive);
+        colliderMeshSettings.m_linkExportMethods.emplace(
+            "collider_meshes_test::wheel_right", ROS2::ColliderMeshExportMethod::ConvexDecomposition);
+        colliderMeshSettings.m_linkExportMethods.emplace("collider_meshes_test::gripper", ROS2::ColliderMeshExportMethod::Primitive);
+
+        const auto exportMethods = ROS2::Utils::GetColliderMeshExportMethods(sdfRoot, colliderMeshSettings);
+        ASSERT_EQ(3, exportMethods.size());
+        EXPECT_EQ(ROS2::ColliderMeshExportMethod::ConvexHull, exportMethods.at("package://test/meshes/base.dae"));
+        EXPECT_EQ(ROS2::ColliderMeshExportMethod::ConvexDecomposition, exportMethods.at("package://test/meshes/wheel.dae"));
+        EXPECT_EQ(ROS2::ColliderMeshExportMethod::Primitive, exportMethods.at("package://test/meshes/gripper.dae"));
+
+        const ROS2::ColliderMeshExport hullExport = colliderMeshSettings.GetExport(ROS2::ColliderMeshExportMethod::ConvexHull);
+        EXPECT_EQ(ROS2::ColliderMeshExportMethod::ConvexHull, hullExport.m_exportMethod);
+        EXPECT_EQ(colliderMeshSettings.m_maxVerticesPerConvexHull, hullExport.m_maxVerticesPerConvexHull);
+    }
+
     TEST_F(UrdfParserTest, TestPathResolve_ValidAbsolutePath_ResolvesCorrectly)
     {
         // Verify that an absolute path that wouldn't be resolved by prefixes or ancestor paths
@@ -1046,4 +1153,146 @@ namespace UnitTest
         EXPECT_EQ(params["laser_enabled"], "false");
     }
 
+    TEST_F(UrdfParserTest, XacroExpandInProcess)
+    {
+        const ROS2::Utils::xacro::Params params{ { "prefix", "my_" } };
+        const auto expansion = ROS2::Utils::xacro::ExpandXacroData(GetXacroWithMacros(), "", params, GetTestSettings());
+        ASSERT_TRUE(expansion.IsSuccess()) << expansion.GetError().c_str();
+        const AZStd::string& urdf = expansion.GetValue().m_urdf;
+        EXPECT_EQ(urdf.find("<xacro:"), AZStd::string::npos);
+        EXPECT_NE(urdf.find("size=\"0.25 0.5 2.0\""), AZStd::string::npos);
+        EXPECT_NE(urdf.find("xyz=\"0 0 -0.5\""), AZStd::string::npos);
+
+        sdf::ParserConfig parserConfig;
+        const auto sdfRootOutcome = ROS2::UrdfParser::Parse(urdf, parserConfig);
+        ASSERT_TRUE(sdfRootOutcome);
+        const sdf::Model* model = sdfRootOutcome.GetRoot().Model();
+        ASSERT_NE(nullptr, model);
+        EXPECT_EQ(2U, model->LinkCount());
+
+        const sdf::Link* baseLink = model->LinkByName("my_base_link");
+        ASSERT_NE(nullptr, baseLink);
+        EXPECT_DOUBLE_EQ(0.5, baseLink->Inertial().MassMatrix().Mass());
+        EXPECT_NE(nullptr, model->LinkByName("my_long_link"));
+        EXPECT_EQ(nullptr, model->LinkByName("my_skipped_link"));
+    }
+
+    TEST_F(UrdfParserTest, XacroExpandInProcessUnsupported)
+    {
+        // Python beyond arithmetic and xacro elements without native support fail, so that the xacro executable is used instead
+        const ROS2::Utils::xacro::Params params;
+        const AZStd::string listExpression = R"(<robot name="test" xmlns:xacro="http://ros.org/wiki/xacro">
+                                                  <link name="${['a', 'b'][0]}"/>
+                                                </robot>)";
+        EXPECT_FALSE(ROS2::Utils::xacro::ExpandXacroData(listExpression, "", params, GetTestSettings()).IsSuccess());
+
+        const AZStd::string dynamicElement = R"(<robot name="test" xmlns:xacro="http://ros.org/wiki/xacro">
+                                                  <xacro:element xacro:name="link" name="a"/>
+                                                </robot>)";
+        EXPECT_FALSE(ROS2::Utils::xacro::ExpandXacroData(dynamicElement, "", params, GetTestSettings()).IsSuccess());
+    }
+
+    //! Counts the expansions the xacro cache reports as reused.
+    class XacroCacheHitCounter : public AZ::Debug::TraceMessageBus::Handler
+    {
+    public:
+        XacroCacheHitCounter()
+        {
+            BusConnect();
+        }
+
+        ~XacroCacheHitCounter() override
+        {
+            BusDisconnect();
+        }
+
+        bool OnPrintf(const char* window, const char* message) override
+        {
+            if (AZStd::string_view(window) == "ParseXacro" && AZStd::string_view(message).starts_with("Reusing the expansion"))
+            {
+                ++m_hits;
+            }
+            return false;
+        }
+
+        int m_hits = 0;
+    };
+
+    TEST_F(UrdfParserTest, XacroExpansionCache_UnchangedInputs_ReusesExpansion)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const auto xacroPath = AZ::Test::CreateTestFile(tempDirectory, "robot.urdf.xacro", GetXacroWithMacros());
+        ASSERT_TRUE(xacroPath.has_value());
+
+        XacroCacheHitCounter hitCounter;
+        ROS2::Utils::xacro::XacroExpansionCache cache;
+        const ROS2::Utils::xacro::Params params{ { "prefix", "my_" } };
+        const auto expansion = cache.Expand(AZ::IO::Path(xacroPath->c_str()), params, GetTestSettings());
+        ASSERT_TRUE(expansion.IsSuccess()) << expansion.GetError().c_str();
+        EXPECT_EQ(0, hitCounter.m_hits);
+
+        const auto cachedExpansion = cache.Expand(AZ::IO::Path(xacroPath->c_str()), params, GetTestSettings());
+        ASSERT_TRUE(cachedExpansion.IsSuccess());
+        EXPECT_EQ(1, hitCounter.m_hits);
+        EXPECT_EQ(expansion.GetValue().m_urdf, cachedExpansion.GetValue().m_urdf);
+
+        // Different arguments are a different expansion.
+        const ROS2::Utils::xacro::Params otherParams{ { "prefix", "other_" } };
+        const auto otherExpansion = cache.Expand(AZ::IO::Path(xacroPath->c_str()), otherParams, GetTestSettings());
+        ASSERT_TRUE(otherExpansion.IsSuccess());
+        EXPECT_EQ(1, hitCounter.m_hits);
+        EXPECT_NE(otherExpansion.GetValue().m_urdf.find("other_base_link"), AZStd::string::npos);
+    }
+
+    TEST_F(UrdfParserTest, XacroExpansionCache_FileOrEnvironmentChanged_ExpandsAgain)
+    {
+        constexpr const char* VariableName = "ROS2_XACRO_EXPANSION_CACHE_TEST";
+        AZ::Utils::UnsetEnv(VariableName);
+
+        const AZStd::string xacro = AZStd::string::format(
+            R"(<robot name="test" xmlns:xacro="http://ros.org/wiki/xacro">
+                 <link name="$(optenv %s default_link)"/>
+               </robot>)",
+            VariableName);
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const auto xacroPath = AZ::Test::CreateTestFile(tempDirectory, "robot.urdf.xacro", xacro);
+        ASSERT_TRUE(xacroPath.has_value());
+        const AZ::IO::Path filename(xacroPath->c_str());
+
+        XacroCacheHitCounter hitCounter;
+        ROS2::Utils::xacro::XacroExpansionCache cache;
+        const ROS2::Utils::xacro::Params params;
+        auto expansion = cache.Expand(filename, params, GetTestSettings());
+        ASSERT_TRUE(expansion.IsSuccess()) << expansion.GetError().c_str();
+        EXPECT_NE(expansion.GetValue().m_urdf.find("default_link"), AZStd::string::npos);
+
+        // Setting a variable read by the expansion invalidates it, even though it was not set before.
+        ASSERT_TRUE(AZ::Utils::SetEnv(VariableName, "first_link", true));
+        expansion = cache.Expand(filename, params, GetTestSettings());
+        ASSERT_TRUE(expansion.IsSuccess());
+        EXPECT_NE(expansion.GetValue().m_urdf.find("first_link"), AZStd::string::npos);
+
+        ASSERT_TRUE(AZ::Utils::SetEnv(VariableName, "second_link", true));
+        expansion = cache.Expand(filename, params, GetTestSettings());
+        ASSERT_TRUE(expansion.IsSuccess());
+        EXPECT_NE(expansion.GetValue().m_urdf.find("second_link"), AZStd::string::npos);
+
+        // So does unsetting it again.
+        AZ::Utils::UnsetEnv(VariableName);
+        expansion = cache.Expand(filename, params, GetTestSettings());
+        ASSERT_TRUE(expansion.IsSuccess());
+        EXPECT_NE(expansion.GetValue().m_urdf.find("default_link"), AZStd::string::npos);
+
+        // And a change of the expanded file.
+        ASSERT_TRUE(AZ::Test::CreateTestFile(tempDirectory, "robot.urdf.xacro", xacro + "\n<!-- edited -->").has_value());
+        expansion = cache.Expand(filename, params, GetTestSettings());
+        ASSERT_TRUE(expansion.IsSuccess());
+        EXPECT_EQ(0, hitCounter.m_hits);
+
+        // Only now the inputs are the ones of the previous expansion.
+        expansion = cache.Expand(filename, params, GetTestSettings());
+        ASSERT_TRUE(expansion.IsSuccess());
+        EXPECT_EQ(1, hitCounter.m_hits);
+    }
+
 } // namespace UnitTest
@@ -30,6 +30,8 @@ set(FILES
     Source/RobotImporter/Pages/IntroPage.h
     Source/RobotImporter/Pages/XacroParamsPage.cpp
     Source/RobotImporter/Pages/XacroParamsPage.h
+    Source/RobotImporter/RobotBatchImporter.cpp
+    Source/RobotImporter/RobotBatchImporter.h
     Source/RobotImporter/RobotImporterWidget.cpp
     Source/RobotImporter/RobotImporterWidget.h
     Source/RobotImporter/ROS2RobotImporterEditorSystemComponent.cpp
@@ -59,6 +61,8 @@ set(FILES
     Source/RobotImporter/URDF/URDFPrefabMaker.h
     Source/RobotImporter/URDF/VisualsMaker.cpp
     Source/RobotImporter/URDF/VisualsMaker.h
+    Source/RobotImporter/xacro/XacroExpander.cpp
+    Source/RobotImporter/xacro/XacroExpander.h
     Source/RobotImporter/xacro/XacroUtils.cpp
     Source/RobotImporter/xacro/XacroUtils.h
     Source/RobotImporter/Utils/DefaultSolverConfiguration.h
@@ -68,6 +72,8 @@ set(FILES
     Source/RobotImporter/Utils/FilePath.h
     Source/RobotImporter/Utils/RobotImporterUtils.cpp
     Source/RobotImporter/Utils/RobotImporterUtils.h
+    Source/RobotImporter/Utils/SourceAssetsCrcIndex.cpp
+    Source/RobotImporter/Utils/SourceAssetsCrcIndex.h
     Source/RobotImporter/Utils/SourceAssetsStorage.cpp
     Source/RobotImporter/Utils/SourceAssetsStorage.h
     Source/RobotImporter/Utils/TypeConversions.cpp
@@ -79,6 +85,8 @@ set(FILES
     Source/Spawner/ROS2SpawnPointEditorComponent.h
     Source/SdfAssetBuilder/SdfAssetBuilder.cpp
     Source/SdfAssetBuilder/SdfAssetBuilder.h
+    Source/SdfAssetBuilder/SdfAssetBuilderParseCache.cpp
+    Source/SdfAssetBuilder/SdfAssetBuilderParseCache.h
     Source/SdfAssetBuilder/SdfAssetBuilderSettings.cpp
     Source/SdfAssetBuilder/SdfAssetBuilderSettings.h
     Source/SdfAssetBuilder/SdfAssetBuilderSystemComponent.cpp
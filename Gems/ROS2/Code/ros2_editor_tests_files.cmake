@@ -5,6 +5,9 @@
 
 set(FILES
     Tests/ROS2EditorTest.cpp
+    Tests/RobotBatchImporterTest.cpp
+    Tests/SdfAssetBuilderParseCacheTest.cpp
     Tests/SdfParserTest.cpp
+    Tests/SourceAssetsCrcIndexTest.cpp
     Tests/UrdfParserTest.cpp
 )
@@ -118,6 +118,8 @@ set(FILES
         Source/SimulationUtils/FollowingCameraConfiguration.h
         Source/SimulationUtils/FollowingCameraComponent.cpp
         Source/SimulationUtils/FollowingCameraComponent.h
+        Source/Spawner/SpawnBatchState.cpp
+        Source/Spawner/SpawnBatchState.h
         Source/Spawner/ROS2SpawnerComponent.cpp
         Source/Spawner/ROS2SpawnerComponent.h
         Source/Spawner/ROS2SpawnPointComponent.cpp
@@ -29,6 +29,8 @@ set(FILES
         Include/ROS2/Manipulation/MotorizedJoints/PidMotorControllerComponent.h
         Include/ROS2/RobotControl/ControlConfiguration.h
         Include/ROS2/RobotControl/ControlSubscriptionHandler.h
+        Include/ROS2/RobotControl/LatestValueMailbox.h
+        Include/ROS2/RobotControl/RobotControlBus.h
         Include/ROS2/RobotImporter/SDFormatSensorImporterHook.h
         Include/ROS2/Lidar/LidarRaycasterBus.h
         Include/ROS2/Lidar/LidarSystemBus.h
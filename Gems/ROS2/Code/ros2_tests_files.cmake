@@ -6,4 +6,6 @@
 set(FILES
     Tests/ROS2Test.cpp
     Tests/GNSSTest.cpp
+    Tests/LatestValueMailboxTest.cpp
+    Tests/SpawnerTest.cpp
 )
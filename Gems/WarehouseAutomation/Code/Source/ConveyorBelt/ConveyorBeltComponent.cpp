@@ -96,6 +96,7 @@ namespace WarehouseAutomation
 
             // initial segment population
             AZ_Assert(m_splineLength != 0.0f, "m_splineLength must be non-zero");
+            CacheSplineFrames(splinePtr);
             const float normalizedDistanceStep = SegmentSeparation * m_configuration.m_segmentSize / m_splineLength;
             for (float normalizedIndex = 0.f; normalizedIndex < 1.f + normalizedDistanceStep; normalizedIndex += normalizedDistanceStep)
             {
@@ -118,6 +119,22 @@ namespace WarehouseAutomation
         {
             m_sceneSimStartHandler.Disconnect();
         }
+        // the scene may be already gone when the level is unloaded
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        if (AzPhysics::Scene* scene = physicsSystem ? physicsSystem->GetScene(m_sceneHandle) : nullptr)
+        {
+            for (auto& [pos, handle] : m_conveyorSegments)
+            {
+                scene->RemoveSimulatedBody(handle);
+            }
+            for (auto& handle : m_segmentsPool)
+            {
+                scene->RemoveSimulatedBody(handle);
+            }
+        }
+        m_conveyorSegments.clear();
+        m_segmentsPool.clear();
+        m_splineFrames.clear();
         ConveyorBeltRequestBus::Handler::BusDisconnect();
         AZ::EntityBus::Handler::BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
@@ -177,7 +194,7 @@ namespace WarehouseAutomation
         colliderConfiguration->m_rotation = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3::CreateAxisX(), AZ::DegToRad(90.0f));
         auto shapeConfiguration =
             AZStd::make_shared<Physics::CapsuleShapeConfiguration>(m_configuration.m_beltWidth, m_configuration.m_segmentSize / 2.0f);
-        const auto transform = GetTransformFromSpline(m_splineConsPtr, normalizedLocation);
+        const auto transform = GetCachedTransformFromSpline(normalizedLocation);
         AzPhysics::RigidBodyConfiguration conveyorSegmentRigidBodyConfig;
         conveyorSegmentRigidBodyConfig.m_kinematic = true;
         conveyorSegmentRigidBodyConfig.m_position = transform.GetTranslation();
@@ -194,6 +211,26 @@ namespace WarehouseAutomation
         return AZStd::make_pair(normalizedLocation, handle);
     }
 
+    AZStd::pair<float, AzPhysics::SimulatedBodyHandle> ConveyorBeltComponent::AcquireSegment(float normalizedLocation)
+    {
+        while (!m_segmentsPool.empty())
+        {
+            const AzPhysics::SimulatedBodyHandle handle = m_segmentsPool.back();
+            m_segmentsPool.pop_back();
+
+            AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+            AZ_Assert(sceneInterface != nullptr, "Unable to get Scene Interface");
+            auto* body = azdynamic_cast<AzPhysics::RigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(m_sceneHandle, handle));
+            if (body)
+            {
+                body->SetTransform(GetCachedTransformFromSpline(normalizedLocation));
+                sceneInterface->EnableSimulationOfBody(m_sceneHandle, handle);
+                return AZStd::make_pair(normalizedLocation, handle);
+            }
+        }
+        return CreateSegment(m_splineConsPtr, normalizedLocation);
+    }
+
     void ConveyorBeltComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
         MoveSegmentsGraphically(deltaTime);
@@ -244,6 +281,42 @@ namespace WarehouseAutomation
         return m_splineTransform * transform;
     }
 
+    void ConveyorBeltComponent::CacheSplineFrames(AZ::ConstSplinePtr splinePtr)
+    {
+        AZ_Assert(m_configuration.m_segmentSize > 0.0f, "Segment size must be positive");
+        const float samplesForLength = SplineSamplesPerSegment * m_splineLength / m_configuration.m_segmentSize;
+        const size_t sampleCount = AZStd::clamp(static_cast<size_t>(samplesForLength) + 2, size_t{ 2 }, MaxSplineSamples);
+
+        m_splineFrames.resize(sampleCount);
+        for (size_t i = 0; i < sampleCount; ++i)
+        {
+            m_splineFrames[i] = GetTransformFromSpline(splinePtr, static_cast<float>(i) / static_cast<float>(sampleCount - 1));
+        }
+    }
+
+    AZ::Transform ConveyorBeltComponent::InterpolateSplineFrames(const AZStd::vector<AZ::Transform>& splineFrames, float distanceNormalized)
+    {
+        AZ_Assert(splineFrames.size() > 1, "Spline frames are not cached");
+        const float lastIndex = static_cast<float>(splineFrames.size() - 1);
+        const float position = AZStd::clamp(distanceNormalized, 0.0f, 1.0f) * lastIndex;
+        const size_t index = AZStd::min(static_cast<size_t>(position), splineFrames.size() - 2);
+        const float fraction = position - static_cast<float>(index);
+
+        const AZ::Transform& frameBegin = splineFrames[index];
+        const AZ::Transform& frameEnd = splineFrames[index + 1];
+        // frames carry the uniform scale of the belt entity, it has to be kept to match the non-cached transform
+        const float scaleBegin = frameBegin.GetUniformScale();
+        return AZ::Transform(
+            frameBegin.GetTranslation().Lerp(frameEnd.GetTranslation(), fraction),
+            frameBegin.GetRotation().NLerp(frameEnd.GetRotation(), fraction),
+            scaleBegin + (frameEnd.GetUniformScale() - scaleBegin) * fraction);
+    }
+
+    AZ::Transform ConveyorBeltComponent::GetCachedTransformFromSpline(float distanceNormalized) const
+    {
+        return InterpolateSplineFrames(m_splineFrames, distanceNormalized);
+    }
+
     float ConveyorBeltComponent::GetSplineLength(AZ::ConstSplinePtr splinePtr)
     {
         AZ_Assert(splinePtr, "Spline pointer is null");
@@ -285,7 +358,9 @@ namespace WarehouseAutomation
             const bool positiveDirection = m_configuration.m_speed > 0.0f;
             if ((positiveDirection && pos > 1.0f) || (!positiveDirection && pos < 0.0f))
             {
-                AZ::Interface<AzPhysics::SceneInterface>::Get()->RemoveSimulatedBody(m_sceneHandle, handle);
+                // keep the body for reuse instead of removing it from the scene
+                AZ::Interface<AzPhysics::SceneInterface>::Get()->DisableSimulationOfBody(m_sceneHandle, handle);
+                m_segmentsPool.push_back(handle);
                 handle = AzPhysics::InvalidSimulatedBodyHandle;
                 wasSegmentRemoved = true;
             }
@@ -318,9 +393,7 @@ namespace WarehouseAutomation
             if (body)
             {
                 pos += m_configuration.m_speed * fixedDeltaTime / m_splineLength;
-                auto transform = GetTransformFromSpline(m_splineConsPtr, pos);
-                transform.SetTranslation(transform.GetTranslation());
-                body->SetKinematicTarget(transform);
+                body->SetKinematicTarget(GetCachedTransformFromSpline(pos));
             }
         }
     }
@@ -332,13 +405,13 @@ namespace WarehouseAutomation
         m_deltaTimeFromLastSpawn += deltaTime;
         if (m_conveyorSegments.empty())
         {
-            m_conveyorSegments.push_back(CreateSegment(m_splineConsPtr, spawnPlaceNormalized));
+            m_conveyorSegments.push_back(AcquireSegment(spawnPlaceNormalized));
             return;
         }
         if (m_deltaTimeFromLastSpawn > SegmentSeparation * m_configuration.m_segmentSize / AZStd::abs(m_configuration.m_speed))
         {
             m_deltaTimeFromLastSpawn = 0.f;
-            m_conveyorSegments.push_back(CreateSegment(m_splineConsPtr, spawnPlaceNormalized));
+            m_conveyorSegments.push_back(AcquireSegment(spawnPlaceNormalized));
         }
     }
 
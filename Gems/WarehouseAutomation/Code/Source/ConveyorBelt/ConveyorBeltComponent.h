@@ -17,6 +17,7 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBodyEvents.h>
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
@@ -30,6 +31,8 @@ namespace WarehouseAutomation
     //! The conveyor belt is simulated using a spline and number of kinematic rigid bodies.
     //! The kinematic rigid bodies have their kinematic targets set to interpolate along the spline.
     //! The component is updating kinematic targets every physic sub-step and creates and despawns rigid bodies as needed.
+    //! Despawned rigid bodies are not removed from the scene, but disabled and kept in a pool to be reused by the next spawned segment.
+    //! Poses along the spline are interpolated from a table of spline frames sampled once on activation.
     class ConveyorBeltComponent
         : public AZ::Component
         , public AZ::TickBus::Handler
@@ -37,6 +40,8 @@ namespace WarehouseAutomation
         , protected WarehouseAutomation::ConveyorBeltRequestBus::Handler
     {
         static constexpr float SegmentSeparation = 1.0f; //!< Separation between segments of the belt (in normalized units)
+        static constexpr float SplineSamplesPerSegment = 4.0f; //!< Density of the spline frames table (samples per segment length)
+        static constexpr size_t MaxSplineSamples = 16384; //!< Upper bound of the spline frames table size
 
     public:
         AZ_COMPONENT(ConveyorBeltComponent, "{B7F56411-01D4-48B0-8874-230C58A578BD}");
@@ -45,6 +50,12 @@ namespace WarehouseAutomation
         static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
         static void Reflect(AZ::ReflectContext* context);
 
+        //! Interpolates a pose between uniformly sampled spline frames, preserving the frames' uniform scale
+        //! @param splineFrames frames sampled uniformly in normalized distance, at least two
+        //! @param distanceNormalized the distance along the spline to obtain the transform from (normalized)
+        //! @return the interpolated transform at the given distance
+        static AZ::Transform InterpolateSplineFrames(const AZStd::vector<AZ::Transform>& splineFrames, float distanceNormalized);
+
         // Component overrides
         void Activate() override;
         void Deactivate() override;
@@ -73,12 +84,26 @@ namespace WarehouseAutomation
         //! @return the transform of the pose on the spline at the given distance
         AZ::Transform GetTransformFromSpline(AZ::ConstSplinePtr splinePtr, float distanceNormalized);
 
+        //! Samples the spline frames into m_splineFrames, so that poses can be interpolated without evaluating the spline
+        //! @param splinePtr the spline to sample
+        void CacheSplineFrames(AZ::ConstSplinePtr splinePtr);
+
+        //! Obtains the transform of the pose on the spline at the given distance, interpolated from cached spline frames
+        //! @param distanceNormalized the distance along the spline to obtain the transform from (normalized)
+        //! @return the transform of the pose on the spline at the given distance
+        AZ::Transform GetCachedTransformFromSpline(float distanceNormalized) const;
+
         //! Spawn a rigid body at the given location
         //! @param splinePtr the spline to spawn the rigid body on
         //! @param location the location to spawn the rigid body at (normalized)
         //! @return a pair of the normalized location and the handle of the simulated body
         AZStd::pair<float, AzPhysics::SimulatedBodyHandle> CreateSegment(AZ::ConstSplinePtr splinePtr, float normalizedLocation);
 
+        //! Obtain a segment at the given location, reusing a rigid body from the pool if available
+        //! @param normalizedLocation the location to place the segment at (normalized)
+        //! @return a pair of the normalized location and the handle of the simulated body
+        AZStd::pair<float, AzPhysics::SimulatedBodyHandle> AcquireSegment(float normalizedLocation);
+
         // AZ::TickBus::Handler overrides...
         void OnTick(float delta, AZ::ScriptTimePoint timePoint) override;
 
@@ -106,6 +131,8 @@ namespace WarehouseAutomation
 
         AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_sceneSimStartHandler; //!< Handler called after every physics sub-step
         AZStd::deque<AZStd::pair<float, AzPhysics::SimulatedBodyHandle>> m_conveyorSegments; //!< Cache of created segments
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> m_segmentsPool; //!< Disabled rigid bodies of despawned segments
+        AZStd::vector<AZ::Transform> m_splineFrames; //!< Spline frames in world space, sampled uniformly in normalized distance
         float m_textureOffset = 0.0f; //!< Current offset of the texture during animation
         AZ::ConstSplinePtr m_splineConsPtr{ nullptr }; //!< Pointer to the spline
         float m_splineLength = -1.0f; //!< Non-normalized spline length
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Transform.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzTest/AzTest.h>
+
+#include <ConveyorBelt/ConveyorBeltComponent.h>
+
+namespace UnitTest
+{
+    class ConveyorBeltTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(ConveyorBeltTest, CachedFramesKeepScaleOfBelt)
+    {
+        // belt entity scaled 2x and rotated, spline frames expressed in its space as GetTransformFromSpline does
+        const AZ::Transform beltTransform = AZ::Transform(
+            AZ::Vector3(1.0f, 2.0f, 3.0f), AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3::CreateAxisZ(), AZ::DegToRad(90.0f)), 2.0f);
+        const AZ::Transform frameBeginLocal = AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, -0.5f));
+        const AZ::Transform frameEndLocal = AZ::Transform::CreateTranslation(AZ::Vector3(4.0f, 0.0f, -0.5f));
+
+        AZStd::vector<AZ::Transform> splineFrames{ beltTransform * frameBeginLocal, beltTransform * frameEndLocal };
+
+        const AZ::Transform middle = WarehouseAutomation::ConveyorBeltComponent::InterpolateSplineFrames(splineFrames, 0.5f);
+        const AZ::Transform expectedMiddle = beltTransform * AZ::Transform::CreateTranslation(AZ::Vector3(2.0f, 0.0f, -0.5f));
+        EXPECT_TRUE(middle.IsClose(expectedMiddle));
+        EXPECT_NEAR(2.0f, middle.GetUniformScale(), 1e-5f);
+
+        // a segment collider offset is scaled together with the belt
+        const AZ::Vector3 offset = middle.TransformPoint(AZ::Vector3(1.0f, 0.0f, 0.0f));
+        EXPECT_TRUE(offset.IsClose(expectedMiddle.TransformPoint(AZ::Vector3(1.0f, 0.0f, 0.0f))));
+
+        EXPECT_TRUE(WarehouseAutomation::ConveyorBeltComponent::InterpolateSplineFrames(splineFrames, 0.0f).IsClose(splineFrames.front()));
+        EXPECT_TRUE(WarehouseAutomation::ConveyorBeltComponent::InterpolateSplineFrames(splineFrames, 1.0f).IsClose(splineFrames.back()));
+        EXPECT_TRUE(WarehouseAutomation::ConveyorBeltComponent::InterpolateSplineFrames(splineFrames, 1.5f).IsClose(splineFrames.back()));
+    }
+} // namespace UnitTest
@@ -4,4 +4,5 @@
 # SPDX-License-Identifier: Apache-2.0 OR MIT
 set(FILES
     Tests/WarehouseAutomationTest.cpp
+    Tests/ConveyorBeltTest.cpp
 )